@@ -10,6 +10,12 @@ pub enum DateCheckMode {
 #[derive(Debug, Args)]
 pub struct PipelineConvertArgs {
     pub path: String,
+    #[arg(
+        short = 'j',
+        long = "jobs",
+        help = "Worker threads for conversion and validation (0 = all cores)"
+    )]
+    pub jobs: Option<usize>,
 }
 
 #[derive(Debug, Args)]
@@ -32,6 +38,12 @@ pub struct PipelineIngestArgs {
     pub save_processed: bool,
     #[arg(long = "no-save-processed", action = ArgAction::SetTrue)]
     pub no_save_processed: bool,
+    #[arg(
+        short = 'j',
+        long = "jobs",
+        help = "Worker threads for conversion and validation (0 = all cores)"
+    )]
+    pub jobs: Option<usize>,
 }
 
 #[derive(Debug, Args)]
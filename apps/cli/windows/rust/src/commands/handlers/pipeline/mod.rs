@@ -217,6 +217,7 @@ mod tests {
         run_convert_with_port(
             PipelineConvertArgs {
                 path: "input.txt".to_string(),
+                jobs: None,
             },
             &default_context(),
             &port,
@@ -230,6 +231,7 @@ mod tests {
         assert_eq!(request["save_processed_output"], true);
         assert_eq!(request["validate_logic"], true);
         assert_eq!(request["validate_structure"], true);
+        assert_eq!(request["max_parallelism"], 4);
     }
 
     #[test]
@@ -246,6 +248,7 @@ mod tests {
                 no_date_check: false,
                 save_processed: false,
                 no_save_processed: false,
+                jobs: Some(2),
             },
             &default_context(),
             &port,
@@ -257,6 +260,7 @@ mod tests {
         assert_eq!(request["input_path"], "source_dir");
         assert_eq!(request["date_check_mode"], "full");
         assert_eq!(request["save_processed_output"], false);
+        assert_eq!(request["max_parallelism"], 2);
     }
 
     #[test]
@@ -24,6 +24,7 @@ pub fn build_convert_request(args: &PipelineConvertArgs, cli_config: &CliConfig)
             .command_defaults
             .convert_validate_structure
             .unwrap_or(true),
+        "max_parallelism": args.jobs.unwrap_or(cli_config.default_max_parallelism),
     })
 }
 
@@ -46,6 +47,7 @@ pub fn build_ingest_request(args: &PipelineIngestArgs, cli_config: &CliConfig) -
             args.save_processed,
             args.no_save_processed,
         ),
+        "max_parallelism": args.jobs.unwrap_or(cli_config.default_max_parallelism),
     })
 }
 
@@ -16,6 +16,7 @@ use super::handler::CommandContext;
 pub(crate) fn sample_cli_config() -> CliConfig {
     CliConfig {
         default_save_processed_output: false,
+        default_max_parallelism: 4,
         default_date_check_mode: Some("none".to_string()),
         defaults: CliDefaults {
             default_format: Some("md".to_string()),
@@ -56,6 +56,8 @@ pub struct CliCommandDefaults {
 #[derive(Debug, Deserialize, Clone)]
 pub struct CliConfig {
     pub default_save_processed_output: bool,
+    #[serde(default)]
+    pub default_max_parallelism: usize,
     pub default_date_check_mode: Option<String>,
     pub defaults: CliDefaults,
     pub command_defaults: CliCommandDefaults,
@@ -2,6 +2,7 @@
 #ifndef COMMON_CONFIG_TYPES_H_
 #define COMMON_CONFIG_TYPES_H_
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -34,6 +35,9 @@ struct Config {
   bool enable_monthly_average_report = false;
   double nosleep_probability = 1.0;
   std::string output_directory = "dates";
+  // 固定随机种子时生成结果可复现（基准测试语料依赖此项）；未设置则取
+  // std::random_device。
+  std::optional<std::uint32_t> seed;
 };
 
 // TOML 文件对应的原始数据结构
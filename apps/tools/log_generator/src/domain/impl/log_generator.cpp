@@ -13,8 +13,8 @@ LogGenerator::LogGenerator(
     const std::optional<DailyRemarkConfig>& remark_config,
     const std::optional<ActivityRemarkConfig>& activity_remark_config,
     const std::vector<std::string>& wake_keywords)
-    : gen_(std::random_device{}())  // 初始化随机数引擎
-{
+    // 初始化随机数引擎；配置了种子时输出可复现
+    : gen_(config.seed.value_or(std::random_device{}())) {
   // 初始化 DayGenerator
   day_generator_ = std::make_unique<DayGenerator>(
       config.items_per_day, activities, remark_config, activity_remark_config,
@@ -46,6 +46,7 @@ auto LoadCliConfigSnapshot(const std::filesystem::path& executable_path)
       .export_path = config.export_path,
       .converter_config_toml_path = config.converter_config_toml_path,
       .default_save_processed_output = config.default_save_processed_output,
+      .default_max_parallelism = config.default_max_parallelism,
       .default_date_check_mode = config.default_date_check_mode,
       .defaults = ToCliGlobalDefaultsSnapshot(config.defaults),
       .command_defaults = ToCliCommandDefaultsSnapshot(config.command_defaults),
@@ -1,6 +1,7 @@
 #ifndef API_CORE_CLI_RUNTIME_CONFIG_BRIDGE_H_
 #define API_CORE_CLI_RUNTIME_CONFIG_BRIDGE_H_
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -32,6 +33,7 @@ struct CliConfigSnapshot {
   std::optional<std::filesystem::path> export_path;
   std::filesystem::path converter_config_toml_path;
   bool default_save_processed_output = false;
+  std::size_t default_max_parallelism = 0;
   DateCheckMode default_date_check_mode = DateCheckMode::kNone;
   CliGlobalDefaultsSnapshot defaults;
   CliCommandDefaultsSnapshot command_defaults;
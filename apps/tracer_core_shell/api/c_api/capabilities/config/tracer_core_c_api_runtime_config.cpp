@@ -74,6 +74,7 @@ constexpr std::string_view kLibwinpthreadRuntimeName = "libwinpthread-1.dll";
   return json{
       {"default_save_processed_output",
        cli_config.default_save_processed_output},
+      {"default_max_parallelism", cli_config.default_max_parallelism},
       {"default_date_check_mode",
        std::string(ToDateCheckModeString(cli_config.default_date_check_mode))},
       {"defaults",
@@ -193,6 +194,7 @@ constexpr std::string_view kDatabaseFilename = "time_data.sqlite3";
       .export_path = cli_config.export_path,
       .converter_config_toml_path = cli_config.converter_config_toml_path,
       .default_save_processed_output = cli_config.default_save_processed_output,
+      .default_max_parallelism = cli_config.default_max_parallelism,
       .default_date_check_mode = cli_config.default_date_check_mode,
       .defaults = ToCliGlobalDefaultsContext(cli_config.defaults),
       .command_defaults =
@@ -19,6 +19,7 @@ using tracer_core::core::c_api::internal::BuildOperationResponse;
 using tracer_core::core::c_api::internal::ClearLastError;
 using tracer_core::core::c_api::internal::ParseDateCheckMode;
 using tracer_core::core::c_api::internal::ParseIngestMode;
+using tracer_core::core::c_api::internal::ParseMaxParallelism;
 using tracer_core::core::c_api::internal::ParseTimeOrderMode;
 using tracer_core::core::c_api::internal::RequireRuntime;
 using tracer_core::core::c_api::internal::ToRequestJsonView;
@@ -77,6 +78,9 @@ extern "C" TT_CORE_API auto tracer_core_runtime_ingest_json(
     if (kPayload.ingest_mode.has_value()) {
       request.ingest_mode = ParseIngestMode(*kPayload.ingest_mode);
     }
+    if (kPayload.max_parallelism.has_value()) {
+      request.max_parallelism = ParseMaxParallelism(*kPayload.max_parallelism);
+    }
 
     const auto kResponse = runtime.pipeline().RunIngest(request);
     return BuildOperationResponse(kResponse);
@@ -149,6 +153,9 @@ extern "C" TT_CORE_API auto tracer_core_runtime_convert_json(
     if (kPayload.validate_structure.has_value()) {
       request.validate_structure = *kPayload.validate_structure;
     }
+    if (kPayload.max_parallelism.has_value()) {
+      request.max_parallelism = ParseMaxParallelism(*kPayload.max_parallelism);
+    }
 
     return BuildOperationResponse(runtime.pipeline().RunConvert(request));
   } catch (const std::exception& error) {
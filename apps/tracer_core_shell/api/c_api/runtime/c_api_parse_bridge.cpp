@@ -45,8 +45,12 @@ namespace tracer_core::shell::c_api_bridge {
       normalized == "single-txt-replace-month") {
     return IngestMode::kSingleTxtReplaceMonth;
   }
+  if (normalized == "incremental") {
+    return IngestMode::kIncremental;
+  }
   throw std::invalid_argument(
-      "field `ingest_mode` must be one of: standard|single_txt_replace_month.");
+      "field `ingest_mode` must be one of: "
+      "standard|single_txt_replace_month|incremental.");
 }
 
 [[nodiscard]] auto ParseTimeOrderMode(const std::string& value)
@@ -234,4 +238,13 @@ namespace tracer_core::shell::c_api_bridge {
       "field `format` must be one of: markdown|latex|typst.");
 }
 
+[[nodiscard]] auto ParseMaxParallelism(int value) -> std::size_t {
+  if (value < 0) {
+    throw std::invalid_argument(
+        "field `max_parallelism` must be a non-negative integer "
+        "(0 = hardware concurrency).");
+  }
+  return static_cast<std::size_t>(value);
+}
+
 }  // namespace tracer_core::shell::c_api_bridge
@@ -1,6 +1,7 @@
 #ifndef API_CORE_C_API_PARSE_BRIDGE_H_
 #define API_CORE_C_API_PARSE_BRIDGE_H_
 
+#include <cstddef>
 #include <string>
 
 #include "domain/types/date_check_mode.hpp"
@@ -42,6 +43,7 @@ namespace tracer_core::shell::c_api_bridge {
 [[nodiscard]] auto ParseTemporalSelectionKind(const std::string& value)
     -> tracer_core::core::dto::TemporalSelectionKind;
 [[nodiscard]] auto ParseReportFormat(const std::string& value) -> ReportFormat;
+[[nodiscard]] auto ParseMaxParallelism(int value) -> std::size_t;
 
 }  // namespace tracer_core::shell::c_api_bridge
 
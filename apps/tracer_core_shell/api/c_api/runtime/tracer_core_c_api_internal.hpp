@@ -2,6 +2,7 @@
 #ifndef API_CORE_C_TRACER_CORE_C_API_INTERNAL_H_
 #define API_CORE_C_TRACER_CORE_C_API_INTERNAL_H_
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -75,6 +76,7 @@ struct CliConfigContext {
   std::optional<std::filesystem::path> export_path;
   std::filesystem::path converter_config_toml_path;
   bool default_save_processed_output = false;
+  std::size_t default_max_parallelism = 0;
   DateCheckMode default_date_check_mode = DateCheckMode::kNone;
   CliGlobalDefaultsContext defaults;
   CliCommandDefaultsContext command_defaults;
@@ -143,6 +145,7 @@ void SetLastError(const char* message);
 [[nodiscard]] auto ParseTemporalSelectionKind(const std::string& value)
     -> tracer_core::core::dto::TemporalSelectionKind;
 [[nodiscard]] auto ParseReportFormat(const std::string& value) -> ReportFormat;
+[[nodiscard]] auto ParseMaxParallelism(int value) -> std::size_t;
 
 void SetCryptoProgressCallbackRegistration(
     TtCoreCryptoProgressCallback callback, void* user_data);
@@ -154,6 +154,8 @@ enforce_source_content_boundary(
         "application/reporting"
         "application/use_cases/report_api.cpp"
         "application/use_cases/report_api_support.cpp"
+        "application/use_cases/report_batch_export.cpp"
+        "application/use_cases/report_batch_export.hpp"
         "application/use_cases/tracer_core_api_report.module.cpp"
         "infra/reporting"
     FORBIDDEN_PATTERNS
@@ -193,6 +195,12 @@ enforce_source_content_boundary(
         "infra/persistence/sqlite_database_health_checker.hpp"
         "infra/persistence/sqlite/db_manager.cpp"
         "infra/persistence/sqlite/db_manager.hpp"
+        "infra/persistence/sqlite/sqlite_read_connection_pool.cpp"
+        "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
+        "infra/persistence/sqlite/project_dictionary.cpp"
+        "infra/persistence/sqlite/project_dictionary.hpp"
+        "infra/persistence/sqlite/record_column_snapshot.cpp"
+        "infra/persistence/sqlite/record_column_snapshot.hpp"
     FORBIDDEN_PATTERNS
         ${TT_FORBIDDEN_NON_OWNER_INCLUDE_PATTERNS}
         "^[ \t]*import[ \t]+tracer\\.core\\.application\\.query\\."
@@ -465,6 +473,8 @@ if(BUILD_TESTING)
         add_executable(tc_reporting_infra_smoke_tests
             "${TRACER_CORE_LIB_TESTS_ROOT}/infra/tests/infrastructure_modules_smoke_reporting_main.cpp"
             "${TRACER_CORE_LIB_TESTS_ROOT}/infra/tests/modules_smoke/reports.cpp"
+            "${TRACER_CORE_LIB_TESTS_ROOT}/infra/tests/modules_smoke/rendered_report_cache.cpp"
+            "${TRACER_CORE_LIB_TESTS_ROOT}/infra/tests/modules_smoke/trailing_window.cpp"
         )
         setup_app_target(tc_reporting_infra_smoke_tests NO_PCH)
         target_include_directories(tc_reporting_infra_smoke_tests PRIVATE
@@ -787,5 +797,44 @@ if(BUILD_TESTING)
     endforeach()
 endif()
 
-
-
+if(TT_BUILD_BENCHMARKS AND NOT ANDROID)
+    # End-to-end benchmark: synthesizes deterministic corpora with the
+    # log_generator domain sources, then times the PipelineOrchestrator run,
+    # the runtime ingest, data queries and report exports. ctest runs one
+    # tiny corpus as a smoke check; real measurements run it by hand.
+    set(TRACER_LOG_GENERATOR_SOURCE_ROOT
+        "${PROJECT_SOURCE_DIR}/../tools/log_generator/src"
+    )
+    add_executable(tracer_bench
+        "${TRACER_CORE_SHELL_SOURCE_ROOT}/tests/bench/tracer_bench_main.cpp"
+        "${TRACER_CORE_SHELL_SOURCE_ROOT}/tests/bench/tracer_bench_corpus.cpp"
+        "${TRACER_CORE_SHELL_HOST_ROOT}/bootstrap/android_runtime_config_bridge.cpp"
+        "${TRACER_CORE_SHELL_HOST_ROOT}/bootstrap/android_runtime_factory.cpp"
+        "${TRACER_CORE_SHELL_HOST_ROOT}/bootstrap/android_runtime_factory_resolver.cpp"
+        "${TRACER_CORE_SHELL_HOST_ROOT}/bootstrap/android_runtime_factory_catalog.cpp"
+        "${TRACER_LOG_GENERATOR_SOURCE_ROOT}/domain/components/remark_generator.cpp"
+        "${TRACER_LOG_GENERATOR_SOURCE_ROOT}/domain/components/event_generator.cpp"
+        "${TRACER_LOG_GENERATOR_SOURCE_ROOT}/domain/components/day_generator.cpp"
+        "${TRACER_LOG_GENERATOR_SOURCE_ROOT}/domain/impl/log_generator.cpp"
+        "${TRACER_LOG_GENERATOR_SOURCE_ROOT}/domain/strategies/sleep_scheduler.cpp"
+    )
+    setup_app_target(tracer_bench NO_PCH)
+    target_include_directories(tracer_bench PRIVATE
+        "${TRACER_CORE_SHELL_SOURCE_ROOT}"
+        "${TRACER_LOG_GENERATOR_SOURCE_ROOT}"
+    )
+    target_link_libraries(tracer_bench PRIVATE
+        tc_infra_full_lib
+        nlohmann_json::nlohmann_json
+    )
+    if(BUILD_TESTING)
+        add_test(
+            NAME tracer_bench_smoke
+            COMMAND tracer_bench
+                --years 1
+                --repeat 1
+                --work-dir "${CMAKE_CURRENT_BINARY_DIR}/tracer_bench_smoke"
+                --output "${CMAKE_CURRENT_BINARY_DIR}/tracer_bench_smoke.json"
+        )
+    endif()
+endif()
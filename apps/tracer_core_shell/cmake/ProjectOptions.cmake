@@ -37,6 +37,8 @@ option(TT_REPORT_ENABLE_TYPST
        "Enable Typst report formatter implementation in core runtime" ON)
 option(TT_ENABLE_HEAVY_DIAGNOSTICS
        "Enable heavy diagnostics details (diff context/trace payloads)" OFF)
+option(TT_BUILD_BENCHMARKS
+       "Build the tracer_bench end-to-end ingest/query/report benchmark" OFF)
 
 include("${CMAKE_CURRENT_LIST_DIR}/options/ai_options.cmake")
 
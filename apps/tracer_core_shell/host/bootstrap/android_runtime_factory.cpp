@@ -20,6 +20,7 @@ import tracer.core.infrastructure.platform.android.clock;
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "host/bootstrap/android_runtime_factory_internal.hpp"
 #include "application/compat/reporting/i_report_handler.hpp"
@@ -30,6 +31,7 @@ import tracer.core.infrastructure.platform.android.clock;
 #include "infra/exchange/tracer_exchange_service.hpp"
 #include "infra/query/data/repository/query_runtime_service.hpp"
 #include "infra/reporting/facade/android_static_report_formatter_registrar.hpp"
+#include "shared/types/version.hpp"
 
 namespace {
 
@@ -51,6 +53,38 @@ struct AndroidRuntimeState {
   std::shared_ptr<ReportCatalog> report_catalog;
 };
 
+// Version plus build timestamp: a rebuilt core may render reports
+// differently, so entries written by another build must not hit.
+auto RenderedReportCacheBuildVersion() -> std::string {
+  std::string build_version(AppInfo::kVersion);
+  build_version += '+';
+  build_version += AppInfo::kLastUpdated;
+  return build_version;
+}
+
+// Every file that can change rendered report text; their contents form the
+// rendered-report cache fingerprint.
+auto CollectReportConfigPaths(
+    const infrastructure::bootstrap::android_runtime_detail::
+        AndroidRuntimeConfigPaths& config_paths) -> std::vector<fs::path> {
+  std::vector<fs::path> paths{config_paths.converter_config_toml_path};
+  const auto kAppendSet =
+      [&paths](const infrastructure::bootstrap::android_runtime_detail::
+                   AndroidReportConfigPathSet& path_set) {
+        paths.insert(paths.end(), {path_set.day, path_set.month,
+                                   path_set.period, path_set.week,
+                                   path_set.year});
+      };
+  kAppendSet(config_paths.markdown);
+  if (config_paths.latex.has_value()) {
+    kAppendSet(*config_paths.latex);
+  }
+  if (config_paths.typst.has_value()) {
+    kAppendSet(*config_paths.typst);
+  }
+  return paths;
+}
+
 }  // namespace
 
 namespace infrastructure::bootstrap {
@@ -80,18 +114,28 @@ auto BuildAndroidRuntime(const AndroidRuntimeRequest& request)
   tracer_core::domain::ports::ClearBufferedDiagnostics();
   tracer_core::domain::ports::ClearDiagnosticsDedup();
 
+  // Query/report services share one pool of read-only connections (with
+  // their prepared statements); ingest writes invalidate it.
+  auto read_pool =
+      std::make_shared<infra_persistence_runtime::SqliteReadConnectionPool>(
+          kDbPath);
   auto processed_data_loader = adapters_runtime::CreateProcessedDataLoader();
   auto time_sheet_repository =
       std::make_shared<infra_persistence_write::SqliteTimeSheetRepository>(
-          kDbPath.string());
+          kDbPath.string(), read_pool);
   auto database_health_checker =
       std::make_shared<infra_persistence_runtime::SqliteDatabaseHealthChecker>(
           kDbPath.string());
   auto converter_config_provider =
       std::make_shared<FileConverterConfigProvider>(
           kConverterConfigTomlPath, std::unordered_map<fs::path, fs::path>{});
-  // Fail fast during runtime bootstrap if converter TOML is invalid.
-  static_cast<void>(converter_config_provider->LoadConverterConfig());
+  // Fail fast during runtime bootstrap if converter TOML is invalid. The
+  // project class rules it carries apply to every reader and importer, so
+  // they are installed before any repository touches the database.
+  const auto kConverterConfig =
+      converter_config_provider->LoadConverterConfig();
+  infra_persistence_runtime::InstallProjectClassRules(
+      kConverterConfig.project_class_rules);
   auto ingest_input_provider = adapters_runtime::CreateTxtIngestInputProvider();
   auto processed_data_storage = adapters_runtime::CreateProcessedDataStorage();
   auto validation_issue_reporter =
@@ -112,7 +156,7 @@ auto BuildAndroidRuntime(const AndroidRuntimeRequest& request)
 
   auto report_query_service =
       std::make_unique<infra_reports::LazySqliteReportQueryService>(
-          kDbPath, report_catalog, platform_clock);
+          kDbPath, report_catalog, platform_clock, read_pool);
   auto report =
       std::make_shared<ReportHandler>(std::move(report_query_service));
 
@@ -121,11 +165,11 @@ auto BuildAndroidRuntime(const AndroidRuntimeRequest& request)
           kDbPath.string());
   auto data_query_service =
       std::make_shared<tracer::core::infrastructure::query::data::repository::
-                           QueryRuntimeService>(kDbPath,
-                                                kConverterConfigTomlPath);
+                           QueryRuntimeService>(
+          kDbPath, kConverterConfigTomlPath, read_pool);
   auto report_data_query_service =
       std::make_shared<infra_reports::LazySqliteReportDataQueryService>(
-          kDbPath, platform_clock);
+          kDbPath, platform_clock, read_pool);
   auto static_formatter_registrar = std::make_shared<
       infrastructure::reports::AndroidStaticReportFormatterRegistrar>(
       kRuntimeConfigPaths.formatter_policy);
@@ -135,6 +179,14 @@ auto BuildAndroidRuntime(const AndroidRuntimeRequest& request)
   formatter_registry->RegisterFormatters();
   auto report_dto_formatter =
       std::make_shared<infra_reports::ReportDtoFormatter>(*report_catalog);
+  // The cache directory is only created on the first store, so bootstrap
+  // stays free of filesystem writes.
+  auto rendered_report_cache =
+      std::make_shared<infra_reports::RenderedReportCache>(
+          kOutputRoot / "cache" / "reports",
+          infra_reports::FingerprintReportConfigFiles(
+              CollectReportConfigPaths(kRuntimeConfigPaths)),
+          RenderedReportCacheBuildVersion(), read_pool);
   auto tracer_exchange_service =
       tracer_core::infrastructure::crypto::CreateTracerExchangeService(
           *workflow);
@@ -145,7 +197,8 @@ auto BuildAndroidRuntime(const AndroidRuntimeRequest& request)
   auto query_api = std::make_shared<app_use_cases::QueryApi>(
       project_repository, data_query_service);
   auto report_api = std::make_shared<app_use_cases::ReportApi>(
-      *report, report_data_query_service, report_dto_formatter);
+      *report, report_data_query_service, report_dto_formatter,
+      std::move(rendered_report_cache));
   auto tracer_exchange_api = std::make_shared<app_use_cases::TracerExchangeApi>(
       tracer_exchange_service);
 
@@ -0,0 +1,93 @@
+// tests/bench/tracer_bench_corpus.cpp
+#include "tests/bench/tracer_bench_corpus.hpp"
+
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "common/config_types.hpp"
+#include "domain/impl/log_generator.hpp"
+#include "shared/utils/civil_time.hpp"
+
+namespace tracer_bench {
+namespace {
+
+namespace civil_time = tracer::core::shared::civil_time;
+
+constexpr int kMonthsPerYear = 12;
+constexpr double kDailyRemarkChance = 0.3;
+constexpr double kActivityRemarkChance = 0.2;
+
+auto BuildDailyRemarks(const CorpusSpec& spec)
+    -> std::optional<DailyRemarkConfig> {
+  if (spec.remark_prefix.empty()) {
+    return std::nullopt;
+  }
+  return DailyRemarkConfig{
+      .prefix = spec.remark_prefix,
+      .contents = {"bench remark", "alpha", "beta", "基准备注"},
+      .generation_chance = kDailyRemarkChance,
+      .max_lines = 2};
+}
+
+auto WriteMonthFile(const std::filesystem::path& path,
+                    const std::string& content) -> void {
+  std::filesystem::create_directories(path.parent_path());
+  std::ofstream output(path, std::ios::binary | std::ios::trunc);
+  output.write(content.data(), static_cast<std::streamsize>(content.size()));
+  if (!output) {
+    throw std::runtime_error("Failed to write corpus file: " + path.string());
+  }
+}
+
+}  // namespace
+
+auto GenerateCorpus(const CorpusSpec& spec, const std::filesystem::path& root)
+    -> CorpusStats {
+  if (spec.activities.empty()) {
+    throw std::invalid_argument(
+        "Corpus activity vocabulary must not be empty.");
+  }
+  if (spec.wake_keywords.empty()) {
+    throw std::invalid_argument("Corpus wake keywords must not be empty.");
+  }
+
+  const Config kConfig{.start_year = spec.start_year,
+                       .end_year = spec.start_year + spec.years - 1,
+                       .items_per_day = spec.items_per_day,
+                       .mode = GenerationMode::YearRange,
+                       .seed = spec.seed};
+  LogGenerator generator(
+      kConfig, spec.activities, BuildDailyRemarks(spec),
+      ActivityRemarkConfig{.contents = {"bench", "备注"},
+                           .generation_chance = kActivityRemarkChance},
+      spec.wake_keywords);
+
+  CorpusStats stats;
+  std::string buffer;
+  for (int year = kConfig.start_year; year <= kConfig.end_year; ++year) {
+    for (int month = 1; month <= kMonthsPerYear; ++month) {
+      const auto kStart = std::chrono::steady_clock::now();
+      generator.generate_for_month(
+          {.year = year,
+           .month = month,
+           .days_in_month = civil_time::DaysInMonth(year, month)},
+          buffer);
+      stats.generation_ms += std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - kStart)
+                                 .count();
+
+      WriteMonthFile(root / std::to_string(year) /
+                         std::format("{}-{:02}.txt", year, month),
+                     buffer);
+      ++stats.files;
+      stats.bytes += buffer.size();
+    }
+  }
+  return stats;
+}
+
+}  // namespace tracer_bench
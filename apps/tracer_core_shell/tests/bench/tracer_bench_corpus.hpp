@@ -0,0 +1,41 @@
+// tests/bench/tracer_bench_corpus.hpp
+#ifndef TRACER_CORE_SHELL_TESTS_BENCH_TRACER_BENCH_CORPUS_HPP_
+#define TRACER_CORE_SHELL_TESTS_BENCH_TRACER_BENCH_CORPUS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace tracer_bench {
+
+struct CorpusSpec {
+  int start_year = 2000;
+  int years = 1;
+  int items_per_day = 12;
+  std::uint32_t seed = 20240101U;
+  // 参与生成的活动词表（取自 converter 配置的别名键）。
+  std::vector<std::string> activities;
+  std::vector<std::string> wake_keywords;
+  std::string remark_prefix;
+};
+
+struct CorpusStats {
+  std::size_t files = 0;
+  std::size_t bytes = 0;
+  double generation_ms = 0.0;
+};
+
+/**
+ * @brief 使用 log_generator 的领域生成器写出确定性的 TXT 语料。
+ *
+ * 目录布局与 log_generator CLI 一致：`<root>/<YYYY>/<YYYY-MM>.txt`；
+ * 同一 `CorpusSpec` 多次生成的内容逐字节相同。
+ */
+auto GenerateCorpus(const CorpusSpec& spec, const std::filesystem::path& root)
+    -> CorpusStats;
+
+}  // namespace tracer_bench
+
+#endif  // TRACER_CORE_SHELL_TESTS_BENCH_TRACER_BENCH_CORPUS_HPP_
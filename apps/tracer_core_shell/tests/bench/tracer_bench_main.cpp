@@ -0,0 +1,409 @@
+// tests/bench/tracer_bench_main.cpp
+//
+// 端到端基准：用 log_generator 合成确定性语料，计时 PipelineOrchestrator
+// 运行（收集 / 校验 / 转换）与运行时完整 ingest（含 SQLite 导入），
+// 再计时代表性的数据查询与报表导出，结果以 JSON 输出。
+//
+// 用法：
+//   tracer_bench [--years 1,10,50] [--activities N] [--items-per-day N]
+//                [--seed N] [--repeat N] [--config <converter toml>]
+//                [--work-dir <dir>] [--output <result.json>] [--keep]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "application/aggregate_runtime/i_tracer_core_runtime.hpp"
+#include "application/dto/pipeline_requests.hpp"
+#include "application/dto/query_requests.hpp"
+#include "application/dto/reporting_requests.hpp"
+#include "application/dto/shared_envelopes.hpp"
+#include "tests/bench/tracer_bench_corpus.hpp"
+#include "domain/types/app_options.hpp"
+#include "domain/types/converter_config.hpp"
+#include "host/bootstrap/android_runtime_factory.hpp"
+
+import tracer.adapters.io.runtime;
+import tracer.core.application.pipeline;
+import tracer.core.infrastructure.config.file_converter_config_provider;
+import tracer.core.infrastructure.logging;
+
+namespace {
+
+namespace fs = std::filesystem;
+namespace app_pipeline = tracer::core::application::pipeline;
+namespace adapters_runtime = tracer::adapters::io::modruntime;
+namespace dto = tracer_core::core::dto;
+namespace infra_logging = tracer::core::infrastructure::logging;
+using FileConverterConfigProvider =
+    tracer::core::infrastructure::config::FileConverterConfigProvider;
+using nlohmann::json;
+
+constexpr int kDefaultRepeat = 5;
+constexpr std::string_view kDefaultYears = "1,10,50";
+
+struct BenchOptions {
+  std::vector<int> years_list;
+  std::size_t activity_count = 0;  // 0 表示使用全部别名键
+  int items_per_day = 12;
+  std::uint32_t seed = 20240101U;
+  int repeat = kDefaultRepeat;
+  fs::path config_toml_path;
+  fs::path work_dir;
+  std::optional<fs::path> output_path;
+  bool keep_work_dir = false;
+};
+
+auto BuildRepoRoot() -> fs::path {
+  return fs::path(__FILE__)
+      .parent_path()   // bench
+      .parent_path()   // tests
+      .parent_path()   // tracer_core_shell
+      .parent_path()   // apps
+      .parent_path();  // repo root
+}
+
+auto ParseYearsList(std::string_view text) -> std::vector<int> {
+  std::vector<int> years;
+  std::stringstream stream{std::string(text)};
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    const int kYears = std::stoi(item);
+    if (kYears <= 0) {
+      throw std::invalid_argument("--years entries must be positive.");
+    }
+    years.push_back(kYears);
+  }
+  return years;
+}
+
+auto ParseOptions(std::span<char* const> args) -> BenchOptions {
+  BenchOptions options;
+  options.years_list = ParseYearsList(kDefaultYears);
+  options.config_toml_path = BuildRepoRoot() / "assets" / "tracer_core" /
+                             "config" / "converter" /
+                             "interval_processor_config.toml";
+  options.work_dir = fs::temp_directory_path() / "tracer_bench";
+
+  for (std::size_t index = 1; index < args.size(); ++index) {
+    const std::string_view kArg = args[index];
+    if (kArg == "--keep") {
+      options.keep_work_dir = true;
+      continue;
+    }
+    if (index + 1 >= args.size()) {
+      throw std::invalid_argument("Missing value for option " +
+                                  std::string(kArg));
+    }
+    const std::string kValue = args[++index];
+    if (kArg == "--years") {
+      options.years_list = ParseYearsList(kValue);
+    } else if (kArg == "--activities") {
+      options.activity_count = static_cast<std::size_t>(std::stoul(kValue));
+    } else if (kArg == "--items-per-day") {
+      options.items_per_day = std::stoi(kValue);
+    } else if (kArg == "--seed") {
+      options.seed = static_cast<std::uint32_t>(std::stoul(kValue));
+    } else if (kArg == "--repeat") {
+      options.repeat = std::max(1, std::stoi(kValue));
+    } else if (kArg == "--config") {
+      options.config_toml_path = kValue;
+    } else if (kArg == "--work-dir") {
+      options.work_dir = kValue;
+    } else if (kArg == "--output") {
+      options.output_path = fs::path(kValue);
+    } else {
+      throw std::invalid_argument("Unknown option " + std::string(kArg));
+    }
+  }
+  return options;
+}
+
+template <typename Fn>
+auto TimeMs(Fn&& function) -> double {
+  const auto kStart = std::chrono::steady_clock::now();
+  std::forward<Fn>(function)();
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - kStart)
+      .count();
+}
+
+// 活动词表取 converter 别名键的字典序前 N 个，保证跨机器可复现。
+auto BuildActivityVocabulary(const ConverterConfig& config,
+                             std::size_t activity_count)
+    -> std::vector<std::string> {
+  std::vector<std::string> activities;
+  activities.reserve(config.text_mapping.size());
+  for (const auto& [alias, _] : config.text_mapping) {
+    activities.push_back(alias);
+  }
+  std::ranges::sort(activities);
+  if (activity_count > 0 && activity_count < activities.size()) {
+    activities.resize(activity_count);
+  }
+  return activities;
+}
+
+// 经 PipelineOrchestrator 计时“收集 + 校验 + 转换”（不写库），
+// 与生产 ingest 使用同一条阶段序列。
+auto RunPipeline(const fs::path& input_root, const fs::path& output_root,
+                 const fs::path& config_toml_path) -> json {
+  app_pipeline::PipelineOrchestrator orchestrator(
+      output_root,
+      std::make_shared<FileConverterConfigProvider>(
+          config_toml_path, std::unordered_map<fs::path, fs::path>{}),
+      adapters_runtime::CreateTxtIngestInputProvider(),
+      adapters_runtime::CreateProcessedDataStorage(),
+      std::make_shared<infra_logging::ValidationIssueReporter>());
+
+  const AppOptions kOptions{.input_path = input_root,
+                            .convert = true,
+                            .validate_structure = true,
+                            .validate_logic = true,
+                            .run_structure_validation_before_conversion = true};
+  std::optional<app_pipeline::PipelineSession> session;
+  const double kElapsedMs =
+      TimeMs([&]() -> void { session = orchestrator.Run(kOptions); });
+  if (!session.has_value()) {
+    throw std::runtime_error("Pipeline run failed.");
+  }
+
+  std::size_t day_count = 0;
+  for (const auto& [_, days] : session->result.processed_data) {
+    day_count += days.size();
+  }
+  return json{{"pipeline_ms", kElapsedMs}, {"days", day_count}};
+}
+
+// 经运行时 pipeline().RunIngest（WorkflowHandler）计时完整 ingest，
+// 含 SQLite 导入与派生表刷新。
+auto RunIngest(ITracerCoreRuntime& runtime, const fs::path& input_root)
+    -> double {
+  dto::OperationAck ack;
+  const double kElapsedMs = TimeMs([&]() -> void {
+    ack = runtime.pipeline().RunIngest({.input_path = input_root.string()});
+  });
+  if (!ack.ok) {
+    throw std::runtime_error("Ingest failed: " + ack.error_message);
+  }
+  return kElapsedMs;
+}
+
+struct TimedAction {
+  std::string name;
+  std::function<bool()> run;
+};
+
+auto RunTimedActions(const std::vector<TimedAction>& actions, int repeat)
+    -> json {
+  json results = json::array();
+  for (const auto& action : actions) {
+    double total_ms = 0.0;
+    double min_ms = std::numeric_limits<double>::max();
+    bool all_ok = true;
+    for (int round = 0; round < repeat; ++round) {
+      bool succeeded = false;
+      const double kElapsedMs =
+          TimeMs([&]() -> void { succeeded = action.run(); });
+      all_ok = all_ok && succeeded;
+      total_ms += kElapsedMs;
+      min_ms = std::min(min_ms, kElapsedMs);
+    }
+    results.push_back({{"name", action.name},
+                       {"ok", all_ok},
+                       {"mean_ms", total_ms / repeat},
+                       {"min_ms", min_ms}});
+  }
+  return results;
+}
+
+auto BuildQueryActions(ITracerCoreRuntime& runtime, int first_year,
+                       int last_year) -> std::vector<TimedAction> {
+  auto data_query = [&runtime](dto::DataQueryRequest request) {
+    return [&runtime, request = std::move(request)]() -> bool {
+      return runtime.query().RunDataQuery(request).ok;
+    };
+  };
+  return {
+      {"query_years", data_query({.action = dto::DataQueryAction::kYears})},
+      {"query_months",
+       data_query(
+           {.action = dto::DataQueryAction::kMonths, .year = last_year})},
+      {"query_days_stats",
+       data_query(
+           {.action = dto::DataQueryAction::kDaysStats, .year = last_year})},
+      {"query_days_duration_all",
+       data_query({.action = dto::DataQueryAction::kDaysDuration,
+                   .from_date = std::to_string(first_year) + "-01-01",
+                   .to_date = std::to_string(last_year) + "-12-31"})},
+      {"query_remark_search",
+       data_query({.action = dto::DataQueryAction::kSearch,
+                   .remark = "bench",
+                   .limit = 100})},
+      {"query_tree_roots",
+       [&runtime]() -> bool {
+         return runtime.query().RunTreeQuery({.list_roots = true}).ok;
+       }},
+  };
+}
+
+auto BuildReportActions(ITracerCoreRuntime& runtime, int last_year,
+                        const fs::path& export_root)
+    -> std::vector<TimedAction> {
+  constexpr auto kSingleDay = dto::TemporalSelectionKind::kSingleDay;
+  constexpr auto kDateRange = dto::TemporalSelectionKind::kDateRange;
+  const std::string kYear = std::to_string(last_year);
+  auto report_query = [&runtime](dto::TemporalReportQueryRequest request) {
+    return [&runtime, request = std::move(request)]() -> bool {
+      return runtime.report().RunTemporalReportQuery(request).ok;
+    };
+  };
+  auto export_all = [&runtime, &export_root](dto::ReportDisplayMode mode) {
+    return [&runtime, mode, root = export_root.string()]() -> bool {
+      return runtime.report()
+          .RunTemporalReportExport(
+              {.display_mode = mode,
+               .export_scope = dto::ReportExportScope::kAllMatching,
+               .format = ReportFormat::kMarkdown,
+               .output_root_path = root})
+          .ok;
+    };
+  };
+  return {
+      {"report_day",
+       report_query({.display_mode = dto::ReportDisplayMode::kDay,
+                     .selection = {.kind = kSingleDay,
+                                   .date = kYear + "-06-15"}})},
+      {"report_month",
+       report_query({.display_mode = dto::ReportDisplayMode::kMonth,
+                     .selection = {.kind = kDateRange,
+                                   .start_date = kYear + "-06-01",
+                                   .end_date = kYear + "-06-30"}})},
+      {"report_year",
+       report_query({.display_mode = dto::ReportDisplayMode::kYear,
+                     .selection = {.kind = kDateRange,
+                                   .start_date = kYear + "-01-01",
+                                   .end_date = kYear + "-12-31"}})},
+      {"report_recent_30",
+       report_query(
+           {.display_mode = dto::ReportDisplayMode::kRecent,
+            .selection = {.kind = dto::TemporalSelectionKind::kRecentDays,
+                          .days = 30,
+                          .anchor_date = kYear + "-12-31"}})},
+      {"export_all_months", export_all(dto::ReportDisplayMode::kMonth)},
+      {"export_all_years", export_all(dto::ReportDisplayMode::kYear)},
+  };
+}
+
+auto RunCorpusBenchmark(const BenchOptions& options,
+                        const ConverterConfig& converter_config,
+                        const std::vector<std::string>& activities, int years)
+    -> json {
+  const fs::path kCorpusRoot = options.work_dir / (std::to_string(years) + "y");
+  const fs::path kInputRoot = kCorpusRoot / "input";
+  const fs::path kOutputRoot = kCorpusRoot / "output";
+  const fs::path kDbPath = kOutputRoot / "db" / "bench.sqlite3";
+  std::error_code error;
+  fs::remove_all(kCorpusRoot, error);
+  fs::create_directories(kDbPath.parent_path());
+
+  const tracer_bench::CorpusSpec kSpec{
+      .years = years,
+      .items_per_day = options.items_per_day,
+      .seed = options.seed,
+      .activities = activities,
+      .wake_keywords = converter_config.wake_keywords,
+      .remark_prefix = converter_config.remark_prefix};
+  const tracer_bench::CorpusStats kCorpus =
+      tracer_bench::GenerateCorpus(kSpec, kInputRoot);
+  const int kFirstYear = kSpec.start_year;
+  const int kLastYear = kSpec.start_year + years - 1;
+
+  json result = {{"years", years},
+                 {"corpus",
+                  {{"files", kCorpus.files},
+                   {"bytes", kCorpus.bytes},
+                   {"generation_ms", kCorpus.generation_ms}}}};
+  result["stages"] =
+      RunPipeline(kInputRoot, kOutputRoot, options.config_toml_path);
+
+  const auto kRuntime = infrastructure::bootstrap::BuildAndroidRuntime(
+      {.db_path = kDbPath,
+       .output_root = kOutputRoot,
+       .converter_config_toml_path = options.config_toml_path});
+  result["stages"]["ingest_ms"] = RunIngest(*kRuntime.runtime_api, kInputRoot);
+  result["queries"] = RunTimedActions(
+      BuildQueryActions(*kRuntime.runtime_api, kFirstYear, kLastYear),
+      options.repeat);
+  result["reports"] = RunTimedActions(
+      BuildReportActions(*kRuntime.runtime_api, kLastYear,
+                         kOutputRoot / "exports"),
+      options.repeat);
+
+  if (!options.keep_work_dir) {
+    fs::remove_all(kCorpusRoot, error);
+  }
+  return result;
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+  try {
+    const BenchOptions kOptions =
+        ParseOptions(std::span<char* const>(argv, static_cast<size_t>(argc)));
+
+    FileConverterConfigProvider config_provider(
+        kOptions.config_toml_path, std::unordered_map<fs::path, fs::path>{});
+    const ConverterConfig kConverterConfig =
+        config_provider.LoadConverterConfig();
+    const std::vector<std::string> kActivities =
+        BuildActivityVocabulary(kConverterConfig, kOptions.activity_count);
+
+    json report = {{"benchmark", "tracer_bench"},
+                   {"seed", kOptions.seed},
+                   {"activities", kActivities.size()},
+                   {"items_per_day", kOptions.items_per_day},
+                   {"repeat", kOptions.repeat},
+                   {"corpora", json::array()}};
+    for (const int kYears : kOptions.years_list) {
+      report["corpora"].push_back(RunCorpusBenchmark(
+          kOptions, kConverterConfig, kActivities, kYears));
+    }
+
+    const std::string kPayload = report.dump(2);
+    if (kOptions.output_path.has_value()) {
+      std::ofstream output(*kOptions.output_path, std::ios::trunc);
+      output << kPayload << '\n';
+      if (!output) {
+        std::cerr << "[tracer_bench] failed to write "
+                  << kOptions.output_path->string() << '\n';
+        return 1;
+      }
+    } else {
+      std::cout << kPayload << '\n';
+    }
+    return 0;
+  } catch (const std::exception& exception) {
+    std::cerr << "[tracer_bench] " << exception.what() << '\n';
+    return 1;
+  }
+}
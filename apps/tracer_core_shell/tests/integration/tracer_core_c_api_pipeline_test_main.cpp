@@ -37,6 +37,18 @@ auto main() -> int {
       RunPipelineChecks(api, runtime.Get(), kInputRoot);
     }
 
+    {
+      const fs::path kIncrementalRoot = kTempRoot / "incremental";
+      auto runtime =
+          CreateRuntime(api, kIncrementalRoot / "db" / "time_data.sqlite3",
+                        kIncrementalRoot, kConverterConfig);
+      RunIncrementalIngestChecks(api, runtime.Get(), kInputRoot,
+                                 kIncrementalRoot);
+    }
+
+    RunIncrementalConfigChangeChecks(api, kInputRoot, kConverterConfig,
+                                     kTempRoot / "incremental_config");
+
     std::cout << "[PASS] tracer_core_c_api_pipeline_tests\n";
     CloseLibrary(library);
     return 0;
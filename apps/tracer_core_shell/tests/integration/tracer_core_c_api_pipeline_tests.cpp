@@ -1,7 +1,174 @@
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+
 #include "tests/integration/tracer_core_c_api_stability_internal.hpp"
 
 namespace tracer_core_c_api_stability_internal {
 
+namespace {
+
+auto IngestAt(const CoreApiFns& api, TtCoreRuntimeHandle* runtime,
+              const fs::path& input_root, std::string_view ingest_mode,
+              std::string_view context) -> void {
+  RequireOk(api.runtime_ingest(runtime,
+                               json{{"input_path", input_root.string()},
+                                    {"date_check_mode", "none"},
+                                    {"save_processed_output", false},
+                                    {"ingest_mode", std::string(ingest_mode)}}
+                                   .dump()
+                                   .c_str()),
+            context);
+}
+
+auto ReadSyncRows(const CoreApiFns& api, TtCoreRuntimeHandle* runtime,
+                  std::string_view context) -> std::map<std::string, json> {
+  const json kStatus = ParseResponse(
+      api.runtime_ingest_sync_status(runtime, json::object().dump().c_str()),
+      context);
+  Require(kStatus.value("ok", false), std::string(context) + ": ok=false");
+  std::map<std::string, json> rows;
+  for (const auto& item : kStatus["items"]) {
+    rows[item.value("month_key", std::string{})] = item;
+  }
+  return rows;
+}
+
+}  // namespace
+
+void RunIncrementalIngestChecks(const CoreApiFns& api,
+                                TtCoreRuntimeHandle* runtime,
+                                const fs::path& input_root,
+                                const fs::path& work_root) {
+  const fs::path kWorkInput = work_root / "input";
+  std::error_code io_error;
+  fs::remove_all(kWorkInput, io_error);
+  fs::create_directories(work_root, io_error);
+  fs::copy(input_root, kWorkInput, fs::copy_options::recursive, io_error);
+  Require(!io_error, "Failed to copy test/data for incremental ingest");
+
+  IngestAt(api, runtime, kWorkInput, "standard",
+           "incremental fixture standard ingest");
+  const auto kBefore =
+      ReadSyncRows(api, runtime, "sync status before incremental ingest");
+  Require(kBefore.contains("2025-03") && kBefore.contains("2025-04"),
+          "fixture should sync 2025-03 and 2025-04");
+
+  // Only one month changes; a fresh ingest timestamp marks every month that
+  // was written again.
+  const fs::path kEditedMonth = kWorkInput / "2025" / "2025-03.txt";
+  std::string content;
+  {
+    std::ifstream input(kEditedMonth, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(input),
+                   std::istreambuf_iterator<char>());
+  }
+  const std::string kRemark = "r 烤肉自助";
+  const auto kRemarkPos = content.find(kRemark);
+  Require(kRemarkPos != std::string::npos,
+          "fixture 2025-03 should contain the edited remark");
+  content.insert(kRemarkPos + kRemark.size(), " edited");
+  {
+    std::ofstream output(kEditedMonth, std::ios::binary | std::ios::trunc);
+    output << content;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  IngestAt(api, runtime, kWorkInput, "incremental",
+           "incremental ingest after editing one month");
+  const auto kAfter =
+      ReadSyncRows(api, runtime, "sync status after incremental ingest");
+  Require(kAfter.size() == kBefore.size(),
+          "incremental ingest should keep one sync row per month");
+
+  const std::set<std::string> kReimported = {"2025-03", "2025-04"};
+  for (const auto& [month_key, before] : kBefore) {
+    Require(kAfter.contains(month_key),
+            "incremental ingest dropped sync row " + month_key);
+    const auto kBeforeAt = before.value("ingested_at_unix_ms", std::int64_t{0});
+    const auto kAfterAt =
+        kAfter.at(month_key).value("ingested_at_unix_ms", std::int64_t{0});
+    if (kReimported.contains(month_key)) {
+      Require(kAfterAt > kBeforeAt,
+              "changed and boundary months should be re-imported: " +
+                  month_key);
+    } else {
+      Require(kAfterAt == kBeforeAt,
+              "unchanged month should not be re-imported: " + month_key);
+    }
+  }
+  Require(kAfter.at("2025-03").value("txt_content_hash_sha256", "") !=
+              kBefore.at("2025-03").value("txt_content_hash_sha256", ""),
+          "edited month should store its new content hash");
+  Require(kAfter.at("2025-04").value("txt_content_hash_sha256", "") ==
+              kBefore.at("2025-04").value("txt_content_hash_sha256", ""),
+          "boundary month content hash should be unchanged");
+}
+
+void RunIncrementalConfigChangeChecks(const CoreApiFns& api,
+                                      const fs::path& input_root,
+                                      const fs::path& converter_config,
+                                      const fs::path& work_root) {
+  const fs::path kConfigDir = work_root / "converter";
+  const fs::path kDbPath = work_root / "db" / "time_data.sqlite3";
+  std::error_code io_error;
+  fs::remove_all(work_root, io_error);
+  fs::create_directories(work_root, io_error);
+  fs::copy(converter_config.parent_path(), kConfigDir,
+           fs::copy_options::recursive, io_error);
+  Require(!io_error, "Failed to copy converter config for incremental ingest");
+  const fs::path kConfigPath = kConfigDir / converter_config.filename();
+
+  std::map<std::string, json> before;
+  {
+    auto runtime = CreateRuntime(api, kDbPath, work_root, kConfigPath);
+    IngestAt(api, runtime.Get(), input_root, "standard",
+             "config change fixture standard ingest");
+    before = ReadSyncRows(api, runtime.Get(),
+                          "sync status before converter config change");
+  }
+  Require(!before.empty(), "config change fixture should sync some months");
+
+  // TXT inputs stay the same; only the converter config changes.
+  std::string config_text;
+  {
+    std::ifstream input(kConfigPath, std::ios::binary);
+    config_text.assign(std::istreambuf_iterator<char>(input),
+                       std::istreambuf_iterator<char>());
+  }
+  const std::string kWakeKeywords = "wake_keywords = [";
+  const auto kWakePos = config_text.find(kWakeKeywords);
+  Require(kWakePos != std::string::npos,
+          "converter config should declare wake_keywords");
+  config_text.insert(kWakePos + kWakeKeywords.size(), "\"config_probe\", ");
+  {
+    std::ofstream output(kConfigPath, std::ios::binary | std::ios::trunc);
+    output << config_text;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  auto runtime = CreateRuntime(api, kDbPath, work_root, kConfigPath);
+  IngestAt(api, runtime.Get(), input_root, "incremental",
+           "incremental ingest after converter config change");
+  const auto kAfter = ReadSyncRows(
+      api, runtime.Get(), "sync status after converter config change");
+  Require(kAfter.size() == before.size(),
+          "config change ingest should keep one sync row per month");
+  for (const auto& [month_key, row] : before) {
+    Require(kAfter.contains(month_key),
+            "config change ingest dropped sync row " + month_key);
+    Require(kAfter.at(month_key).value("ingested_at_unix_ms", std::int64_t{0}) >
+                row.value("ingested_at_unix_ms", std::int64_t{0}),
+            "converter config change should re-import every month: " +
+                month_key);
+  }
+}
+
 void RunPipelineChecks(const CoreApiFns& api, TtCoreRuntimeHandle* runtime,
                        const fs::path& input_root) {
   RequireOk(
@@ -42,6 +209,21 @@ void RunPipelineChecks(const CoreApiFns& api, TtCoreRuntimeHandle* runtime,
   Require(kSyncStatus.contains("items") && kSyncStatus["items"].is_array(),
           "ingest sync status should include array field `items`");
 
+  RequireOk(
+      api.runtime_ingest(runtime, json{{"input_path", input_root.string()},
+                                       {"date_check_mode", "none"},
+                                       {"save_processed_output", false},
+                                       {"ingest_mode", "incremental"}}
+                                      .dump()
+                                      .c_str()),
+      "baseline pipeline incremental ingest");
+
+  const json kIncrementalSyncStatus = ParseResponse(
+      api.runtime_ingest_sync_status(runtime, json::object().dump().c_str()),
+      "baseline pipeline ingest sync status after incremental ingest");
+  Require(kIncrementalSyncStatus["items"].size() == kSyncStatus["items"].size(),
+          "incremental ingest of unchanged input should keep sync rows");
+
   RequireOk(api.runtime_clear_ingest_sync_status(runtime),
             "baseline pipeline clear ingest sync status");
 
@@ -154,6 +154,14 @@ void RunReportingChecks(const CoreApiFns& api, TtCoreRuntimeHandle* runtime,
                         const fs::path& output_root);
 void RunPipelineChecks(const CoreApiFns& api, TtCoreRuntimeHandle* runtime,
                        const fs::path& input_root);
+void RunIncrementalIngestChecks(const CoreApiFns& api,
+                                TtCoreRuntimeHandle* runtime,
+                                const fs::path& input_root,
+                                const fs::path& work_root);
+void RunIncrementalConfigChangeChecks(const CoreApiFns& api,
+                                      const fs::path& input_root,
+                                      const fs::path& converter_config,
+                                      const fs::path& work_root);
 void RunErrorPathChecks(const CoreApiFns& api, TtCoreRuntimeHandle* runtime,
                         const fs::path& converter_config);
 
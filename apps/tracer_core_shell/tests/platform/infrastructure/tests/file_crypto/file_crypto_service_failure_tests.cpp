@@ -1,7 +1,12 @@
 // infrastructure/tests/file_crypto/file_crypto_service_failure_tests.cpp
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "infrastructure/tests/file_crypto/file_crypto_service_test_internal.hpp"
 
@@ -48,22 +53,22 @@ auto TestWrongPassphraseRejected(int& failures) -> void {
   RemoveTree(kPaths.test_root);
 }
 
-auto TestCompressionMetadataMismatchRejected(int& failures) -> void {
+auto TestTamperedHeaderRejected(int& failures) -> void {
   using namespace file_crypto_tests_internal;
 
   const RuntimeTestPaths kPaths =
-      BuildTempTestPaths("tracer_core_file_crypto_mismatch_test");
+      BuildTempTestPaths("tracer_core_file_crypto_header_tamper_test");
   const auto kInputTxt = kPaths.test_root / "plain.txt";
   const auto kEncrypted = kPaths.test_root / "payload.tracer";
   const auto kTampered = kPaths.test_root / "payload_tampered.tracer";
   const auto kRestoredTxt = kPaths.test_root / "restored.txt";
   constexpr std::string_view kPassphrase = "phase0-phase1-passphrase";
-  constexpr std::size_t kMinimumEncryptedHeaderSize = 80;
+  constexpr std::size_t kMinimumEncryptedHeaderSize = 104;
 
   RemoveTree(kPaths.test_root);
   if (!WriteFileWithParents(kInputTxt, "y2026\nm02\n0203\n0700 study\n")) {
     ++failures;
-    std::cerr << "[FAIL] Failed to write compression mismatch input file.\n";
+    std::cerr << "[FAIL] Failed to write header tamper input file.\n";
     RemoveTree(kPaths.test_root);
     return;
   }
@@ -78,37 +83,117 @@ auto TestCompressionMetadataMismatchRejected(int& failures) -> void {
     return;
   }
 
-  auto bytes = ReadBytes(kEncrypted);
-  if (bytes.size() < kMinimumEncryptedHeaderSize) {
+  const auto kOriginal = ReadBytes(kEncrypted);
+  if (kOriginal.size() < kMinimumEncryptedHeaderSize) {
     ++failures;
-    std::cerr << "[FAIL] Encrypted file is smaller than expected v2 header.\n";
+    std::cerr << "[FAIL] Encrypted file is smaller than expected header.\n";
     RemoveTree(kPaths.test_root);
     return;
   }
 
-  constexpr std::size_t kPlaintextSizeOffsetV2 = 60;
+  // The v3 header is bound as associated data of the first record, so a
+  // field the parser accepts either way still fails authentication.
+  const auto kExpectRejected = [&](std::vector<std::uint8_t> bytes,
+                                   const std::string& field) -> void {
+    if (!WriteBytes(kTampered, bytes)) {
+      ++failures;
+      std::cerr << "[FAIL] Failed to write tampered encrypted file.\n";
+      return;
+    }
+    const auto kDecryptResult =
+        tracer_core::infrastructure::crypto::DecryptFile(
+            kTampered, kRestoredTxt, kPassphrase);
+    Expect(!kDecryptResult.ok() &&
+               kDecryptResult.error == tracer_core::infrastructure::crypto::
+                                           FileCryptoError::kDecryptFailed,
+           "Tampered v3 " + field + " should map to kDecryptFailed.",
+           failures);
+    Expect(!std::filesystem::exists(kRestoredTxt),
+           "Rejected v3 header should not leave an output file.", failures);
+  };
+
+  constexpr std::size_t kCompressionLevelOffset = 8;
+  constexpr std::size_t kPlaintextSizeOffset = 60;
   constexpr std::uint64_t kTamperedPlaintextSize = 999999ULL;
-  WriteU64LE(bytes, kPlaintextSizeOffsetV2, kTamperedPlaintextSize);
-  if (!WriteBytes(kTampered, bytes)) {
+  auto level_bytes = kOriginal;
+  level_bytes[kCompressionLevelOffset] = 2;
+  kExpectRejected(std::move(level_bytes), "compression_level");
+  auto size_bytes = kOriginal;
+  WriteU64LE(size_bytes, kPlaintextSizeOffset, kTamperedPlaintextSize);
+  kExpectRejected(std::move(size_bytes), "plaintext_size");
+
+  RemoveTree(kPaths.test_root);
+}
+
+auto TestTruncatedStreamRejected(int& failures) -> void {
+  using namespace file_crypto_tests_internal;
+
+  const RuntimeTestPaths kPaths =
+      BuildTempTestPaths("tracer_core_file_crypto_truncated_test");
+  const auto kInputTxt = kPaths.test_root / "plain.txt";
+  const auto kEncrypted = kPaths.test_root / "payload.tracer";
+  const auto kTruncated = kPaths.test_root / "payload_truncated.tracer";
+  const auto kRestoredTxt = kPaths.test_root / "restored.txt";
+  constexpr std::string_view kPassphrase = "phase0-phase1-passphrase";
+  // 不可压缩的内容超过一个分块，密文由多条记录组成。
+  constexpr std::size_t kPlaintextSize = 3U * 1024U * 1024U;
+  constexpr std::size_t kTruncatedTailSize = 1024;
+
+  RemoveTree(kPaths.test_root);
+  std::vector<std::uint8_t> plaintext(kPlaintextSize);
+  std::uint32_t state = 0x9E3779B9U;
+  for (std::uint8_t& value : plaintext) {
+    state = state * 1664525U + 1013904223U;
+    value = static_cast<std::uint8_t>(state >> 24U);
+  }
+  std::filesystem::create_directories(kPaths.test_root);
+  if (!WriteBytes(kInputTxt, plaintext)) {
     ++failures;
-    std::cerr << "[FAIL] Failed to write tampered encrypted file.\n";
+    std::cerr << "[FAIL] Failed to write truncation input file.\n";
+    RemoveTree(kPaths.test_root);
+    return;
+  }
+
+  const auto kEncryptResult = tracer_core::infrastructure::crypto::EncryptFile(
+      kInputTxt, kEncrypted, kPassphrase);
+  if (!kEncryptResult.ok()) {
+    ++failures;
+    std::cerr << "[FAIL] Encrypt setup failed: " << kEncryptResult.error_code
+              << " | " << kEncryptResult.error_message << '\n';
+    RemoveTree(kPaths.test_root);
+    return;
+  }
+
+  const auto kRoundTripResult =
+      tracer_core::infrastructure::crypto::DecryptFile(kEncrypted, kRestoredTxt,
+                                                       kPassphrase);
+  Expect(kRoundTripResult.ok() && ReadBytes(kRestoredTxt) == plaintext,
+         "Multi-chunk .tracer should round-trip unchanged.", failures);
+  RemoveTree(kRestoredTxt);
+
+  auto bytes = ReadBytes(kEncrypted);
+  bytes.resize(bytes.size() - std::min(bytes.size(), kTruncatedTailSize));
+  if (!WriteBytes(kTruncated, bytes)) {
+    ++failures;
+    std::cerr << "[FAIL] Failed to write truncated encrypted file.\n";
     RemoveTree(kPaths.test_root);
     return;
   }
 
   const auto kDecryptResult = tracer_core::infrastructure::crypto::DecryptFile(
-      kTampered, kRestoredTxt, kPassphrase);
+      kTruncated, kRestoredTxt, kPassphrase);
   Expect(!kDecryptResult.ok(),
-         "DecryptFile should fail when compression metadata is tampered.",
+         "DecryptFile should fail when the encrypted stream is truncated.",
          failures);
   if (!kDecryptResult.ok()) {
     Expect(kDecryptResult.error ==
                tracer_core::infrastructure::crypto::FileCryptoError::
-                   kCompressionMetadataMismatch,
-           "Tampered plaintext_size should map to "
-           "kCompressionMetadataMismatch.",
-           failures);
+                   kDecryptFailed,
+           "Truncated stream should map to kDecryptFailed.", failures);
   }
+  Expect(!std::filesystem::exists(kRestoredTxt),
+         "Failed DecryptFile should not leave a partial output file.",
+         failures);
 
   RemoveTree(kPaths.test_root);
 }
@@ -168,7 +253,8 @@ auto TestDecryptFileToBytesWrongPassphraseRejected(int& failures) -> void {
 
 auto RunFileCryptoFailureTests(int& failures) -> void {
   TestWrongPassphraseRejected(failures);
-  TestCompressionMetadataMismatchRejected(failures);
+  TestTamperedHeaderRejected(failures);
+  TestTruncatedStreamRejected(failures);
   TestDecryptFileToBytesWrongPassphraseRejected(failures);
 }
 
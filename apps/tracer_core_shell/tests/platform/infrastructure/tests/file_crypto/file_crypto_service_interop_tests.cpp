@@ -211,11 +211,71 @@ auto TestWindowsToAndroidCryptoImportInterop(int& failures) -> void {
   RemoveTree(kPaths.test_root);
 }
 
+auto TestLegacyV2FixtureStillDecrypts(int& failures) -> void {
+  using namespace file_crypto_tests_internal;
+
+  const RuntimeTestPaths kPaths =
+      BuildTempTestPaths("tracer_core_file_crypto_legacy_v2_test");
+  const auto kFixtureRoot = ResolveRepoRootForInterop() / "test" / "fixtures";
+  const auto kLegacyTracer =
+      kFixtureRoot / "crypto" / "2026-01.single_day.v2.tracer";
+  const auto kExpectedTxt =
+      kFixtureRoot / "text" / "minimal_month" / "2026-01.single_day.txt";
+  const auto kRestoredTxt = kPaths.test_root / "restored.txt";
+  constexpr std::string_view kPassphrase = "fixture-v2-passphrase";
+
+  RemoveTree(kPaths.test_root);
+  tracer_core::infrastructure::crypto::TracerFileMetadata metadata{};
+  const auto kInspectResult =
+      tracer_core::infrastructure::crypto::InspectEncryptedFile(kLegacyTracer,
+                                                                &metadata);
+  Expect(kInspectResult.ok() && metadata.version == 2,
+         "InspectEncryptedFile should still parse v2 .tracer files.",
+         failures);
+
+  const auto kDecryptResult = tracer_core::infrastructure::crypto::DecryptFile(
+      kLegacyTracer, kRestoredTxt, kPassphrase);
+  Expect(kDecryptResult.ok(),
+         "DecryptFile should still accept v2 .tracer files.", failures);
+  if (!kDecryptResult.ok()) {
+    std::cerr << "[FAIL] Legacy v2 decrypt error: "
+              << kDecryptResult.error_code << " | "
+              << kDecryptResult.error_message << '\n';
+    RemoveTree(kPaths.test_root);
+    return;
+  }
+  Expect(ReadTextFile(kRestoredTxt) == ReadTextFile(kExpectedTxt),
+         "Legacy v2 .tracer should decrypt to the original fixture TXT.",
+         failures);
+
+  // v2 does not authenticate its header; a forged plaintext_size is caught
+  // by the decompressed size check instead.
+  constexpr std::size_t kPlaintextSizeOffset = 60;
+  constexpr std::uint64_t kTamperedPlaintextSize = 999999ULL;
+  const auto kTampered = kPaths.test_root / "tampered.v2.tracer";
+  auto bytes = ReadBytes(kLegacyTracer);
+  WriteU64LE(bytes, kPlaintextSizeOffset, kTamperedPlaintextSize);
+  Expect(WriteBytes(kTampered, bytes),
+         "Tampered v2 fixture copy should be writable.", failures);
+  const auto kTamperedResult = tracer_core::infrastructure::crypto::DecryptFile(
+      kTampered, kPaths.test_root / "tampered.txt", kPassphrase);
+  Expect(!kTamperedResult.ok() &&
+             kTamperedResult.error == tracer_core::infrastructure::crypto::
+                                          FileCryptoError::
+                                              kCompressionMetadataMismatch,
+         "Tampered v2 plaintext_size should map to "
+         "kCompressionMetadataMismatch.",
+         failures);
+
+  RemoveTree(kPaths.test_root);
+}
+
 }  // namespace
 
 auto RunFileCryptoInteropTests(int& failures) -> void {
   TestAndroidToWindowsCryptoInterop(failures);
   TestWindowsToAndroidCryptoImportInterop(failures);
+  TestLegacyV2FixtureStillDecrypts(failures);
 }
 
 }  // namespace android_runtime_tests
@@ -1,7 +1,11 @@
 // infrastructure/tests/file_crypto/file_crypto_service_progress_tests.cpp
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <filesystem>
+#include <format>
 #include <iostream>
+#include <string>
 #include <vector>
 
 #include "infrastructure/tests/file_crypto/file_crypto_service_test_internal.hpp"
@@ -150,7 +154,7 @@ auto TestBatchDecryptCancellation(int& failures) -> void {
   options.progress_min_bytes_delta = 1;
   options.progress_callback =
       [&](const FileCryptoProgressSnapshot& snapshot) -> FileCryptoControl {
-    if (!cancel_requested && snapshot.phase == FileCryptoPhase::kReadInput &&
+    if (!cancel_requested && snapshot.phase == FileCryptoPhase::kDecrypt &&
         snapshot.current_file_done_bytes > 0) {
       cancel_requested = true;
       return FileCryptoControl::kCancel;
@@ -212,7 +216,7 @@ auto TestSingleFileEncryptCancelToken(int& failures) -> void {
   options.progress_min_bytes_delta = 1;
   options.progress_callback =
       [&](const FileCryptoProgressSnapshot& snapshot) -> FileCryptoControl {
-    if (!cancel_armed && snapshot.phase == FileCryptoPhase::kReadInput &&
+    if (!cancel_armed && snapshot.phase == FileCryptoPhase::kEncrypt &&
         snapshot.current_file_done_bytes > 0) {
       cancel_token.RequestCancel();
       cancel_armed = true;
@@ -231,6 +235,115 @@ auto TestSingleFileEncryptCancelToken(int& failures) -> void {
   RemoveTree(kPaths.test_root);
 }
 
+// Collapses repeated snapshots of one phase so the result is the order in
+// which phases were entered.
+auto CollectPhaseSequence(
+    const std::vector<
+        tracer_core::infrastructure::crypto::FileCryptoProgressSnapshot>&
+        snapshots)
+    -> std::vector<tracer_core::infrastructure::crypto::FileCryptoPhase> {
+  std::vector<tracer_core::infrastructure::crypto::FileCryptoPhase> phases;
+  for (const auto& snapshot : snapshots) {
+    if (phases.empty() || phases.back() != snapshot.phase) {
+      phases.push_back(snapshot.phase);
+    }
+  }
+  return phases;
+}
+
+auto TestSingleFilePhaseSequence(int& failures) -> void {
+  using namespace file_crypto_tests_internal;
+
+  const RuntimeTestPaths kPaths =
+      BuildTempTestPaths("tracer_core_file_crypto_phase_sequence_test");
+  const auto kInputTxt = kPaths.test_root / "plain.txt";
+  const auto kEncrypted = kPaths.test_root / "payload.tracer";
+  const auto kRestoredTxt = kPaths.test_root / "restored.txt";
+  constexpr std::string_view kPassphrase = "phase-sequence-passphrase";
+
+  RemoveTree(kPaths.test_root);
+  std::string content = "y2026\nm03\n";
+  for (int line = 0; line < 2000; ++line) {
+    content += std::format("03{:02}\n0600 study_{}\n", line % 28 + 1, line);
+  }
+  if (!WriteFileWithParents(kInputTxt, content)) {
+    ++failures;
+    std::cerr << "[FAIL] Failed to seed phase sequence input file.\n";
+    RemoveTree(kPaths.test_root);
+    return;
+  }
+
+  using tracer_core::infrastructure::crypto::FileCryptoControl;
+  using tracer_core::infrastructure::crypto::FileCryptoOptions;
+  using tracer_core::infrastructure::crypto::FileCryptoPhase;
+  using tracer_core::infrastructure::crypto::FileCryptoProgressSnapshot;
+
+  std::vector<FileCryptoProgressSnapshot> snapshots;
+  FileCryptoOptions options{};
+  options.progress_min_interval = std::chrono::milliseconds(0);
+  options.progress_min_bytes_delta = 1;
+  options.progress_callback =
+      [&](const FileCryptoProgressSnapshot& snapshot) -> FileCryptoControl {
+    snapshots.push_back(snapshot);
+    return FileCryptoControl::kContinue;
+  };
+
+  // Sequences documented in progress_callback_v1.md.
+  const std::vector<FileCryptoPhase> kEncryptPhases = {
+      FileCryptoPhase::kScan,        FileCryptoPhase::kReadInput,
+      FileCryptoPhase::kCompress,    FileCryptoPhase::kDeriveKey,
+      FileCryptoPhase::kEncrypt,     FileCryptoPhase::kWriteOutput,
+      FileCryptoPhase::kCompleted};
+  const std::vector<FileCryptoPhase> kDecryptPhases = {
+      FileCryptoPhase::kScan,        FileCryptoPhase::kReadInput,
+      FileCryptoPhase::kDeriveKey,   FileCryptoPhase::kDecrypt,
+      FileCryptoPhase::kWriteOutput, FileCryptoPhase::kCompleted};
+  // Byte progress moves only while data is streamed through the cipher.
+  const auto kBytesOnlyIn = [&](FileCryptoPhase transfer_phase) -> bool {
+    std::uint64_t previous_done = 0;
+    for (const auto& snapshot : snapshots) {
+      if (snapshot.current_file_done_bytes != previous_done &&
+          snapshot.phase != transfer_phase &&
+          snapshot.phase != FileCryptoPhase::kWriteOutput) {
+        return false;
+      }
+      previous_done = snapshot.current_file_done_bytes;
+    }
+    return std::ranges::any_of(
+        snapshots, [&](const FileCryptoProgressSnapshot& snapshot) {
+          return snapshot.phase == transfer_phase &&
+                 snapshot.current_file_done_bytes > 0;
+        });
+  };
+
+  const auto kEncryptResult = tracer_core::infrastructure::crypto::EncryptFile(
+      kInputTxt, kEncrypted, kPassphrase, options);
+  Expect(kEncryptResult.ok(),
+         "EncryptFile should succeed for phase sequence input.", failures);
+  Expect(CollectPhaseSequence(snapshots) == kEncryptPhases,
+         "EncryptFile should emit scan, read-input, compress, derive-key, "
+         "encrypt, write-output, completed in order.",
+         failures);
+  Expect(kBytesOnlyIn(FileCryptoPhase::kEncrypt),
+         "EncryptFile byte progress should be reported in the encrypt phase.",
+         failures);
+
+  snapshots.clear();
+  const auto kDecryptResult = tracer_core::infrastructure::crypto::DecryptFile(
+      kEncrypted, kRestoredTxt, kPassphrase, options);
+  Expect(kDecryptResult.ok() && ReadTextFile(kRestoredTxt) == content,
+         "DecryptFile should restore the phase sequence input.", failures);
+  Expect(CollectPhaseSequence(snapshots) == kDecryptPhases,
+         "DecryptFile should emit scan, read-input, derive-key, decrypt, "
+         "write-output, completed in order.",
+         failures);
+  Expect(kBytesOnlyIn(FileCryptoPhase::kDecrypt),
+         "DecryptFile byte progress should be reported in the decrypt phase.",
+         failures);
+
+  RemoveTree(kPaths.test_root);
+}
+
 auto TestEncryptBytesProgressUsesLogicalPaths(int& failures) -> void {
   using namespace file_crypto_tests_internal;
 
@@ -295,12 +408,129 @@ auto TestEncryptBytesProgressUsesLogicalPaths(int& failures) -> void {
   RemoveTree(kPaths.test_root);
 }
 
+auto TestParallelBatchProgressOrdering(int& failures) -> void {
+  using namespace file_crypto_tests_internal;
+
+  const RuntimeTestPaths kPaths =
+      BuildTempTestPaths("tracer_core_file_crypto_parallel_batch_test");
+  const auto kPlaintextRoot = kPaths.test_root / "plain";
+  const auto kEncryptedRoot = kPaths.test_root / "encrypted";
+  const auto kDecryptedRoot = kPaths.test_root / "decrypted";
+  constexpr std::string_view kPassphrase = "parallel-batch-passphrase";
+  constexpr int kFirstYear = 2024;
+  constexpr int kYearCount = 3;
+  constexpr int kMonthsPerYear = 4;
+  constexpr int kLinesPerMonth = 400;
+
+  RemoveTree(kPaths.test_root);
+  std::vector<std::filesystem::path> sources;
+  for (int year = kFirstYear; year < kFirstYear + kYearCount; ++year) {
+    for (int month = 1; month <= kMonthsPerYear; ++month) {
+      std::string content = std::format("y{}\nm{:02}\n", year, month);
+      for (int line = 0; line < kLinesPerMonth * month; ++line) {
+        content += std::format("{:02}{:02}\n0600 study_{}\n", month,
+                               line % 28 + 1, line);
+      }
+      const auto kRelative = std::filesystem::path(std::to_string(year)) /
+                             std::format("{}-{:02}.txt", year, month);
+      if (!WriteFileWithParents(kPlaintextRoot / kRelative, content)) {
+        ++failures;
+        std::cerr << "[FAIL] Failed to seed parallel batch plaintext files.\n";
+        RemoveTree(kPaths.test_root);
+        return;
+      }
+      sources.push_back(kRelative);
+    }
+  }
+
+  using tracer_core::infrastructure::crypto::FileCryptoControl;
+  using tracer_core::infrastructure::crypto::FileCryptoOptions;
+  using tracer_core::infrastructure::crypto::FileCryptoPhase;
+  using tracer_core::infrastructure::crypto::FileCryptoProgressSnapshot;
+
+  std::vector<FileCryptoProgressSnapshot> snapshots;
+  FileCryptoOptions options{};
+  options.max_parallel_files = 4;
+  options.progress_min_interval = std::chrono::milliseconds(0);
+  options.progress_min_bytes_delta = 1;
+  options.progress_callback =
+      [&](const FileCryptoProgressSnapshot& snapshot) -> FileCryptoControl {
+    snapshots.push_back(snapshot);
+    return FileCryptoControl::kContinue;
+  };
+
+  const auto kEncryptResult =
+      tracer_core::infrastructure::crypto::EncryptDirectory(
+          kPlaintextRoot, kEncryptedRoot, kPassphrase, options);
+  Expect(kEncryptResult.ok() &&
+             kEncryptResult.succeeded_files == sources.size(),
+         "Parallel EncryptDirectory should encrypt every file.", failures);
+
+  bool files_in_order = true;
+  bool overall_monotonic = true;
+  std::size_t previous_file_index = 0;
+  std::uint64_t previous_overall_done = 0;
+  std::vector<std::size_t> seen_file_indices;
+  for (const auto& snapshot : snapshots) {
+    if (snapshot.overall_done_bytes < previous_overall_done) {
+      overall_monotonic = false;
+    }
+    previous_overall_done = snapshot.overall_done_bytes;
+    if (snapshot.phase == FileCryptoPhase::kScan ||
+        snapshot.phase == FileCryptoPhase::kCompleted) {
+      continue;
+    }
+    if (snapshot.current_file_index < previous_file_index) {
+      files_in_order = false;
+    }
+    previous_file_index = snapshot.current_file_index;
+    if (seen_file_indices.empty() ||
+        seen_file_indices.back() != snapshot.current_file_index) {
+      seen_file_indices.push_back(snapshot.current_file_index);
+    }
+  }
+  Expect(files_in_order,
+         "Parallel batch progress should report files in plan order.",
+         failures);
+  Expect(overall_monotonic,
+         "Parallel batch overall_done_bytes should be monotonic.", failures);
+  Expect(seen_file_indices.size() == sources.size(),
+         "Parallel batch progress should report every file.", failures);
+  if (!snapshots.empty()) {
+    Expect(snapshots.back().phase == FileCryptoPhase::kCompleted &&
+               snapshots.back().overall_done_bytes ==
+                   snapshots.back().overall_total_bytes,
+           "Parallel batch final snapshot should be completed.", failures);
+  }
+
+  FileCryptoOptions decrypt_options{};
+  decrypt_options.max_parallel_files = 4;
+  const auto kDecryptResult =
+      tracer_core::infrastructure::crypto::DecryptDirectory(
+          kEncryptedRoot, kDecryptedRoot, kPassphrase, decrypt_options);
+  Expect(kDecryptResult.ok() &&
+             kDecryptResult.succeeded_files == sources.size(),
+         "Parallel DecryptDirectory should decrypt every file.", failures);
+  const bool kRoundtripMatches = std::ranges::all_of(
+      sources, [&](const std::filesystem::path& relative_path) {
+        return ReadTextFile(kDecryptedRoot / relative_path) ==
+               ReadTextFile(kPlaintextRoot / relative_path);
+      });
+  Expect(kRoundtripMatches,
+         "Parallel batch roundtrip should restore every plaintext file.",
+         failures);
+
+  RemoveTree(kPaths.test_root);
+}
+
 }  // namespace
 
 auto RunFileCryptoProgressTests(int& failures) -> void {
   TestBatchEncryptProgressSnapshot(failures);
   TestBatchDecryptCancellation(failures);
+  TestParallelBatchProgressOrdering(failures);
   TestSingleFileEncryptCancelToken(failures);
+  TestSingleFilePhaseSequence(failures);
   TestEncryptBytesProgressUsesLogicalPaths(failures);
 }
 
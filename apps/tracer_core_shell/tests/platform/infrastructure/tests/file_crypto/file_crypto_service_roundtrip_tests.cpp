@@ -61,9 +61,9 @@ auto TestEncryptDecryptRoundTrip(int& failures) -> void {
       tracer_core::infrastructure::crypto::InspectEncryptedFile(kEncrypted,
                                                                 &metadata);
   Expect(kInspectResult.ok(),
-         "InspectEncryptedFile should parse v2 .tracer metadata.", failures);
+         "InspectEncryptedFile should parse v3 .tracer metadata.", failures);
   if (kInspectResult.ok()) {
-    Expect(metadata.version == 2, "Encrypted file format version should be 2.",
+    Expect(metadata.version == 3, "Encrypted file format version should be 3.",
            failures);
     Expect(metadata.compression_id == 1,
            "Encrypted file compression_id should be zstd(1).", failures);
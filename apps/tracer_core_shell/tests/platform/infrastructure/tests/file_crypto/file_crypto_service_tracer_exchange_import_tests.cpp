@@ -1,7 +1,12 @@
 // infrastructure/tests/file_crypto/file_crypto_service_tracer_exchange_import_tests.cpp
+#include <sqlite3.h>
+
+#include <filesystem>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 
 #include "infrastructure/tests/file_crypto/file_crypto_service_tracer_exchange_test_support.hpp"
 
@@ -11,6 +16,31 @@ namespace {
 using namespace file_crypto_tests_internal;
 using namespace tracer_exchange_tests_internal;
 
+auto QueryDatabaseCount(const fs::path& db_path, const std::string& sql)
+    -> std::optional<long long> {
+  sqlite3* database = nullptr;
+  if (sqlite3_open(db_path.string().c_str(), &database) != SQLITE_OK ||
+      database == nullptr) {
+    if (database != nullptr) {
+      sqlite3_close(database);
+    }
+    return std::nullopt;
+  }
+  const auto count = QueryCount(database, sql);
+  sqlite3_close(database);
+  return count;
+}
+
+// Missing scopes read as generation 0, so a month bumped for the first time
+// still compares as changed.
+auto QueryReportGeneration(const fs::path& db_path, std::string_view scope)
+    -> std::optional<long long> {
+  return QueryDatabaseCount(
+      db_path, "SELECT COALESCE((SELECT generation FROM report_generations "
+               "WHERE scope = '" +
+                   std::string(scope) + "'), 0);");
+}
+
 auto TestTracerExchangeImportCanonicalizesLegacyText(int& failures) -> void {
   constexpr std::string_view kPassphrase = "phase3-tracer-exchange-passphrase";
   const RuntimeTestPaths paths = BuildTempTestPaths(
@@ -256,6 +286,182 @@ auto TestTracerExchangeImportPreservesExtraMonthsAndRebuildsDatabase(
   Expect(fs::exists(paths.db_path),
          "Transaction import should rebuild the runtime database.", failures);
 
+  // Re-importing the same package keeps the converter config and every month
+  // hash unchanged, so the database must come through the changed-month path
+  // untouched. A full rebuild would bump the global report epoch.
+  const auto records_before = QueryDatabaseCount(
+      paths.db_path, "SELECT COUNT(*) FROM time_records;");
+  const auto epoch_before = QueryReportGeneration(paths.db_path, "*");
+  const auto generation_sum_before = QueryDatabaseCount(
+      paths.db_path, "SELECT TOTAL(generation) FROM report_generations;");
+  const auto reimport_result =
+      runtime->runtime_api->tracer_exchange().RunTracerExchangeImport(request);
+  Expect(reimport_result.ok,
+         "Re-importing an identical package should succeed.", failures);
+  const auto records_after = QueryDatabaseCount(
+      paths.db_path, "SELECT COUNT(*) FROM time_records;");
+  Expect(records_before.has_value() && *records_before > 0 &&
+             records_after == records_before,
+         "Re-importing an identical package should keep database rows.",
+         failures);
+  Expect(QueryDatabaseCount(paths.db_path,
+                            "SELECT COUNT(*) FROM ingest_month_sync;") ==
+             static_cast<long long>(BuildSamplePayloads().size() + 1U),
+         "Re-import should keep one ingest sync row per effective month.",
+         failures);
+  Expect(epoch_before.has_value() &&
+             QueryReportGeneration(paths.db_path, "*") == epoch_before,
+         "Re-importing an identical package should not rebuild the database.",
+         failures);
+  Expect(generation_sum_before.has_value() &&
+             QueryDatabaseCount(
+                 paths.db_path,
+                 "SELECT TOTAL(generation) FROM report_generations;") ==
+                 generation_sum_before,
+         "Re-importing an identical package should not bump any month "
+         "generation.",
+         failures);
+
+  RemoveTree(paths.test_root);
+}
+
+auto TestTracerExchangeImportRebuildsOnlyChangedMonth(int& failures) -> void {
+  constexpr std::string_view kPassphrase = "phase3-tracer-exchange-passphrase";
+  const RuntimeTestPaths paths = BuildTempTestPaths(
+      "tracer_core_tracer_exchange_changed_month_import_test");
+  const fs::path config_root = paths.test_root / "config";
+  const fs::path main_config_path =
+      config_root / "converter" / "interval_processor_config.toml";
+  const fs::path active_text_root = paths.test_root / "input";
+  const fs::path runtime_work_root = paths.test_root / "work";
+  const fs::path first_package_path =
+      paths.test_root / "package" / "first.ttpkg";
+  const fs::path first_tracer_path =
+      paths.test_root / "package" / "first.tracer";
+  const fs::path second_package_path =
+      paths.test_root / "package" / "second.ttpkg";
+  const fs::path second_tracer_path =
+      paths.test_root / "package" / "second.tracer";
+
+  const std::string preserved_month =
+      "y2024\nm01\n0101\n0600w\n0630meal\n0700rest\n";
+  // 2025-01 gains one record; 2026-12 and the local 2024-01 stay the same.
+  const std::string changed_month =
+      "y2025\nm01\n0101\n0600w\n0630meal\n0700rest\n0730meal\n";
+  const std::string package_main = ReadRepoConverterConfig(
+      "assets/tracer_core/config/converter/interval_processor_config.toml");
+  const std::string package_alias = ReadRepoConverterConfig(
+      "assets/tracer_core/config/converter/alias_mapping.toml");
+  const std::string package_duration = ReadRepoConverterConfig(
+      "assets/tracer_core/config/converter/duration_rules.toml");
+  const auto package_alias_children = BuildRepoAliasChildConfigs();
+
+  auto changed_payloads = BuildSamplePayloads();
+  changed_payloads.front().text = changed_month;
+
+  if (!PrepareRuntimeFixture(paths, config_root, failures)) {
+    return;
+  }
+  if (!WriteFileWithParents(active_text_root / "2024" / "2024-01.txt",
+                            preserved_month)) {
+    ++failures;
+    std::cerr << "[FAIL] Failed to prepare changed-month import fixture.\n";
+    RemoveTree(paths.test_root);
+    return;
+  }
+  if (!WriteEncryptedTracerFromEntries(
+          first_package_path, first_tracer_path,
+          BuildValidPackageEntries(BuildSamplePayloads(), package_main,
+                                   package_alias, package_duration,
+                                   package_alias_children),
+          kPassphrase, failures) ||
+      !WriteEncryptedTracerFromEntries(
+          second_package_path, second_tracer_path,
+          BuildValidPackageEntries(changed_payloads, package_main,
+                                   package_alias, package_duration,
+                                   package_alias_children),
+          kPassphrase, failures)) {
+    RemoveTree(paths.test_root);
+    return;
+  }
+
+  auto runtime = BuildTracerExchangeRuntime(paths, main_config_path, failures);
+  if (!runtime.has_value()) {
+    return;
+  }
+
+  tracer_core::core::dto::TracerExchangeImportRequest request{
+      .input_tracer_path = first_tracer_path,
+      .active_text_root_path = active_text_root,
+      .active_converter_main_config_path = main_config_path,
+      .runtime_work_root = runtime_work_root,
+      .passphrase = std::string(kPassphrase),
+  };
+  const auto first_result =
+      runtime->runtime_api->tracer_exchange().RunTracerExchangeImport(request);
+  if (!first_result.ok) {
+    ++failures;
+    std::cerr << "[FAIL] Initial import for changed-month test failed: "
+              << first_result.error_message << '\n';
+    RemoveTree(paths.test_root);
+    return;
+  }
+
+  const std::string kChangedMonthRecordsSql =
+      "SELECT COUNT(*) FROM time_records WHERE date LIKE '2025-01-%';";
+  const auto changed_records_before =
+      QueryDatabaseCount(paths.db_path, kChangedMonthRecordsSql);
+  const auto epoch_before = QueryReportGeneration(paths.db_path, "*");
+  const auto changed_generation_before =
+      QueryReportGeneration(paths.db_path, "2025-01");
+  const auto preserved_generation_before =
+      QueryReportGeneration(paths.db_path, "2024-01");
+  const auto unchanged_generation_before =
+      QueryReportGeneration(paths.db_path, "2026-12");
+
+  request.input_tracer_path = second_tracer_path;
+  const auto result =
+      runtime->runtime_api->tracer_exchange().RunTracerExchangeImport(request);
+  if (!result.ok) {
+    ++failures;
+    std::cerr << "[FAIL] Importing a package with one changed month failed: "
+              << result.error_message << '\n';
+    RemoveTree(paths.test_root);
+    return;
+  }
+
+  Expect(NormalizeLf(ReadTextFile(active_text_root / "2025" / "2025-01.txt")) ==
+             NormalizeLf(changed_month),
+         "Changed-month import should write the new month text.", failures);
+  Expect(changed_records_before.has_value() &&
+             QueryDatabaseCount(paths.db_path, kChangedMonthRecordsSql) ==
+                 *changed_records_before + 1,
+         "Changed-month import should rebuild the changed month's records.",
+         failures);
+  Expect(QueryDatabaseCount(paths.db_path,
+                            "SELECT COUNT(*) FROM ingest_month_sync;") ==
+             static_cast<long long>(changed_payloads.size() + 1U),
+         "Changed-month import should keep one ingest sync row per month.",
+         failures);
+  Expect(epoch_before.has_value() &&
+             QueryReportGeneration(paths.db_path, "*") == epoch_before,
+         "Changed-month import should not rebuild the whole database.",
+         failures);
+  Expect(changed_generation_before.has_value() &&
+             QueryReportGeneration(paths.db_path, "2025-01") ==
+                 *changed_generation_before + 1,
+         "Changed-month import should bump the changed month's generation.",
+         failures);
+  Expect(preserved_generation_before.has_value() &&
+             QueryReportGeneration(paths.db_path, "2024-01") ==
+                 preserved_generation_before &&
+             unchanged_generation_before.has_value() &&
+             QueryReportGeneration(paths.db_path, "2026-12") ==
+                 unchanged_generation_before,
+         "Changed-month import should leave untouched month generations "
+         "alone.",
+         failures);
+
   RemoveTree(paths.test_root);
 }
 
@@ -390,6 +596,19 @@ auto TestTracerExchangeImportApplyFailureRollsBackConfig(int& failures)
   Expect(!fs::exists(*result.retained_failure_root / "exchange.ttpkg"),
          "Failed import should not retain a decrypted package file on disk.",
          failures);
+  bool staged_payload_found = false;
+  std::error_code scan_error;
+  for (fs::recursive_directory_iterator it(*result.retained_failure_root,
+                                           scan_error),
+       end;
+       !scan_error && it != end; it.increment(scan_error)) {
+    staged_payload_found =
+        staged_payload_found || it->path().extension() == ".txt";
+  }
+  Expect(!staged_payload_found,
+         "Import should validate package payloads in memory instead of "
+         "staging them under the transaction root.",
+         failures);
 
   RemoveTree(paths.test_root);
 }
@@ -497,6 +716,7 @@ auto TestTracerExchangeImportRejectsInvalidConverterConfig(int& failures)
 auto RunFileCryptoTracerExchangeImportTests(int& failures) -> void {
   TestTracerExchangeImportCanonicalizesLegacyText(failures);
   TestTracerExchangeImportPreservesExtraMonthsAndRebuildsDatabase(failures);
+  TestTracerExchangeImportRebuildsOnlyChangedMonth(failures);
   TestTracerExchangeImportApplyFailureRollsBackConfig(failures);
   TestTracerExchangeImportRejectsInvalidConverterConfig(failures);
 }
@@ -1,6 +1,8 @@
 // infrastructure/tests/file_crypto/file_crypto_service_tracer_exchange_package_tests.cpp
+#include <cstdint>
 #include <exception>
 #include <string>
+#include <vector>
 
 #include "infrastructure/tests/file_crypto/file_crypto_service_tracer_exchange_test_support.hpp"
 
@@ -46,7 +48,9 @@ auto TestTracerExchangePackageRoundTrip(int& failures) -> void {
 }
 
 auto TestTracerExchangeDecodeRejectsShaMismatch(int& failures) -> void {
-  auto bytes = exchange_pkg::EncodePackageBytes(
+  // Legacy v3 packages keep the data section last, so the final byte belongs
+  // to the last payload entry.
+  auto bytes = exchange_pkg::EncodePackageBytesV3(
       BuildValidPackageEntries(BuildSamplePayloads(), "main = true\n",
                                "includes = [\"aliases/default.toml\"]\n",
                                "duration = true\n"));
@@ -69,6 +73,71 @@ auto TestTracerExchangeDecodeRejectsShaMismatch(int& failures) -> void {
          "DecodePackageBytes error should mention SHA-256 mismatch.", failures);
 }
 
+auto DecodeErrorMessage(const std::vector<std::uint8_t>& bytes)
+    -> std::string {
+  try {
+    static_cast<void>(exchange_pkg::DecodePackageBytes(bytes));
+  } catch (const std::exception& error) {
+    return error.what();
+  }
+  return {};
+}
+
+auto TestTracerExchangeIndexedPackage(int& failures) -> void {
+  const auto payloads = BuildSamplePayloads();
+  const auto bytes = exchange_pkg::EncodePackageBytes(BuildValidPackageEntries(
+      payloads, "main = true\n", "includes = [\"aliases/default.toml\"]\n",
+      "duration = true\n"));
+
+  const auto index = exchange_pkg::DecodePackageIndex(bytes);
+  Expect(index.format_version == 4U,
+         "EncodePackageBytes should write the indexed v4 layout.", failures);
+  Expect(index.manifest.payload_files.size() == payloads.size(),
+         "DecodePackageIndex should parse the manifest.", failures);
+  for (const auto& payload : payloads) {
+    bool found = false;
+    for (const auto& entry : index.entries) {
+      if (entry.relative_path == payload.relative_path) {
+        found = true;
+        Expect(entry.raw_size == payload.text.size(),
+               "Index raw_size should equal the payload text size.", failures);
+        const auto decoded = exchange_pkg::DecodePackageEntry(bytes, entry);
+        Expect(std::string(decoded.data.begin(), decoded.data.end()) ==
+                   payload.text,
+               "DecodePackageEntry should return the original payload bytes.",
+               failures);
+      }
+    }
+    Expect(found, "Index should list every payload entry.", failures);
+  }
+
+  const auto v3_package =
+      exchange_pkg::DecodePackageBytes(exchange_pkg::EncodePackageBytesV3(
+          BuildValidPackageEntries(payloads, "main = true\n",
+                                   "includes = [\"aliases/default.toml\"]\n",
+                                   "duration = true\n")));
+  Expect(v3_package.entries.size() == index.entries.size(),
+         "DecodePackageBytes should still read v3 packages.", failures);
+
+  const auto& last_entry = index.entries.back();
+  Expect(last_entry.stored_size > 0U,
+         "Last payload entry should have stored bytes.", failures);
+  if (last_entry.stored_size > 0U) {
+    auto tampered_entry = bytes;
+    tampered_entry[static_cast<std::size_t>(last_entry.stored_offset)] ^= 0x01U;
+    const std::string message = DecodeErrorMessage(tampered_entry);
+    Expect(Contains(message, "entry SHA-256 mismatch") ||
+               Contains(message, "entry decompression failed"),
+           "Tampered v4 entry data should be rejected.", failures);
+  }
+
+  auto tampered_trailer = bytes;
+  tampered_trailer.back() ^= 0x01U;
+  Expect(Contains(DecodeErrorMessage(tampered_trailer),
+                  "index digest mismatch"),
+         "Tampered v4 index digest should be rejected.", failures);
+}
+
 auto TestTracerExchangeManifestRejectsPathDrift(int& failures) -> void {
   exchange_pkg::TracerExchangeManifest manifest{};
   manifest.producer_platform = "windows";
@@ -103,6 +172,7 @@ auto TestTracerExchangeManifestRejectsPathDrift(int& failures) -> void {
 auto RunFileCryptoTracerExchangePackageTests(int& failures) -> void {
   TestTracerExchangePackageRoundTrip(failures);
   TestTracerExchangeDecodeRejectsShaMismatch(failures);
+  TestTracerExchangeIndexedPackage(failures);
   TestTracerExchangeManifestRejectsPathDrift(failures);
 }
 
@@ -4,6 +4,8 @@ set(TRACER_CORE_DOMAIN_SOURCES
     "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/logic/converter/convert/core/converter_core.cpp"
     "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/logic/converter/convert/core/converter_core_stats.cpp"
     "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/logic/converter/convert/core/converter_core_activity_mapper.cpp"
+    "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/logic/converter/resolution/activity_resolution_table.cpp"
+    "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/logic/lexer/txt_line_lexer.cpp"
     "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/logic/validator/txt/facade/text_validator.cpp"
     "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/logic/validator/txt/rules/txt_rules.cpp"
     "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/logic/validator/structure/structure_validator.cpp"
@@ -38,6 +40,7 @@ target_sources(tc_domain_lib PUBLIC
         "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/modules/tc.core.dom.rpt.models.query_data_structs.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/modules/tracer.core.domain.logic.converter.core.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/modules/tc.core.dom.logic.conv.log_processor.cppm"
+        "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/modules/tracer.core.domain.logic.lexer.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/modules/tc.core.dom.logic.valid.common.diag.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/modules/tc.core.dom.logic.valid.common.valid_utils.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/domain/modules/tracer.core.domain.logic.validator.txt.rules.cppm"
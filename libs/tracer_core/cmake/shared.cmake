@@ -10,8 +10,10 @@ target_sources(tc_shared_lib PUBLIC
         "${TRACER_CORE_LIB_SOURCE_ROOT}/shared/modules/tracer.core.shared.canonical_text.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/shared/modules/tracer.core.shared.string_utils.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/shared/modules/tracer.core.shared.period_utils.cppm"
+        "${TRACER_CORE_LIB_SOURCE_ROOT}/shared/modules/tracer.core.shared.civil_time.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/shared/modules/tracer.core.shared.exceptions.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/shared/modules/tracer.core.shared.exit_codes.cppm"
+        "${TRACER_CORE_LIB_SOURCE_ROOT}/shared/modules/tracer.core.shared.work_stealing_executor.cppm"
         "${TRACER_CORE_LIB_SOURCE_ROOT}/shared/modules/tracer.core.shared.cppm"
 )
 set_target_properties(tc_shared_lib PROPERTIES
@@ -4,6 +4,7 @@ set(TIME_TRACKER_APPLICATION_USE_CASE_FAMILY_SOURCES
     "use_cases/pipeline_api.cpp"
     "use_cases/query_api.cpp"
     "use_cases/report_api.cpp"
+    "use_cases/report_batch_export.cpp"
     "use_cases/tracer_exchange_api.cpp"
     "aggregate_runtime/tracer_core_runtime.cpp"
 )
@@ -1,5 +1,8 @@
 set(TIME_TRACKER_INFRA_PERSISTENCE_SUPPORT_SOURCES
     "persistence/sqlite/db_manager.cpp"
+    "persistence/sqlite/sqlite_read_connection_pool.cpp"
+    "persistence/sqlite/project_dictionary.cpp"
+    "persistence/sqlite/record_column_snapshot.cpp"
 )
 
 set(TIME_TRACKER_INFRA_PERSISTENCE_WRITE_SOURCES
@@ -10,6 +13,9 @@ set(TIME_TRACKER_INFRA_PERSISTENCE_WRITE_SOURCES
     "persistence/importer/sqlite/project_resolver.module.cpp"
     "persistence/importer/sqlite/connection.module.cpp"
     "persistence/importer/sqlite/statement.module.cpp"
+    "persistence/importer/sqlite/rollup.module.cpp"
+    "persistence/importer/sqlite/search_index.module.cpp"
+    "persistence/importer/sqlite/report_generation.module.cpp"
 )
 
 set(TIME_TRACKER_INFRA_PERSISTENCE_RUNTIME_SOURCES
@@ -32,12 +38,18 @@ set(TIME_TRACKER_INFRA_PERSISTENCE_WRITE_MODULE_FILES
     "persistence/write/importer/sqlite/sql_stmt.cppm"
     "persistence/write/importer/sqlite/sql_writer.cppm"
     "persistence/write/importer/sqlite/sql_proj.cppm"
+    "persistence/write/importer/sqlite/sql_rollup.cppm"
+    "persistence/write/importer/sqlite/sql_search.cppm"
+    "persistence/write/importer/sqlite/sql_generation.cppm"
 )
 
 set(TIME_TRACKER_INFRA_PERSISTENCE_RUNTIME_MODULE_FILES
     "persistence/runtime/tracer.core.infrastructure.persistence.runtime.cppm"
     "persistence/runtime/rt_project_repo.cppm"
     "persistence/runtime/rt_db_health.cppm"
+    "persistence/runtime/rt_read_pool.cppm"
+    "persistence/runtime/rt_project_dict.cppm"
+    "persistence/runtime/rt_record_snapshot.cppm"
 )
 
 set(TIME_TRACKER_INFRA_PERSISTENCE_SOURCES
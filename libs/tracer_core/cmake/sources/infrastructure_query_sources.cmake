@@ -6,6 +6,7 @@ set(TIME_TRACKER_INFRA_QUERY_DATA_STATS_SOURCES
 
 set(TIME_TRACKER_INFRA_QUERY_SOURCES
     "query/data/data_query_repository.cpp"
+    "query/data/data_query_columnar.cpp"
     "query/data/data_query_sql_common.cpp"
     "query/data/data_query_sql_filters.cpp"
     "query/data/data_query_sql_builders_calendar.cpp"
@@ -18,6 +18,7 @@ set(TIME_TRACKER_INFRA_REPORTING_QUERYING_SOURCES
 set(TIME_TRACKER_INFRA_REPORTING_DATA_QUERYING_SOURCES
     "reporting/lazy_sqlite_report_data_query_service.module.cpp"
     "reporting/sqlite_report_data_query_service.module.cpp"
+    "reporting/rendered_report_cache.module.cpp"
 )
 
 set(TIME_TRACKER_INFRA_REPORTING_SOURCES
@@ -63,6 +64,7 @@ set(TIME_TRACKER_INFRA_REPORTING_MODULE_FILES
     "reporting/data_querying/dq.cppm"
     "reporting/data_querying/dq_lazy_sqlite.cppm"
     "reporting/data_querying/dq_sqlite.cppm"
+    "reporting/data_querying/dq_rendered_cache.cppm"
     "reporting/querying/q.cppm"
     "reporting/querying/q_lazy_sqlite.cppm"
     "reporting/querying/q_report_service.cppm"
@@ -2,6 +2,7 @@
 #ifndef APPLICATION_DTO_CLI_CONFIG_H_
 #define APPLICATION_DTO_CLI_CONFIG_H_
 
+#include <cstddef>
 #include <optional>
 #include <string>
 
@@ -27,6 +28,7 @@ struct CliCommandDefaults {
 
 struct CliConfig {
   bool default_save_processed_output = false;
+  std::size_t default_max_parallelism = 0;
   DateCheckMode default_date_check_mode = DateCheckMode::kNone;
   CliGlobalDefaults defaults;
   CliCommandDefaults command_defaults;
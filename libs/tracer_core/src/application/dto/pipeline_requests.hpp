@@ -1,6 +1,7 @@
 #ifndef APPLICATION_DTO_PIPELINE_REQUESTS_HPP_
 #define APPLICATION_DTO_PIPELINE_REQUESTS_HPP_
 
+#include <cstddef>
 #include <string>
 
 #include "domain/types/date_check_mode.hpp"
@@ -15,6 +16,8 @@ struct ConvertRequest {
   bool save_processed_output = false;
   bool validate_logic = true;
   bool validate_structure = true;
+  // 0 表示使用 hardware_concurrency。
+  std::size_t max_parallelism = 0;
 };
 
 struct IngestRequest {
@@ -22,6 +25,8 @@ struct IngestRequest {
   DateCheckMode date_check_mode = DateCheckMode::kNone;
   bool save_processed_output = false;
   IngestMode ingest_mode = IngestMode::kStandard;
+  // 0 表示使用 hardware_concurrency。
+  std::size_t max_parallelism = 0;
 };
 
 struct ImportRequest {
@@ -17,6 +17,8 @@ struct IngestSyncStatusEntry {
   std::string txt_relative_path;
   std::string txt_content_hash_sha256;
   std::int64_t ingested_at_unix_ms = 0;
+  // 入库时转换配置的指纹；与当前配置不同时增量摄入回退为全量。
+  std::string converter_config_fingerprint;
 };
 
 struct IngestSyncStatusOutput {
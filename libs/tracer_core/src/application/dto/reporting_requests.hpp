@@ -1,6 +1,10 @@
 #ifndef APPLICATION_DTO_REPORTING_REQUESTS_HPP_
 #define APPLICATION_DTO_REPORTING_REQUESTS_HPP_
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <optional>
 #include <string>
 #include <vector>
@@ -70,6 +74,24 @@ struct TemporalReportTargetsRequest {
   ReportDisplayMode display_mode = ReportDisplayMode::kDay;
 };
 
+// all_matching 批量导出的进度快照；耗时字段在 phase 为 "done" 时为最终值。
+// render_elapsed 为各工作线程格式化耗时之和，write_elapsed 为写线程忙碌时间。
+struct TemporalReportExportProgress {
+  std::string phase;
+  std::size_t total_count = 0;
+  std::size_t rendered_count = 0;
+  std::size_t written_count = 0;
+  std::uint64_t written_bytes = 0;
+  std::chrono::milliseconds fetch_elapsed{0};
+  std::chrono::milliseconds render_elapsed{0};
+  std::chrono::milliseconds write_elapsed{0};
+  std::chrono::milliseconds total_elapsed{0};
+};
+
+// 可能在工作线程上调用，但调用之间互斥。
+using TemporalReportExportProgressObserver =
+    std::function<void(const TemporalReportExportProgress&)>;
+
 struct TemporalReportExportRequest {
   ReportDisplayMode display_mode = ReportDisplayMode::kDay;
   ReportExportScope export_scope = ReportExportScope::kSingle;
@@ -77,6 +99,10 @@ struct TemporalReportExportRequest {
   std::optional<TemporalSelectionPayload> selection;
   std::vector<int> recent_days_list;
   std::string output_root_path;
+  // 以下仅作用于 all_matching：0 表示使用默认值。
+  std::size_t max_render_workers = 0;
+  std::size_t max_in_flight_write_bytes = 0;
+  TemporalReportExportProgressObserver progress_observer{};
 };
 
 }  // namespace tracer_core::core::dto
@@ -11,6 +11,7 @@ using ::ImportService;
 using ::ImportStats;
 using ::ReplaceAllTarget;
 using ::ReplaceMonthTarget;
+using ::ReplaceMonthsTarget;
 using ::TimeRecordInternal;
 
 }  // namespace tracer::core::application::modimporter
@@ -1,6 +1,10 @@
 module;
 
 #include <string>
+#include <vector>
+
+#include "application/dto/ingest_input_model.hpp"
+#include "domain/logic/lexer/txt_line_lexer.hpp"
 
 namespace tracer_core::application::ports {
 class IIngestInputProvider;
@@ -1,15 +1,21 @@
 module;
 
+#include <cstddef>
+#include <deque>
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "application/dto/ingest_input_model.hpp"
+#include "domain/logic/lexer/txt_line_lexer.hpp"
 #include "domain/model/daily_log.hpp"
 #include "domain/types/converter_config.hpp"
 #include "domain/types/date_check_mode.hpp"
+#include "shared/utils/work_stealing_executor.hpp"
 
 namespace tracer_core::application::ports {
 class IValidationIssueReporter;
@@ -2,25 +2,20 @@
 #include "application/parser/text_parser.hpp"
 #include "shared/utils/ide_location_formatter.hpp"
 
-#include <algorithm>
-#include <array>
-#include <cctype>
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include "application/runtime_bridge/logger.hpp"
 
-import tracer.core.shared.string_utils;
-
 using tracer::core::shared::ide_location::BuildIdeLocationPrefix;
-using tracer::core::shared::string_utils::Trim;
+using txt_lexer::TxtLineKind;
 
 namespace {
-constexpr size_t kYearMarkerLength = 5;
-constexpr char kYearMarkerPrefix = 'y';
-constexpr size_t kMonthMarkerLength = 3;
-constexpr char kMonthMarkerPrefix = 'm';
-constexpr size_t kDayMarkerLength = 4;
 constexpr size_t kDayDigitsLength = 2;
 constexpr size_t kDayStartOffset = 2;
 constexpr size_t kTimeDigitsLength = 4;
@@ -28,103 +23,133 @@ constexpr size_t kTimeHourOffset = 0;
 constexpr size_t kTimeHourLength = 2;
 constexpr size_t kTimeMinuteOffset = 2;
 constexpr size_t kTimeMinuteLength = 2;
-constexpr int kMaxHour = 23;
-constexpr int kMaxMinute = 59;
-constexpr int kMinMonth = 1;
-constexpr int kMaxMonth = 12;
-constexpr size_t kRemarkDelimiterCount = 3;
-// Inline remark delimiters. Example: "1026math //note" -> remark "note".
-constexpr std::array<std::string_view, kRemarkDelimiterCount>
-    kRemarkDelimiters = {"//", "#", ";"};
-
-[[nodiscard]] auto IsAsciiDigit(char value) -> bool {
-  return value >= '0' && value <= '9';
-}
 
-auto FormatTime(const std::string& time_str_hhmm) -> std::string {
-  return (time_str_hhmm.length() == kTimeDigitsLength)
-             ? time_str_hhmm.substr(kTimeHourOffset, kTimeHourLength) + ":" +
-                   time_str_hhmm.substr(kTimeMinuteOffset, kTimeMinuteLength)
-             : time_str_hhmm;
+auto FormatTime(std::string_view time_str_hhmm) -> std::string {
+  if (time_str_hhmm.length() != kTimeDigitsLength) {
+    return std::string(time_str_hhmm);
+  }
+  std::string formatted;
+  formatted.reserve(kTimeDigitsLength + 1);
+  formatted.append(time_str_hhmm.substr(kTimeHourOffset, kTimeHourLength));
+  formatted.push_back(':');
+  formatted.append(time_str_hhmm.substr(kTimeMinuteOffset, kTimeMinuteLength));
+  return formatted;
 }
 
 [[noreturn]] void ThrowParseError(std::string_view source_file, int line_number,
-                                  const std::string& line,
+                                  std::string_view line,
                                   const std::string& message) {
   std::string prefix = BuildIdeLocationPrefix(source_file, line_number);
   if (prefix.empty()) {
     prefix = "unknown location: ";
   }
-  throw std::runtime_error(prefix + "Parse error: " + message + " => '" + line +
-                           "'");
+  throw std::runtime_error(prefix + "Parse error: " + message + " => '" +
+                           std::string(line) + "'");
 }
+
 }  // namespace
 
 TextParser::TextParser(const ConverterConfig& config)
-    : config_(config), wake_keywords_(config.wake_keywords) {}
+    : config_(config),
+      wake_keywords_(config.wake_keywords),
+      lexer_(config.remark_prefix) {}
 
 auto TextParser::Parse(std::istream& input_stream,
                        std::function<void(DailyLog&)> on_new_day,
                        std::string_view source_file) -> void {
+  const std::string kContent{std::istreambuf_iterator<char>(input_stream),
+                             std::istreambuf_iterator<char>()};
+  Parse(std::string_view(kContent), on_new_day, source_file);
+}
+
+auto TextParser::Parse(std::string_view content,
+                       const std::function<void(DailyLog&)>& on_new_day,
+                       std::string_view source_file) -> void {
+  const std::vector<txt_lexer::TxtLineToken> kTokens =
+      lexer_.Tokenize(content);
+  Parse(std::span<const txt_lexer::TxtLineToken>(kTokens), on_new_day,
+        source_file);
+}
+
+auto TextParser::BuildLineSpan(const LineSource& source, int line_number,
+                               std::string_view line) -> SourceSpan {
+  return SourceSpan{
+      .file_path = source.file_path,
+      .line_start = line_number,
+      .line_end = line_number,
+      .column_start = 1,
+      .column_end = static_cast<int>(line.length()),
+      .raw_text = SourceLine(
+          source.buffer, static_cast<std::size_t>(line.data() - source.base),
+          line.size())};
+}
+
+auto TextParser::Parse(std::span<const txt_lexer::TxtLineToken> tokens,
+                       const std::function<void(DailyLog&)>& on_new_day,
+                       std::string_view source_file) -> void {
+  // token 均为同一内容缓冲区上的视图：按首尾 token 截取一份共享拷贝，
+  // 之后每个 span 只记录偏移与长度，不再逐事件复制行文本。
+  LineSource source{.file_path = SourcePath(source_file)};
+  if (!tokens.empty()) {
+    const std::string_view kLast = tokens.back().raw;
+    source.base = tokens.front().raw.data();
+    source.buffer = std::make_shared<const std::string>(
+        source.base,
+        static_cast<std::size_t>(kLast.data() + kLast.size() - source.base));
+  }
   DailyLog current_day;
-  std::string line;
-  std::string current_year_prefix;
-  std::string current_month_prefix;
-  int line_number = 0;
+  std::string_view current_year_prefix;
+  std::string_view current_month_prefix;
 
-  while (std::getline(input_stream, line)) {
-    ++line_number;
-    line = Trim(line);
-    if (line.empty()) {
-      continue;
-    }
+  for (const auto& token : tokens) {
+    const std::string_view kLine = token.text;
 
-    if (IsYearMarker(line)) {
-      current_year_prefix = line.substr(1);
-      current_month_prefix.clear();
+    if (token.kind == TxtLineKind::kYear) {
+      current_year_prefix = kLine.substr(1);
+      current_month_prefix = {};
       continue;
     }
 
-    if (IsMonthMarker(line)) {
+    if (token.kind == TxtLineKind::kMonth) {
       if (current_year_prefix.empty()) {
         tracer_core::application::runtime_bridge::LogWarn(
-            "Warning: Skipping line '" + line +
+            "Warning: Skipping line '" + std::string(kLine) +
             "' because a year header (e.g., y2025) has not been found yet.");
         continue;
       }
-      current_month_prefix = line.substr(1);
+      current_month_prefix = kLine.substr(1);
       continue;
     }
 
     if (current_year_prefix.empty()) {
       tracer_core::application::runtime_bridge::LogWarn(
-          "Warning: Skipping line '" + line +
+          "Warning: Skipping line '" + std::string(kLine) +
           "' because a year header (e.g., y2025) has not been found yet.");
       continue;
     }
 
-    if (IsNewDayMarker(line)) {
+    if (token.kind == TxtLineKind::kDate) {
       if (current_month_prefix.empty()) {
-        ThrowParseError(source_file, line_number, line,
+        ThrowParseError(source_file, token.line_number, kLine,
                         "Date found before month header (mMM)");
       }
       if (!current_day.date.empty()) {
         on_new_day(current_day);
       }
       current_day.Clear();
-      const std::string kMonthPrefix = current_month_prefix;
-      current_day.date = current_year_prefix + "-" + kMonthPrefix + "-" +
-                         line.substr(kDayStartOffset, kDayDigitsLength);
+      current_day.date.reserve(current_year_prefix.size() +
+                               current_month_prefix.size() +
+                               kDayDigitsLength + 2);
+      current_day.date.append(current_year_prefix);
+      current_day.date.push_back('-');
+      current_day.date.append(current_month_prefix);
+      current_day.date.push_back('-');
+      current_day.date.append(kLine.substr(kDayStartOffset, kDayDigitsLength));
       current_day.source_span =
-          SourceSpan{.file_path = std::string(source_file),
-                     .line_start = line_number,
-                     .line_end = line_number,
-                     .column_start = 1,
-                     .column_end = static_cast<int>(line.length()),
-                     .raw_text = line};
+          BuildLineSpan(source, token.line_number, kLine);
 
     } else {
-      ParseLine(line, line_number, current_day, source_file);
+      ParseLine(token, current_day, source);
     }
   }
   if (!current_day.date.empty()) {
@@ -132,61 +157,6 @@ auto TextParser::Parse(std::istream& input_stream,
   }
 }
 
-auto TextParser::IsYearMarker(const std::string& line) -> bool {
-  if (line.length() != kYearMarkerLength || line[0] != kYearMarkerPrefix) {
-    return false;
-  }
-  return std::ranges::all_of(
-      line.substr(1), [](char value) -> bool { return IsAsciiDigit(value); });
-}
-
-auto TextParser::IsMonthMarker(const std::string& line) -> bool {
-  if (line.length() != kMonthMarkerLength || line[0] != kMonthMarkerPrefix) {
-    return false;
-  }
-  if (!std::ranges::all_of(line.substr(1), [](char value) -> bool {
-        return IsAsciiDigit(value);
-      })) {
-    return false;
-  }
-  int month_value = std::stoi(line.substr(1));
-  return month_value >= kMinMonth && month_value <= kMaxMonth;
-}
-
-auto TextParser::IsNewDayMarker(const std::string& line) -> bool {
-  return line.length() == kDayMarkerLength &&
-         std::ranges::all_of(
-             line, [](char value) -> bool { return IsAsciiDigit(value); });
-}
-
-auto TextParser::ExtractRemark(std::string_view remaining_line)
-    -> RemarkResult {
-  size_t comment_pos = std::string::npos;
-  std::string_view chosen_delimiter;
-
-  // Multiple inline remark markers are allowed; pick the earliest one so
-  // "0232foo //a #b" keeps description as "foo" and remark as "a #b".
-  for (std::string_view delimiter : kRemarkDelimiters) {
-    size_t pos = remaining_line.find(delimiter);
-    if (pos != std::string::npos) {
-      if (comment_pos == std::string::npos || pos < comment_pos) {
-        comment_pos = pos;
-        chosen_delimiter = delimiter;
-      }
-    }
-  }
-
-  if (comment_pos != std::string::npos) {
-    std::string description =
-        Trim(std::string(remaining_line.substr(0, comment_pos)));
-    std::string remark = Trim(std::string(
-        remaining_line.substr(comment_pos + chosen_delimiter.length())));
-    return {.description = description, .remark = remark};
-  }
-
-  return {.description = Trim(std::string(remaining_line)), .remark = ""};
-}
-
 auto TextParser::ProcessEventContext(DailyLog& current_day,
                                      EventInput input) const
 
@@ -206,7 +176,7 @@ auto TextParser::ProcessEventContext(DailyLog& current_day,
     // keywords are not rejected in parser, but must be rejected later by
     // logic validation and must not redefine the day.
     if (current_day.getupTime.empty() && current_day.rawEvents.empty()) {
-      current_day.getupTime = FormatTime(std::string(input.time_str_hhmm));
+      current_day.getupTime = FormatTime(input.time_str_hhmm);
     }
 
   } else {
@@ -219,57 +189,45 @@ auto TextParser::ProcessEventContext(DailyLog& current_day,
   return is_wake;
 }
 
-auto TextParser::ParseLine(const std::string& line, int line_number,
+auto TextParser::ParseLine(const txt_lexer::TxtLineToken& token,
                            DailyLog& current_day,
-                           std::string_view source_file) const -> void {
-  const std::string& remark_prefix = config_.remark_prefix;
+                           const LineSource& source) const -> void {
+  const std::string_view kLine = token.text;
+  const std::string_view kSourceFile = source.file_path;
 
-  if (!remark_prefix.empty() && line.starts_with(remark_prefix)) {
+  if (token.kind == TxtLineKind::kRemark) {
     if (!current_day.date.empty()) {
-      current_day.generalRemarks.push_back(line.substr(remark_prefix.length()));
+      current_day.generalRemarks.emplace_back(token.remark_body);
     }
     return;
   }
 
   if (current_day.date.empty()) {
-    ThrowParseError(source_file, line_number, line,
+    ThrowParseError(kSourceFile, token.line_number, kLine,
                     "Event line appears before date");
   }
 
-  if (line.length() < kTimeDigitsLength ||
-      !std::ranges::all_of(
-          line.substr(0, kTimeDigitsLength),
-          [](char value) -> bool { return IsAsciiDigit(value); })) {
-    ThrowParseError(source_file, line_number, line,
+  if (token.kind != TxtLineKind::kEvent) {
+    ThrowParseError(kSourceFile, token.line_number, kLine,
                     "Invalid event line format");
   }
 
-  const int kHour =
-      ((line[kTimeHourOffset] - '0') * 10) + (line[kTimeHourOffset + 1] - '0');
-  const int kMinute = ((line[kTimeMinuteOffset] - '0') * 10) +
-                      (line[kTimeMinuteOffset + 1] - '0');
-
-  if (kHour > kMaxHour || kMinute > kMaxMinute) {
-    ThrowParseError(source_file, line_number, line, "Time out of range");
+  if (!token.IsTimeInRange()) {
+    ThrowParseError(kSourceFile, token.line_number, kLine,
+                    "Time out of range");
   }
 
-  std::string time_str_hhmm = line.substr(0, kTimeDigitsLength);
-  RemarkResult remark_data = ExtractRemark(line.substr(kTimeDigitsLength));
-
-  if (remark_data.description.empty()) {
-    ThrowParseError(source_file, line_number, line,
+  if (token.description.empty()) {
+    ThrowParseError(kSourceFile, token.line_number, kLine,
                     "Missing activity description");
   }
 
-  ProcessEventContext(current_day, {.description = remark_data.description,
-                                    .time_str_hhmm = time_str_hhmm});
+  ProcessEventContext(current_day, {.description = token.description,
+                                    .time_str_hhmm = token.time_hhmm});
 
+  // 视图在此处一次性物化为 RawEvent 拥有的字符串。
   current_day.rawEvents.push_back(
-      {time_str_hhmm, remark_data.description, remark_data.remark,
-       SourceSpan{.file_path = std::string(source_file),
-                  .line_start = line_number,
-                  .line_end = line_number,
-                  .column_start = 1,
-                  .column_end = static_cast<int>(line.length()),
-                  .raw_text = line}});
+      {std::string(token.time_hhmm), std::string(token.description),
+       std::string(token.inline_remark),
+       BuildLineSpan(source, token.line_number, kLine)});
 }
@@ -4,10 +4,13 @@
 
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_set>
 
+#include "domain/logic/lexer/txt_line_lexer.hpp"
 #include "domain/model/daily_log.hpp"
 #include "domain/types/converter_config.hpp"
 
@@ -17,6 +20,15 @@ class TextParser {
   auto Parse(std::istream& input_stream,
              std::function<void(DailyLog&)> on_new_day,
              std::string_view source_file) -> void;
+  // 直接在内容缓冲区上按行切分视图解析，只在写入 DailyLog/RawEvent 时
+  // 物化字符串。
+  auto Parse(std::string_view content,
+             const std::function<void(DailyLog&)>& on_new_day,
+             std::string_view source_file) -> void;
+  // 消费结构校验阶段已产出的 token，避免对同一内容再次分行与分类。
+  auto Parse(std::span<const txt_lexer::TxtLineToken> tokens,
+             const std::function<void(DailyLog&)>& on_new_day,
+             std::string_view source_file) -> void;
 
  private:
   const ConverterConfig& config_;
@@ -25,26 +37,26 @@ class TextParser {
   const std::vector<std::string>&
       wake_keywords_;  // [优化] 直接引用 vector，避免拷贝 set
 
-  static auto IsYearMarker(const std::string& line) -> bool;
-  static auto IsMonthMarker(const std::string& line) -> bool;
-  static auto IsNewDayMarker(const std::string& line) -> bool;
-  auto ParseLine(const std::string& line, int line_number,
-                 DailyLog& current_day, std::string_view source_file) const
-      -> void;
+  txt_lexer::TxtLineLexer lexer_;
 
-  struct RemarkResult {
-    std::string description;
-    std::string remark;
+  // 同一文件的所有 span 共享路径与一份内容缓冲区，行文本只记录偏移。
+  struct LineSource {
+    SourcePath file_path;
+    std::shared_ptr<const std::string> buffer;
+    const char* base = nullptr;
   };
 
+  [[nodiscard]] static auto BuildLineSpan(const LineSource& source,
+                                          int line_number,
+                                          std::string_view line) -> SourceSpan;
+  auto ParseLine(const txt_lexer::TxtLineToken& token, DailyLog& current_day,
+                 const LineSource& source) const -> void;
+
   struct EventInput {
     std::string_view description;
     std::string_view time_str_hhmm;
   };
 
-  [[nodiscard]] static auto ExtractRemark(std::string_view remaining_line)
-      -> RemarkResult;
-
   auto ProcessEventContext(DailyLog& current_day, EventInput input) const
       -> bool;
 };
@@ -1,6 +1,11 @@
 // application/pipeline/converter/converter_service.cpp
 #include "application/pipeline/converter/converter_service.hpp"
 
+#include <istream>
+#include <iterator>
+#include <string>
+#include <vector>
+
 #include "application/parser/text_parser.hpp"
 
 import tracer.core.domain.logic.converter.core;
@@ -44,6 +49,26 @@ auto ConverterService::ExecuteConversion(
     std::istream& combined_input_stream,
     std::function<void(DailyLog&&)> data_consumer, std::string_view source_file)
     -> void {
+  const std::string kContent{
+      std::istreambuf_iterator<char>(combined_input_stream),
+      std::istreambuf_iterator<char>()};
+  ExecuteConversion(std::string_view(kContent), data_consumer, source_file);
+}
+
+auto ConverterService::ExecuteConversion(
+    std::string_view content,
+    const std::function<void(DailyLog&&)>& data_consumer,
+    std::string_view source_file) -> void {
+  const txt_lexer::TxtLineLexer kLexer(config_.remark_prefix);
+  const std::vector<txt_lexer::TxtLineToken> kTokens = kLexer.Tokenize(content);
+  ExecuteConversion(std::span<const txt_lexer::TxtLineToken>(kTokens),
+                    data_consumer, source_file);
+}
+
+auto ConverterService::ExecuteConversion(
+    std::span<const txt_lexer::TxtLineToken> tokens,
+    const std::function<void(DailyLog&&)>& data_consumer,
+    std::string_view source_file) -> void {
   TextParser parser(config_);
   DayProcessor processor(config_);
 
@@ -52,7 +77,7 @@ auto ConverterService::ExecuteConversion(
   bool has_previous = false;
 
   parser.Parse(
-      combined_input_stream,
+      tokens,
       [&](DailyLog& current_day) -> void {
         // 1. 初始化 / 跨天逻辑处理
         if (!has_previous) {
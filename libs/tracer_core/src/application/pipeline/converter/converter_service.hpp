@@ -4,8 +4,11 @@
 
 #include <functional>
 #include <iosfwd>
+#include <span>
 #include <string_view>
 
+#include "domain/logic/lexer/txt_line_lexer.hpp"
+
 struct ConverterConfig;
 struct DailyLog;
 
@@ -16,6 +19,13 @@ class ConverterService {
   auto ExecuteConversion(std::istream& combined_input_stream,
                          std::function<void(DailyLog&&)> data_consumer,
                          std::string_view source_file) -> void;
+  auto ExecuteConversion(std::string_view content,
+                         const std::function<void(DailyLog&&)>& data_consumer,
+                         std::string_view source_file) -> void;
+  // 复用结构校验阶段已产出的 token；token 中的视图必须在调用期间有效。
+  auto ExecuteConversion(std::span<const txt_lexer::TxtLineToken> tokens,
+                         const std::function<void(DailyLog&&)>& data_consumer,
+                         std::string_view source_file) -> void;
 
  private:
   const ConverterConfig& config_;
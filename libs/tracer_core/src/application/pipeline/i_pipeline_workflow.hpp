@@ -1,10 +1,12 @@
 #ifndef APPLICATION_PIPELINE_I_PIPELINE_WORKFLOW_HPP_
 #define APPLICATION_PIPELINE_I_PIPELINE_WORKFLOW_HPP_
 
+#include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "application/dto/ingest_input_model.hpp"
 #include "application/dto/pipeline_requests.hpp"
 #include "application/dto/pipeline_responses.hpp"
 #include "domain/types/date_check_mode.hpp"
@@ -30,10 +32,12 @@ class IPipelineWorkflow {
       -> void = 0;
   virtual auto RunDatabaseImportFromMemory(
       const std::map<std::string, std::vector<DailyLog>>& data_map) -> void = 0;
+  // max_parallelism 为转换/校验的并发上限；0 表示使用 hardware_concurrency。
   virtual auto RunIngest(const std::string& source_path,
                          DateCheckMode date_check_mode,
                          bool save_processed,
-                         IngestMode ingest_mode)
+                         IngestMode ingest_mode,
+                         std::size_t max_parallelism)
       -> void = 0;
   virtual auto RunIngestSyncStatusQuery(
       const tracer_core::core::dto::IngestSyncStatusRequest& request)
@@ -45,6 +49,22 @@ class IPipelineWorkflow {
   virtual auto RunValidateStructure(const std::string& source_path) -> void = 0;
   virtual auto RunValidateLogic(const std::string& source_path,
                                 DateCheckMode date_check_mode) -> void = 0;
+  // 以下变体直接处理调用方已在内存中的 TXT 输入（按月份顺序），不读取
+  // 文件系统。
+  virtual auto RunValidateStructureFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&
+          inputs) -> void = 0;
+  virtual auto RunValidateLogicFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&
+          inputs,
+      DateCheckMode date_check_mode) -> void = 0;
+  virtual auto RunIngestReplacingAllFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+      DateCheckMode date_check_mode) -> void = 0;
+  // 只重建内容哈希变化的月份；输入须为完整月份视图，无法增量时退回全量替换。
+  virtual auto RunIngestChangedMonthsFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+      DateCheckMode date_check_mode) -> void = 0;
   virtual auto RunRecordActivityAtomically(
       const tracer_core::core::dto::RecordActivityAtomicallyRequest& request)
       -> tracer_core::core::dto::RecordActivityAtomicallyResponse = 0;
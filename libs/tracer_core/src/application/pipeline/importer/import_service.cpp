@@ -4,6 +4,8 @@
 #include <chrono>
 #include <exception>
 #include <format>
+#include <string>
+#include <utility>
 
 #include "application/parser/memory_parser.hpp"
 #include "application/ports/pipeline/i_time_sheet_repository.hpp"
@@ -17,7 +19,9 @@ ImportService::ImportService(
 auto ImportService::ImportFromMemory(
     const std::map<std::string, std::vector<DailyLog>>& data_map,
     const std::optional<ReplaceMonthTarget>& replace_month_target,
-    const std::optional<ReplaceAllTarget>& replace_all_target) -> ImportStats {
+    const std::optional<ReplaceAllTarget>& replace_all_target,
+    const std::optional<ReplaceMonthsTarget>& replace_months_target)
+    -> ImportStats {
   ImportStats stats;
   for (const auto& [source_key, days] : data_map) {
     static_cast<void>(source_key);
@@ -31,7 +35,8 @@ auto ImportService::ImportFromMemory(
   stats.successful_files = stats.total_files;
 
   if (data_map.empty() && !replace_month_target.has_value() &&
-      !replace_all_target.has_value()) {
+      !replace_all_target.has_value() &&
+      !replace_months_target.has_value()) {
     return stats;
   }
 
@@ -67,6 +72,19 @@ auto ImportService::ImportFromMemory(
     if (replace_all_target.has_value()) {
       repository_.ReplaceAllData(all_data.days, all_data.records);
       stats.replaced_month = "ALL";
+    } else if (replace_months_target.has_value()) {
+      repository_.ReplaceMonthsData(replace_months_target->months,
+                                    all_data.days, all_data.records,
+                                    replace_months_target->sync_entries);
+      std::string replaced_months;
+      for (const auto& month : replace_months_target->months) {
+        if (!replaced_months.empty()) {
+          replaced_months += ",";
+        }
+        replaced_months +=
+            std::format("{:04d}-{:02d}", month.kYear, month.kMonth);
+      }
+      stats.replaced_month = std::move(replaced_months);
     } else if (replace_month_target.has_value()) {
       repository_.ReplaceMonthData(replace_month_target->kYear,
                                    replace_month_target->kMonth, all_data.days,
@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 
+#include "application/dto/pipeline_responses.hpp"
 #include "application/pipeline/importer/model/import_models.hpp"
 
 struct DailyLog;
@@ -16,6 +17,12 @@ class ITimeSheetRepository;
 
 struct ReplaceAllTarget {};
 
+// 多月份单事务替换：月份数据与其摄入同步行一起提交。
+struct ReplaceMonthsTarget {
+  std::vector<ReplaceMonthTarget> months;
+  std::vector<tracer_core::core::dto::IngestSyncStatusEntry> sync_entries;
+};
+
 class ImportService {
  public:
   explicit ImportService(
@@ -25,8 +32,9 @@ class ImportService {
       const std::map<std::string, std::vector<DailyLog>>& data_map,
       const std::optional<ReplaceMonthTarget>& replace_month_target =
           std::nullopt,
-      const std::optional<ReplaceAllTarget>& replace_all_target = std::nullopt)
-      -> ImportStats;
+      const std::optional<ReplaceAllTarget>& replace_all_target = std::nullopt,
+      const std::optional<ReplaceMonthsTarget>& replace_months_target =
+          std::nullopt) -> ImportStats;
 
  private:
   tracer_core::application::ports::ITimeSheetRepository& repository_;
@@ -71,16 +71,12 @@ auto PipelineOrchestrator::Run(const AppOptions& options)
   session.config.structure_validation_blocks_conversion =
       options.convert && kRunStructureValidation;
   session.config.save_processed_output = options.save_processed_output;
+  session.config.max_parallelism = options.max_parallelism;
   session.state.validation_issue_reporter = validation_issue_reporter_;
 
   tracer_core::application::runtime_bridge::LogInfo(
       "\n--- Pipeline Execution Started ---");
 
-  if (!InputCollectionStage::Execute(session, *ingest_input_provider_,
-                                     ".txt")) {
-    return std::nullopt;
-  }
-
   if (options.validate_structure || options.convert) {
     try {
       tracer_core::application::runtime_bridge::LogInfo(
@@ -96,6 +92,11 @@ auto PipelineOrchestrator::Run(const AppOptions& options)
     }
   }
 
+  if (!InputCollectionStage::Execute(session, *ingest_input_provider_,
+                                     ".txt")) {
+    return std::nullopt;
+  }
+
   if (kRunStructureValidation) {
     tracer_core::application::runtime_bridge::LogInfo(
         BuildStructureValidationStepLabel(
@@ -2,6 +2,7 @@
 #define APPLICATION_PIPELINE_PIPELINE_STAGES_H_
 
 #include <string>
+#include <vector>
 
 #include "application/pipeline/pipeline_types.hpp"
 
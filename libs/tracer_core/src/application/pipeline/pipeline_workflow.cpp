@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -78,8 +79,68 @@ namespace {
   return std::format("{0:04d}/{0:04d}-{1:02d}.txt", month.year, month.month);
 }
 
-[[nodiscard]] auto TryBuildIngestSyncEntry(const IngestInputModel& input,
-                                           const std::int64_t kIngestedAtMs)
+// 转换结果依赖的全部配置项的摘要；无序映射按键排序，字段带长度前缀，
+// 保证同一配置总得到同一指纹。
+[[nodiscard]] auto ConverterConfigFingerprint(const ConverterConfig& config)
+    -> std::string {
+  std::string text;
+  const auto kAppend = [&text](std::string_view value) -> void {
+    text += std::to_string(value.size());
+    text += ':';
+    text += value;
+  };
+  const auto kAppendList =
+      [&kAppend, &text](const std::vector<std::string>& values) -> void {
+    text += std::to_string(values.size()) + '#';
+    for (const auto& value : values) {
+      kAppend(value);
+    }
+  };
+  const auto kAppendMap =
+      [&kAppend, &text](
+          const std::unordered_map<std::string, std::string>& values) -> void {
+    const std::map<std::string, std::string> kSorted(values.begin(),
+                                                     values.end());
+    text += std::to_string(kSorted.size()) + '#';
+    for (const auto& [key, value] : kSorted) {
+      kAppend(key);
+      kAppend(value);
+    }
+  };
+
+  kAppend(config.remark_prefix);
+  kAppendList(config.header_order);
+  kAppendList(config.wake_keywords);
+  kAppend(config.generated_sleep_project_path);
+  text += std::to_string(config.project_class_rules.size()) + '#';
+  for (const auto& rule : config.project_class_rules) {
+    kAppend(rule.project_class);
+    kAppend(rule.match);
+    kAppend(rule.root);
+    kAppend(rule.token);
+  }
+  kAppendMap(config.top_parent_mapping);
+  kAppendMap(config.text_mapping);
+  kAppendMap(config.text_duration_mapping);
+  const std::map<std::string, std::vector<DurationMappingRule>>
+      kDurationMappings(config.duration_mappings.begin(),
+                        config.duration_mappings.end());
+  text += std::to_string(kDurationMappings.size()) + '#';
+  for (const auto& [key, rules] : kDurationMappings) {
+    kAppend(key);
+    text += std::to_string(rules.size()) + '#';
+    for (const auto& rule : rules) {
+      text += std::to_string(rule.less_than_minutes) + '<';
+      kAppend(rule.value);
+    }
+  }
+  kAppendMap(config.initial_top_parents);
+  return pipeline_detail::ComputeSha256Hex(text);
+}
+
+[[nodiscard]] auto TryBuildIngestSyncEntry(
+    const IngestInputModel& input, const std::int64_t kIngestedAtMs,
+    const std::string& converter_config_fingerprint)
     -> std::optional<IngestSyncStatusEntry> {
   const auto kCanonical = modtext::Canonicalize(
       input.content, input.source_label.empty() ? input.source_id
@@ -105,6 +166,7 @@ namespace {
       .txt_content_hash_sha256 = pipeline_detail::ComputeSha256Hex(
           kCanonical.text),
       .ingested_at_unix_ms = kIngestedAtMs,
+      .converter_config_fingerprint = converter_config_fingerprint,
   };
 }
 
@@ -113,9 +175,12 @@ namespace {
   std::map<std::string, IngestSyncStatusEntry> unique_entries;
   std::set<std::string> duplicate_months;
   const std::int64_t kIngestedAtMs = pipeline_detail::CurrentUnixMillis();
+  const std::string kConfigFingerprint =
+      ConverterConfigFingerprint(context.state.converter_config);
 
   for (const auto& input : context.state.ingest_inputs) {
-    const auto kEntry = TryBuildIngestSyncEntry(input, kIngestedAtMs);
+    const auto kEntry =
+        TryBuildIngestSyncEntry(input, kIngestedAtMs, kConfigFingerprint);
     if (!kEntry.has_value()) {
       continue;
     }
@@ -159,9 +224,9 @@ auto PersistSingleIngestSyncEntry(const PipelineSession& context,
         "Single TXT ingest sync snapshot requires exactly one input.");
   }
 
-  const auto kEntry =
-      TryBuildIngestSyncEntry(context.state.ingest_inputs.front(),
-                              pipeline_detail::CurrentUnixMillis());
+  const auto kEntry = TryBuildIngestSyncEntry(
+      context.state.ingest_inputs.front(), pipeline_detail::CurrentUnixMillis(),
+      ConverterConfigFingerprint(context.state.converter_config));
   if (!kEntry.has_value()) {
     throw std::runtime_error(
         "Single TXT ingest sync snapshot requires valid yYYYY + mMM headers.");
@@ -170,6 +235,8 @@ auto PersistSingleIngestSyncEntry(const PipelineSession& context,
   repository.UpsertIngestSyncStatus(*kEntry);
 }
 
+#include "application/pipeline/detail/pipeline_incremental_ingest_support_impl.inc"
+
 }  // namespace
 
 PipelineWorkflow::PipelineWorkflow(
@@ -210,25 +277,54 @@ auto PipelineWorkflow::RunConverter(const std::string& input_path,
 
 auto PipelineWorkflow::RunValidateStructure(const std::string& source_path)
     -> void {
+  RunValidateStructureWith(source_path, ingest_input_provider_);
+}
+
+auto PipelineWorkflow::RunValidateLogic(const std::string& source_path,
+                                        DateCheckMode date_check_mode) -> void {
+  RunValidateLogicWith(source_path, date_check_mode, ingest_input_provider_);
+}
+
+auto PipelineWorkflow::RunValidateStructureFromInputs(
+    const std::vector<IngestInputModel>& inputs) -> void {
+  RunValidateStructureWith(
+      std::string(kInMemoryInputLabel),
+      std::make_shared<PrecollectedIngestInputProvider>(inputs));
+}
+
+auto PipelineWorkflow::RunValidateLogicFromInputs(
+    const std::vector<IngestInputModel>& inputs, DateCheckMode date_check_mode)
+    -> void {
+  RunValidateLogicWith(
+      std::string(kInMemoryInputLabel), date_check_mode,
+      std::make_shared<PrecollectedIngestInputProvider>(inputs));
+}
+
+auto PipelineWorkflow::RunValidateStructureWith(
+    const std::string& source_path, IngestInputProviderPtr input_provider)
+    -> void {
   modports::ClearBufferedDiagnostics();
   const AppOptions kOptions = BuildStructureValidationOptions(source_path);
   const ScopedErrorReportWriterOverride kDisableErrorReports(nullptr);
 
   PipelineOrchestrator pipeline(output_root_path_, converter_config_provider_,
-                                ingest_input_provider_, processed_data_storage_,
+                                std::move(input_provider),
+                                processed_data_storage_,
                                 validation_issue_reporter_);
   RunPipelineOrThrow(pipeline, kOptions, "Validate structure pipeline failed.");
 }
 
-auto PipelineWorkflow::RunValidateLogic(const std::string& source_path,
-                                        DateCheckMode date_check_mode) -> void {
+auto PipelineWorkflow::RunValidateLogicWith(
+    const std::string& source_path, DateCheckMode date_check_mode,
+    IngestInputProviderPtr input_provider) -> void {
   modports::ClearBufferedDiagnostics();
   const AppOptions kOptions =
       BuildLogicValidationOptions(source_path, date_check_mode);
   const ScopedErrorReportWriterOverride kDisableErrorReports(nullptr);
 
   PipelineOrchestrator pipeline(output_root_path_, converter_config_provider_,
-                                ingest_input_provider_, processed_data_storage_,
+                                std::move(input_provider),
+                                processed_data_storage_,
                                 validation_issue_reporter_);
   RunPipelineOrThrow(pipeline, kOptions, "Validate logic pipeline failed.");
 }
@@ -244,7 +340,7 @@ auto PipelineWorkflow::RunRecordActivityAtomically(
       [this](const std::string& source_path,
              const DateCheckMode kDateCheckMode) -> void {
         RunIngest(source_path, kDateCheckMode, false,
-                  IngestMode::kSingleTxtReplaceMonth);
+                  IngestMode::kSingleTxtReplaceMonth, 0);
       });
 }
 
@@ -342,10 +438,21 @@ auto PipelineWorkflow::RunDatabaseImportFromMemoryReplacingMonth(
   ThrowIfImportTaskFailed(stats, "Memory import (replace month) failed.");
 }
 
+auto PipelineWorkflow::RunDatabaseImportFromMemoryReplacingMonths(
+    const std::map<std::string, std::vector<DailyLog>>& data_map,
+    const ReplaceMonthsTarget& target) -> void {
+  runtime_bridge::LogInfo("Task: Memory Import (Replace Months)...");
+  ImportService service(*time_sheet_repository_);
+  ImportStats stats = service.ImportFromMemory(data_map, std::nullopt,
+                                               std::nullopt, target);
+  PrintImportStats(stats, "Memory Import (Replace Months)");
+  ThrowIfImportTaskFailed(stats, "Memory import (replace months) failed.");
+}
+
 auto PipelineWorkflow::RunIngest(const std::string& source_path,
                                  DateCheckMode date_check_mode,
-                                 bool save_processed, IngestMode ingest_mode)
-    -> void {
+                                 bool save_processed, IngestMode ingest_mode,
+                                 std::size_t max_parallelism) -> void {
   runtime_bridge::LogInfo("\n--- 启动数据摄入 (Ingest) ---");
   modports::ClearBufferedDiagnostics();
 
@@ -356,12 +463,25 @@ auto PipelineWorkflow::RunIngest(const std::string& source_path,
                                  : kDbCheck.message);
   }
 
+  AppOptions full_options =
+      BuildIngestOptions(source_path, date_check_mode, save_processed);
+  full_options.max_parallelism = max_parallelism;
+  if (ingest_mode == IngestMode::kIncremental) {
+    RunIncrementalIngest(full_options);
+    return;
+  }
+  RunIngestWith(full_options, ingest_mode, ingest_input_provider_);
+}
+
+auto PipelineWorkflow::RunIngestWith(const AppOptions& ingest_options,
+                                     IngestMode ingest_mode,
+                                     IngestInputProviderPtr input_provider)
+    -> void {
   PipelineOrchestrator pipeline(output_root_path_, converter_config_provider_,
-                                ingest_input_provider_, processed_data_storage_,
+                                std::move(input_provider),
+                                processed_data_storage_,
                                 validation_issue_reporter_);
-  const AppOptions kFullOptions =
-      BuildIngestOptions(source_path, date_check_mode, save_processed);
-  auto result_context_opt = pipeline.Run(kFullOptions);
+  auto result_context_opt = pipeline.Run(ingest_options);
 
   if (!result_context_opt) {
     runtime_bridge::LogError("\n=== Ingest 执行失败 ===");
@@ -423,6 +543,148 @@ auto PipelineWorkflow::RunIngest(const std::string& source_path,
   }
 }
 
+auto PipelineWorkflow::RunIncrementalIngest(const AppOptions& ingest_options)
+    -> void {
+  const std::string kSourcePath = ingest_options.input_path.string();
+  auto collection =
+      ingest_input_provider_->CollectTextInputs(kSourcePath, ".txt");
+  if (collection.input_exists && !collection.inputs.empty() &&
+      TryRunIncrementalIngestWith(ingest_options, collection.inputs, false)) {
+    return;
+  }
+  runtime_bridge::LogWarn(
+      "[Incremental] Falling back to standard ingest for: " + kSourcePath);
+  // 回退时直接复用已读入的输入，不再重新扫描目录；输入路径不存在时仍交给
+  // 原 provider，保持标准摄入的错误信息。
+  IngestInputProviderPtr fallback_provider = ingest_input_provider_;
+  if (collection.input_exists) {
+    fallback_provider = std::make_shared<PrecollectedIngestInputProvider>(
+        std::move(collection.inputs));
+  }
+  RunIngestWith(ingest_options, IngestMode::kStandard,
+                std::move(fallback_provider));
+}
+
+auto PipelineWorkflow::RunIngestChangedMonthsFromInputs(
+    std::vector<IngestInputModel> inputs, DateCheckMode date_check_mode)
+    -> void {
+  runtime_bridge::LogInfo("\n--- 启动数据摄入 (Changed Months) ---");
+  modports::ClearBufferedDiagnostics();
+
+  const auto kDbCheck = database_health_checker_->CheckReady();
+  if (!kDbCheck.ok) {
+    throw std::runtime_error(kDbCheck.message.empty()
+                                 ? "Database readiness check failed."
+                                 : kDbCheck.message);
+  }
+
+  const std::string kSourcePath(kInMemoryInputLabel);
+  if (!inputs.empty() &&
+      TryRunIncrementalIngestWith(
+          BuildIngestOptions(kSourcePath, date_check_mode, false), inputs,
+          true)) {
+    return;
+  }
+  runtime_bridge::LogWarn(
+      "[Incremental] Falling back to replace-all ingest for: " + kSourcePath);
+  RunIngestReplacingAllWith(
+      kSourcePath, date_check_mode, false,
+      std::make_shared<PrecollectedIngestInputProvider>(std::move(inputs)));
+}
+
+auto PipelineWorkflow::TryRunIncrementalIngestWith(
+    const AppOptions& ingest_options, std::vector<IngestInputModel>& inputs,
+    bool inputs_are_complete_view) -> bool {
+  const auto kStoredStatuses =
+      time_sheet_repository_->ListIngestSyncStatuses({});
+  if (!kStoredStatuses.ok) {
+    return false;
+  }
+  const auto kPlan = TryBuildIncrementalIngestPlan(
+      inputs, kStoredStatuses.items,
+      ConverterConfigFingerprint(
+          converter_config_provider_->LoadConverterConfig()));
+  if (!kPlan.has_value()) {
+    return false;
+  }
+  // 完整视图下没有任何未变月份时，按月替换不比全量替换省事，且全量替换还能
+  // 清理缺少同步记录的历史行。
+  if (inputs_are_complete_view &&
+      (kPlan->unchanged_month_count == 0U ||
+       !CoversStoredMonths(*kPlan, kStoredStatuses.items))) {
+    return false;
+  }
+
+  runtime_bridge::LogInfo(std::format(
+      "[Incremental] months: {} changed, {} boundary, {} unchanged.",
+      kPlan->changed_month_count, kPlan->boundary_month_count,
+      kPlan->unchanged_month_count));
+  if (kPlan->runs.empty()) {
+    runtime_bridge::LogInfo("\n=== Ingest 完成：所有月份均已是最新 ===");
+    return true;
+  }
+
+  std::map<std::string, std::vector<DailyLog>> affected_data;
+  ReplaceMonthsTarget replace_target;
+  for (const auto& run : kPlan->runs) {
+    // 每段连续月份单独跑一次流水线，LogLinker 只会连接日历上相邻的月份。
+    // 各段之间隔着未变月份，因此段首读取的库内尾部记录不受本次写入影响。
+    std::vector<IngestInputModel> run_inputs;
+    run_inputs.reserve(run.months.size());
+    for (const auto& month : run.months) {
+      run_inputs.push_back(std::move(inputs[month.input_index]));
+    }
+
+    PipelineOrchestrator pipeline(
+        output_root_path_, converter_config_provider_,
+        std::make_shared<PrecollectedIngestInputProvider>(
+            std::move(run_inputs)),
+        processed_data_storage_, validation_issue_reporter_);
+    auto result_context_opt = pipeline.Run(ingest_options);
+    if (!result_context_opt) {
+      runtime_bridge::LogError("\n=== Incremental ingest 执行失败 ===");
+      throw std::runtime_error(
+          BuildPipelineFailureMessage("Incremental ingestion process failed."));
+    }
+
+    auto& context = *result_context_opt;
+    const auto& kRunHead = run.months.front().target_month;
+    const auto kPreviousTail = ResolvePreviousTailForReplaceMonth(
+        context, kRunHead, context.result.processed_data,
+        *time_sheet_repository_);
+    if (kPreviousTail.has_value()) {
+      LogLinker linker(context.state.converter_config);
+      linker.LinkFirstDayWithExternalPreviousEvent(
+          context.result.processed_data,
+          LogLinker::ExternalPreviousEvent{
+              .date = kPreviousTail->date,
+              .end_time = kPreviousTail->end_time,
+          });
+    }
+
+    for (const auto& month : run.months) {
+      auto month_data = ExtractMonthProcessedData(
+          context.result.processed_data, month.target_month.month_key);
+      if (!IsSingleMonthConsistent(month_data, month.target_month.month_key)) {
+        throw std::runtime_error(
+            "Incremental ingest failed: parsed days are not consistent with "
+            "header month " +
+            month.target_month.month_key + ".");
+      }
+      affected_data.merge(month_data);
+      replace_target.months.push_back(
+          ReplaceMonthTarget{.kYear = month.target_month.year,
+                             .kMonth = month.target_month.month});
+      replace_target.sync_entries.push_back(month.sync_entry);
+    }
+  }
+
+  // 所有受影响月份与其同步行在同一事务内提交，失败时库内保持原状。
+  RunDatabaseImportFromMemoryReplacingMonths(affected_data, replace_target);
+  runtime_bridge::LogInfo("\n=== Ingest 执行成功（增量）===");
+  return true;
+}
+
 auto PipelineWorkflow::RunIngestSyncStatusQuery(
     const IngestSyncStatusRequest& request) -> IngestSyncStatusOutput {
   return time_sheet_repository_->ListIngestSyncStatuses(request);
@@ -435,6 +697,21 @@ auto PipelineWorkflow::ClearIngestSyncStatus() -> void {
 auto PipelineWorkflow::RunIngestReplacingAll(const std::string& source_path,
                                              DateCheckMode date_check_mode,
                                              bool save_processed) -> void {
+  RunIngestReplacingAllWith(source_path, date_check_mode, save_processed,
+                            ingest_input_provider_);
+}
+
+auto PipelineWorkflow::RunIngestReplacingAllFromInputs(
+    std::vector<IngestInputModel> inputs, DateCheckMode date_check_mode)
+    -> void {
+  RunIngestReplacingAllWith(
+      std::string(kInMemoryInputLabel), date_check_mode, false,
+      std::make_shared<PrecollectedIngestInputProvider>(std::move(inputs)));
+}
+
+auto PipelineWorkflow::RunIngestReplacingAllWith(
+    const std::string& source_path, DateCheckMode date_check_mode,
+    bool save_processed, IngestInputProviderPtr input_provider) -> void {
   runtime_bridge::LogInfo("\n--- 启动数据摄入 (Replace All) ---");
   modports::ClearBufferedDiagnostics();
 
@@ -446,7 +723,8 @@ auto PipelineWorkflow::RunIngestReplacingAll(const std::string& source_path,
   }
 
   PipelineOrchestrator pipeline(output_root_path_, converter_config_provider_,
-                                ingest_input_provider_, processed_data_storage_,
+                                std::move(input_provider),
+                                processed_data_storage_,
                                 validation_issue_reporter_);
   const AppOptions kFullOptions =
       BuildIngestOptions(source_path, date_check_mode, save_processed);
@@ -1,6 +1,7 @@
 #ifndef APPLICATION_PIPELINE_PIPELINE_WORKFLOW_HPP_
 #define APPLICATION_PIPELINE_PIPELINE_WORKFLOW_HPP_
 
+#include <cstddef>
 #include <filesystem>
 #include <map>
 #include <memory>
@@ -16,6 +17,8 @@
 #include "application/ports/pipeline/i_time_sheet_repository.hpp"
 #include "application/ports/pipeline/i_validation_issue_reporter.hpp"
 
+struct ReplaceMonthsTarget;
+
 namespace tracer::core::application::pipeline {
 
 class PipelineWorkflow final : public IPipelineWorkflow {
@@ -53,8 +56,8 @@ class PipelineWorkflow final : public IPipelineWorkflow {
       const std::map<std::string, std::vector<DailyLog>>& data_map)
       -> void override;
   auto RunIngest(const std::string& source_path, DateCheckMode date_check_mode,
-                 bool save_processed, IngestMode ingest_mode)
-      -> void override;
+                 bool save_processed, IngestMode ingest_mode,
+                 std::size_t max_parallelism) -> void override;
   auto RunIngestSyncStatusQuery(
       const tracer_core::core::dto::IngestSyncStatusRequest& request)
       -> tracer_core::core::dto::IngestSyncStatusOutput override;
@@ -65,6 +68,19 @@ class PipelineWorkflow final : public IPipelineWorkflow {
   auto RunValidateStructure(const std::string& source_path) -> void override;
   auto RunValidateLogic(const std::string& source_path,
                         DateCheckMode date_check_mode) -> void override;
+  auto RunValidateStructureFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&
+          inputs) -> void override;
+  auto RunValidateLogicFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&
+          inputs,
+      DateCheckMode date_check_mode) -> void override;
+  auto RunIngestReplacingAllFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+      DateCheckMode date_check_mode) -> void override;
+  auto RunIngestChangedMonthsFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+      DateCheckMode date_check_mode) -> void override;
   auto RunRecordActivityAtomically(
       const tracer_core::core::dto::RecordActivityAtomicallyRequest& request)
       -> tracer_core::core::dto::RecordActivityAtomicallyResponse override;
@@ -93,8 +109,32 @@ class PipelineWorkflow final : public IPipelineWorkflow {
   auto RunDatabaseImportFromMemoryReplacingMonth(
       const std::map<std::string, std::vector<DailyLog>>& data_map, int year,
       int month) -> void;
+  auto RunDatabaseImportFromMemoryReplacingMonths(
+      const std::map<std::string, std::vector<DailyLog>>& data_map,
+      const ReplaceMonthsTarget& target) -> void;
   auto RunDatabaseImportFromMemoryReplacingAll(
       const std::map<std::string, std::vector<DailyLog>>& data_map) -> void;
+  // 标准摄入与单月替换共用的主体；input_provider 可以是已收集好的输入。
+  auto RunIngestWith(const AppOptions& ingest_options, IngestMode ingest_mode,
+                     IngestInputProviderPtr input_provider) -> void;
+  auto RunIncrementalIngest(const AppOptions& ingest_options) -> void;
+  // 返回 false 表示输入无法按月增量处理，由调用方决定回退方式；
+  // 此时 inputs 保持原样。
+  auto TryRunIncrementalIngestWith(
+      const AppOptions& ingest_options,
+      std::vector<tracer_core::application::dto::IngestInputModel>& inputs,
+      bool inputs_are_complete_view) -> bool;
+  auto RunValidateStructureWith(const std::string& source_path,
+                                IngestInputProviderPtr input_provider)
+      -> void;
+  auto RunValidateLogicWith(const std::string& source_path,
+                            DateCheckMode date_check_mode,
+                            IngestInputProviderPtr input_provider) -> void;
+  auto RunIngestReplacingAllWith(const std::string& source_path,
+                                 DateCheckMode date_check_mode,
+                                 bool save_processed,
+                                 IngestInputProviderPtr input_provider)
+      -> void;
 };
 
 }  // namespace tracer::core::application::pipeline
@@ -6,10 +6,13 @@ module;
 #include <iterator>
 #include <sstream>
 #include <string>
-#include <thread>
+#include <utility>
 #include <vector>
 
+#include "application/dto/ingest_input_model.hpp"
 #include "application/runtime_bridge/logger.hpp"
+#include "domain/logic/lexer/txt_line_lexer.hpp"
+#include "shared/utils/work_stealing_executor.hpp"
 
 module tracer.core.application.pipeline.stages;
 
@@ -26,6 +29,27 @@ constexpr double kMillisPerSecond = 1000.0;
 
 }  // namespace
 
+auto ConversionStage::ConvertInput(
+    const PipelineSession& session,
+    const tracer_core::application::dto::IngestInputModel& input,
+    const std::vector<txt_lexer::TxtLineToken>* tokens) -> ConvertedInput {
+  try {
+    LogProcessor processor(session.state.converter_config);
+    LogProcessingResult result =
+        tokens != nullptr
+            ? processor.ProcessSourceTokens(input.source_id, *tokens)
+            : processor.ProcessSourceContent(input.source_id, input.content);
+    return {.success = result.success,
+            .processed_data = std::move(result.processed_data)};
+  } catch (const std::exception& e) {
+    const std::string kSourceLabel =
+        input.source_label.empty() ? input.source_id : input.source_label;
+    tracer_core::application::runtime_bridge::LogError(
+        "Thread Error [" + kSourceLabel + "]: " + e.what());
+    return {.success = false, .processed_data = {}};
+  }
+}
+
 auto ConversionStage::Execute(PipelineSession& session) -> bool {
   if (session.config.structure_validation_blocks_conversion) {
     tracer_core::application::runtime_bridge::LogInfo(
@@ -37,46 +61,35 @@ auto ConversionStage::Execute(PipelineSession& session) -> bool {
   const auto kStartTime = std::chrono::steady_clock::now();
 
   const auto& inputs = session.state.ingest_inputs;
-  std::vector<LogProcessingResult> results(inputs.size());
-  std::vector<std::exception_ptr> thread_errors(inputs.size());
-  std::vector<std::thread> workers;
-  workers.reserve(inputs.size());
-
-  for (size_t index = 0; index < inputs.size(); ++index) {
-    workers.emplace_back([&session, &results, &thread_errors, index,
-                          input = inputs[index]]() -> void {
-      try {
-        LogProcessor processor(session.state.converter_config);
-        results[index] =
-            processor.ProcessSourceContent(input.source_id, input.content);
-      } catch (const std::exception& e) {
-        const std::string kSourceLabel =
-            input.source_label.empty() ? input.source_id : input.source_label;
-        tracer_core::application::runtime_bridge::LogError(
-            "Thread Error [" + kSourceLabel + "]: " + e.what());
-        results[index] = LogProcessingResult{
-            .success = false,
-            .processed_data = {},
-        };
-      } catch (...) {
-        thread_errors[index] = std::current_exception();
-      }
-    });
-  }
-
-  for (auto& worker : workers) {
-    worker.join();
-  }
+  auto& converted = session.state.converted_inputs;
+  converted.resize(inputs.size());
+
+  // 结构校验阶段已转换的输入直接归并；其余输入按文件粒度提交到会话共享的
+  // 有界执行器，在各自任务内词法化并转换。结果按输入下标写回，随后按输入
+  // 顺序归并，输出与串行执行一致。
+  std::vector<std::exception_ptr> task_errors(inputs.size());
+  session.TaskExecutor().ParallelFor(
+      inputs.size(),
+      [&session, &inputs, &converted, &task_errors](size_t index) -> void {
+        if (converted[index].has_value()) {
+          return;
+        }
+        try {
+          converted[index] = ConvertInput(session, inputs[index], nullptr);
+        } catch (...) {
+          task_errors[index] = std::current_exception();
+        }
+      });
 
   bool all_success = true;
   int processed_count = 0;
 
-  for (size_t index = 0; index < results.size(); ++index) {
-    if (thread_errors[index]) {
-      std::rethrow_exception(thread_errors[index]);
+  for (size_t index = 0; index < converted.size(); ++index) {
+    if (task_errors[index]) {
+      std::rethrow_exception(task_errors[index]);
     }
 
-    auto& result = results[index];
+    auto& result = *converted[index];
     ++processed_count;
 
     if (!result.success) {
@@ -91,6 +104,7 @@ auto ConversionStage::Execute(PipelineSession& session) -> bool {
                          std::make_move_iterator(month_days.end()));
     }
   }
+  converted.clear();
 
   const auto kEndTime = std::chrono::steady_clock::now();
   const double kDuration =
@@ -1,6 +1,8 @@
 module;
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "application/ports/pipeline/i_ingest_input_provider.hpp"
 #include "application/runtime_bridge/logger.hpp"
@@ -8,33 +10,39 @@ module;
 module tracer.core.application.pipeline.stages;
 
 import tracer.core.application.pipeline.types;
+
 namespace tracer::core::application::pipeline {
 
 auto InputCollectionStage::Execute(
     PipelineSession& session,
     const tracer_core::application::ports::IIngestInputProvider& input_provider,
     const std::string& extension) -> bool {
-  session.state.ingest_inputs.clear();
+  auto& inputs = session.state.ingest_inputs;
+  inputs.clear();
+  session.state.converted_inputs.clear();
   session.state.generated_files.clear();
 
-  const auto kInputCollection =
+  auto collection =
       input_provider.CollectTextInputs(session.config.input_root, extension);
 
-  if (!kInputCollection.input_exists) {
+  if (!collection.input_exists) {
     tracer_core::application::runtime_bridge::LogError(
         "错误: 输入的路径不存在: " + session.config.input_root.string());
     return false;
   }
 
-  if (kInputCollection.inputs.empty()) {
+  if (collection.inputs.empty()) {
     tracer_core::application::runtime_bridge::LogWarn(
         "警告: 在指定路径下没有找到 " + extension + " 文件。");
     return false;
   }
 
-  session.state.ingest_inputs = kInputCollection.inputs;
+  // 逐个移入会话，不复制文件内容。
+  for (auto& input : collection.inputs) {
+    inputs.push_back(std::move(input));
+  }
   tracer_core::application::runtime_bridge::LogInfo(
-      "信息: 成功收集到 " + std::to_string(session.state.ingest_inputs.size()) +
+      "信息: 成功收集到 " + std::to_string(inputs.size()) +
       " 个待处理文件 (" + extension + ").");
   return true;
 }
@@ -1,45 +1,83 @@
 module;
 
+#include <optional>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "application/ports/pipeline/i_validation_issue_reporter.hpp"
 #include "application/runtime_bridge/logger.hpp"
+#include "shared/utils/work_stealing_executor.hpp"
 
 module tracer.core.application.pipeline.stages;
 
 import tracer.core.application.pipeline.types;
+import tracer.core.domain.logic.lexer;
 import tracer.core.domain.logic.validator.common.validator_utils;
 import tracer.core.domain.logic.validator.txt.facade;
 
+using tracer::core::domain::modlogic::lexer::TxtLineLexer;
+using tracer::core::domain::modlogic::lexer::TxtLineToken;
 using tracer::core::domain::modlogic::validator_common::Error;
 using tracer::core::domain::modlogic::validator_txt::TextValidator;
 
 namespace tracer::core::application::pipeline {
 
 auto StructureValidationStage::Execute(PipelineSession& session) -> bool {
-  TextValidator validator(session.state.converter_config);
+  const auto& inputs = session.state.ingest_inputs;
+  std::vector<std::set<Error>> file_errors(inputs.size());
+  std::vector<char> file_valid(inputs.size(), 1);
+  // 校验通过后紧接着转换时，在同一任务里把刚产出的 token 交给转换，
+  // token 随任务结束释放，不会在阶段之间为所有文件常驻。
+  const bool kConvertValidInputs =
+      session.config.structure_validation_blocks_conversion;
+  auto& converted = session.state.converted_inputs;
+  converted.assign(inputs.size(), std::nullopt);
+
+  // TextValidator 持有逐文件的结构状态，因此每个任务使用独立实例；
+  // 错误按输入顺序上报，保证多线程下输出稳定。
+  session.TaskExecutor().ParallelFor(
+      inputs.size(), [&session, &inputs, &file_errors, &file_valid, &converted,
+                      kConvertValidInputs](size_t index) -> void {
+        const auto& input = inputs[index];
+        const std::string kSourcePath =
+            input.source_id.empty() ? input.source_label : input.source_id;
+        const TxtLineLexer kLexer(session.state.converter_config.remark_prefix);
+        const std::vector<TxtLineToken> kTokens =
+            kLexer.Tokenize(input.content);
+        TextValidator validator(session.state.converter_config);
+        file_valid[index] =
+            validator.Validate(kSourcePath, kTokens, file_errors[index]) ? 1
+                                                                         : 0;
+        if (kConvertValidInputs && file_valid[index] != 0) {
+          converted[index] =
+              ConversionStage::ConvertInput(session, input, &kTokens);
+        }
+      });
 
   bool all_valid = true;
-  int files_checked = 0;
+  const int files_checked = static_cast<int>(inputs.size());
 
-  for (const auto& input : session.state.ingest_inputs) {
-    ++files_checked;
+  for (size_t index = 0; index < inputs.size(); ++index) {
+    if (file_valid[index] != 0) {
+      continue;
+    }
+    all_valid = false;
+    const auto& input = inputs[index];
     const std::string kSourcePath =
         input.source_id.empty() ? input.source_label : input.source_id;
     const std::string kDisplayLabel =
         input.source_label.empty() ? kSourcePath : input.source_label;
-
-    std::set<Error> errors;
-    if (!validator.Validate(kSourcePath, input.content, errors)) {
-      all_valid = false;
-      if (session.state.validation_issue_reporter != nullptr) {
-        session.state.validation_issue_reporter->ReportStructureErrors(
-            kDisplayLabel, errors);
-      }
+    if (session.state.validation_issue_reporter != nullptr) {
+      session.state.validation_issue_reporter->ReportStructureErrors(
+          kDisplayLabel, file_errors[index]);
     }
   }
 
+  if (!all_valid) {
+    converted.clear();
+  }
+
   if (all_valid) {
     if (session.config.structure_validation_blocks_conversion) {
       tracer_core::application::runtime_bridge::LogInfo(
@@ -32,6 +32,13 @@ class ITimeSheetRepository {
                                 const std::vector<DayData>& days,
                                 const std::vector<TimeRecordInternal>& records)
       -> void = 0;
+  // 在一个事务内替换多个月份，并写入这些月份的摄入同步行。
+  virtual auto ReplaceMonthsData(
+      const std::vector<ReplaceMonthTarget>& months,
+      const std::vector<DayData>& days,
+      const std::vector<TimeRecordInternal>& records,
+      const std::vector<tracer_core::core::dto::IngestSyncStatusEntry>&
+          sync_entries) -> void = 0;
   virtual auto UpsertIngestSyncStatus(
       const tracer_core::core::dto::IngestSyncStatusEntry& entry) -> void = 0;
   virtual auto ReplaceIngestSyncStatuses(
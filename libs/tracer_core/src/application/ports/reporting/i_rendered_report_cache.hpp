@@ -0,0 +1,43 @@
+// application/ports/reporting/i_rendered_report_cache.hpp
+#ifndef APPLICATION_PORTS_I_RENDERED_REPORT_CACHE_H_
+#define APPLICATION_PORTS_I_RENDERED_REPORT_CACHE_H_
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "domain/reports/types/report_types.hpp"
+
+namespace tracer_core::application::ports {
+
+// 一份已渲染报表的定位信息：报表种类（day/week/month/year）、
+// 报表实际覆盖的闭区间日期（YYYY-MM-DD）与输出格式。
+struct RenderedReportRequest {
+  std::string kind;
+  std::string first_date;
+  std::string last_date;
+  ReportFormat format = ReportFormat::kMarkdown;
+};
+
+struct RenderedReportLookup {
+  // 完整缓存键（含数据代次与配置指纹）；为空表示本次不可缓存。
+  std::string entry_key;
+  // 命中时为缓存的报表正文。
+  std::optional<std::string> content;
+};
+
+// 已渲染报表缓存。实现需允许多个线程同时调用；缓存出错时按未命中
+// 处理，不得向调用方抛出异常。
+class IRenderedReportCache {
+ public:
+  virtual ~IRenderedReportCache() = default;
+
+  virtual auto Lookup(const RenderedReportRequest& request)
+      -> RenderedReportLookup = 0;
+  virtual auto Store(const std::string& entry_key, std::string_view content)
+      -> void = 0;
+};
+
+}  // namespace tracer_core::application::ports
+
+#endif  // APPLICATION_PORTS_I_RENDERED_REPORT_CACHE_H_
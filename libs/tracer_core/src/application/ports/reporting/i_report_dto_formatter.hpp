@@ -10,6 +10,7 @@
 
 namespace tracer_core::application::ports {
 
+// 实现需允许多个线程同时调用（all_matching 导出会并行格式化）。
 class IReportDtoFormatter {
  public:
   virtual ~IReportDtoFormatter() = default;
@@ -24,6 +25,34 @@ class IReportDtoFormatter {
       -> std::string = 0;
   virtual auto FormatYearly(const YearlyReportData& report, ReportFormat format)
       -> std::string = 0;
+
+  // 以下变体把报告追加到调用方持有的缓冲区末尾，内容与对应的 Format*
+  // 相同；批量导出借此复用缓冲区。默认实现转调 Format*。
+  virtual auto FormatDailyTo(const DailyReportData& report,
+                             ReportFormat format, std::string& output)
+      -> void {
+    output += FormatDaily(report, format);
+  }
+  virtual auto FormatMonthlyTo(const MonthlyReportData& report,
+                               ReportFormat format, std::string& output)
+      -> void {
+    output += FormatMonthly(report, format);
+  }
+  virtual auto FormatPeriodTo(const PeriodReportData& report,
+                              ReportFormat format, std::string& output)
+      -> void {
+    output += FormatPeriod(report, format);
+  }
+  virtual auto FormatWeeklyTo(const WeeklyReportData& report,
+                              ReportFormat format, std::string& output)
+      -> void {
+    output += FormatWeekly(report, format);
+  }
+  virtual auto FormatYearlyTo(const YearlyReportData& report,
+                              ReportFormat format, std::string& output)
+      -> void {
+    output += FormatYearly(report, format);
+  }
 };
 
 }  // namespace tracer_core::application::ports
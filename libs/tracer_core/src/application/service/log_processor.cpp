@@ -1,12 +1,13 @@
 // application/service/log_processor.cpp
 #include <functional>
 #include <istream>
-#include <sstream>
+#include <span>
 #include <string>
 #include <string_view>
 
 import tracer.core.application.pipeline.converter.service;
 import tracer.core.domain.logic.converter.log_processor;
+import tracer.core.domain.logic.lexer;
 import tracer.core.domain.model.daily_log;
 import tracer.core.domain.ports.diagnostics;
 import tracer.core.domain.types.converter_config;
@@ -14,6 +15,7 @@ import tracer.core.domain.types.converter_config;
 using tracer::core::application::modservice::ConverterService;
 using tracer::core::domain::modlogic::converter::LogProcessingResult;
 using tracer::core::domain::modlogic::converter::LogProcessor;
+using tracer::core::domain::modlogic::lexer::TxtLineToken;
 using tracer::core::domain::modmodel::DailyLog;
 using tracer::core::domain::modtypes::ConverterConfig;
 
@@ -29,17 +31,18 @@ void LogProcessor::ConvertStreamToData(
   processor.ExecuteConversion(combined_stream, data_consumer, source_file);
 }
 
-// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
-auto LogProcessor::ProcessSourceContent(const std::string& filename,
-                                        const std::string& content)
-    -> LogProcessingResult {
+namespace {
+
+template <typename Input>
+auto RunConversion(const ConverterConfig& config, const std::string& filename,
+                   const Input& input) -> LogProcessingResult {
   LogProcessingResult result;
   result.success = true;
 
   try {
-    std::stringstream string_stream(content);
-    ConvertStreamToData(
-        string_stream,
+    ConverterService processor(config);
+    processor.ExecuteConversion(
+        input,
         [&](DailyLog&& log) -> void {
           constexpr size_t kYearMonthLen = 7;
           std::string key = log.date.substr(0, kYearMonthLen);  // YYYY-MM
@@ -55,3 +58,19 @@ auto LogProcessor::ProcessSourceContent(const std::string& filename,
 
   return result;
 }
+
+}  // namespace
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+auto LogProcessor::ProcessSourceContent(const std::string& filename,
+                                        const std::string& content)
+    -> LogProcessingResult {
+  // 直接在输入缓冲区上解析，避免再复制一份 stringstream。
+  return RunConversion(config_, filename, std::string_view(content));
+}
+
+auto LogProcessor::ProcessSourceTokens(
+    const std::string& filename,
+    std::span<const TxtLineToken> tokens) -> LogProcessingResult {
+  return RunConversion(config_, filename, tokens);
+}
@@ -40,6 +40,7 @@ auto PipelineApi::RunConvert(const ConvertRequest& request) -> OperationAck {
     options.run_structure_validation_before_conversion = request.validate_logic;
     options.date_check_mode = request.date_check_mode;
     options.save_processed_output = request.save_processed_output;
+    options.max_parallelism = request.max_parallelism;
 
     pipeline_workflow_.RunConverter(request.input_path, options);
     return {.ok = true, .error_message = ""};
@@ -54,7 +55,7 @@ auto PipelineApi::RunIngest(const IngestRequest& request) -> OperationAck {
   try {
     pipeline_workflow_.RunIngest(request.input_path, request.date_check_mode,
                                  request.save_processed_output,
-                                 request.ingest_mode);
+                                 request.ingest_mode, request.max_parallelism);
     return {.ok = true, .error_message = ""};
   } catch (const std::exception& exception) {
     return core_api_failure::BuildOperationFailure("RunIngest", exception);
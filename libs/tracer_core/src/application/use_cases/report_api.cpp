@@ -1,9 +1,12 @@
 #include "application/use_cases/report_api.hpp"
 
 #include <chrono>
+#include <cstddef>
 #include <exception>
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -12,16 +15,20 @@
 
 #include "application/use_cases/core_api_failure.hpp"
 #include "application/use_cases/report_api_support.hpp"
+#include "application/use_cases/report_batch_export.hpp"
 #include "domain/utils/time_utils.hpp"
 #include "shared/types/reporting_errors.hpp"
 #include "shared/utils/period_utils.hpp"
 
 namespace tracer::core::application::use_cases {
 
+using tracer_core::application::ports::RenderedReportLookup;
+using tracer_core::application::ports::RenderedReportRequest;
 using tracer_core::core::dto::OperationAck;
 using tracer_core::core::dto::PeriodBatchQueryRequest;
 using tracer_core::core::dto::ReportDisplayMode;
 using tracer_core::core::dto::ReportExportScope;
+using tracer_core::core::dto::TemporalReportDto;
 using tracer_core::core::dto::StructuredPeriodBatchItem;
 using tracer_core::core::dto::StructuredPeriodBatchOutput;
 using tracer_core::core::dto::StructuredPeriodBatchQueryRequest;
@@ -156,10 +163,11 @@ auto ToPeriodReport(const RangeReportData& source) -> PeriodReportData {
   return out;
 }
 
-auto FormatTemporalStructuredReport(
+// 把报告追加到 content 末尾；成功时返回的 TextOutput 不带内容。
+auto FormatTemporalStructuredReportTo(
     const TemporalStructuredReportOutput& output, ReportFormat format,
-    tracer_core::application::ports::IReportDtoFormatter& formatter)
-    -> TextOutput {
+    tracer_core::application::ports::IReportDtoFormatter& formatter,
+    std::string& content) -> TextOutput {
   switch (output.display_mode) {
     case ReportDisplayMode::kDay: {
       const auto* report = std::get_if<DailyReportData>(&output.report);
@@ -168,9 +176,8 @@ auto FormatTemporalStructuredReport(
             "RunTemporalReportQuery",
             "Temporal structured report kind/data mismatch: day.");
       }
-      return {.ok = true,
-              .content = formatter.FormatDaily(*report, format),
-              .error_message = ""};
+      formatter.FormatDailyTo(*report, format, content);
+      return {.ok = true, .content = "", .error_message = ""};
     }
     case ReportDisplayMode::kMonth: {
       const auto* report = std::get_if<PeriodReportData>(&output.report);
@@ -179,10 +186,8 @@ auto FormatTemporalStructuredReport(
             "RunTemporalReportQuery",
             "Temporal structured report kind/data mismatch: month.");
       }
-      return {.ok = true,
-              .content = formatter.FormatMonthly(WrapMonthlyReport(*report),
-                                                 format),
-              .error_message = ""};
+      formatter.FormatMonthlyTo(WrapMonthlyReport(*report), format, content);
+      return {.ok = true, .content = "", .error_message = ""};
     }
     case ReportDisplayMode::kWeek: {
       const auto* report = std::get_if<PeriodReportData>(&output.report);
@@ -191,10 +196,8 @@ auto FormatTemporalStructuredReport(
             "RunTemporalReportQuery",
             "Temporal structured report kind/data mismatch: week.");
       }
-      return {.ok = true,
-              .content = formatter.FormatWeekly(WrapWeeklyReport(*report),
-                                                format),
-              .error_message = ""};
+      formatter.FormatWeeklyTo(WrapWeeklyReport(*report), format, content);
+      return {.ok = true, .content = "", .error_message = ""};
     }
     case ReportDisplayMode::kYear: {
       const auto* report = std::get_if<PeriodReportData>(&output.report);
@@ -203,10 +206,8 @@ auto FormatTemporalStructuredReport(
             "RunTemporalReportQuery",
             "Temporal structured report kind/data mismatch: year.");
       }
-      return {.ok = true,
-              .content = formatter.FormatYearly(WrapYearlyReport(*report),
-                                                format),
-              .error_message = ""};
+      formatter.FormatYearlyTo(WrapYearlyReport(*report), format, content);
+      return {.ok = true, .content = "", .error_message = ""};
     }
     case ReportDisplayMode::kRecent:
     case ReportDisplayMode::kRange: {
@@ -216,8 +217,9 @@ auto FormatTemporalStructuredReport(
             "RunTemporalReportQuery",
             "Temporal structured report kind/data mismatch: period.");
       }
+      formatter.FormatPeriodTo(*report, format, content);
       return {.ok = true,
-              .content = formatter.FormatPeriod(*report, format),
+              .content = "",
               .error_message = "",
               .report_window_metadata = BuildWindowMetadata(*report)};
     }
@@ -228,6 +230,19 @@ auto FormatTemporalStructuredReport(
       "Unhandled temporal structured report display mode.");
 }
 
+auto FormatTemporalStructuredReport(
+    const TemporalStructuredReportOutput& output, ReportFormat format,
+    tracer_core::application::ports::IReportDtoFormatter& formatter)
+    -> TextOutput {
+  std::string content;
+  auto result =
+      FormatTemporalStructuredReportTo(output, format, formatter, content);
+  if (result.ok) {
+    result.content = std::move(content);
+  }
+  return result;
+}
+
 auto NormalizeDateArgument(std::string_view argument) -> std::string {
   return NormalizeToDateFormat(std::string(argument));
 }
@@ -544,6 +559,62 @@ auto RenderTemporalReportForExport(ReportApi& api,
        .format = request.format});
 }
 
+// 与 RunTemporalReportQuery 相同的异常到失败结果的映射，供批量导出的
+// 工作线程使用。
+auto FormatStructuredReportForExport(
+    const TemporalStructuredReportOutput& structured, ReportFormat format,
+    tracer_core::application::ports::IReportDtoFormatter& formatter,
+    std::string& content) -> TextOutput {
+  try {
+    return FormatTemporalStructuredReportTo(structured, format, formatter,
+                                            content);
+  } catch (const tracer_core::common::ReportingContractError& error) {
+    auto failure =
+        core_api_failure::BuildTextFailure("RunTemporalReportQuery", error);
+    tracer_core::common::ApplyReportingContract(failure, error);
+    return failure;
+  } catch (const std::exception& exception) {
+    return core_api_failure::BuildTextFailure("RunTemporalReportQuery",
+                                              exception);
+  } catch (...) {
+    return core_api_failure::BuildTextFailure("RunTemporalReportQuery");
+  }
+}
+
+// 一次取齐某一显示模式下全部目标的数据，按目标标签索引。
+auto FetchAllMatchingReports(
+    tracer_core::application::ports::IReportDataQueryService& service,
+    ReportDisplayMode display_mode)
+    -> std::map<std::string, TemporalReportDto> {
+  std::map<std::string, TemporalReportDto> reports;
+  switch (display_mode) {
+    case ReportDisplayMode::kDay:
+      for (auto& [date, report] : service.QueryAllDaily()) {
+        reports.emplace(date, std::move(report));
+      }
+      break;
+    case ReportDisplayMode::kMonth:
+      for (const auto& [month, report] : service.QueryAllMonthly()) {
+        reports.emplace(month, ToPeriodReport(report));
+      }
+      break;
+    case ReportDisplayMode::kWeek:
+      for (const auto& [week, report] : service.QueryAllWeekly()) {
+        reports.emplace(week, ToPeriodReport(report));
+      }
+      break;
+    case ReportDisplayMode::kYear:
+      for (const auto& [year, report] : service.QueryAllYearly()) {
+        reports.emplace(year, ToPeriodReport(report));
+      }
+      break;
+    case ReportDisplayMode::kRange:
+    case ReportDisplayMode::kRecent:
+      break;
+  }
+  return reports;
+}
+
 void RequireExportScopeRules(const TemporalReportExportRequest& request) {
   if (request.output_root_path.empty()) {
     throw tracer_core::common::ReportingContractError(
@@ -617,14 +688,69 @@ auto BuildSelectionFromTarget(ReportDisplayMode display_mode,
   throw std::invalid_argument("Targets are unsupported for this display mode.");
 }
 
+// 只有由目标唯一确定的 day/week/month/year 报表可以缓存；range 附带窗口
+// 元数据，recent 随当天日期滚动，都直接查询。缓存范围取报表实际覆盖的
+// 整日/整周/整月/整年，与 RunTemporalStructuredReportQuery 的解析一致。
+auto BuildRenderedReportRequest(const TemporalReportQueryRequest& request)
+    -> std::optional<RenderedReportRequest> {
+  try {
+    switch (request.display_mode) {
+      case ReportDisplayMode::kDay: {
+        if (request.selection.kind != TemporalSelectionKind::kSingleDay) {
+          return std::nullopt;
+        }
+        std::string date = RequireSingleDaySelection(request.selection);
+        return RenderedReportRequest{.kind = "day",
+                                     .first_date = date,
+                                     .last_date = std::move(date),
+                                     .format = request.format};
+      }
+      case ReportDisplayMode::kWeek:
+      case ReportDisplayMode::kMonth:
+      case ReportDisplayMode::kYear: {
+        if (request.selection.kind != TemporalSelectionKind::kDateRange) {
+          return std::nullopt;
+        }
+        const auto range = RequireDateRangeSelection(request.selection);
+        TemporalSelectionPayload covered;
+        std::string kind;
+        if (request.display_mode == ReportDisplayMode::kWeek) {
+          covered = ResolveWeekRange(
+              FormatIsoWeek(IsoWeekFromDate(range.start_date)));
+          kind = "week";
+        } else if (request.display_mode == ReportDisplayMode::kMonth) {
+          covered = ResolveMonthRange(range.start_date.substr(0, 7));
+          kind = "month";
+        } else {
+          covered = ResolveYearRange(range.start_date.substr(0, 4));
+          kind = "year";
+        }
+        return RenderedReportRequest{
+            .kind = std::move(kind),
+            .first_date = std::move(covered.start_date),
+            .last_date = std::move(covered.end_date),
+            .format = request.format};
+      }
+      case ReportDisplayMode::kRange:
+      case ReportDisplayMode::kRecent:
+        break;
+    }
+  } catch (...) {
+    // 非法选择不缓存，由正常查询路径报告错误。
+  }
+  return std::nullopt;
+}
+
 }  // namespace
 
 ReportApi::ReportApi(IReportHandler& report_handler,
                      ReportDataQueryServicePtr report_data_query_service,
-                     ReportDtoFormatterPtr report_dto_formatter)
+                     ReportDtoFormatterPtr report_dto_formatter,
+                     RenderedReportCachePtr rendered_report_cache)
     : report_handler_(report_handler),
       report_data_query_service_(std::move(report_data_query_service)),
-      report_dto_formatter_(std::move(report_dto_formatter)) {}
+      report_dto_formatter_(std::move(report_dto_formatter)),
+      rendered_report_cache_(std::move(rendered_report_cache)) {}
 
 auto ReportApi::RunTemporalReportQuery(const TemporalReportQueryRequest& request)
     -> TextOutput {
@@ -635,6 +761,21 @@ auto ReportApi::RunTemporalReportQuery(const TemporalReportQueryRequest& request
           "Report data query service and formatter are required.");
     }
 
+    // 先读数据代次再查询：查询期间发生的导入只会让本次结果存到旧键下，
+    // 不会被之后的查询读到。
+    RenderedReportLookup cached;
+    if (rendered_report_cache_) {
+      if (const auto kCacheRequest = BuildRenderedReportRequest(request);
+          kCacheRequest.has_value()) {
+        cached = rendered_report_cache_->Lookup(*kCacheRequest);
+        if (cached.content.has_value()) {
+          return {.ok = true,
+                  .content = std::move(*cached.content),
+                  .error_message = ""};
+        }
+      }
+    }
+
     const auto structured = RunTemporalStructuredReportQuery(
         {.display_mode = request.display_mode, .selection = request.selection});
     if (!structured.ok) {
@@ -643,8 +784,12 @@ auto ReportApi::RunTemporalReportQuery(const TemporalReportQueryRequest& request
               .error_message = structured.error_message,
               .error_contract = structured.error_contract};
     }
-    return FormatTemporalStructuredReport(structured, request.format,
-                                          *report_dto_formatter_);
+    auto output = FormatTemporalStructuredReport(structured, request.format,
+                                                 *report_dto_formatter_);
+    if (output.ok && !cached.entry_key.empty()) {
+      rendered_report_cache_->Store(cached.entry_key, output.content);
+    }
+    return output;
   } catch (const tracer_core::common::ReportingContractError& error) {
     auto failure =
         core_api_failure::BuildTextFailure("RunTemporalReportQuery", error);
@@ -785,32 +930,40 @@ auto ReportApi::RunPeriodBatchQuery(const PeriodBatchQueryRequest& request)
             "Structured period batch query failed without error message.");
       }
 
-      std::ostringstream output;
+      // 各报告直接追加到同一份输出，不为每个报告另建字符串。
+      std::string content;
       for (size_t index = 0; index < structured.items.size(); ++index) {
         if (index > 0) {
-          output << "\n" << std::string(kPeriodSeparatorLength, '-') << "\n";
+          content += "\n";
+          content.append(static_cast<std::size_t>(kPeriodSeparatorLength),
+                         '-');
+          content += "\n";
         }
 
         const auto& item = structured.items[index];
         if (!item.ok || !item.report.has_value()) {
-          output << report_api_support::BuildPeriodBatchErrorLine(
+          content += report_api_support::BuildPeriodBatchErrorLine(
               item.kDays, item.error_message);
           continue;
         }
 
+        // 格式化中途失败时丢弃已追加的部分，只留下错误行。
+        const std::size_t kReportStart = content.size();
         try {
-          output << report_dto_formatter_->FormatPeriod(*item.report,
-                                                        request.format);
+          report_dto_formatter_->FormatPeriodTo(*item.report, request.format,
+                                                content);
         } catch (const std::exception& exception) {
-          output << report_api_support::BuildPeriodBatchErrorLine(
+          content.resize(kReportStart);
+          content += report_api_support::BuildPeriodBatchErrorLine(
               item.kDays, exception.what());
         } catch (...) {
-          output << report_api_support::BuildPeriodBatchErrorLine(
+          content.resize(kReportStart);
+          content += report_api_support::BuildPeriodBatchErrorLine(
               item.kDays, "Unknown non-standard exception.");
         }
       }
 
-      return {.ok = true, .content = output.str(), .error_message = ""};
+      return {.ok = true, .content = std::move(content), .error_message = ""};
     }
 
     return {.ok = true,
@@ -945,6 +1098,7 @@ auto ReportApi::RunTemporalReportExport(
         return {.ok = true, .error_message = ""};
       }
       case ReportExportScope::kAllMatching: {
+        const auto kFetchStart = std::chrono::steady_clock::now();
         const auto targets =
             RunTemporalReportTargetsQuery({.display_mode = request.display_mode});
         if (!targets.ok) {
@@ -952,20 +1106,55 @@ auto ReportApi::RunTemporalReportExport(
                   .error_message = targets.error_message,
                   .error_contract = targets.error_contract};
         }
+        if (!report_dto_formatter_) {
+          throw std::invalid_argument("Report formatter is not configured.");
+        }
+
+        // 取数只在调用线程上进行；工作线程只做格式化，不触碰数据库连接。
+        auto prefetched = FetchAllMatchingReports(*report_data_query_service_,
+                                                  request.display_mode);
+        std::vector<report_api_support::BatchExportItem> items;
+        items.reserve(targets.items.size());
         for (const auto& target : targets.items) {
           const auto selection =
               BuildSelectionFromTarget(request.display_mode, target);
-          const auto rendered =
-              RenderTemporalReportForExport(*this, request, selection);
-          if (!rendered.ok) {
-            return {.ok = false,
-                    .error_message = rendered.error_message,
-                    .error_contract = rendered.error_contract};
+          TemporalStructuredReportOutput structured;
+          const auto kPrefetched = prefetched.find(target);
+          if (kPrefetched != prefetched.end()) {
+            structured = {.ok = true,
+                          .display_mode = request.display_mode,
+                          .selection_kind = selection.kind,
+                          .report = std::move(kPrefetched->second),
+                          .error_message = ""};
+          } else {
+            // 批量结果未覆盖的目标回退为逐个查询，缺失目标的报错保持不变。
+            structured = RunTemporalStructuredReportQuery(
+                {.display_mode = request.display_mode, .selection = selection});
+            if (!structured.ok) {
+              return {.ok = false,
+                      .error_message = structured.error_message,
+                      .error_contract = structured.error_contract};
+            }
           }
-          WriteExportFileIfNeeded(ResolveExportPath(request, selection),
-                                  rendered.content);
+          items.push_back(
+              {.output_path = ResolveExportPath(request, selection),
+               .render = [structured = std::move(structured),
+                          format = request.format,
+                          formatter = report_dto_formatter_](
+                             std::string& content) -> TextOutput {
+                 return FormatStructuredReportForExport(structured, format,
+                                                        *formatter, content);
+               }});
         }
-        return {.ok = true, .error_message = ""};
+        prefetched.clear();
+
+        return report_api_support::RunBatchExport(
+            items,
+            {.max_render_workers = request.max_render_workers,
+             .max_in_flight_write_bytes = request.max_in_flight_write_bytes,
+             .fetch_elapsed = std::chrono::steady_clock::now() - kFetchStart,
+             .progress_observer = request.progress_observer},
+            WriteExportFileIfNeeded);
       }
       case ReportExportScope::kBatchRecentList:
         for (const int days : request.recent_days_list) {
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "application/compat/reporting/i_report_handler.hpp"
+#include "application/ports/reporting/i_rendered_report_cache.hpp"
 #include "application/ports/reporting/i_report_data_query_service.hpp"
 #include "application/ports/reporting/i_report_dto_formatter.hpp"
 #include "application/use_cases/i_report_api.hpp"
@@ -16,10 +17,13 @@ class ReportApi final : public IReportApi {
       std::shared_ptr<tracer_core::application::ports::IReportDataQueryService>;
   using ReportDtoFormatterPtr =
       std::shared_ptr<tracer_core::application::ports::IReportDtoFormatter>;
+  using RenderedReportCachePtr =
+      std::shared_ptr<tracer_core::application::ports::IRenderedReportCache>;
 
   ReportApi(IReportHandler& report_handler,
             ReportDataQueryServicePtr report_data_query_service = nullptr,
-            ReportDtoFormatterPtr report_dto_formatter = nullptr);
+            ReportDtoFormatterPtr report_dto_formatter = nullptr,
+            RenderedReportCachePtr rendered_report_cache = nullptr);
 
   auto RunTemporalReportQuery(
       const tracer_core::core::dto::TemporalReportQueryRequest& request)
@@ -49,6 +53,8 @@ class ReportApi final : public IReportApi {
   IReportHandler& report_handler_;
   ReportDataQueryServicePtr report_data_query_service_;
   ReportDtoFormatterPtr report_dto_formatter_;
+  // 可选；day/week/month/year 的文本报表经此缓存。
+  RenderedReportCachePtr rendered_report_cache_;
 };
 
 }  // namespace tracer::core::application::use_cases
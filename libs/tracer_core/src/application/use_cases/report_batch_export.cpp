@@ -0,0 +1,318 @@
+#include "application/use_cases/report_batch_export.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "shared/utils/work_stealing_executor.hpp"
+
+namespace tracer::core::application::use_cases::report_support {
+
+using tracer_core::core::dto::OperationAck;
+using tracer_core::core::dto::TemporalReportExportProgress;
+using tracer_core::core::dto::TemporalReportExportProgressObserver;
+using tracer_core::core::dto::TextOutput;
+namespace concurrency = tracer::core::shared::concurrency;
+
+namespace {
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t kDefaultMaxInFlightWriteBytes =
+    std::size_t{64} * 1024 * 1024;
+
+auto ToMillis(Clock::duration duration) -> std::chrono::milliseconds {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+}
+
+class AsyncExportWriter {
+ public:
+  struct Stats {
+    std::size_t written_count = 0;
+    std::uint64_t written_bytes = 0;
+    Clock::duration busy{};
+  };
+
+  AsyncExportWriter(std::size_t max_in_flight_bytes,
+                    std::size_t max_spare_buffers,
+                    const ExportFileWriter& write_file)
+      : max_in_flight_bytes_(max_in_flight_bytes == 0
+                                 ? kDefaultMaxInFlightWriteBytes
+                                 : max_in_flight_bytes),
+        max_spare_buffers_(max_spare_buffers),
+        write_file_(write_file),
+        worker_([this]() -> void { Run(); }) {}
+
+  AsyncExportWriter(const AsyncExportWriter&) = delete;
+  auto operator=(const AsyncExportWriter&) -> AsyncExportWriter& = delete;
+  AsyncExportWriter(AsyncExportWriter&&) = delete;
+  auto operator=(AsyncExportWriter&&) -> AsyncExportWriter& = delete;
+
+  ~AsyncExportWriter() {
+    Close();
+    if (worker_.joinable()) {
+      worker_.join();
+    }
+  }
+
+  // 排队字节数超过上限时阻塞；队列为空时单个超大文件也会放行。
+  // 写线程已失败时丢弃内容并返回 false。
+  auto Enqueue(fs::path output_path, std::string content) -> bool {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const std::size_t kSize = content.size();
+    space_cv_.wait(lock, [this, kSize]() -> bool {
+      return failed_ || in_flight_bytes_ == 0 ||
+             in_flight_bytes_ + kSize <= max_in_flight_bytes_;
+    });
+    if (failed_) {
+      return false;
+    }
+    in_flight_bytes_ += kSize;
+    pending_.push_back(
+        {.output_path = std::move(output_path), .content = std::move(content)});
+    lock.unlock();
+    work_cv_.notify_one();
+    return true;
+  }
+
+  // 取一块写完后回收的空缓冲区，容量保留上次的报告大小；没有时返回
+  // 新的空字符串。
+  auto AcquireBuffer() -> std::string {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (spare_buffers_.empty()) {
+      return {};
+    }
+    std::string buffer = std::move(spare_buffers_.back());
+    spare_buffers_.pop_back();
+    return buffer;
+  }
+
+  // 归还未入队的缓冲区（如渲染失败时）。
+  auto RecycleBuffer(std::string buffer) -> void {
+    buffer.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    KeepSpareLocked(std::move(buffer));
+  }
+
+  // 写完队列中剩余的文件并结束写线程，重新抛出第一个写入异常。
+  auto Finish() -> void {
+    Close();
+    if (worker_.joinable()) {
+      worker_.join();
+    }
+    if (error_) {
+      std::rethrow_exception(error_);
+    }
+  }
+
+  [[nodiscard]] auto Snapshot() -> Stats {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  struct PendingWrite {
+    fs::path output_path;
+    std::string content;
+  };
+
+  auto KeepSpareLocked(std::string buffer) -> void {
+    if (spare_buffers_.size() < max_spare_buffers_) {
+      spare_buffers_.push_back(std::move(buffer));
+    }
+  }
+
+  auto Close() -> void {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    work_cv_.notify_all();
+  }
+
+  auto Run() -> void {
+    while (true) {
+      PendingWrite item;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_cv_.wait(lock, [this]() -> bool {
+          return closed_ || !pending_.empty();
+        });
+        if (pending_.empty()) {
+          return;
+        }
+        item = std::move(pending_.front());
+        pending_.pop_front();
+      }
+
+      const auto kWriteStart = Clock::now();
+      try {
+        write_file_(item.output_path, item.content);
+      } catch (...) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          error_ = std::current_exception();
+          failed_ = true;
+          pending_.clear();
+          in_flight_bytes_ = 0;
+        }
+        space_cv_.notify_all();
+        return;
+      }
+      const auto kWriteElapsed = Clock::now() - kWriteStart;
+      const std::size_t kWrittenBytes = item.content.size();
+      item.content.clear();
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        in_flight_bytes_ -= kWrittenBytes;
+        ++stats_.written_count;
+        stats_.written_bytes += kWrittenBytes;
+        stats_.busy += kWriteElapsed;
+        KeepSpareLocked(std::move(item.content));
+      }
+      space_cv_.notify_all();
+    }
+  }
+
+  std::size_t max_in_flight_bytes_;
+  std::size_t max_spare_buffers_;
+  const ExportFileWriter& write_file_;
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable space_cv_;
+  std::deque<PendingWrite> pending_;
+  std::size_t in_flight_bytes_ = 0;
+  std::vector<std::string> spare_buffers_;
+  bool closed_ = false;
+  bool failed_ = false;
+  std::exception_ptr error_;
+  Stats stats_;
+  // 最后初始化：线程启动时其余成员都已构造完成。
+  std::thread worker_;
+};
+
+class BatchExportProgress {
+ public:
+  BatchExportProgress(const TemporalReportExportProgressObserver& observer,
+                      std::size_t total_count, Clock::duration fetch_elapsed)
+      : observer_(observer),
+        total_count_(total_count),
+        fetch_elapsed_(fetch_elapsed),
+        start_(Clock::now()) {}
+
+  auto AddRendered(Clock::duration elapsed) -> void {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++rendered_count_;
+    render_elapsed_ += elapsed;
+  }
+
+  auto Report(std::string_view phase, const AsyncExportWriter::Stats& writes)
+      -> void {
+    if (!observer_) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    observer_({
+        .phase = std::string(phase),
+        .total_count = total_count_,
+        .rendered_count = rendered_count_,
+        .written_count = writes.written_count,
+        .written_bytes = writes.written_bytes,
+        .fetch_elapsed = ToMillis(fetch_elapsed_),
+        .render_elapsed = ToMillis(render_elapsed_),
+        .write_elapsed = ToMillis(writes.busy),
+        .total_elapsed = ToMillis(fetch_elapsed_ + (Clock::now() - start_)),
+    });
+  }
+
+ private:
+  const TemporalReportExportProgressObserver& observer_;
+  std::size_t total_count_;
+  Clock::duration fetch_elapsed_;
+  Clock::time_point start_;
+  std::mutex mutex_;
+  std::size_t rendered_count_ = 0;
+  Clock::duration render_elapsed_{};
+};
+
+}  // namespace
+
+auto RunBatchExport(const std::vector<BatchExportItem>& items,
+                    const BatchExportOptions& options,
+                    const ExportFileWriter& write_file) -> OperationAck {
+  BatchExportProgress progress(options.progress_observer, items.size(),
+                               options.fetch_elapsed);
+  progress.Report("fetch", {});
+  if (items.empty()) {
+    progress.Report("done", {});
+    return {.ok = true, .error_message = ""};
+  }
+
+  std::atomic<bool> stop{false};
+  std::mutex failure_mutex;
+  std::optional<std::size_t> failed_index;
+  TextOutput failure;
+
+  const std::size_t kWorkers = std::min(
+      concurrency::ResolveWorkerCount(options.max_render_workers),
+      items.size());
+  // 每个渲染线程留一块备用缓冲区即可；多出的在写完后释放。
+  AsyncExportWriter writer(options.max_in_flight_write_bytes, kWorkers,
+                           write_file);
+  {
+    concurrency::WorkStealingExecutor executor(kWorkers);
+    executor.ParallelFor(items.size(), [&](std::size_t index) -> void {
+      if (stop.load(std::memory_order_relaxed)) {
+        return;
+      }
+      const auto kRenderStart = Clock::now();
+      std::string content = writer.AcquireBuffer();
+      TextOutput rendered;
+      try {
+        rendered = items[index].render(content);
+      } catch (...) {
+        stop.store(true, std::memory_order_relaxed);
+        throw;
+      }
+      progress.AddRendered(Clock::now() - kRenderStart);
+
+      if (!rendered.ok) {
+        stop.store(true, std::memory_order_relaxed);
+        writer.RecycleBuffer(std::move(content));
+        std::lock_guard<std::mutex> lock(failure_mutex);
+        if (!failed_index.has_value() || index < *failed_index) {
+          failed_index = index;
+          failure = std::move(rendered);
+        }
+        return;
+      }
+      if (!writer.Enqueue(items[index].output_path, std::move(content))) {
+        stop.store(true, std::memory_order_relaxed);
+        return;
+      }
+      progress.Report("render", writer.Snapshot());
+    });
+  }
+  writer.Finish();
+
+  if (failed_index.has_value()) {
+    return {.ok = false,
+            .error_message = failure.error_message,
+            .error_contract = failure.error_contract};
+  }
+  progress.Report("done", writer.Snapshot());
+  return {.ok = true, .error_message = ""};
+}
+
+}  // namespace tracer::core::application::use_cases::report_support
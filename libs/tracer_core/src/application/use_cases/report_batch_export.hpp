@@ -0,0 +1,51 @@
+#ifndef APPLICATION_USE_CASES_REPORT_BATCH_EXPORT_HPP_
+#define APPLICATION_USE_CASES_REPORT_BATCH_EXPORT_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "application/dto/reporting_requests.hpp"
+#include "application/dto/shared_envelopes.hpp"
+
+namespace tracer::core::application::use_cases::report_support {
+
+struct BatchExportItem {
+  std::filesystem::path output_path;
+  // 在工作线程上调用，只允许做纯格式化，不得访问数据库连接。报告追加到
+  // 传入的空缓冲区，返回值只携带成败与错误信息。
+  std::function<tracer_core::core::dto::TextOutput(std::string& content)>
+      render;
+};
+
+struct BatchExportOptions {
+  std::size_t max_render_workers = 0;
+  std::size_t max_in_flight_write_bytes = 0;
+  std::chrono::steady_clock::duration fetch_elapsed{};
+  tracer_core::core::dto::TemporalReportExportProgressObserver
+      progress_observer;
+};
+
+using ExportFileWriter =
+    std::function<void(const std::filesystem::path&, std::string_view)>;
+
+/**
+ * @brief 并行渲染、异步写出一批已取数的导出目标。
+ *
+ * 渲染在有界线程池上进行；渲染结果交给单独的写线程，排队中的字节数
+ * 超过上限时渲染线程阻塞等待。写完的缓冲区清空后回收给后续渲染复用，
+ * 缓冲区总数不超过渲染线程数加排队中的文件数。某个目标渲染失败后不再调度新的目标，
+ * 返回按目标顺序最靠前的失败；写文件抛出的异常在所有线程结束后重新抛出。
+ */
+auto RunBatchExport(const std::vector<BatchExportItem>& items,
+                    const BatchExportOptions& options,
+                    const ExportFileWriter& write_file)
+    -> tracer_core::core::dto::OperationAck;
+
+}  // namespace tracer::core::application::use_cases::report_support
+
+#endif  // APPLICATION_USE_CASES_REPORT_BATCH_EXPORT_HPP_
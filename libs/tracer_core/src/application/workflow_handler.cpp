@@ -37,9 +37,10 @@ auto WorkflowHandler::RunDatabaseImportFromMemory(
 
 auto WorkflowHandler::RunIngest(const std::string& source_path,
                                 DateCheckMode date_check_mode,
-                                bool save_processed, IngestMode ingest_mode)
-    -> void {
-  impl_.RunIngest(source_path, date_check_mode, save_processed, ingest_mode);
+                                bool save_processed, IngestMode ingest_mode,
+                                std::size_t max_parallelism) -> void {
+  impl_.RunIngest(source_path, date_check_mode, save_processed, ingest_mode,
+                  max_parallelism);
 }
 
 auto WorkflowHandler::RunIngestSyncStatusQuery(
@@ -68,6 +69,30 @@ auto WorkflowHandler::RunValidateLogic(const std::string& source_path,
   impl_.RunValidateLogic(source_path, date_check_mode);
 }
 
+auto WorkflowHandler::RunValidateStructureFromInputs(
+    const std::vector<tracer_core::application::dto::IngestInputModel>& inputs)
+    -> void {
+  impl_.RunValidateStructureFromInputs(inputs);
+}
+
+auto WorkflowHandler::RunValidateLogicFromInputs(
+    const std::vector<tracer_core::application::dto::IngestInputModel>& inputs,
+    DateCheckMode date_check_mode) -> void {
+  impl_.RunValidateLogicFromInputs(inputs, date_check_mode);
+}
+
+auto WorkflowHandler::RunIngestReplacingAllFromInputs(
+    std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+    DateCheckMode date_check_mode) -> void {
+  impl_.RunIngestReplacingAllFromInputs(std::move(inputs), date_check_mode);
+}
+
+auto WorkflowHandler::RunIngestChangedMonthsFromInputs(
+    std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+    DateCheckMode date_check_mode) -> void {
+  impl_.RunIngestChangedMonthsFromInputs(std::move(inputs), date_check_mode);
+}
+
 auto WorkflowHandler::RunRecordActivityAtomically(
     const tracer_core::core::dto::RecordActivityAtomicallyRequest& request)
     -> tracer_core::core::dto::RecordActivityAtomicallyResponse {
@@ -41,8 +41,8 @@ class WorkflowHandler final : public IWorkflowHandler {
       const std::map<std::string, std::vector<DailyLog>>& data_map)
       -> void override;
   auto RunIngest(const std::string& source_path, DateCheckMode date_check_mode,
-                 bool save_processed, IngestMode ingest_mode)
-      -> void override;
+                 bool save_processed, IngestMode ingest_mode,
+                 std::size_t max_parallelism) -> void override;
   auto RunIngestSyncStatusQuery(
       const tracer_core::core::dto::IngestSyncStatusRequest& request)
       -> tracer_core::core::dto::IngestSyncStatusOutput override;
@@ -53,6 +53,19 @@ class WorkflowHandler final : public IWorkflowHandler {
   auto RunValidateStructure(const std::string& source_path) -> void override;
   auto RunValidateLogic(const std::string& source_path,
                         DateCheckMode date_check_mode) -> void override;
+  auto RunValidateStructureFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&
+          inputs) -> void override;
+  auto RunValidateLogicFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&
+          inputs,
+      DateCheckMode date_check_mode) -> void override;
+  auto RunIngestReplacingAllFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+      DateCheckMode date_check_mode) -> void override;
+  auto RunIngestChangedMonthsFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+      DateCheckMode date_check_mode) -> void override;
   auto RunRecordActivityAtomically(
       const tracer_core::core::dto::RecordActivityAtomicallyRequest& request)
       -> tracer_core::core::dto::RecordActivityAtomicallyResponse override;
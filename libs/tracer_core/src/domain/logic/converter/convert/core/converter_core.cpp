@@ -6,6 +6,7 @@
 #include <string_view>
 
 #include "domain/logic/converter/convert/core/converter_core_internal.hpp"
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
 #include "domain/ports/diagnostics.hpp"
 
 namespace {
@@ -33,7 +34,9 @@ auto HasGeneratedOvernightSleep(const DailyLog& day,
 
 }  // namespace
 
-DayProcessor::DayProcessor(const ConverterConfig& config) : config_(config) {}
+DayProcessor::DayProcessor(const ConverterConfig& config)
+    : config_(config),
+      resolution_table_(ActivityResolutionTable::ForConfig(config)) {}
 
 void DayProcessor::Process(DailyLog& previous_day, DailyLog& day_to_process) {
   if (day_to_process.date.empty()) {
@@ -45,7 +48,7 @@ void DayProcessor::Process(DailyLog& previous_day, DailyLog& day_to_process) {
         previous_day.rawEvents.back().endTimeStr);
   }
 
-  converter_core_internal::ActivityMapper activity_mapper(config_);
+  converter_core_internal::ActivityMapper activity_mapper(*resolution_table_);
   activity_mapper.MapActivities(day_to_process);
 
   // If the day starts with a valid wake anchor, we may synthesize an overnight
@@ -3,6 +3,7 @@
 #define DOMAIN_LOGIC_CONVERTER_CONVERT_CORE_CONVERTER_CORE_H_
 
 #include <map>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -17,6 +18,8 @@ class DayProcessor {
 
  private:
   const ConverterConfig& config_;
+  // 每个处理器只解析一次：优先复用配置上已安装的解析表。
+  std::shared_ptr<const ActivityResolutionTable> resolution_table_;
 };
 
 class LogLinker {
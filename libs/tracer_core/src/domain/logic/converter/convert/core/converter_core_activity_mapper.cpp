@@ -1,6 +1,5 @@
 // domain/logic/converter/convert/core/converter_core_activity_mapper.cpp
-#include <algorithm>
-#include <sstream>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -8,26 +7,21 @@
 
 #include "domain/logic/converter/convert/core/converter_core_internal.hpp"
 
-import tracer.core.shared.string_utils;
+import tracer.core.shared.civil_time;
 
 namespace converter_core_internal {
 
-using tracer::core::shared::string_utils::SplitString;
+namespace civil_time = tracer::core::shared::civil_time;
 
 namespace {
 
-constexpr int kHoursPerDay = 24;
-constexpr int kMinutesPerHour = 60;
 constexpr size_t kTimeStringLength = 5;
-constexpr size_t kTimeHourOffset = 0;
-constexpr size_t kTimeHourLength = 2;
-constexpr size_t kTimeMinuteOffset = 3;
-constexpr size_t kTimeMinuteLength = 2;
 
 }  // namespace
 
-ActivityMapper::ActivityMapper(const ConverterConfig& config)
-    : config_(config), wake_keywords_(config.wake_keywords) {}
+ActivityMapper::ActivityMapper(
+    const ActivityResolutionTable& resolution_table)
+    : resolution_table_(resolution_table) {}
 
 auto ActivityMapper::MapActivities(DailyLog& day) -> void {
   day.processedActivities.clear();
@@ -40,7 +34,7 @@ auto ActivityMapper::MapActivities(DailyLog& day) -> void {
   std::optional<SourceSpan> start_span;
 
   for (const auto& raw_event : day.rawEvents) {
-    if (IsWakeEvent(raw_event)) {
+    if (resolution_table_.IsWakeKeyword(raw_event.description)) {
       if (start_time.empty()) {
         start_time = NormalizeTime(raw_event.endTimeStr);
         start_span = raw_event.source_span;
@@ -52,109 +46,38 @@ auto ActivityMapper::MapActivities(DailyLog& day) -> void {
     TimeRange range{.start_hhmm = start_time,
                     .end_hhmm = formatted_event_end_time};
 
-    std::string mapped_description = MapDescription(raw_event.description);
+    // Canonical mapping stage:
+    // TXT stores alias keys (raw activity tokens). The resolution table was
+    // compiled from alias_mapping.toml + converter/aliases/*.toml, so one
+    // lookup yields the canonical project path, including duration rules.
+    // Timing semantics stay here: durations are derived from neighboring
+    // authored event timestamps.
     const int kDuration = CalculateDurationMinutes(range);
-    mapped_description = ApplyDurationRules(mapped_description, kDuration);
+    const ActivityResolution kResolution =
+        resolution_table_.Resolve(raw_event.description, kDuration);
 
-    AppendActivity(day, raw_event, range, mapped_description, start_span);
-    start_time = formatted_event_end_time;
+    AppendActivity(day, raw_event, range, kResolution, start_span);
+    start_time = std::move(formatted_event_end_time);
     start_span = raw_event.source_span;
   }
 }
 
-[[nodiscard]] auto ActivityMapper::IsWakeEvent(const RawEvent& raw_event) const
-    -> bool {
-  return std::ranges::find(wake_keywords_, raw_event.description) !=
-         wake_keywords_.end();
-}
-
-[[nodiscard]] auto ActivityMapper::MapDescription(
-    std::string_view description) const -> std::string {
-  std::string mapped_description(description);
-
-  // Canonical mapping stage:
-  // TXT stores alias keys (raw activity tokens). During full-text conversion/ingest we map
-  // alias key -> canonical value expanded from alias_mapping.toml index +
-  // converter/aliases/*.toml child files.
-  // Timing semantics are applied later: alias normalization decides only the
-  // canonical activity path, while time ranges and durations are derived from
-  // neighboring authored event timestamps in subsequent steps.
-  auto map_it = config_.text_mapping.find(mapped_description);
-  if (map_it != config_.text_mapping.end()) {
-    mapped_description = map_it->second;
-  }
-
-  auto duration_map_it = config_.text_duration_mapping.find(mapped_description);
-  if (duration_map_it != config_.text_duration_mapping.end()) {
-    mapped_description = duration_map_it->second;
-  }
-  return mapped_description;
-}
-
-[[nodiscard]] auto ActivityMapper::ApplyDurationRules(
-    std::string_view mapped_description, int duration_minutes) const
-    -> std::string {
-  std::string description_str(mapped_description);
-  auto duration_rules_it = config_.duration_mappings.find(description_str);
-  if (duration_rules_it == config_.duration_mappings.end()) {
-    return description_str;
-  }
-
-  for (const auto& rule : duration_rules_it->second) {
-    if (duration_minutes < rule.less_than_minutes) {
-      return rule.value;
-    }
-  }
-  return description_str;
-}
-
-auto ActivityMapper::ApplyTopParentMapping(
-    std::vector<std::string>& parts) const -> void {
-  if (parts.empty()) {
-    return;
-  }
-
-  auto map_it = config_.top_parent_mapping.find(parts.front());
-  if (map_it != config_.top_parent_mapping.end()) {
-    parts.front() = map_it->second;
-    return;
-  }
-
-  auto init_map_it = config_.initial_top_parents.find(parts.front());
-  if (init_map_it != config_.initial_top_parents.end()) {
-    parts.front() = init_map_it->second;
-  }
-}
-
-[[nodiscard]] auto ActivityMapper::BuildProjectPath(
-    const std::vector<std::string>& parts) -> std::string {
-  std::stringstream path_stream;
-  for (size_t i = 0; i < parts.size(); ++i) {
-    path_stream << parts[i] << (i + 1 < parts.size() ? "_" : "");
-  }
-  return path_stream.str();
-}
-
 auto ActivityMapper::AppendActivity(
     DailyLog& day, const RawEvent& raw_event, const TimeRange& time_range,
-    std::string_view mapped_description,
+    const ActivityResolution& resolution,
     const std::optional<SourceSpan>& start_span) const -> void {
-  if (time_range.start_hhmm.empty()) {
-    return;
-  }
-
-  std::vector<std::string> parts =
-      SplitString(std::string(mapped_description), '_');
-  if (parts.empty()) {
+  if (time_range.start_hhmm.empty() || !resolution.has_activity) {
     return;
   }
 
   BaseActivityRecord activity;
   activity.start_time_str = std::string(time_range.start_hhmm);
   activity.end_time_str = std::string(time_range.end_hhmm);
-
-  ApplyTopParentMapping(parts);
-  activity.project_path = BuildProjectPath(parts);
+  // 未预编译的描述（不在任何映射中）原样作为 mapped description 拼接。
+  activity.project_path =
+      resolution.project_id == ActivityResolution::kUncompiledProjectId
+          ? resolution_table_.BuildProjectPath(raw_event.description)
+          : std::string(resolution.project_path);
   if (!raw_event.remark.empty()) {
     activity.remark = raw_event.remark;
   }
@@ -169,25 +92,14 @@ auto ActivityMapper::AppendActivity(
       range.end_hhmm.length() != kTimeStringLength) {
     return 0;
   }
-  try {
-    const int kStartHour = std::stoi(
-        std::string(range.start_hhmm.substr(kTimeHourOffset, kTimeHourLength)));
-    const int kStartMinute = std::stoi(std::string(
-        range.start_hhmm.substr(kTimeMinuteOffset, kTimeMinuteLength)));
-    const int kEndHour = std::stoi(
-        std::string(range.end_hhmm.substr(kTimeHourOffset, kTimeHourLength)));
-    const int kEndMinute = std::stoi(std::string(
-        range.end_hhmm.substr(kTimeMinuteOffset, kTimeMinuteLength)));
-
-    const int kStartTimeMinutes = (kStartHour * kMinutesPerHour) + kStartMinute;
-    int end_time_minutes = (kEndHour * kMinutesPerHour) + kEndMinute;
-    if (end_time_minutes < kStartTimeMinutes) {
-      end_time_minutes += kHoursPerDay * kMinutesPerHour;
-    }
-    return end_time_minutes - kStartTimeMinutes;
-  } catch (const std::exception&) {
+  const std::optional<int> kStartMinutes =
+      civil_time::ParseMinutesOfDay(range.start_hhmm);
+  const std::optional<int> kEndMinutes =
+      civil_time::ParseMinutesOfDay(range.end_hhmm);
+  if (!kStartMinutes.has_value() || !kEndMinutes.has_value()) {
     return 0;
   }
+  return civil_time::WrappedDurationMinutes(*kStartMinutes, *kEndMinutes);
 }
 
 }  // namespace converter_core_internal
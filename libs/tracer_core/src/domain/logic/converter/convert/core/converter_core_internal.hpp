@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "domain/logic/converter/convert/core/converter_core.hpp"
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
 
 namespace converter_core_internal {
 
@@ -27,7 +28,7 @@ class DayStats {
 
 class ActivityMapper {
  public:
-  explicit ActivityMapper(const ConverterConfig& config);
+  explicit ActivityMapper(const ActivityResolutionTable& resolution_table);
 
   auto MapActivities(DailyLog& day) -> void;
 
@@ -37,26 +38,11 @@ class ActivityMapper {
     std::string_view end_hhmm;
   };
 
-  const ConverterConfig& config_;
-  const std::vector<std::string>& wake_keywords_;
-
-  [[nodiscard]] auto IsWakeEvent(const RawEvent& raw_event) const -> bool;
-
-  [[nodiscard]] auto MapDescription(std::string_view description) const
-      -> std::string;
-
-  [[nodiscard]] auto ApplyDurationRules(std::string_view mapped_description,
-                                        int duration_minutes) const
-      -> std::string;
-
-  auto ApplyTopParentMapping(std::vector<std::string>& parts) const -> void;
-
-  [[nodiscard]] static auto BuildProjectPath(
-      const std::vector<std::string>& parts) -> std::string;
+  const ActivityResolutionTable& resolution_table_;
 
   auto AppendActivity(DailyLog& day, const RawEvent& raw_event,
                       const TimeRange& time_range,
-                      std::string_view mapped_description,
+                      const ActivityResolution& resolution,
                       const std::optional<SourceSpan>& start_span) const
       -> void;
 
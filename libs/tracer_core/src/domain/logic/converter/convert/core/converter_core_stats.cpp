@@ -1,119 +1,116 @@
 // domain/logic/converter/convert/core/converter_core_stats.cpp
 #include <algorithm>
-#include <array>
 #include <cstdint>
 #include <ctime>
-#include <iomanip>
 #include <optional>
-#include <sstream>
-#include <stdexcept>
 #include <string_view>
 
 #include "domain/logic/converter/convert/core/converter_core_internal.hpp"
 
+import tracer.core.shared.civil_time;
+
 namespace converter_core_internal {
 namespace {
 
+namespace civil = tracer::core::shared::civil_time;
+
 constexpr std::int64_t kDailySequenceBase = 1000000;
-constexpr int kHoursPerDay = 24;
-constexpr int kMinutesPerHour = 60;
 constexpr int kSecondsPerMinute = 60;
-constexpr int kSecondsPerDay =
-    kHoursPerDay * kMinutesPerHour * kSecondsPerMinute;
+constexpr int kLastMinuteOfDay = civil::kMinutesPerDay - 1;
+constexpr int kTmYearBase = 1900;
 
-constexpr size_t kDateStringLength = 10;
 constexpr size_t kTimeStringLength = 5;
 constexpr size_t kTimeDigitsLength = 4;
 
 constexpr size_t kTimeHourOffset = 0;
 constexpr size_t kTimeHourLength = 2;
-constexpr size_t kTimeMinuteOffset = 3;
 constexpr size_t kTimeMinuteLength = 2;
 
 constexpr size_t kTimeDigitsMinuteOffset = 2;
-constexpr size_t kDateTimeMinLength = 16;
 
-auto StringToTimeT(const std::string& datetime_str) -> std::int64_t {
-  if (datetime_str.length() < kDateTimeMinLength) {
-    return 0;
-  }
-  std::tm time_info = {};
-  std::stringstream time_stream(datetime_str);
-  time_stream >> std::get_time(&time_info, "%Y-%m-%d %H:%M");
-  if (time_stream.fail()) {
-    return 0;
-  }
-  return static_cast<std::int64_t>(std::mktime(&time_info));
-}
-
-[[nodiscard]] auto ParseHhmmToSeconds(std::string_view time_value)
+// 只接受 "HH:MM"；"HHMM" 在进入统计前已由 NormalizeTime 规范化。
+[[nodiscard]] auto ParseHhmmToMinutes(std::string_view time_value)
     -> std::optional<int> {
   if (time_value.length() != kTimeStringLength) {
     return std::nullopt;
   }
-  if (time_value[2] != ':') {
-    return std::nullopt;
-  }
-
-  try {
-    const int kHour =
-        std::stoi(std::string(time_value.substr(kTimeHourOffset, 2)));
-    const int kMinute =
-        std::stoi(std::string(time_value.substr(kTimeMinuteOffset, 2)));
-    if (kHour < 0 || kHour >= kHoursPerDay || kMinute < 0 ||
-        kMinute >= kMinutesPerHour) {
-      return std::nullopt;
-    }
-    return ((kHour * kMinutesPerHour) + kMinute) * kSecondsPerMinute;
-  } catch (const std::exception&) {
-    return std::nullopt;
-  }
+  return civil::ParseMinutesOfDay(time_value);
 }
 
-[[nodiscard]] auto CalculateDurationSeconds(const std::string& start_time_str,
-                                            const std::string& end_time_str)
+[[nodiscard]] auto CalculateDurationSeconds(std::string_view start_time_str,
+                                            std::string_view end_time_str)
     -> int {
-  if (start_time_str.length() != kTimeStringLength ||
-      end_time_str.length() != kTimeStringLength) {
+  const std::optional<int> kStartMinutes = ParseHhmmToMinutes(start_time_str);
+  const std::optional<int> kEndMinutes = ParseHhmmToMinutes(end_time_str);
+  if (!kStartMinutes.has_value() || !kEndMinutes.has_value()) {
     return 0;
   }
+  return civil::WrappedDurationMinutes(*kStartMinutes, *kEndMinutes) *
+         kSecondsPerMinute;
+}
 
-  try {
-    const int kStartHour =
-        std::stoi(start_time_str.substr(kTimeHourOffset, kTimeHourLength));
-    const int kStartMinute =
-        std::stoi(start_time_str.substr(kTimeMinuteOffset, kTimeMinuteLength));
-    const int kEndHour =
-        std::stoi(end_time_str.substr(kTimeHourOffset, kTimeHourLength));
-    const int kEndMinute =
-        std::stoi(end_time_str.substr(kTimeMinuteOffset, kTimeMinuteLength));
-
-    const int kStartSeconds =
-        (kStartHour * kMinutesPerHour + kStartMinute) * kSecondsPerMinute;
-    int end_seconds =
-        (kEndHour * kMinutesPerHour + kEndMinute) * kSecondsPerMinute;
-    if (end_seconds < kStartSeconds) {
-      end_seconds += kSecondsPerDay;
-    }
-    return end_seconds - kStartSeconds;
-  } catch (const std::exception&) {
-    return 0;
-  }
+// 与历史实现 StringToTimeT 相同：std::get_time 产出的 tm 中 tm_isdst 为 0，
+// mktime 因此始终按“标准时间”解释墙钟时间，夏令时期间也不例外。
+[[nodiscard]] auto LocalStandardMktime(const civil::CivilDate& date,
+                                       int minutes_of_day) -> std::int64_t {
+  std::tm local = {};
+  local.tm_year = date.year - kTmYearBase;
+  local.tm_mon = date.month - 1;
+  local.tm_mday = date.day;
+  local.tm_hour = minutes_of_day / civil::kMinutesPerHour;
+  local.tm_min = minutes_of_day % civil::kMinutesPerHour;
+  local.tm_isdst = 0;
+  return static_cast<std::int64_t>(std::mktime(&local));
 }
 
-[[nodiscard]] auto TimeStringToTimestamp(const std::string& date,
-                                         const std::string& time,
-                                         bool is_end_time,
-                                         std::int64_t start_timestamp_for_end)
-    -> std::int64_t {
-  if (date.length() != kDateStringLength ||
-      time.length() != kTimeStringLength) {
+// 时区策略：time_records 的 start/end_timestamp 一直按“本地标准时间墙钟”
+// 编码。tm_isdst = 0 时偏移只随标准时区变化，因此每个日期只在 00:00 与
+// 23:59 各探测一次并按线程缓存；两端一致时整天共用该偏移，转换线程之间
+// 不再逐条争用 mktime 的全局锁。极少数在当天内改变标准偏移的日期返回
+// nullopt，由调用方逐条走 mktime，结果与历史路径逐秒一致。
+[[nodiscard]] auto ResolveLocalUtcOffsetSeconds(const civil::CivilDate& date)
+    -> std::optional<std::int64_t> {
+  thread_local std::int32_t cached_packed_date = 0;
+  thread_local std::optional<std::int64_t> cached_offset_seconds;
+  const std::int32_t kPackedDate = civil::PackDate(date);
+  if (kPackedDate == cached_packed_date) {
+    return cached_offset_seconds;
+  }
+
+  const std::int64_t kFirstInstant = LocalStandardMktime(date, 0);
+  const std::int64_t kLastInstant =
+      LocalStandardMktime(date, kLastMinuteOfDay);
+  const std::int64_t kFirstOffset =
+      civil::ToUtcEpochSeconds(date, 0) - kFirstInstant;
+  const std::int64_t kLastOffset =
+      civil::ToUtcEpochSeconds(date, kLastMinuteOfDay) - kLastInstant;
+  std::optional<std::int64_t> offset_seconds;
+  if (kFirstInstant != -1 && kLastInstant != -1 &&
+      kFirstOffset == kLastOffset) {
+    offset_seconds = kFirstOffset;
+  }
+
+  cached_packed_date = kPackedDate;
+  cached_offset_seconds = offset_seconds;
+  return offset_seconds;
+}
+
+[[nodiscard]] auto TimeStringToTimestamp(
+    const std::optional<civil::CivilDate>& date, std::string_view time,
+    bool is_end_time, std::int64_t start_timestamp_for_end) -> std::int64_t {
+  const std::optional<int> kMinutes = ParseHhmmToMinutes(time);
+  if (!date.has_value() || !kMinutes.has_value()) {
     return 0;
   }
 
-  std::int64_t timestamp = StringToTimeT(date + " " + time);
+  const std::optional<std::int64_t> kOffsetSeconds =
+      ResolveLocalUtcOffsetSeconds(*date);
+  std::int64_t timestamp =
+      kOffsetSeconds.has_value()
+          ? civil::ToUtcEpochSeconds(*date, *kMinutes) - *kOffsetSeconds
+          : LocalStandardMktime(*date, *kMinutes);
   if (is_end_time && timestamp < start_timestamp_for_end) {
-    timestamp += static_cast<std::int64_t>(kSecondsPerDay);
+    timestamp += civil::kSecondsPerDay;
   }
   return timestamp;
 }
@@ -134,17 +131,14 @@ auto NormalizeTime(std::string_view time_str) -> std::string {
 auto CalculateWrappedDurationSeconds(std::string_view start_hhmm,
                                      std::string_view end_hhmm)
     -> std::optional<int> {
-  const std::optional<int> kStartSeconds = ParseHhmmToSeconds(start_hhmm);
-  const std::optional<int> kEndSeconds = ParseHhmmToSeconds(end_hhmm);
-  if (!kStartSeconds.has_value() || !kEndSeconds.has_value()) {
+  const std::optional<int> kStartMinutes = ParseHhmmToMinutes(start_hhmm);
+  const std::optional<int> kEndMinutes = ParseHhmmToMinutes(end_hhmm);
+  if (!kStartMinutes.has_value() || !kEndMinutes.has_value()) {
     return std::nullopt;
   }
 
-  int wrapped_end_seconds = *kEndSeconds;
-  if (wrapped_end_seconds < *kStartSeconds) {
-    wrapped_end_seconds += kSecondsPerDay;
-  }
-  return wrapped_end_seconds - *kStartSeconds;
+  return civil::WrappedDurationMinutes(*kStartMinutes, *kEndMinutes) *
+         kSecondsPerMinute;
 }
 
 auto MergeSpans(const std::optional<SourceSpan>& start_span,
@@ -179,26 +173,22 @@ void DayStats::CalculateStats(DailyLog& day) {
       !day.isContinuation && !day.getupTime.empty() && day.getupTime != "00:00";
 
   std::int64_t activity_sequence = 1;
-  std::int64_t date_as_long = 0;
-  try {
-    std::string temp_date = day.date;
-    temp_date.erase(std::ranges::remove(temp_date, '-').begin(),
-                    temp_date.end());
-    date_as_long = std::stoll(temp_date);
-  } catch (const std::invalid_argument&) {
+  const std::optional<civil::CivilDate> kDate = civil::ParseIsoDate(day.date);
+  if (!kDate.has_value()) {
     return;
   }
+  const std::int64_t kDateAsLong = civil::PackDate(*kDate);
 
   for (auto& activity : day.processedActivities) {
     activity.logical_id =
-        (date_as_long * kDailySequenceBase) + activity_sequence++;
+        (kDateAsLong * kDailySequenceBase) + activity_sequence++;
     activity.duration_seconds = CalculateDurationSeconds(
         activity.start_time_str, activity.end_time_str);
 
     activity.start_timestamp =
-        TimeStringToTimestamp(day.date, activity.start_time_str, false, 0);
+        TimeStringToTimestamp(kDate, activity.start_time_str, false, 0);
     activity.end_timestamp = TimeStringToTimestamp(
-        day.date, activity.end_time_str, true, activity.start_timestamp);
+        kDate, activity.end_time_str, true, activity.start_timestamp);
 
     if (activity.project_path.starts_with("study")) {
       day.hasStudyActivity = true;
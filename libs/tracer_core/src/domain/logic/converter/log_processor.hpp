@@ -5,10 +5,12 @@
 #include <functional>
 #include <istream>
 #include <map>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "domain/logic/lexer/txt_line_lexer.hpp"
 #include "domain/model/daily_log.hpp"
 #include "domain/types/converter_config.hpp"
 
@@ -31,6 +33,11 @@ class LogProcessor {
           content)  // NOLINT(bugprone-easily-swappable-parameters)
       -> LogProcessingResult;
 
+  // 与 ProcessSourceContent 相同，但直接消费已词法化的行。
+  auto ProcessSourceTokens(const std::string& filename,
+                           std::span<const txt_lexer::TxtLineToken> tokens)
+      -> LogProcessingResult;
+
  private:
   const ConverterConfig& config_;
 };
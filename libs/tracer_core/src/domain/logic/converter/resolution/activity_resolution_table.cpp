@@ -0,0 +1,178 @@
+// domain/logic/converter/resolution/activity_resolution_table.cpp
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
+
+#include <utility>
+
+import tracer.core.shared.string_utils;
+
+using tracer::core::shared::string_utils::SplitView;
+
+namespace {
+
+template <typename Map>
+[[nodiscard]] auto LookupOr(const Map& map, const std::string& key)
+    -> const std::string& {
+  const auto kIt = map.find(key);
+  return kIt == map.end() ? key : kIt->second;
+}
+
+}  // namespace
+
+auto ActivityResolutionTable::Compile(const ConverterConfig& config)
+    -> std::shared_ptr<const ActivityResolutionTable> {
+  auto table = std::make_shared<ActivityResolutionTable>();
+
+  // 顶层父级：top_parent_mapping 优先于 initial_top_parents。
+  for (const auto& [key, value] : config.top_parent_mapping) {
+    table->top_parents_.emplace(key, value);
+  }
+  for (const auto& [key, value] : config.initial_top_parents) {
+    table->top_parents_.try_emplace(key, value);
+  }
+
+  table->wake_keywords_.insert(config.wake_keywords.begin(),
+                               config.wake_keywords.end());
+  table->known_keywords_ = table->wake_keywords_;
+  for (const auto* mapping :
+       {&config.text_mapping, &config.text_duration_mapping,
+        &config.top_parent_mapping, &config.initial_top_parents}) {
+    for (const auto& entry : *mapping) {
+      table->known_keywords_.insert(entry.first);
+    }
+  }
+
+  // 不在任何映射中的描述原样作为 mapped description（走 Resolve 的回退
+  // 路径），因此只需为三类映射的键预编译条目。
+  std::vector<const std::string*> alias_keys;
+  for (const auto& entry : config.text_mapping) {
+    alias_keys.push_back(&entry.first);
+  }
+  for (const auto& entry : config.text_duration_mapping) {
+    alias_keys.push_back(&entry.first);
+  }
+  for (const auto& entry : config.duration_mappings) {
+    alias_keys.push_back(&entry.first);
+  }
+
+  for (const std::string* alias_key : alias_keys) {
+    if (table->aliases_.contains(*alias_key)) {
+      continue;
+    }
+    // alias -> text_mapping -> text_duration_mapping，与 ActivityMapper
+    // 的历史映射顺序一致。
+    const std::string& mapped =
+        LookupOr(config.text_duration_mapping,
+                 LookupOr(config.text_mapping, *alias_key));
+
+    CompiledAlias compiled{.target = table->CompileTarget(mapped),
+                           .duration_rules = {}};
+    if (const auto kRulesIt = config.duration_mappings.find(mapped);
+        kRulesIt != config.duration_mappings.end()) {
+      compiled.duration_rules.reserve(kRulesIt->second.size());
+      for (const auto& rule : kRulesIt->second) {
+        compiled.duration_rules.push_back(
+            {.less_than_minutes = rule.less_than_minutes,
+             .target = table->CompileTarget(rule.value)});
+      }
+    }
+    table->aliases_.emplace(*alias_key, std::move(compiled));
+  }
+  return table;
+}
+
+auto ActivityResolutionTable::ForConfig(const ConverterConfig& config)
+    -> std::shared_ptr<const ActivityResolutionTable> {
+  if (config.activity_resolution != nullptr) {
+    return config.activity_resolution;
+  }
+  return Compile(config);
+}
+
+auto ActivityResolutionTable::Resolve(std::string_view description,
+                                      int duration_minutes) const
+    -> ActivityResolution {
+  const auto kAliasIt = aliases_.find(description);
+  if (kAliasIt == aliases_.end()) {
+    return {.has_activity = !description.empty(),
+            .project_id = ActivityResolution::kUncompiledProjectId,
+            .project_path = {}};
+  }
+
+  for (const auto& rule : kAliasIt->second.duration_rules) {
+    if (duration_minutes < rule.less_than_minutes) {
+      return ToResolution(rule.target);
+    }
+  }
+  return ToResolution(kAliasIt->second.target);
+}
+
+auto ActivityResolutionTable::BuildProjectPath(
+    std::string_view mapped_description) const -> std::string {
+  const std::vector<std::string_view> kParts =
+      SplitView(mapped_description, '_');
+  if (kParts.empty()) {
+    return {};
+  }
+
+  const std::string_view kTopParent = ResolveTopParent(kParts.front());
+  std::string project_path;
+  project_path.reserve(kTopParent.size() + mapped_description.size());
+  project_path.append(kTopParent);
+  for (size_t index = 1; index < kParts.size(); ++index) {
+    project_path.push_back('_');
+    project_path.append(kParts[index]);
+  }
+  return project_path;
+}
+
+auto ActivityResolutionTable::IsWakeKeyword(std::string_view description) const
+    -> bool {
+  return wake_keywords_.contains(description);
+}
+
+auto ActivityResolutionTable::IsKnownKeyword(
+    std::string_view description) const -> bool {
+  return known_keywords_.contains(description);
+}
+
+auto ActivityResolutionTable::ProjectPath(std::uint32_t project_id) const
+    -> const std::string& {
+  return project_paths_.at(project_id);
+}
+
+auto ActivityResolutionTable::ProjectCount() const -> std::size_t {
+  return project_paths_.size();
+}
+
+auto ActivityResolutionTable::ResolveTopParent(
+    std::string_view top_parent) const -> std::string_view {
+  const auto kIt = top_parents_.find(top_parent);
+  return kIt == top_parents_.end() ? top_parent
+                                   : std::string_view(kIt->second);
+}
+
+auto ActivityResolutionTable::ToResolution(const CompiledTarget& target) const
+    -> ActivityResolution {
+  if (!target.has_activity) {
+    return {};
+  }
+  return {.has_activity = true,
+          .project_id = target.project_id,
+          .project_path = project_paths_[target.project_id]};
+}
+
+auto ActivityResolutionTable::CompileTarget(std::string_view mapped_description)
+    -> CompiledTarget {
+  if (mapped_description.empty()) {
+    return {};
+  }
+  std::string project_path = BuildProjectPath(mapped_description);
+  const auto kIt = project_ids_.find(project_path);
+  if (kIt != project_ids_.end()) {
+    return {.has_activity = true, .project_id = kIt->second};
+  }
+  const auto kProjectId = static_cast<std::uint32_t>(project_paths_.size());
+  project_ids_.emplace(project_path, kProjectId);
+  project_paths_.push_back(std::move(project_path));
+  return {.has_activity = true, .project_id = kProjectId};
+}
@@ -0,0 +1,114 @@
+// domain/logic/converter/resolution/activity_resolution_table.hpp
+#ifndef DOMAIN_LOGIC_CONVERTER_RESOLUTION_ACTIVITY_RESOLUTION_TABLE_H_
+#define DOMAIN_LOGIC_CONVERTER_RESOLUTION_ACTIVITY_RESOLUTION_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "domain/types/converter_config.hpp"
+
+struct TransparentStringHash {
+  using is_transparent = void;
+
+  [[nodiscard]] auto operator()(std::string_view value) const noexcept
+      -> std::size_t {
+    return std::hash<std::string_view>{}(value);
+  }
+};
+
+struct ActivityResolution {
+  static constexpr std::uint32_t kUncompiledProjectId =
+      std::numeric_limits<std::uint32_t>::max();
+
+  // 映射结果为空时该事件不产生活动（与历史行为一致）。
+  bool has_activity = false;
+  // 预编译命中时指向表内的规范路径；未命中时为 kUncompiledProjectId，
+  // 调用方需通过 BuildProjectPath(description) 现场拼接。
+  std::uint32_t project_id = kUncompiledProjectId;
+  std::string_view project_path;
+};
+
+/**
+ * @brief 由 ConverterConfig 一次性编译出的只读活动解析表。
+ *
+ * 每个别名键直接映射到预拼接好的规范 project_path（已应用 text_mapping、
+ * text_duration_mapping 与顶层父级替换）、驻留的 project id 以及按阈值
+ * 排序的时长规则；查找使用透明哈希，按 string_view 查询不分配内存。
+ * 结构校验复用同一张表判断关键字是否已配置。
+ *
+ * 表在配置加载时编译并随 ConverterConfig::activity_resolution 共享；
+ * 手工构造、未安装表的配置由 ForConfig 现场编译。
+ */
+class ActivityResolutionTable {
+ public:
+  [[nodiscard]] static auto Compile(const ConverterConfig& config)
+      -> std::shared_ptr<const ActivityResolutionTable>;
+
+  // 优先返回配置上已安装的表，否则现场编译一份。
+  [[nodiscard]] static auto ForConfig(const ConverterConfig& config)
+      -> std::shared_ptr<const ActivityResolutionTable>;
+
+  [[nodiscard]] auto Resolve(std::string_view description,
+                             int duration_minutes) const -> ActivityResolution;
+
+  // 按 '_' 拆分，只替换首段的顶层父级后重新拼接。
+  [[nodiscard]] auto BuildProjectPath(std::string_view mapped_description) const
+      -> std::string;
+
+  [[nodiscard]] auto IsWakeKeyword(std::string_view description) const -> bool;
+  // 校验器认可的活动关键字（别名、时长别名、顶层父级与唤醒词）。
+  [[nodiscard]] auto IsKnownKeyword(std::string_view description) const
+      -> bool;
+
+  [[nodiscard]] auto ProjectPath(std::uint32_t project_id) const
+      -> const std::string&;
+  [[nodiscard]] auto ProjectCount() const -> std::size_t;
+
+ private:
+  struct CompiledTarget {
+    bool has_activity = false;
+    std::uint32_t project_id = ActivityResolution::kUncompiledProjectId;
+  };
+
+  struct CompiledDurationRule {
+    int less_than_minutes = 0;
+    CompiledTarget target;
+  };
+
+  struct CompiledAlias {
+    CompiledTarget target;
+    std::vector<CompiledDurationRule> duration_rules;
+  };
+
+  using AliasMap = std::unordered_map<std::string, CompiledAlias,
+                                      TransparentStringHash, std::equal_to<>>;
+  using ParentMap = std::unordered_map<std::string, std::string,
+                                       TransparentStringHash, std::equal_to<>>;
+  using KeywordSet = std::unordered_set<std::string, TransparentStringHash,
+                                        std::equal_to<>>;
+
+  [[nodiscard]] auto ResolveTopParent(std::string_view top_parent) const
+      -> std::string_view;
+  [[nodiscard]] auto ToResolution(const CompiledTarget& target) const
+      -> ActivityResolution;
+  auto CompileTarget(std::string_view mapped_description) -> CompiledTarget;
+
+  AliasMap aliases_;
+  ParentMap top_parents_;
+  KeywordSet wake_keywords_;
+  KeywordSet known_keywords_;
+  std::vector<std::string> project_paths_;
+  std::unordered_map<std::string, std::uint32_t, TransparentStringHash,
+                     std::equal_to<>>
+      project_ids_;
+};
+
+#endif  // DOMAIN_LOGIC_CONVERTER_RESOLUTION_ACTIVITY_RESOLUTION_TABLE_H_
@@ -0,0 +1,145 @@
+// domain/logic/lexer/txt_line_lexer.cpp
+#include "domain/logic/lexer/txt_line_lexer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+import tracer.core.shared.string_utils;
+
+namespace txt_lexer {
+
+using tracer::core::shared::string_utils::TrimView;
+
+namespace {
+constexpr size_t kYearMarkerLength = 5;
+constexpr char kYearMarkerPrefix = 'y';
+constexpr size_t kMonthMarkerLength = 3;
+constexpr char kMonthMarkerPrefix = 'm';
+constexpr size_t kDateMarkerLength = 4;
+constexpr size_t kTimeDigitsLength = 4;
+constexpr int kDecimalBase = 10;
+constexpr int kMinMonth = 1;
+constexpr int kMaxMonth = 12;
+constexpr size_t kAverageLineLength = 16;
+// Inline remark delimiters. Example: "1026math //note" -> remark "note".
+constexpr std::array<std::string_view, 3> kRemarkDelimiters = {"//", "#", ";"};
+
+[[nodiscard]] auto IsAsciiDigit(char value) -> bool {
+  return value >= '0' && value <= '9';
+}
+
+[[nodiscard]] auto IsAllAsciiDigits(std::string_view value) -> bool {
+  return std::ranges::all_of(
+      value, [](char item) -> bool { return IsAsciiDigit(item); });
+}
+
+[[nodiscard]] auto TwoDigitValue(std::string_view value, size_t offset)
+    -> int {
+  return ((value[offset] - '0') * kDecimalBase) + (value[offset + 1] - '0');
+}
+}  // namespace
+
+TxtLineLexer::TxtLineLexer(std::string remark_prefix)
+    : remark_prefix_(std::move(remark_prefix)) {}
+
+auto TxtLineLexer::IsYear(std::string_view line) -> bool {
+  return line.length() == kYearMarkerLength && line[0] == kYearMarkerPrefix &&
+         IsAllAsciiDigits(line.substr(1));
+}
+
+auto TxtLineLexer::IsMonth(std::string_view line) -> bool {
+  if (line.length() != kMonthMarkerLength || line[0] != kMonthMarkerPrefix ||
+      !IsAllAsciiDigits(line.substr(1))) {
+    return false;
+  }
+  const int kMonthValue = TwoDigitValue(line, 1);
+  return kMonthValue >= kMinMonth && kMonthValue <= kMaxMonth;
+}
+
+auto TxtLineLexer::IsDate(std::string_view line) -> bool {
+  return line.length() == kDateMarkerLength && IsAllAsciiDigits(line);
+}
+
+auto TxtLineLexer::SplitInlineRemark(std::string_view remaining_line,
+                                     std::string_view& description,
+                                     std::string_view& remark) -> void {
+  size_t comment_pos = std::string_view::npos;
+  std::string_view chosen_delimiter;
+
+  // Multiple inline remark markers are allowed; pick the earliest one so
+  // "0232foo //a #b" keeps description as "foo" and remark as "a #b".
+  for (const std::string_view kDelimiter : kRemarkDelimiters) {
+    const size_t kPos = remaining_line.find(kDelimiter);
+    if (kPos != std::string_view::npos &&
+        (comment_pos == std::string_view::npos || kPos < comment_pos)) {
+      comment_pos = kPos;
+      chosen_delimiter = kDelimiter;
+    }
+  }
+
+  if (comment_pos == std::string_view::npos) {
+    description = TrimView(remaining_line);
+    remark = {};
+    return;
+  }
+  description = TrimView(remaining_line.substr(0, comment_pos));
+  remark =
+      TrimView(remaining_line.substr(comment_pos + chosen_delimiter.length()));
+}
+
+auto TxtLineLexer::LexLine(std::string_view raw_line, int line_number) const
+    -> TxtLineToken {
+  TxtLineToken token;
+  token.line_number = line_number;
+  token.raw = raw_line;
+  token.text = TrimView(raw_line);
+  const std::string_view kText = token.text;
+
+  if (IsYear(kText)) {
+    token.kind = TxtLineKind::kYear;
+  } else if (IsMonth(kText)) {
+    token.kind = TxtLineKind::kMonth;
+  } else if (IsDate(kText)) {
+    token.kind = TxtLineKind::kDate;
+  } else if (!remark_prefix_.empty() && kText.starts_with(remark_prefix_)) {
+    token.kind = TxtLineKind::kRemark;
+    token.remark_body = kText.substr(remark_prefix_.length());
+  } else if (kText.length() > kTimeDigitsLength &&
+             IsAllAsciiDigits(kText.substr(0, kTimeDigitsLength))) {
+    token.kind = TxtLineKind::kEvent;
+    token.time_hhmm = kText.substr(0, kTimeDigitsLength);
+    token.hour = TwoDigitValue(kText, 0);
+    token.minute = TwoDigitValue(kText, 2);
+    SplitInlineRemark(kText.substr(kTimeDigitsLength), token.description,
+                      token.inline_remark);
+  }
+  return token;
+}
+
+auto TxtLineLexer::Tokenize(std::string_view content) const
+    -> std::vector<TxtLineToken> {
+  std::vector<TxtLineToken> tokens;
+  tokens.reserve(content.size() / kAverageLineLength);
+
+  int line_number = 0;
+  size_t line_begin = 0;
+  while (line_begin < content.size()) {
+    size_t line_end = content.find('\n', line_begin);
+    if (line_end == std::string_view::npos) {
+      line_end = content.size();
+    }
+    const std::string_view kRawLine =
+        content.substr(line_begin, line_end - line_begin);
+    line_begin = line_end + 1;
+    ++line_number;
+
+    TxtLineToken token = LexLine(kRawLine, line_number);
+    if (!token.text.empty()) {
+      tokens.push_back(token);
+    }
+  }
+  return tokens;
+}
+
+}  // namespace txt_lexer
@@ -0,0 +1,79 @@
+// domain/logic/lexer/txt_line_lexer.hpp
+#ifndef DOMAIN_LOGIC_LEXER_TXT_LINE_LEXER_H_
+#define DOMAIN_LOGIC_LEXER_TXT_LINE_LEXER_H_
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace txt_lexer {
+
+enum class TxtLineKind {
+  kYear,          // y2025
+  kMonth,         // m01..m12
+  kDate,          // MMDD
+  kRemark,        // <remark_prefix>...
+  kEvent,         // HHMM<description>[//|#|; remark]
+  kUnrecognized,  // 其他非空行
+};
+
+/**
+ * @brief TXT 单行词法结果。所有视图都指向原始内容缓冲区，
+ *        调用方必须保证缓冲区在 token 使用期间存活且不被修改。
+ */
+struct TxtLineToken {
+  TxtLineKind kind = TxtLineKind::kUnrecognized;
+  int line_number = 0;
+  std::string_view raw;   // 未裁剪的整行（不含换行符）
+  std::string_view text;  // 去除首尾空白后的行
+
+  // kRemark：去掉前缀后的剩余部分（未裁剪）。
+  std::string_view remark_body;
+
+  // kEvent：前 4 位时间数字及其拆分结果，描述与行内备注均已裁剪。
+  std::string_view time_hhmm;
+  int hour = 0;
+  int minute = 0;
+  std::string_view description;
+  std::string_view inline_remark;
+
+  [[nodiscard]] auto IsTimeInRange() const -> bool {
+    return hour <= 23 && minute <= 59;
+  }
+};
+
+/**
+ * @brief 结构校验与解析共用的 TXT 行词法器。
+ *
+ * 每行只分类一次（年/月/日/备注/事件），并以视图形式切出时间、描述与
+ * 行内备注；空行不产生 token。分类顺序与历史实现一致：年、月、日、
+ * 备注前缀、事件。
+ */
+class TxtLineLexer {
+ public:
+  explicit TxtLineLexer(std::string remark_prefix);
+
+  [[nodiscard]] auto Tokenize(std::string_view content) const
+      -> std::vector<TxtLineToken>;
+
+  [[nodiscard]] auto LexLine(std::string_view raw_line, int line_number) const
+      -> TxtLineToken;
+
+  [[nodiscard]] static auto IsYear(std::string_view line) -> bool;
+  [[nodiscard]] static auto IsMonth(std::string_view line) -> bool;
+  [[nodiscard]] static auto IsDate(std::string_view line) -> bool;
+
+  /**
+   * @brief 按最早出现的分隔符（"//"、"#"、";"）切分描述与行内备注。
+   */
+  static auto SplitInlineRemark(std::string_view remaining_line,
+                                std::string_view& description,
+                                std::string_view& remark) -> void;
+
+ private:
+  std::string remark_prefix_;
+};
+
+}  // namespace txt_lexer
+
+#endif  // DOMAIN_LOGIC_LEXER_TXT_LINE_LEXER_H_
@@ -8,52 +8,13 @@
 #include <string_view>
 #include <unordered_set>
 
+import tracer.core.shared.civil_time;
+
 namespace validator::structure {
 namespace {
-constexpr int kDaysInNormalFebruary = 28;
-constexpr int kDaysInLeapFebruary = 29;
-constexpr int kDaysInSmallMonth = 30;
-constexpr int kDaysInBigMonth = 31;
-constexpr int kMonthsInYear = 12;
-
-constexpr int kYearDivisor4 = 4;
-constexpr int kYearDivisor100 = 100;
-constexpr int kYearDivisor400 = 400;
-
-constexpr int kApril = 4;
-constexpr int kJune = 6;
-constexpr int kSeptember = 9;
-constexpr int kNovember = 11;
-
-constexpr int kDateStringLength = 10;
-constexpr int kIsoYearLength = 4;
-constexpr int kIsoMonthOffset = 5;
-constexpr int kIsoMonthLength = 2;
-constexpr int kIsoYearMonthLength = 7;
-constexpr int kIsoDayOffset = 8;
-constexpr int kIsoDayLength = 2;
-constexpr int kSingleDigitThreshold = 10;
+namespace civil_time = tracer::core::shared::civil_time;
 
-auto IsLeap(int year) -> bool {
-  return (year % kYearDivisor4 == 0 &&
-          (year % kYearDivisor100 != 0 || year % kYearDivisor400 == 0));
-}
-
-// NOLINTBEGIN(bugprone-easily-swappable-parameters)
-auto DaysInMonth(int year, int month) -> int {
-  if (month < 1 || month > kMonthsInYear) {
-    return 0;
-  }
-  if (month == 2) {
-    return IsLeap(year) ? kDaysInLeapFebruary : kDaysInNormalFebruary;
-  }
-  if (month == kApril || month == kJune || month == kSeptember ||
-      month == kNovember) {
-    return kDaysInSmallMonth;
-  }
-  return kDaysInBigMonth;
-}
-// NOLINTEND(bugprone-easily-swappable-parameters)
+constexpr int kIsoYearMonthLength = 7;
 
 void ValidateActivityDuration(const DailyLog& day,
                               std::vector<Diagnostic>& diagnostics) {
@@ -147,25 +108,26 @@ void ValidateDateContinuity(const std::vector<DailyLog>& days,
   }
 
   const auto& first_day = days[0];
-  if (first_day.date.length() != kDateStringLength) {
+  const std::optional<civil_time::CivilDate> kFirstDate =
+      civil_time::ParseIsoDate(first_day.date);
+  if (!kFirstDate.has_value()) {
     return;
   }
 
   std::string yyyy_mm = first_day.date.substr(0, kIsoYearMonthLength);
-  int year = std::stoi(first_day.date.substr(0, kIsoYearLength));
-  int month =
-      std::stoi(first_day.date.substr(kIsoMonthOffset, kIsoMonthLength));
 
   std::set<int> days_found;
   for (const auto& day : days) {
-    if (day.date.starts_with(yyyy_mm) &&
-        day.date.length() == kDateStringLength) {
-      days_found.insert(
-          std::stoi(day.date.substr(kIsoDayOffset, kIsoDayLength)));
+    const std::optional<civil_time::CivilDate> kDate =
+        civil_time::ParseIsoDate(day.date);
+    if (kDate.has_value() && kDate->year == kFirstDate->year &&
+        kDate->month == kFirstDate->month) {
+      days_found.insert(kDate->day);
     }
   }
 
-  int check_until = DaysInMonth(year, month);
+  int check_until =
+      civil_time::DaysInMonth(kFirstDate->year, kFirstDate->month);
   if (mode == DateCheckMode::kContinuity) {
     if (days_found.empty()) {
       return;
@@ -175,9 +137,10 @@ void ValidateDateContinuity(const std::vector<DailyLog>& days,
 
   for (int day_val = 1; day_val <= check_until; ++day_val) {
     if (!days_found.contains(day_val)) {
-      std::string missing_date = yyyy_mm + "-" +
-                                 (day_val < kSingleDigitThreshold ? "0" : "") +
-                                 std::to_string(day_val);
+      std::string missing_date =
+          civil_time::FormatIsoDate({.year = kFirstDate->year,
+                                     .month = kFirstDate->month,
+                                     .day = day_val});
       std::string error_msg =
           "Missing date detected in month " + yyyy_mm + ": " + missing_date;
       if (mode == DateCheckMode::kContinuity) {
@@ -1,8 +1,7 @@
 // domain/logic/validator/txt/facade/text_validator.cpp
 #include "domain/logic/validator/txt/facade/text_validator.hpp"
 
-#include <iostream>
-#include <sstream>
+#include <vector>
 
 import tracer.core.shared.string_utils;
 import tracer.core.domain.logic.validator.txt.rules;
@@ -11,13 +10,16 @@ namespace validator::txt {
 
 using tracer::core::domain::modlogic::validator_txt::LineRules;
 using tracer::core::domain::modlogic::validator_txt::StructureRules;
-using tracer::core::shared::string_utils::Trim;
+using tracer::core::shared::string_utils::TrimView;
+using txt_lexer::TxtLineKind;
 
 struct TextValidator::PImpl {
   LineRules line_processor;
   StructureRules structural_validator;
+  txt_lexer::TxtLineLexer lexer;
 
-  explicit PImpl(const ConverterConfig& config) : line_processor(config) {}
+  explicit PImpl(const ConverterConfig& config)
+      : line_processor(config), lexer(config.remark_prefix) {}
 };
 
 TextValidator::TextValidator(const ConverterConfig& config)
@@ -29,56 +31,75 @@ TextValidator::~TextValidator() = default;
 auto TextValidator::Validate(const std::string& filename,
                              const std::string& content,
                              std::set<Error>& errors) -> bool {
+  const std::vector<txt_lexer::TxtLineToken> kTokens =
+      pimpl_->lexer.Tokenize(content);
+  return Validate(filename, kTokens, errors);
+}
+
+// NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+auto TextValidator::Validate(const std::string& filename,
+                             std::span<const txt_lexer::TxtLineToken> tokens,
+                             std::set<Error>& errors) -> bool {
   // [关键修复] 每次验证新文件前，必须重置结构验证器的状态
   // 否则上一个文件的状态（如 has_seen_year）会影响当前文件，导致"Multiple year
   // headers"误报
   pimpl_->structural_validator.Reset();
 
-  std::stringstream content_ss(content);
-  std::string line;
   int line_number = 0;
+  const SourcePath kFilePath(filename);
 
-  while (std::getline(content_ss, line)) {
-    line_number++;
-    std::string trimmed_line = Trim(line);
-    if (trimmed_line.empty()) {
-      continue;
-    }
-    SourceSpan span{.file_path = filename,
+  for (const auto& token : tokens) {
+    line_number = token.line_number;
+    const std::string kTrimmedLine(token.text);
+    SourceSpan span{.file_path = kFilePath,
                     .line_start = line_number,
                     .line_end = line_number,
                     .column_start = 1,
-                    .column_end = static_cast<int>(line.length()),
-                    .raw_text = line};
-
-    if (LineRules::IsYear(trimmed_line)) {
-      pimpl_->structural_validator.ProcessYearLine(line_number, trimmed_line,
-                                                   errors, span);
-    } else if (LineRules::IsMonth(trimmed_line)) {
-      pimpl_->structural_validator.ProcessMonthLine(line_number, trimmed_line,
-                                                    errors, span);
-    } else if (LineRules::IsDate(trimmed_line)) {
-      pimpl_->structural_validator.ProcessDateLine(line_number, trimmed_line,
-                                                   errors, span);
-    } else if (pimpl_->line_processor.IsRemark(trimmed_line)) {
-      pimpl_->structural_validator.ProcessRemarkLine(line_number, trimmed_line,
+                    .column_end = static_cast<int>(token.raw.length()),
+                    .raw_text = std::string(token.raw)};
+
+    switch (token.kind) {
+      case TxtLineKind::kYear:
+        pimpl_->structural_validator.ProcessYearLine(line_number, kTrimmedLine,
+                                                     errors, span);
+        break;
+      case TxtLineKind::kMonth:
+        pimpl_->structural_validator.ProcessMonthLine(
+            line_number, kTrimmedLine, errors, span);
+        break;
+      case TxtLineKind::kDate:
+        pimpl_->structural_validator.ProcessDateLine(line_number, kTrimmedLine,
                                                      errors, span);
-    } else if (pimpl_->line_processor.IsValidEventLine(
-                   trimmed_line, line_number, errors, span)) {
-      pimpl_->structural_validator.ProcessEventLine(line_number, trimmed_line,
-                                                    errors, span);
-    } else {
-      StructureRules::ProcessUnrecognizedLine(line_number, trimmed_line, errors,
-                                              span);
+        break;
+      case TxtLineKind::kRemark:
+        if (!TrimView(token.remark_body).empty()) {
+          pimpl_->structural_validator.ProcessRemarkLine(
+              line_number, kTrimmedLine, errors, span);
+        } else {
+          StructureRules::ProcessUnrecognizedLine(line_number, kTrimmedLine,
+                                                  errors, span);
+        }
+        break;
+      case TxtLineKind::kEvent:
+        if (pimpl_->line_processor.ValidateEventToken(token, errors, span)) {
+          pimpl_->structural_validator.ProcessEventLine(
+              line_number, kTrimmedLine, errors, span);
+        } else {
+          StructureRules::ProcessUnrecognizedLine(line_number, kTrimmedLine,
+                                                  errors, span);
+        }
+        break;
+      case TxtLineKind::kUnrecognized:
+        StructureRules::ProcessUnrecognizedLine(line_number, kTrimmedLine,
+                                                errors, span);
+        break;
     }
 
     // 检查文件头是否缺失年份
-    // 注意：这里逻辑稍微调整，只有当遇到有效内容（且还没见年份）时才报错，或者文件结束检查
-    // 原有逻辑在每一行都查，可能会报多次，但这里保持原样以确保尽早发现
     // 这里采用 fail-fast：缺失 year header
     // 时立即返回，避免后续结构规则产生级联噪声错误。
     if (!pimpl_->structural_validator.HasSeenYear() &&
-        !LineRules::IsYear(trimmed_line)) {
+        token.kind != TxtLineKind::kYear) {
       errors.insert({line_number,
                      "The file must start with a year header (e.g., 'y2025').",
                      ErrorType::kSourceMissingYearHeader, span});
@@ -91,7 +112,7 @@ auto TextValidator::Validate(const std::string& filename,
     const int kLine = line_number > 0 ? line_number : 1;
     errors.insert({kLine, "Month header (mMM) is required before date lines.",
                    ErrorType::kStructural,
-                   SourceSpan{.file_path = filename,
+                   SourceSpan{.file_path = kFilePath,
                               .line_start = kLine,
                               .line_end = kLine,
                               .column_start = 1,
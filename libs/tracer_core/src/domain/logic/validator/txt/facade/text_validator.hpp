@@ -4,8 +4,10 @@
 
 #include <memory>
 #include <set>
+#include <span>
 #include <string>
 
+#include "domain/logic/lexer/txt_line_lexer.hpp"
 #include "domain/logic/validator/common/validator_utils.hpp"
 #include "domain/types/converter_config.hpp"
 
@@ -20,6 +22,12 @@ class TextValidator {
   auto Validate(const std::string& filename, const std::string& content,
                 std::set<Error>& errors) -> bool;
 
+  // 校验已词法化的行序列；流水线在结构校验与转换之间共享同一份 token。
+  // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+  auto Validate(const std::string& filename,
+                std::span<const txt_lexer::TxtLineToken> tokens,
+                std::set<Error>& errors) -> bool;
+
  private:
   struct PImpl;
   std::unique_ptr<PImpl> pimpl_;
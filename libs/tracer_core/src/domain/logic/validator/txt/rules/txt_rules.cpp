@@ -1,130 +1,71 @@
 // domain/logic/validator/txt/rules/txt_rules.cpp
 #include "domain/logic/validator/txt/rules/txt_rules.hpp"
 
-#include <algorithm>
-#include <array>
+#include <string_view>
+
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
 
 import tracer.core.shared.string_utils;
 
 namespace validator::txt {
 
-using tracer::core::shared::string_utils::Trim;
+using tracer::core::shared::string_utils::TrimView;
 
 namespace {
 constexpr int kMinMonth = 1;
 constexpr int kMaxMonth = 12;
 }  // namespace
 
-LineRules::LineRules(const ConverterConfig& config) : config_(config) {
-  for (const auto& entry : config.text_mapping) {
-    valid_event_keywords_.insert(entry.first);
-  }
-  for (const auto& entry : config.text_duration_mapping) {
-    valid_event_keywords_.insert(entry.first);
-  }
-  wake_keywords_.insert(config.wake_keywords.begin(),
-                        config.wake_keywords.end());
-  for (const auto& entry : config.top_parent_mapping) {
-    valid_event_keywords_.insert(entry.first);
-  }
-  for (const auto& entry : config.initial_top_parents) {
-    valid_event_keywords_.insert(entry.first);
-  }
-}
+LineRules::LineRules(const ConverterConfig& config)
+    : remark_prefix_(config.remark_prefix),
+      lexer_(config.remark_prefix),
+      resolution_table_(ActivityResolutionTable::ForConfig(config)) {}
 
 auto LineRules::IsYear(const std::string& line) -> bool {
-  constexpr size_t kYearStringLength = 5;
-  if (line.length() != kYearStringLength || line[0] != 'y') {
-    return false;
-  }
-  return std::all_of(line.begin() + 1, line.end(), ::isdigit);
+  return txt_lexer::TxtLineLexer::IsYear(line);
 }
 
 auto LineRules::IsMonth(const std::string& line) -> bool {
-  constexpr size_t kMonthStringLength = 3;
-  if (line.length() != kMonthStringLength || line[0] != 'm') {
-    return false;
-  }
-  if (!std::all_of(line.begin() + 1, line.end(), ::isdigit)) {
-    return false;
-  }
-  int month = 0;
-  try {
-    month = std::stoi(line.substr(1));
-  } catch (const std::exception&) {
-    return false;
-  }
-  return month >= kMinMonth && month <= kMaxMonth;
+  return txt_lexer::TxtLineLexer::IsMonth(line);
 }
 
 auto LineRules::IsDate(const std::string& line) -> bool {
-  constexpr size_t kDateStringLength = 4;
-  return line.length() == kDateStringLength &&
-         std::ranges::all_of(line, [](unsigned char kChar) -> bool {
-           return std::isdigit(kChar) != 0;
-         });
+  return txt_lexer::TxtLineLexer::IsDate(line);
 }
 
 auto LineRules::IsRemark(const std::string& line) const -> bool {
-  const std::string& prefix = config_.remark_prefix;
-  if (prefix.empty() || !line.starts_with(prefix)) {
+  if (remark_prefix_.empty() || !line.starts_with(remark_prefix_)) {
     return false;
   }
-  return !Trim(line.substr(prefix.length())).empty();
+  return !TrimView(std::string_view(line).substr(remark_prefix_.length()))
+              .empty();
 }
 
 auto LineRules::IsValidEventLine(const std::string& line, int line_number,
                                  std::set<Error>& errors,
                                  const std::optional<SourceSpan>& span) const
     -> bool {
-  constexpr size_t kMinimumEventLineLength = 5;
-  constexpr size_t kTimePrefixLength = 4;
-  constexpr int kMaxHours = 23;
-  constexpr int kMaxMinutes = 59;
+  return ValidateEventToken(lexer_.LexLine(line, line_number), errors, span);
+}
 
-  if (line.length() < kMinimumEventLineLength ||
-      !std::all_of(line.begin(), line.begin() + kTimePrefixLength, ::isdigit)) {
+auto LineRules::ValidateEventToken(const txt_lexer::TxtLineToken& token,
+                                   std::set<Error>& errors,
+                                   const std::optional<SourceSpan>& span) const
+    -> bool {
+  if (token.kind != txt_lexer::TxtLineKind::kEvent || !token.IsTimeInRange() ||
+      token.description.empty()) {
     return false;
   }
-  try {
-    int hours = std::stoi(line.substr(0, 2));
-    int minutes = std::stoi(line.substr(2, 2));
-    if (hours > kMaxHours || minutes > kMaxMinutes) {
-      return false;
-    }
 
-    const std::string kRemainingLine = line.substr(kTimePrefixLength);
-    size_t comment_pos = std::string::npos;
-    constexpr std::array<const char*, 3> kDelimiters = {"//", "#", ";"};
-    // Keep parser/validator behavior aligned: inline remark begins at the
-    // earliest delimiter occurrence.
-    for (const char* delimiter : kDelimiters) {
-      size_t pos = kRemainingLine.find(delimiter);
-      if (pos != std::string::npos &&
-          (comment_pos == std::string::npos || pos < comment_pos)) {
-        comment_pos = pos;
-      }
-    }
-
-    const std::string kDescription =
-        Trim(kRemainingLine.substr(0, comment_pos));
-    if (kDescription.empty()) {
-      return false;
-    }
-
-    if (!wake_keywords_.contains(kDescription) &&
-        !valid_event_keywords_.contains(kDescription)) {
-      // Unknown activity is a semantic validation error, not a syntax error:
-      // the line is structurally valid but references unmapped domain terms.
-      errors.insert({line_number,
-                     "Unrecognized activity '" + kDescription +
-                         "'. Please check spelling or update config file.",
-                     ErrorType::kUnrecognizedActivity, span});
-    }
-    return true;
-  } catch (const std::exception&) {
-    return false;
+  if (!resolution_table_->IsKnownKeyword(token.description)) {
+    // Unknown activity is a semantic validation error, not a syntax error:
+    // the line is structurally valid but references unmapped domain terms.
+    errors.insert({token.line_number,
+                   "Unrecognized activity '" + std::string(token.description) +
+                       "'. Please check spelling or update config file.",
+                   ErrorType::kUnrecognizedActivity, span});
   }
+  return true;
 }
 
 void StructureRules::Reset() {
@@ -2,11 +2,12 @@
 #ifndef DOMAIN_LOGIC_VALIDATOR_TXT_RULES_TXT_RULES_H_
 #define DOMAIN_LOGIC_VALIDATOR_TXT_RULES_TXT_RULES_H_
 
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
-#include <unordered_set>
 
+#include "domain/logic/lexer/txt_line_lexer.hpp"
 #include "domain/logic/validator/common/validator_utils.hpp"
 #include "domain/model/source_span.hpp"
 #include "domain/types/converter_config.hpp"
@@ -26,10 +27,16 @@ class LineRules {
                         std::set<Error>& errors,
                         const std::optional<SourceSpan>& span) const -> bool;
 
+  // 校验已由词法器切分好的事件 token：时间范围与描述非空为结构要求，
+  // 未知活动只记录语义错误而不影响结构判定。
+  auto ValidateEventToken(const txt_lexer::TxtLineToken& token,
+                          std::set<Error>& errors,
+                          const std::optional<SourceSpan>& span) const -> bool;
+
  private:
-  const ConverterConfig& config_;
-  std::unordered_set<std::string> valid_event_keywords_;
-  std::unordered_set<std::string> wake_keywords_;
+  std::string remark_prefix_;
+  txt_lexer::TxtLineLexer lexer_;
+  std::shared_ptr<const ActivityResolutionTable> resolution_table_;
 };
 
 class StructureRules {
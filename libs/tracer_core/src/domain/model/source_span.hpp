@@ -2,15 +2,96 @@
 #ifndef DOMAIN_MODEL_SOURCE_SPAN_H_
 #define DOMAIN_MODEL_SOURCE_SPAN_H_
 
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+
+// 源文件路径的共享只读句柄：同一文件解析出的所有 span 共享一份路径字符串，
+// 拷贝只增加引用计数，避免每个事件都复制一次完整路径。
+class SourcePath {
+ public:
+  SourcePath() = default;
+  SourcePath(std::string path)  // NOLINT(google-explicit-constructor)
+      : value_(path.empty() ? nullptr
+                            : std::make_shared<const std::string>(
+                                  std::move(path))) {}
+  SourcePath(std::string_view path)  // NOLINT(google-explicit-constructor)
+      : SourcePath(std::string(path)) {}
+  SourcePath(const char* path)  // NOLINT(google-explicit-constructor)
+      : SourcePath(std::string_view(path == nullptr ? "" : path)) {}
+
+  [[nodiscard]] auto empty() const -> bool { return value_ == nullptr; }
+  [[nodiscard]] auto str() const -> const std::string& {
+    static const std::string kEmpty;
+    return value_ == nullptr ? kEmpty : *value_;
+  }
+
+  operator std::string_view() const {  // NOLINT(google-explicit-constructor)
+    return str();
+  }
+  operator const std::string&() const {  // NOLINT(google-explicit-constructor)
+    return str();
+  }
+
+  friend auto operator==(const SourcePath& lhs, const SourcePath& rhs)
+      -> bool {
+    return lhs.value_ == rhs.value_ || lhs.str() == rhs.str();
+  }
+
+ private:
+  std::shared_ptr<const std::string> value_;
+};
+
+// 源文本行的只读视图：解析器为每个文件共享一份内容缓冲区，span 只记录
+// 偏移与长度，不再为每个事件复制整行文本。从字符串构造时独占一份缓冲区。
+class SourceLine {
+ public:
+  SourceLine() = default;
+  SourceLine(std::string text)  // NOLINT(google-explicit-constructor)
+      : length_(text.size()),
+        buffer_(text.empty() ? nullptr
+                             : std::make_shared<const std::string>(
+                                   std::move(text))) {}
+  SourceLine(std::string_view text)  // NOLINT(google-explicit-constructor)
+      : SourceLine(std::string(text)) {}
+  SourceLine(const char* text)  // NOLINT(google-explicit-constructor)
+      : SourceLine(std::string_view(text == nullptr ? "" : text)) {}
+  SourceLine(std::shared_ptr<const std::string> buffer, std::size_t offset,
+             std::size_t length)
+      : offset_(offset), length_(length), buffer_(std::move(buffer)) {}
+
+  [[nodiscard]] auto empty() const -> bool { return length_ == 0; }
+  [[nodiscard]] auto view() const -> std::string_view {
+    return buffer_ == nullptr
+               ? std::string_view{}
+               : std::string_view(*buffer_).substr(offset_, length_);
+  }
+  [[nodiscard]] auto str() const -> std::string { return std::string(view()); }
+
+  operator std::string_view() const {  // NOLINT(google-explicit-constructor)
+    return view();
+  }
+
+  friend auto operator==(const SourceLine& lhs, const SourceLine& rhs)
+      -> bool {
+    return lhs.view() == rhs.view();
+  }
+
+ private:
+  std::size_t offset_ = 0;
+  std::size_t length_ = 0;
+  std::shared_ptr<const std::string> buffer_;
+};
 
 struct SourceSpan {
-  std::string file_path;
+  SourcePath file_path;
   int line_start = 0;
   int line_end = 0;
   int column_start = 0;
   int column_end = 0;
-  std::string raw_text;
+  SourceLine raw_text;
 
   [[nodiscard]] auto HasLine() const -> bool { return line_start > 0; }
 };
@@ -1,11 +1,14 @@
 module;
 
 #include "domain/logic/converter/convert/core/converter_core.hpp"
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
 
 export module tracer.core.domain.logic.converter.core;
 
 export namespace tracer::core::domain::modlogic::converter {
 
+using ::ActivityResolution;
+using ::ActivityResolutionTable;
 using ::DayProcessor;
 using ::LogLinker;
 
@@ -2,6 +2,7 @@ export module tracer.core.domain.logic;
 
 export import tracer.core.domain.logic.converter.core;
 export import tracer.core.domain.logic.converter.log_processor;
+export import tracer.core.domain.logic.lexer;
 export import tracer.core.domain.logic.validator.common.diagnostic;
 export import tracer.core.domain.logic.validator.common.validator_utils;
 export import tracer.core.domain.logic.validator.txt.rules;
@@ -0,0 +1,13 @@
+module;
+
+#include "domain/logic/lexer/txt_line_lexer.hpp"
+
+export module tracer.core.domain.logic.lexer;
+
+export namespace tracer::core::domain::modlogic::lexer {
+
+using ::txt_lexer::TxtLineKind;
+using ::txt_lexer::TxtLineLexer;
+using ::txt_lexer::TxtLineToken;
+
+}  // namespace tracer::core::domain::modlogic::lexer
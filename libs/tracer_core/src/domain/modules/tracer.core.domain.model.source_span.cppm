@@ -12,6 +12,8 @@ export namespace tracer::core::domain::model {
 
 export namespace tracer::core::domain::modmodel {
 
+using tracer::core::domain::model::SourceLine;
+using tracer::core::domain::model::SourcePath;
 using tracer::core::domain::model::SourceSpan;
 
 }  // namespace tracer::core::domain::modmodel
@@ -14,5 +14,6 @@ export namespace tracer::core::domain::modtypes {
 
 using tracer::core::domain::types::ConverterConfig;
 using tracer::core::domain::types::DurationMappingRule;
+using tracer::core::domain::types::ProjectClassRuleConfig;
 
 }  // namespace tracer::core::domain::modtypes
@@ -19,6 +19,14 @@ class IProjectInfoProvider {
   // 获取项目路径部分
   [[nodiscard]] virtual auto GetPathParts(std::int64_t project_id) const
       -> std::vector<std::string> = 0;
+
+  // 获取以 '_' 连接的完整项目路径；未知项目返回空串
+  [[nodiscard]] virtual auto GetFullPath(std::int64_t project_id) const
+      -> const std::string& = 0;
+
+  // 获取项目分类掩码（各位含义由基础设施层的分类规则定义）；未知项目返回 0
+  [[nodiscard]] virtual auto GetClassMask(std::int64_t project_id) const
+      -> std::uint32_t = 0;
 };
 
 #endif  // DOMAIN_REPORTS_INTERFACES_I_PROJECT_INFO_PROVIDER_H_
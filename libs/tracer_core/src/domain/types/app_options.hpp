@@ -2,6 +2,7 @@
 #ifndef DOMAIN_TYPES_APP_OPTIONS_H_
 #define DOMAIN_TYPES_APP_OPTIONS_H_
 
+#include <cstddef>
 #include <filesystem>
 
 #include "domain/types/date_check_mode.hpp"
@@ -17,6 +18,8 @@ struct AppOptions {
   bool run_structure_validation_before_conversion = false;
   DateCheckMode date_check_mode = DateCheckMode::kNone;
   bool save_processed_output = false;
+  // 转换/校验阶段的并发上限；0 表示使用 hardware_concurrency。
+  std::size_t max_parallelism = 0;
 };
 
 namespace tracer::core::domain::types {
@@ -3,15 +3,27 @@
 #define DOMAIN_TYPES_CONVERTER_CONFIG_H_
 
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+class ActivityResolutionTable;
+
 struct DurationMappingRule {
   int less_than_minutes = 0;
   std::string value;
 };
 
+// [[project_classes]] 中的一条项目分类规则，语义见
+// ProjectClassRule；名称在安装规则时解析。
+struct ProjectClassRuleConfig {
+  std::string project_class;
+  std::string match;
+  std::string root;
+  std::string token;
+};
+
 struct ConverterConfig {
   std::string remark_prefix;
   std::vector<std::string> header_order;
@@ -19,6 +31,9 @@ struct ConverterConfig {
 
   std::string generated_sleep_project_path = "sleep_night";
 
+  // 为空时使用内置分类规则表。
+  std::vector<ProjectClassRuleConfig> project_class_rules;
+
   std::unordered_map<std::string, std::string> top_parent_mapping;
   std::unordered_map<std::string, std::string> text_mapping;
   std::unordered_map<std::string, std::string> text_duration_mapping;
@@ -27,6 +42,10 @@ struct ConverterConfig {
       duration_mappings;
 
   std::unordered_map<std::string, std::string> initial_top_parents;
+
+  // 配置加载完成后编译的只读解析表（见 ActivityResolutionTable）；
+  // 为空时由使用方现场编译。修改上述映射后必须重新编译或置空。
+  std::shared_ptr<const ActivityResolutionTable> activity_resolution;
 };
 
 namespace tracer::core::domain::types {
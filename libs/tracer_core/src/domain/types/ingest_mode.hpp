@@ -5,6 +5,8 @@
 enum class IngestMode {
   kStandard = 0,
   kSingleTxtReplaceMonth = 1,
+  // 仅重新摄入内容哈希与 ingest_month_sync 不一致的月份。
+  kIncremental = 2,
 };
 
 namespace tracer::core::domain::types {
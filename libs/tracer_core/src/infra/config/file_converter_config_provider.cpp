@@ -6,6 +6,8 @@
 #include <unordered_map>
 #include <utility>
 
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
+
 import tracer.core.infrastructure.config.loader.converter_config_loader;
 
 namespace tracer::core::infrastructure::config {
@@ -29,6 +31,7 @@ auto FileConverterConfigProvider::LoadConverterConfig() const
     for (const auto& [key, val] : initial_top_parents_) {
       config.initial_top_parents[key.string()] = val.string();
     }
+    config.activity_resolution = ActivityResolutionTable::Compile(config);
     cached_config_ = std::move(config);
   }
 
@@ -7,6 +7,7 @@ module;
 #include <utility>
 
 #include "application/ports/pipeline/i_converter_config_provider.hpp"
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
 
 module tracer.core.infrastructure.config.file_converter_config_provider;
 
@@ -33,6 +34,7 @@ auto FileConverterConfigProvider::LoadConverterConfig() const
     for (const auto& [key, value] : initial_top_parents_) {
       config.initial_top_parents[key.string()] = value.string();
     }
+    config.activity_resolution = ActivityResolutionTable::Compile(config);
     cached_config_ = std::move(config);
   }
 
@@ -1,3 +1,4 @@
+#include <cstddef>
 #include <filesystem>
 #include <mutex>
 #include <optional>
@@ -49,6 +50,7 @@ std::optional<CliConfigSnapshotCacheEntry> g_cli_config_snapshot_cache{};
       .converter_config_toml_path =
           app_config.pipeline.interval_processor_config_path,
       .default_save_processed_output = app_config.default_save_processed_output,
+      .default_max_parallelism = app_config.default_max_parallelism,
       .default_date_check_mode = app_config.default_date_check_mode,
       .defaults =
           {
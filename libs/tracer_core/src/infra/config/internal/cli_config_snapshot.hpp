@@ -2,6 +2,7 @@
 #ifndef INFRASTRUCTURE_CONFIG_INTERNAL_CLI_CONFIG_SNAPSHOT_H_
 #define INFRASTRUCTURE_CONFIG_INTERNAL_CLI_CONFIG_SNAPSHOT_H_
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
 #include <string>
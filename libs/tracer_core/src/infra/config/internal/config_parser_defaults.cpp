@@ -1,6 +1,9 @@
 // infra/config/internal/config_parser_defaults.cpp
 #include "infra/config/internal/config_parser_utils_internal.hpp"
 
+#include <cstddef>
+#include <cstdint>
+
 namespace ConfigParserUtils::internal {
 
 auto ParseDateCheckMode(std::string_view mode_str, const fs::path& source_path,
@@ -137,6 +140,17 @@ void ParseSystemSettingsImpl(const toml::table& tbl, const fs::path& exe_path,
                                 source_config_path, section_key, "a boolean")
             .value_or(false);
 
+    if (const auto kValue = TryReadTypedField<std::int64_t>(
+            section, "max_parallelism", source_config_path, section_key,
+            "an integer")) {
+      if (*kValue < 0) {
+        ThrowConfigFieldError(source_config_path,
+                              JoinFieldPath(section_key, "max_parallelism"),
+                              "must be >= 0 (0 = hardware concurrency).");
+      }
+      config.default_max_parallelism = static_cast<std::size_t>(*kValue);
+    }
+
     const bool kCheck =
         TryReadTypedField<bool>(section, "date_check_continuity",
                                 source_config_path, section_key, "a boolean")
@@ -5,7 +5,9 @@
 #include <cstddef>
 #include <filesystem>
 #include <stdexcept>
+#include <string>
 #include <string_view>
+#include <utility>
 
 #include "infra/config/loader/alias_mapping_index_utils.hpp"
 #include "infra/config/validator/converter/rules/converter_rules.hpp"
@@ -137,6 +139,7 @@ auto ConverterConfigLoader::ParseTomlToStruct(const toml::table& tbl,
                                               ConverterConfig& config) -> void {
   ParseBasicConfig(tbl, config);
   ParseGeneratedActivities(tbl, config);
+  ParseProjectClassRules(tbl, config);
   ParseMappings(tbl, config);
   ParseDurationMappings(tbl, config);
 }
@@ -210,6 +213,57 @@ auto ConverterConfigLoader::ParseGeneratedActivities(const toml::table& tbl,
   }
 }
 
+auto ConverterConfigLoader::ParseProjectClassRules(const toml::table& tbl,
+                                                   ConverterConfig& config)
+    -> void {
+  config.project_class_rules.clear();
+  if (!tbl.contains("project_classes")) {
+    return;
+  }
+  const toml::array* rules_arr = tbl["project_classes"].as_array();
+  if (rules_arr == nullptr) {
+    throw std::runtime_error(
+        "Invalid converter config: 'project_classes' must be an array of "
+        "tables.");
+  }
+
+  config.project_class_rules.reserve(rules_arr->size());
+  for (const auto& rule_node : *rules_arr) {
+    const toml::table* rule_tbl = rule_node.as_table();
+    if (rule_tbl == nullptr) {
+      throw std::runtime_error(
+          "Invalid converter config: each item in 'project_classes' must be a "
+          "table.");
+    }
+
+    auto read_required = [rule_tbl](std::string_view key) -> std::string {
+      const auto kValue = (*rule_tbl)[key].value<std::string>();
+      if (!kValue || kValue->empty()) {
+        throw std::runtime_error("Invalid converter config: '" +
+                                 std::string(key) +
+                                 "' in 'project_classes' must be a non-empty "
+                                 "string.");
+      }
+      return *kValue;
+    };
+
+    ProjectClassRuleConfig rule{.project_class = read_required("class"),
+                                .match = read_required("match"),
+                                .root = read_required("root"),
+                                .token = ""};
+    if (rule_tbl->contains("token")) {
+      const auto kToken = (*rule_tbl)["token"].value<std::string>();
+      if (!kToken) {
+        throw std::runtime_error(
+            "Invalid converter config: 'token' in 'project_classes' must be a "
+            "string.");
+      }
+      rule.token = *kToken;
+    }
+    config.project_class_rules.push_back(std::move(rule));
+  }
+}
+
 auto ConverterConfigLoader::ParseMappings(const toml::table& tbl,
                                           ConverterConfig& config) -> void {
   auto load_map =
@@ -2,6 +2,7 @@
 #ifndef INFRASTRUCTURE_CONFIG_MODELS_APP_CONFIG_H_
 #define INFRASTRUCTURE_CONFIG_MODELS_APP_CONFIG_H_
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -65,6 +66,8 @@ struct AppConfig {
   std::optional<fs::path> kExportPath;
 
   bool default_save_processed_output = false;
+  // 转换/校验阶段的并发上限；0 表示使用 hardware_concurrency。
+  std::size_t default_max_parallelism = 0;
   DateCheckMode default_date_check_mode = DateCheckMode::kNone;
 
   PipelineConfig pipeline;
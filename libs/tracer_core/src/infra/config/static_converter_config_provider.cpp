@@ -3,11 +3,16 @@
 
 #include <utility>
 
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
+
 namespace tracer::core::infrastructure::config {
 
 StaticConverterConfigProvider::StaticConverterConfigProvider(
     ConverterConfig converter_config)
-    : converter_config_(std::move(converter_config)) {}
+    : converter_config_(std::move(converter_config)) {
+  converter_config_.activity_resolution =
+      ActivityResolutionTable::Compile(converter_config_);
+}
 
 auto StaticConverterConfigProvider::LoadConverterConfig() const
     -> ConverterConfig {
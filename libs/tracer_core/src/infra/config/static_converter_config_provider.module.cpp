@@ -3,6 +3,7 @@ module;
 #include <utility>
 
 #include "application/ports/pipeline/i_converter_config_provider.hpp"
+#include "domain/logic/converter/resolution/activity_resolution_table.hpp"
 
 module tracer.core.infrastructure.config.static_converter_config_provider;
 
@@ -10,7 +11,10 @@ namespace tracer::core::infrastructure::config {
 
 StaticConverterConfigProvider::StaticConverterConfigProvider(
     ConverterConfig converter_config)
-    : converter_config_(std::move(converter_config)) {}
+    : converter_config_(std::move(converter_config)) {
+  converter_config_.activity_resolution =
+      ActivityResolutionTable::Compile(converter_config_);
+}
 
 auto StaticConverterConfigProvider::LoadConverterConfig() const
     -> ConverterConfig {
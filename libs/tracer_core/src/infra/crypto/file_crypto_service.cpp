@@ -1,6 +1,8 @@
 // infra/crypto/file_crypto_service.cpp
 #include "infra/crypto/file_crypto_service.hpp"
 
+#include <fstream>
+
 #include "infra/crypto/internal/file_crypto_backend_engine.hpp"
 #include "infra/crypto/internal/file_crypto_common.hpp"
 #include "infra/crypto/internal/file_crypto_directory_orchestrator.hpp"
@@ -235,15 +237,51 @@ auto EncryptBytesToFile(std::span<const std::uint8_t> plaintext_bytes,
                         std::string_view passphrase,
                         const FileCryptoPathContext& path_context,
                         const FileCryptoOptions& options) -> FileCryptoResult {
-  const auto kWriteCallback =
-      [&output_tracer_path](
-          std::span<const std::uint8_t> bytes) -> FileCryptoResult {
-    return file_crypto_internal::WriteAllBytes(
-        output_tracer_path,
-        std::vector<std::uint8_t>(bytes.begin(), bytes.end()));
-  };
-  return EncryptBytesToWriter(plaintext_bytes, kWriteCallback, passphrase,
-                              path_context, options);
+  if (output_tracer_path.empty()) {
+    return file_crypto_internal::MakeError(FileCryptoError::kInvalidArgument,
+                                           "Output path is required.");
+  }
+  if (passphrase.empty()) {
+    return file_crypto_internal::MakeError(FileCryptoError::kInvalidArgument,
+                                           "Passphrase must not be empty.");
+  }
+
+  file_crypto_internal::ProgressReporter reporter(FileCryptoOperation::kEncrypt,
+                                                  &options);
+  const auto kPrepareResult = PrepareSingleFileReporter(
+      path_context.current_input_path, output_tracer_path, path_context,
+      static_cast<std::uint64_t>(plaintext_bytes.size()), reporter);
+  if (!kPrepareResult.ok()) {
+    return kPrepareResult;
+  }
+
+  file_crypto_internal::StagedOutputFile output;
+  auto result = output.Open(output_tracer_path);
+  if (result.ok()) {
+    const FileCryptoWriteCallback kSink =
+        [&output](std::span<const std::uint8_t> bytes) -> FileCryptoResult {
+      return output.Write(bytes);
+    };
+    result = file_crypto_internal::EncryptStreamInternal(
+        file_crypto_internal::MakeSpanSource(plaintext_bytes),
+        static_cast<std::uint64_t>(plaintext_bytes.size()), kSink, passphrase,
+        options.security_level, &reporter);
+  }
+  if (result.ok()) {
+    result = reporter.SetPhase(FileCryptoPhase::kWriteOutput, true);
+  }
+  if (result.ok()) {
+    result = output.Commit();
+  }
+  if (!result.ok()) {
+    if (file_crypto_internal::IsCancelledError(result)) {
+      (void)reporter.MarkCancelled();
+    } else {
+      (void)reporter.MarkFailed();
+    }
+    return result;
+  }
+  return reporter.MarkCompleted();
 }
 
 auto EncryptBytesToWriter(std::span<const std::uint8_t> plaintext_bytes,
@@ -416,27 +454,22 @@ auto DecryptFileToBytes(
       !kPhaseResult.ok()) {
     return {kPhaseResult, {}};
   }
-  auto [read_result, encrypted_bytes] =
-      file_crypto_internal::ReadAllBytes(input_tracer_path, &reporter);
-  if (!read_result.ok()) {
-    if (file_crypto_internal::IsCancelledError(read_result)) {
-      (void)reporter.MarkCancelled();
-    } else {
-      (void)reporter.MarkFailed();
-    }
-    return {read_result, {}};
-  }
-
-  auto [decrypt_result, plaintext_bytes] =
-      file_crypto_internal::DecryptBytesInternal(encrypted_bytes, passphrase,
-                                                 &reporter);
-  if (!decrypt_result.ok()) {
-    if (file_crypto_internal::IsCancelledError(decrypt_result)) {
+  std::vector<std::uint8_t> plaintext_bytes;
+  const FileCryptoWriteCallback kSink =
+      [&plaintext_bytes](
+          std::span<const std::uint8_t> bytes) -> FileCryptoResult {
+    plaintext_bytes.insert(plaintext_bytes.end(), bytes.begin(), bytes.end());
+    return {};
+  };
+  const auto kDecryptResult = file_crypto_internal::DecryptFileToSinkInternal(
+      input_tracer_path, kSink, passphrase, &reporter);
+  if (!kDecryptResult.ok()) {
+    if (file_crypto_internal::IsCancelledError(kDecryptResult)) {
       (void)reporter.MarkCancelled();
     } else {
       (void)reporter.MarkFailed();
     }
-    return {decrypt_result, {}};
+    return {kDecryptResult, {}};
   }
 
   if (const auto kPhaseResult =
@@ -487,10 +520,31 @@ auto InspectEncryptedFile(const std::filesystem::path& input_tracer_path,
                                            "Input path is required.");
   }
 
-  auto [read_result, encrypted_bytes] =
-      file_crypto_internal::ReadAllBytes(input_tracer_path, nullptr);
-  if (!read_result.ok()) {
-    return read_result;
+  std::vector<std::uint8_t> encrypted_bytes(
+      file_crypto_internal::kHeaderSizeV3);
+  {
+    std::ifstream input(input_tracer_path, std::ios::binary);
+    if (!input.is_open()) {
+      return file_crypto_internal::MakeError(FileCryptoError::kInputReadFailed,
+                                             "Failed to open input file.");
+    }
+    auto [read_result, read_size] = file_crypto_internal::ReadExactly(
+        file_crypto_internal::MakeStreamSource(input), encrypted_bytes);
+    if (!read_result.ok()) {
+      return read_result;
+    }
+    encrypted_bytes.resize(read_size);
+  }
+  // v3 头自带全部元数据；v1/v2 需要整文件才能校验密文长度。
+  const bool kIsStream =
+      file_crypto_internal::IsStreamFormatPrefix(encrypted_bytes);
+  if (!kIsStream) {
+    auto [read_result, whole_file] =
+        file_crypto_internal::ReadAllBytes(input_tracer_path, nullptr);
+    if (!read_result.ok()) {
+      return read_result;
+    }
+    encrypted_bytes = std::move(whole_file);
   }
 
   file_crypto_internal::TracerFileHeader header{};
@@ -499,6 +553,17 @@ auto InspectEncryptedFile(const std::filesystem::path& input_tracer_path,
       !kParseResult.ok()) {
     return kParseResult;
   }
+  if (kIsStream) {
+    std::error_code size_error;
+    const auto kFileSize =
+        std::filesystem::file_size(input_tracer_path, size_error);
+    if (size_error) {
+      return file_crypto_internal::MakeError(
+          FileCryptoError::kInputReadFailed, "Failed to read input file size.");
+    }
+    header.ciphertext_size = static_cast<std::uint64_t>(kFileSize) -
+                             static_cast<std::uint64_t>(header.header_size);
+  }
 
   if (metadata_out != nullptr) {
     metadata_out->version = header.kVersion;
@@ -127,6 +127,8 @@ struct FileCryptoOptions {
   std::chrono::milliseconds progress_min_interval{100};
   std::uint64_t progress_min_bytes_delta = 64U * 1024U;
   bool continue_on_error = false;
+  // 目录批处理同时处理的文件数上限；0 表示使用 hardware_concurrency。
+  std::size_t max_parallel_files = 0;
 };
 
 struct FileCryptoBatchFileError {
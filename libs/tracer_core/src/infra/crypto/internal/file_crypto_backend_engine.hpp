@@ -5,6 +5,8 @@
 #include <array>
 #include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <span>
 #include <string>
 #include <string_view>
@@ -12,6 +14,8 @@
 #include <vector>
 
 #include "infra/crypto/file_crypto_service.hpp"
+#include "infra/crypto/internal/file_crypto_format_compat.hpp"
+#include "infra/crypto/internal/file_crypto_io.hpp"
 #include "infra/crypto/internal/file_crypto_progress_control.hpp"
 
 namespace tracer_core::infrastructure::crypto::internal {
@@ -31,12 +35,38 @@ struct BatchCryptoSession {
   std::array<std::uint8_t, 16> encrypt_batch_salt{};
   std::vector<std::uint8_t> encrypt_master_key;
   std::vector<BatchMasterKeyCacheEntry> decrypt_master_key_cache;
+  // 并行目录任务共享同一会话：查缓存与派生都在锁内完成，同一批次的
+  // 文件只跑一次 Argon2id，也不会有多个 Argon2id 同时占用内存。
+  std::shared_ptr<std::mutex> decrypt_master_key_mutex =
+      std::make_shared<std::mutex>();
 };
 
 auto BuildEncryptBatchCryptoSession(std::string_view passphrase,
                                     FileCryptoSecurityLevel security_level)
     -> std::pair<FileCryptoResult, BatchCryptoSession>;
 
+// 按块写出 v3 容器；plaintext_size 必须等于 source 实际产出的字节数。
+// 依次上报 kCompress、kDeriveKey、kEncrypt，进度以已消费的明文字节数
+// 在 kEncrypt 阶段上报。
+auto EncryptStreamInternal(const CryptoByteSource& plaintext_source,
+                           std::uint64_t plaintext_size,
+                           const FileCryptoWriteCallback& sink,
+                           std::string_view passphrase,
+                           FileCryptoSecurityLevel security_level,
+                           ProgressReporter* reporter,
+                           BatchCryptoSession* batch_session = nullptr)
+    -> FileCryptoResult;
+
+// 解密已解析 v3 头之后的记录流；依次上报 kDeriveKey、kDecrypt，
+// 进度以已消费的容器字节数在 kDecrypt 阶段上报。
+auto DecryptStreamInternal(const TracerFileHeader& header,
+                           const CryptoByteSource& record_source,
+                           const FileCryptoWriteCallback& sink,
+                           std::string_view passphrase,
+                           ProgressReporter* reporter,
+                           BatchCryptoSession* batch_session = nullptr)
+    -> FileCryptoResult;
+
 auto EncryptBytesInternal(std::span<const std::uint8_t> plaintext_bytes,
                           std::string_view passphrase,
                           FileCryptoSecurityLevel security_level,
@@ -58,6 +88,14 @@ auto EncryptFileInternal(const fs::path& input_txt_path,
                          BatchCryptoSession* batch_session = nullptr)
     -> FileCryptoResult;
 
+// 解密 .tracer 文件并把明文交给 sink；v3 流式处理，v1/v2 整体解密。
+auto DecryptFileToSinkInternal(const fs::path& input_tracer_path,
+                               const FileCryptoWriteCallback& sink,
+                               std::string_view passphrase,
+                               ProgressReporter* reporter,
+                               BatchCryptoSession* batch_session = nullptr)
+    -> FileCryptoResult;
+
 auto DecryptFileInternal(const fs::path& input_tracer_path,
                          const fs::path& output_txt_path,
                          std::string_view passphrase,
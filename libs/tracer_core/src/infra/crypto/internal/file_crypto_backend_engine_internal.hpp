@@ -43,14 +43,11 @@ auto GetOrDeriveMasterKeyForHeader(std::string_view passphrase,
                                    BatchCryptoSession* batch_session)
     -> std::pair<FileCryptoResult, std::vector<std::uint8_t>>;
 
-auto BuildDefaultHeaderV2(
+auto BuildDefaultHeaderV3(
     FileCryptoSecurityLevel security_level, std::uint8_t kdf_id,
     const std::array<std::uint8_t, kSaltSize>* fixed_salt = nullptr)
     -> std::pair<FileCryptoResult, TracerFileHeader>;
 
-auto CompressWithZstdLevel1(const std::vector<std::uint8_t>& plaintext)
-    -> std::pair<FileCryptoResult, std::vector<std::uint8_t>>;
-
 auto DecompressWithZstd(const std::vector<std::uint8_t>& compressed,
                         std::uint64_t expected_plaintext_size)
     -> std::pair<FileCryptoResult, std::vector<std::uint8_t>>;
@@ -15,37 +15,6 @@
 
 namespace tracer_core::infrastructure::crypto::internal {
 
-auto CompressWithZstdLevel1(const std::vector<std::uint8_t>& plaintext)
-    -> std::pair<FileCryptoResult, std::vector<std::uint8_t>> {
-#if defined(TT_HAS_ZSTD) && TT_HAS_ZSTD
-  const std::size_t kBound = ZSTD_compressBound(plaintext.size());
-  if (kBound == 0) {
-    return {MakeError(FileCryptoError::kCompressionFailed,
-                      "zstd failed to estimate compression bound."),
-            {}};
-  }
-
-  std::vector<std::uint8_t> compressed(kBound);
-  const std::size_t kOutputSize =
-      ZSTD_compress(compressed.data(), compressed.size(), plaintext.data(),
-                    plaintext.size(), kDefaultCompressionLevel);
-  if (ZSTD_isError(kOutputSize) != 0U) {
-    return {MakeError(FileCryptoError::kCompressionFailed,
-                      "zstd compression failed."),
-            {}};
-  }
-
-  compressed.resize(kOutputSize);
-  return {{}, std::move(compressed)};
-#else
-  (void)plaintext;
-  return {MakeError(FileCryptoError::kCryptoBackendUnavailable,
-                    "File crypto backend is unavailable (build without "
-                    "libsodium/zstd)."),
-          {}};
-#endif
-}
-
 auto DecompressWithZstd(const std::vector<std::uint8_t>& compressed,
                         std::uint64_t expected_plaintext_size)
     -> std::pair<FileCryptoResult, std::vector<std::uint8_t>> {
@@ -1,6 +1,9 @@
 // infra/crypto/internal/file_crypto_decrypt_flow.cpp
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <fstream>
+#include <memory>
 #include <span>
 #include <vector>
 
@@ -9,6 +12,9 @@
 #if defined(TT_HAS_LIBSODIUM) && TT_HAS_LIBSODIUM
 #include <sodium.h>
 #endif
+#if defined(TT_HAS_ZSTD) && TT_HAS_ZSTD
+#include <zstd.h>
+#endif
 
 #include "infra/crypto/internal/file_crypto_backend_engine_internal.hpp"
 #include "infra/crypto/internal/file_crypto_common.hpp"
@@ -21,6 +27,17 @@ namespace tracer_core::infrastructure::crypto::internal {
     TT_HAS_ZSTD
 namespace {
 
+constexpr unsigned kByteShiftStep = 8U;
+
+struct ZstdDCtxDeleter {
+  void operator()(ZSTD_DCtx* context) const { ZSTD_freeDCtx(context); }
+};
+
+auto MakeTruncatedStreamError() -> FileCryptoResult {
+  return MakeError(FileCryptoError::kDecryptFailed,
+                   "Encrypted stream is truncated.");
+}
+
 auto SetPhaseIfNeeded(ProgressReporter* reporter, const FileCryptoPhase kPhase)
     -> FileCryptoResult {
   if (reporter == nullptr) {
@@ -120,15 +137,221 @@ auto DecodePlaintext(std::vector<std::uint8_t> decrypted_payload,
 }  // namespace
 #endif
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
+auto DecryptStreamInternal(const TracerFileHeader& header,
+                           const CryptoByteSource& record_source,
+                           const FileCryptoWriteCallback& sink,
+                           std::string_view passphrase,
+                           ProgressReporter* reporter,
+                           BatchCryptoSession* batch_session)
+    -> FileCryptoResult {
+#if defined(TT_HAS_LIBSODIUM) && TT_HAS_LIBSODIUM && defined(TT_HAS_ZSTD) && \
+    TT_HAS_ZSTD
+  if (header.kVersion != kFormatVersionV3) {
+    return MakeError(FileCryptoError::kUnsupportedFormat,
+                     "Encrypted file is not a stream container.");
+  }
+  if (const auto kInitResult = InitializeCryptoBackend(); !kInitResult.ok()) {
+    return kInitResult;
+  }
+
+  if (const auto kPhaseResult =
+          SetPhaseIfNeeded(reporter, FileCryptoPhase::kDeriveKey);
+      !kPhaseResult.ok()) {
+    return kPhaseResult;
+  }
+  auto [derive_result, key] =
+      DeriveDecryptKey(passphrase, header, batch_session);
+  if (!derive_result.ok()) {
+    return derive_result;
+  }
+
+  crypto_secretstream_xchacha20poly1305_state state{};
+  const int kInitPullStatus = crypto_secretstream_xchacha20poly1305_init_pull(
+      &state, header.stream_header.data(), key.data());
+  sodium_memzero(key.data(), key.size());
+  if (kInitPullStatus != 0) {
+    return MakeError(FileCryptoError::kUnsupportedFormat,
+                     "Encrypted stream header is invalid.");
+  }
+  const auto kFailWith = [&state](FileCryptoResult result) -> FileCryptoResult {
+    sodium_memzero(&state, sizeof(state));
+    return result;
+  };
+
+  if (const auto kPhaseResult =
+          SetPhaseIfNeeded(reporter, FileCryptoPhase::kDecrypt);
+      !kPhaseResult.ok()) {
+    return kFailWith(kPhaseResult);
+  }
+
+  const std::unique_ptr<ZSTD_DCtx, ZstdDCtxDeleter> kDecompressor(
+      ZSTD_createDCtx());
+  if (!kDecompressor) {
+    return kFailWith(MakeError(FileCryptoError::kDecompressionFailed,
+                               "zstd failed to initialize decompression."));
+  }
+
+  const std::size_t kMaxRecordSize =
+      static_cast<std::size_t>(header.chunk_size) +
+      crypto_secretstream_xchacha20poly1305_ABYTES;
+  std::vector<std::uint8_t> record(kMaxRecordSize);
+  std::vector<std::uint8_t> message(header.chunk_size);
+  std::vector<std::uint8_t> plaintext(ZSTD_DStreamOutSize());
+  // 加密端把序列化后的头绑定为首条记录的关联数据。解析已要求保留字段
+  // 为零，重新序列化得到的字节与文件中的头完全一致。
+  const std::vector<std::uint8_t> kHeaderBytes = BuildHeaderBytes(header);
+  bool first_record = true;
+  std::uint64_t consumed = header.header_size;
+  std::uint64_t produced = 0;
+  std::size_t frame_remaining = 1;
+  bool final_seen = false;
+  while (!final_seen) {
+    std::array<std::uint8_t, kStreamRecordLengthSize> length_bytes{};
+    auto [length_result, length_read] =
+        ReadExactly(record_source, length_bytes);
+    if (!length_result.ok()) {
+      return kFailWith(length_result);
+    }
+    if (length_read != length_bytes.size()) {
+      return kFailWith(MakeTruncatedStreamError());
+    }
+    std::size_t record_size = 0;
+    for (std::size_t index = 0; index < length_bytes.size(); ++index) {
+      record_size |= static_cast<std::size_t>(length_bytes[index])
+                     << (index * kByteShiftStep);
+    }
+    if (record_size < crypto_secretstream_xchacha20poly1305_ABYTES ||
+        record_size > kMaxRecordSize) {
+      return kFailWith(MakeError(FileCryptoError::kUnsupportedFormat,
+                                 "Encrypted stream record size is invalid."));
+    }
+    const std::span<std::uint8_t> kRecord(record.data(), record_size);
+    auto [record_result, record_read] = ReadExactly(record_source, kRecord);
+    if (!record_result.ok()) {
+      return kFailWith(record_result);
+    }
+    if (record_read != record_size) {
+      return kFailWith(MakeTruncatedStreamError());
+    }
+
+    const std::span<const std::uint8_t> kAssociatedData =
+        first_record ? std::span<const std::uint8_t>(kHeaderBytes)
+                     : std::span<const std::uint8_t>();
+    first_record = false;
+    unsigned long long message_size = 0;
+    unsigned char tag = 0;
+    if (crypto_secretstream_xchacha20poly1305_pull(
+            &state, message.data(), &message_size, &tag, kRecord.data(),
+            static_cast<unsigned long long>(kRecord.size()),
+            kAssociatedData.data(),
+            static_cast<unsigned long long>(kAssociatedData.size())) != 0) {
+      return kFailWith(MakeError(
+          FileCryptoError::kDecryptFailed,
+          "Decryption failed (wrong passphrase or corrupted ciphertext)."));
+    }
+    final_seen = tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL;
+
+    ZSTD_inBuffer decompress_input{message.data(),
+                                   static_cast<std::size_t>(message_size), 0};
+    bool output_full = false;
+    // 帧恰好在输出缓冲区写满时结束会返回 0；此时不能再空转一次，
+    // 否则解码器会开始等待下一帧的头。
+    while (decompress_input.pos < decompress_input.size ||
+           (output_full && frame_remaining != 0)) {
+      ZSTD_outBuffer decompress_output{plaintext.data(), plaintext.size(), 0};
+      frame_remaining = ZSTD_decompressStream(
+          kDecompressor.get(), &decompress_output, &decompress_input);
+      if (ZSTD_isError(frame_remaining) != 0U) {
+        return kFailWith(MakeError(FileCryptoError::kDecompressionFailed,
+                                   "zstd decompression failed."));
+      }
+      produced += decompress_output.pos;
+      if (produced > header.plaintext_size) {
+        return kFailWith(
+            MakeError(FileCryptoError::kCompressionMetadataMismatch,
+                      "Decompressed size does not match plaintext_size."));
+      }
+      if (decompress_output.pos > 0) {
+        if (const auto kSinkResult = sink(std::span<const std::uint8_t>(
+                plaintext.data(), decompress_output.pos));
+            !kSinkResult.ok()) {
+          return kFailWith(kSinkResult);
+        }
+      }
+      output_full = decompress_output.pos == decompress_output.size;
+    }
+
+    consumed += kStreamRecordLengthSize + record_size;
+    if (reporter != nullptr) {
+      if (const auto kProgressResult =
+              reporter->UpdateCurrentFileProgress(consumed);
+          !kProgressResult.ok()) {
+        return kFailWith(kProgressResult);
+      }
+    }
+  }
+  sodium_memzero(&state, sizeof(state));
+
+  std::array<std::uint8_t, 1> trailing{};
+  auto [trailing_result, trailing_read] = ReadExactly(record_source, trailing);
+  if (!trailing_result.ok()) {
+    return trailing_result;
+  }
+  if (trailing_read != 0) {
+    return MakeError(FileCryptoError::kUnsupportedFormat,
+                     "Encrypted stream has data after the final record.");
+  }
+  if (frame_remaining != 0) {
+    return MakeError(FileCryptoError::kDecompressionFailed,
+                     "zstd stream ended before the frame was complete.");
+  }
+  if (produced != header.plaintext_size) {
+    return MakeError(FileCryptoError::kCompressionMetadataMismatch,
+                     "Decompressed size does not match plaintext_size.");
+  }
+  return {};
+#else
+  (void)header;
+  (void)record_source;
+  (void)sink;
+  (void)passphrase;
+  (void)reporter;
+  (void)batch_session;
+  return MakeError(FileCryptoError::kCryptoBackendUnavailable,
+                   "File crypto backend is unavailable (build without "
+                   "libsodium/zstd).");
+#endif
+}
+
 auto DecryptBytesInternal(std::span<const std::uint8_t> encrypted_bytes,
                           std::string_view passphrase,
                           ProgressReporter* reporter,
                           BatchCryptoSession* batch_session)
     -> std::pair<FileCryptoResult, std::vector<std::uint8_t>> {
-  const std::vector<std::uint8_t> kEncryptedBuffer(encrypted_bytes.begin(),
-                                                   encrypted_bytes.end());
+  if (IsStreamFormatPrefix(encrypted_bytes)) {
+    TracerFileHeader header{};
+    if (const auto kParseResult = ParseHeader(encrypted_bytes, header);
+        !kParseResult.ok()) {
+      return {kParseResult, {}};
+    }
+    std::vector<std::uint8_t> plaintext;
+    const FileCryptoWriteCallback kSink =
+        [&plaintext](std::span<const std::uint8_t> bytes) -> FileCryptoResult {
+      plaintext.insert(plaintext.end(), bytes.begin(), bytes.end());
+      return {};
+    };
+    const auto kResult = DecryptStreamInternal(
+        header, MakeSpanSource(encrypted_bytes.subspan(header.header_size)),
+        kSink, passphrase, reporter, batch_session);
+    if (!kResult.ok()) {
+      return {kResult, {}};
+    }
+    return {{}, std::move(plaintext)};
+  }
+
   TracerFileHeader header{};
-  if (const auto kParseResult = ParseHeader(kEncryptedBuffer, header);
+  if (const auto kParseResult = ParseHeader(encrypted_bytes, header);
       !kParseResult.ok()) {
     return {kParseResult, {}};
   }
@@ -158,14 +381,8 @@ auto DecryptBytesInternal(std::span<const std::uint8_t> encrypted_bytes,
     return {kPhaseResult, {}};
   }
 
-  const auto kPayloadBegin =
-      kEncryptedBuffer.begin() +
-      static_cast<std::ptrdiff_t>(header.header_size);
-  const std::vector<std::uint8_t> kCiphertext(
-      kPayloadBegin, kEncryptedBuffer.end());
-
-  auto [decrypt_result, decrypted_payload] =
-      DecryptCiphertext(kCiphertext, header, key);
+  auto [decrypt_result, decrypted_payload] = DecryptCiphertext(
+      encrypted_bytes.subspan(header.header_size), header, key);
   sodium_memzero(key.data(), key.size());
   if (!decrypt_result.ok()) {
     return {decrypt_result, {}};
@@ -189,6 +406,50 @@ auto DecryptBytesInternal(std::span<const std::uint8_t> encrypted_bytes,
 #endif
 }
 
+auto DecryptFileToSinkInternal(const fs::path& input_tracer_path,
+                               const FileCryptoWriteCallback& sink,
+                               std::string_view passphrase,
+                               ProgressReporter* reporter,
+                               BatchCryptoSession* batch_session)
+    -> FileCryptoResult {
+  std::ifstream input(input_tracer_path, std::ios::binary);
+  if (!input.is_open()) {
+    return MakeError(FileCryptoError::kInputReadFailed,
+                     "Failed to open input file.");
+  }
+  std::vector<std::uint8_t> header_bytes(kHeaderSizeV3);
+  const CryptoByteSource kSource = MakeStreamSource(input);
+  auto [prefix_result, prefix_size] = ReadExactly(kSource, header_bytes);
+  if (!prefix_result.ok()) {
+    return prefix_result;
+  }
+  header_bytes.resize(prefix_size);
+
+  if (IsStreamFormatPrefix(header_bytes)) {
+    TracerFileHeader header{};
+    if (const auto kParseResult = ParseHeader(header_bytes, header);
+        !kParseResult.ok()) {
+      return kParseResult;
+    }
+    return DecryptStreamInternal(header, kSource, sink, passphrase, reporter,
+                                 batch_session);
+  }
+
+  // v1/v2 只有一段整体 AEAD 密文，仍按整文件解密。
+  input.close();
+  auto [read_result, encrypted_bytes] =
+      ReadAllBytes(input_tracer_path, reporter);
+  if (!read_result.ok()) {
+    return read_result;
+  }
+  auto [decrypt_result, plaintext] = DecryptBytesInternal(
+      encrypted_bytes, passphrase, reporter, batch_session);
+  if (!decrypt_result.ok()) {
+    return decrypt_result;
+  }
+  return sink(plaintext);
+}
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
 auto DecryptFileInternal(const fs::path& input_tracer_path,
                          const fs::path& output_txt_path,
@@ -204,17 +465,19 @@ auto DecryptFileInternal(const fs::path& input_tracer_path,
     }
   }
 
-  auto [read_result, encrypted_bytes] =
-      ReadAllBytes(input_tracer_path, reporter);
-  if (!read_result.ok()) {
-    return read_result;
+  StagedOutputFile output;
+  if (const auto kOpenResult = output.Open(output_txt_path);
+      !kOpenResult.ok()) {
+    return kOpenResult;
   }
-
-  auto [decrypt_result, plaintext] =
-      DecryptBytesInternal(encrypted_bytes, passphrase, reporter,
-                           batch_session);
-  if (!decrypt_result.ok()) {
-    return decrypt_result;
+  const FileCryptoWriteCallback kSink =
+      [&output](std::span<const std::uint8_t> bytes) -> FileCryptoResult {
+    return output.Write(bytes);
+  };
+  if (const auto kDecryptResult = DecryptFileToSinkInternal(
+          input_tracer_path, kSink, passphrase, reporter, batch_session);
+      !kDecryptResult.ok()) {
+    return kDecryptResult;
   }
 
   if (reporter != nullptr) {
@@ -224,9 +487,8 @@ auto DecryptFileInternal(const fs::path& input_tracer_path,
       return kPhaseResult;
     }
   }
-  const auto kWriteResult = WriteAllBytes(output_txt_path, plaintext);
-  if (!kWriteResult.ok()) {
-    return kWriteResult;
+  if (const auto kCommitResult = output.Commit(); !kCommitResult.ok()) {
+    return kCommitResult;
   }
 
   if (reporter != nullptr) {
@@ -1,16 +1,30 @@
 // infra/crypto/internal/file_crypto_directory_orchestrator.cpp
 #include "infra/crypto/internal/file_crypto_directory_orchestrator.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
 #include <optional>
+#include <vector>
 
 #include "infra/crypto/internal/file_crypto_backend_engine.hpp"
 #include "infra/crypto/internal/file_crypto_common.hpp"
 #include "infra/crypto/internal/file_crypto_directory_plan.hpp"
 #include "infra/crypto/internal/file_crypto_progress_control.hpp"
+#include "shared/utils/work_stealing_executor.hpp"
 
 namespace tracer_core::infrastructure::crypto::internal {
 namespace {
 
+namespace concurrency = tracer::core::shared::concurrency;
+
+struct FileOutcome {
+  FileCryptoResult result;
+  bool ran = false;
+};
+
 auto ToProgressDescriptor(const DirectoryTaskPlanEntry& entry)
     -> ProgressFileDescriptor {
   ProgressFileDescriptor descriptor{};
@@ -26,6 +40,143 @@ auto ToProgressDescriptor(const DirectoryTaskPlanEntry& entry)
   return descriptor;
 }
 
+
+/**
+ * @brief 把各工作线程的单文件进度汇总到同一个 ProgressReporter。
+ *
+ * 总字节数按所有文件的已完成字节累加；事件中的“当前文件”始终是计划
+ * 顺序里最早一个尚未结束的文件，其他文件的进度只推进总字节数。
+ * 文件结束事件也按计划顺序补发，因此无论线程如何调度，回调看到的
+ * 文件序号与组内序号都是单调的。回调在锁内调用，不会并发执行。
+ */
+class ParallelProgressRelay {
+ public:
+  ParallelProgressRelay(ProgressReporter& reporter,
+                        const DirectoryTaskPlan& plan)
+      : reporter_(reporter), slots_(plan.entries.size()) {
+    for (std::size_t index = 0; index < plan.entries.size(); ++index) {
+      const auto& entry = plan.entries[index];
+      auto& snapshot = slots_[index].snapshot;
+      snapshot.phase = FileCryptoPhase::kReadInput;
+      snapshot.current_input_path = entry.input_path;
+      snapshot.current_output_path = entry.output_path;
+      snapshot.current_group_label = entry.group_label;
+      snapshot.group_index = entry.group_index;
+      snapshot.file_index_in_group = entry.group_file_index;
+      snapshot.file_count_in_group = entry.group_file_count;
+      snapshot.current_file_index = entry.file_index;
+      snapshot.current_file_total_bytes = entry.input_size_bytes;
+    }
+  }
+
+  auto OnFileProgress(std::size_t index,
+                      const FileCryptoProgressSnapshot& snapshot)
+      -> FileCryptoControl {
+    std::scoped_lock lock(mutex_);
+    if (cancelled_.load(std::memory_order_relaxed)) {
+      return FileCryptoControl::kCancel;
+    }
+    Slot& slot = slots_[index];
+    const std::uint64_t kDone =
+        std::max(slot.snapshot.current_file_done_bytes,
+                 snapshot.current_file_done_bytes);
+    overall_done_bytes_ += kDone - slot.snapshot.current_file_done_bytes;
+    // 单文件 reporter 在 SetCurrentFile 时还停留在初始的 kScan。
+    if (snapshot.phase != FileCryptoPhase::kScan) {
+      slot.snapshot.phase = snapshot.phase;
+    }
+    slot.snapshot.current_file_done_bytes = kDone;
+    slot.started = true;
+
+    if (head_ >= slots_.size() || !slots_[head_].started) {
+      return FileCryptoControl::kContinue;
+    }
+    // 队首文件切换或换阶段时强制发出，其余按调用方的节流设置。
+    const bool kForce =
+        index == head_ && (published_head_ != head_ ||
+                           published_phase_ != slot.snapshot.phase);
+    return PublishHeadLocked(kForce).ok() ? FileCryptoControl::kContinue
+                                          : FileCryptoControl::kCancel;
+  }
+
+  auto OnFileFinished(std::size_t index, const FileCryptoResult& result)
+      -> void {
+    std::scoped_lock lock(mutex_);
+    Slot& slot = slots_[index];
+    slot.finished = true;
+    slot.started = true;
+    if (IsCancelledError(result)) {
+      SetCancelledLocked(result);
+      return;
+    }
+    if (result.ok()) {
+      overall_done_bytes_ += slot.snapshot.current_file_total_bytes -
+                             slot.snapshot.current_file_done_bytes;
+      slot.snapshot.current_file_done_bytes =
+          slot.snapshot.current_file_total_bytes;
+    } else {
+      slot.snapshot.phase = FileCryptoPhase::kFailed;
+    }
+    if (cancelled_.load(std::memory_order_relaxed)) {
+      return;
+    }
+
+    while (head_ < slots_.size() && slots_[head_].finished) {
+      if (!PublishHeadLocked(true).ok()) {
+        return;
+      }
+      ++head_;
+    }
+    if (head_ < slots_.size() && slots_[head_].started) {
+      (void)PublishHeadLocked(true);
+    }
+  }
+
+  [[nodiscard]] auto Cancelled() const -> bool {
+    return cancelled_.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] auto CancelResult() -> FileCryptoResult {
+    std::scoped_lock lock(mutex_);
+    return cancel_result_;
+  }
+
+ private:
+  struct Slot {
+    FileCryptoProgressSnapshot snapshot{};
+    bool started = false;
+    bool finished = false;
+  };
+
+  auto PublishHeadLocked(bool force_emit) -> FileCryptoResult {
+    const auto& snapshot = slots_[head_].snapshot;
+    published_head_ = head_;
+    published_phase_ = snapshot.phase;
+    auto result = reporter_.PublishFileSnapshot(snapshot, overall_done_bytes_,
+                                                force_emit);
+    if (!result.ok()) {
+      SetCancelledLocked(result);
+    }
+    return result;
+  }
+
+  auto SetCancelledLocked(const FileCryptoResult& result) -> void {
+    if (!cancelled_.exchange(true, std::memory_order_relaxed)) {
+      cancel_result_ = result;
+    }
+  }
+
+  ProgressReporter& reporter_;
+  std::mutex mutex_;
+  std::vector<Slot> slots_;
+  std::size_t head_ = 0;
+  std::size_t published_head_ = SIZE_MAX;
+  FileCryptoPhase published_phase_ = FileCryptoPhase::kScan;
+  std::uint64_t overall_done_bytes_ = 0;
+  std::atomic<bool> cancelled_{false};
+  FileCryptoResult cancel_result_{};
+};
+
 }  // namespace
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
@@ -80,7 +231,6 @@ auto RunDirectoryCrypto(FileCryptoOperation operation,
   }
 
   batch.total_files = plan.entries.size();
-  std::uint64_t overall_done_bytes = 0;
   std::optional<BatchCryptoSession> batch_crypto_session;
   if (operation == FileCryptoOperation::kEncrypt) {
     auto [session_result, session] =
@@ -100,63 +250,91 @@ auto RunDirectoryCrypto(FileCryptoOperation operation,
     batch_crypto_session.emplace();
   }
 
-  for (const auto& plan_entry : plan.entries) {
-    if (const auto kFileSelectResult = reporter.SetCurrentFile(
-            ToProgressDescriptor(plan_entry), overall_done_bytes);
-        !kFileSelectResult.ok()) {
-      batch.status = kFileSelectResult;
-      batch.cancelled = IsCancelledError(kFileSelectResult);
-      if (batch.cancelled) {
-        (void)reporter.MarkCancelled();
-      } else {
-        (void)reporter.MarkFailed();
+  std::vector<FileOutcome> outcomes(plan.entries.size());
+  ParallelProgressRelay relay(reporter, plan);
+  std::atomic<std::size_t> next_entry{0};
+  std::atomic<bool> stop{false};
+  if (!plan.entries.empty()) {
+    const std::size_t kWorkers = std::min(
+        concurrency::ResolveWorkerCount(options.max_parallel_files),
+        plan.entries.size());
+    concurrency::WorkStealingExecutor executor(kWorkers);
+    // 任务不直接使用 ParallelFor 给的下标，而是按计划顺序领取条目，
+    // 保证文件按组内顺序开始处理。
+    executor.ParallelFor(plan.entries.size(), [&](std::size_t) -> void {
+      if (stop.load(std::memory_order_relaxed) || relay.Cancelled()) {
+        return;
       }
-      return batch;
-    }
+      const std::size_t kIndex =
+          next_entry.fetch_add(1, std::memory_order_relaxed);
+      const auto& plan_entry = plan.entries[kIndex];
 
-    FileCryptoResult file_result{};
-    BatchCryptoSession* session_ptr = batch_crypto_session.has_value()
-                                          ? &batch_crypto_session.value()
-                                          : nullptr;
-    if (operation == FileCryptoOperation::kEncrypt) {
-      file_result = EncryptFileInternal(
-          plan_entry.input_path, plan_entry.output_path, passphrase,
-          options.security_level, &reporter, session_ptr);
-    } else {
-      file_result =
-          DecryptFileInternal(plan_entry.input_path, plan_entry.output_path,
-                              passphrase, &reporter, session_ptr);
-    }
-    overall_done_bytes = reporter.CurrentOverallDoneBytes();
+      FileCryptoOptions file_options{};
+      file_options.cancel_token = options.cancel_token;
+      file_options.progress_min_interval = std::chrono::milliseconds(0);
+      file_options.progress_min_bytes_delta = 0;
+      file_options.progress_callback =
+          [&relay, kIndex](
+              const FileCryptoProgressSnapshot& snapshot) -> FileCryptoControl {
+        return relay.OnFileProgress(kIndex, snapshot);
+      };
+      ProgressReporter file_reporter(operation, &file_options);
 
-    if (!file_result.ok()) {
-      if (IsCancelledError(file_result)) {
-        batch.status = file_result;
-        batch.cancelled = true;
-        (void)reporter.MarkCancelled();
-        return batch;
+      FileCryptoResult file_result = file_reporter.SetCurrentFile(
+          ToProgressDescriptor(plan_entry), 0);
+      if (file_result.ok()) {
+        BatchCryptoSession* session_ptr = batch_crypto_session.has_value()
+                                              ? &batch_crypto_session.value()
+                                              : nullptr;
+        if (operation == FileCryptoOperation::kEncrypt) {
+          file_result = EncryptFileInternal(
+              plan_entry.input_path, plan_entry.output_path, passphrase,
+              options.security_level, &file_reporter, session_ptr);
+        } else {
+          file_result = DecryptFileInternal(
+              plan_entry.input_path, plan_entry.output_path, passphrase,
+              &file_reporter, session_ptr);
+        }
       }
-
-      ++batch.failed_files;
-      FileCryptoBatchFileError file_error{};
-      file_error.input_path = plan_entry.input_path;
-      file_error.output_path = plan_entry.output_path;
-      file_error.error_code = file_result.error_code;
-      file_error.error_message = file_result.error_message;
-      batch.file_errors.push_back(std::move(file_error));
-      if (batch.status.ok()) {
-        batch.status = file_result;
+      if (!file_result.ok() && !IsCancelledError(file_result) &&
+          !options.continue_on_error) {
+        stop.store(true, std::memory_order_relaxed);
       }
-      (void)reporter.MarkFailed();
+      relay.OnFileFinished(kIndex, file_result);
+      outcomes[kIndex] = {.result = std::move(file_result), .ran = true};
+    });
+  }
 
-      if (!options.continue_on_error) {
-        return batch;
-      }
+  if (relay.Cancelled()) {
+    batch.succeeded_files = static_cast<std::size_t>(
+        std::ranges::count_if(outcomes, [](const FileOutcome& outcome) {
+          return outcome.ran && outcome.result.ok();
+        }));
+    batch.status = relay.CancelResult();
+    batch.cancelled = true;
+    (void)reporter.MarkCancelled();
+    return batch;
+  }
+
+  for (std::size_t index = 0; index < plan.entries.size(); ++index) {
+    if (!outcomes[index].ran) {
       continue;
     }
-
-    ++batch.succeeded_files;
-    overall_done_bytes = reporter.CurrentOverallDoneBytes();
+    const auto& file_result = outcomes[index].result;
+    if (file_result.ok()) {
+      ++batch.succeeded_files;
+      continue;
+    }
+    ++batch.failed_files;
+    FileCryptoBatchFileError file_error{};
+    file_error.input_path = plan.entries[index].input_path;
+    file_error.output_path = plan.entries[index].output_path;
+    file_error.error_code = file_result.error_code;
+    file_error.error_message = file_result.error_message;
+    batch.file_errors.push_back(std::move(file_error));
+    if (batch.status.ok()) {
+      batch.status = file_result;
+    }
   }
 
   if (batch.failed_files > 0) {
@@ -1,6 +1,8 @@
 // infra/crypto/internal/file_crypto_encrypt_flow.cpp
 #include <cstddef>
 #include <cstdint>
+#include <fstream>
+#include <memory>
 #include <span>
 #include <vector>
 
@@ -9,6 +11,9 @@
 #if defined(TT_HAS_LIBSODIUM) && TT_HAS_LIBSODIUM
 #include <sodium.h>
 #endif
+#if defined(TT_HAS_ZSTD) && TT_HAS_ZSTD
+#include <zstd.h>
+#endif
 
 #include "infra/crypto/internal/file_crypto_backend_engine_internal.hpp"
 #include "infra/crypto/internal/file_crypto_common.hpp"
@@ -17,115 +22,265 @@
 
 namespace tracer_core::infrastructure::crypto::internal {
 
-auto EncryptBytesInternal(std::span<const std::uint8_t> plaintext_bytes,
-                          std::string_view passphrase,
-                          FileCryptoSecurityLevel security_level,
-                          ProgressReporter* reporter,
-                          BatchCryptoSession* batch_session)
+#if defined(TT_HAS_LIBSODIUM) && TT_HAS_LIBSODIUM && defined(TT_HAS_ZSTD) && \
+    TT_HAS_ZSTD
+namespace {
+
+constexpr std::size_t kPlaintextReadSize =
+    static_cast<std::size_t>(64U) * static_cast<std::size_t>(1024U);
+constexpr std::uint32_t kByteMask = 0xFFU;
+constexpr unsigned kByteShiftStep = 8U;
+
+struct ZstdCCtxDeleter {
+  void operator()(ZSTD_CCtx* context) const { ZSTD_freeCCtx(context); }
+};
+
+auto DeriveEncryptKey(std::string_view passphrase,
+                      const TracerFileHeader& header, bool use_batch_subkey,
+                      BatchCryptoSession* batch_session)
     -> std::pair<FileCryptoResult, std::vector<std::uint8_t>> {
+  if (use_batch_subkey) {
+    return DeriveSubkeyFromBatchMaster(batch_session->encrypt_master_key,
+                                       header.nonce);
+  }
+  return DeriveMasterKeyWithArgon2id(passphrase,
+                                     Argon2idLimits{
+                                         .ops_limit = header.ops_limit,
+                                         .mem_limit_kib = header.mem_limit_kib,
+                                     },
+                                     header.salt);
+}
+
+class SecretStreamRecordWriter {
+ public:
+  SecretStreamRecordWriter(const FileCryptoWriteCallback& sink,
+                           std::size_t chunk_size)
+      : sink_(sink),
+        record_(kStreamRecordLengthSize + chunk_size +
+                crypto_secretstream_xchacha20poly1305_ABYTES) {}
+  SecretStreamRecordWriter(const SecretStreamRecordWriter&) = delete;
+  auto operator=(const SecretStreamRecordWriter&)
+      -> SecretStreamRecordWriter& = delete;
+  ~SecretStreamRecordWriter() { sodium_memzero(&state_, sizeof(state_)); }
+
+  // 初始化推送状态并写出头；头中的 stream_header 由 init_push 填入。
+  auto Begin(std::span<const std::uint8_t> key, TracerFileHeader& header)
+      -> FileCryptoResult {
+    if (crypto_secretstream_xchacha20poly1305_init_push(
+            &state_, header.stream_header.data(), key.data()) != 0) {
+      return MakeError(FileCryptoError::kCryptoOperationFailed,
+                       "Encryption failed.");
+    }
+    header_bytes_ = BuildHeaderBytes(header);
+    return sink_(header_bytes_);
+  }
+
+  auto Push(std::span<const std::uint8_t> message, bool final_record)
+      -> FileCryptoResult {
+    // 首条记录以序列化后的头为关联数据，头的任何改动都会让它认证失败。
+    const std::span<const std::uint8_t> kAssociatedData =
+        first_record_ ? std::span<const std::uint8_t>(header_bytes_)
+                      : std::span<const std::uint8_t>();
+    first_record_ = false;
+    unsigned long long ciphertext_size = 0;
+    if (crypto_secretstream_xchacha20poly1305_push(
+            &state_, record_.data() + kStreamRecordLengthSize,
+            &ciphertext_size, message.data(),
+            static_cast<unsigned long long>(message.size()),
+            kAssociatedData.data(),
+            static_cast<unsigned long long>(kAssociatedData.size()),
+            final_record ? crypto_secretstream_xchacha20poly1305_TAG_FINAL
+                         : crypto_secretstream_xchacha20poly1305_TAG_MESSAGE) !=
+        0) {
+      return MakeError(FileCryptoError::kCryptoOperationFailed,
+                       "Encryption failed.");
+    }
+    const auto kRecordSize = static_cast<std::uint32_t>(ciphertext_size);
+    for (std::size_t index = 0; index < kStreamRecordLengthSize; ++index) {
+      record_[index] = static_cast<std::uint8_t>(
+          (kRecordSize >> (index * kByteShiftStep)) & kByteMask);
+    }
+    return sink_(std::span<const std::uint8_t>(
+        record_.data(),
+        kStreamRecordLengthSize + static_cast<std::size_t>(ciphertext_size)));
+  }
+
+ private:
+  const FileCryptoWriteCallback& sink_;
+  crypto_secretstream_xchacha20poly1305_state state_{};
+  std::vector<std::uint8_t> record_;
+  std::vector<std::uint8_t> header_bytes_;
+  bool first_record_ = true;
+};
+
+}  // namespace
+#endif
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
+auto EncryptStreamInternal(const CryptoByteSource& plaintext_source,
+                           std::uint64_t plaintext_size,
+                           const FileCryptoWriteCallback& sink,
+                           std::string_view passphrase,
+                           FileCryptoSecurityLevel security_level,
+                           ProgressReporter* reporter,
+                           BatchCryptoSession* batch_session)
+    -> FileCryptoResult {
 #if defined(TT_HAS_LIBSODIUM) && TT_HAS_LIBSODIUM && defined(TT_HAS_ZSTD) && \
     TT_HAS_ZSTD
   if (const auto kInitResult = InitializeCryptoBackend(); !kInitResult.ok()) {
-    return {kInitResult, {}};
+    return kInitResult;
+  }
+
+  const bool kUseBatchSubkey =
+      batch_session != nullptr && batch_session->encrypt_mode_enabled &&
+      batch_session->encrypt_master_key.size() ==
+          crypto_secretstream_xchacha20poly1305_KEYBYTES;
+  auto [header_result, header] = BuildDefaultHeaderV3(
+      security_level, kUseBatchSubkey ? kKdfArgon2idBatchSubkey : kKdfArgon2id,
+      kUseBatchSubkey ? &batch_session->encrypt_batch_salt : nullptr);
+  if (!header_result.ok()) {
+    return header_result;
   }
-  const std::vector<std::uint8_t> kPlaintext(plaintext_bytes.begin(),
-                                            plaintext_bytes.end());
+  header.plaintext_size = plaintext_size;
 
+  // 阶段顺序与 progress_callback_v1.md 一致：kCompress（建立压缩流）、
+  // kDeriveKey，之后压缩与加密交织进行，字节进度在 kEncrypt 下上报。
   if (reporter != nullptr) {
     if (const auto kPhaseResult =
             reporter->SetPhase(FileCryptoPhase::kCompress, true);
         !kPhaseResult.ok()) {
-      return {kPhaseResult, {}};
+      return kPhaseResult;
     }
   }
-  auto [compress_result, compressed_plaintext] =
-      CompressWithZstdLevel1(kPlaintext);
-  if (!compress_result.ok()) {
-    return {compress_result, {}};
-  }
-
-  const bool kUseBatchSubkey = batch_session != nullptr &&
-                               batch_session->encrypt_mode_enabled &&
-                               batch_session->encrypt_master_key.size() ==
-                                   crypto_aead_xchacha20poly1305_ietf_KEYBYTES;
-  auto [header_result, header] = BuildDefaultHeaderV2(
-      security_level, kUseBatchSubkey ? kKdfArgon2idBatchSubkey : kKdfArgon2id,
-      kUseBatchSubkey ? &batch_session->encrypt_batch_salt : nullptr);
-  if (!header_result.ok()) {
-    return {header_result, {}};
+  const std::unique_ptr<ZSTD_CCtx, ZstdCCtxDeleter> kCompressor(
+      ZSTD_createCCtx());
+  if (!kCompressor ||
+      ZSTD_isError(ZSTD_CCtx_setParameter(kCompressor.get(),
+                                          ZSTD_c_compressionLevel,
+                                          header.compression_level)) != 0U ||
+      ZSTD_isError(ZSTD_CCtx_setPledgedSrcSize(kCompressor.get(),
+                                               plaintext_size)) != 0U) {
+    return MakeError(FileCryptoError::kCompressionFailed,
+                     "zstd failed to initialize compression stream.");
   }
-  header.plaintext_size = static_cast<std::uint64_t>(kPlaintext.size());
 
   if (reporter != nullptr) {
     if (const auto kPhaseResult =
             reporter->SetPhase(FileCryptoPhase::kDeriveKey, true);
         !kPhaseResult.ok()) {
-      return {kPhaseResult, {}};
+      return kPhaseResult;
     }
   }
+  auto [derive_result, key] =
+      DeriveEncryptKey(passphrase, header, kUseBatchSubkey, batch_session);
+  if (!derive_result.ok()) {
+    return derive_result;
+  }
 
-  std::vector<std::uint8_t> key;
-  if (kUseBatchSubkey) {
-    auto [subkey_result, subkey] = DeriveSubkeyFromBatchMaster(
-        batch_session->encrypt_master_key, header.nonce);
-    if (!subkey_result.ok()) {
-      return {subkey_result, {}};
-    }
-    key = std::move(subkey);
-  } else {
-    auto [derive_result, derived_key] =
-        DeriveMasterKeyWithArgon2id(passphrase,
-                                    Argon2idLimits{
-                                        .ops_limit = header.ops_limit,
-                                        .mem_limit_kib = header.mem_limit_kib,
-                                    },
-                                    header.salt);
-    if (!derive_result.ok()) {
-      return {derive_result, {}};
-    }
-    key = std::move(derived_key);
+  SecretStreamRecordWriter writer(sink, header.chunk_size);
+  const auto kBeginResult = writer.Begin(key, header);
+  sodium_memzero(key.data(), key.size());
+  if (!kBeginResult.ok()) {
+    return kBeginResult;
   }
 
   if (reporter != nullptr) {
     if (const auto kPhaseResult =
             reporter->SetPhase(FileCryptoPhase::kEncrypt, true);
         !kPhaseResult.ok()) {
-      sodium_memzero(key.data(), key.size());
-      return {kPhaseResult, {}};
+      return kPhaseResult;
     }
   }
 
-  std::vector<std::uint8_t> ciphertext(
-      compressed_plaintext.size() + crypto_aead_xchacha20poly1305_ietf_ABYTES);
-  unsigned long long ciphertext_size = 0;
-  if (crypto_aead_xchacha20poly1305_ietf_encrypt(
-          ciphertext.data(), &ciphertext_size, compressed_plaintext.data(),
-          static_cast<unsigned long long>(compressed_plaintext.size()), nullptr,
-          0, nullptr, header.nonce.data(), key.data()) != 0) {
-    sodium_memzero(key.data(), key.size());
-    return {MakeError(FileCryptoError::kCryptoOperationFailed,
-                      "Encryption failed."),
-            {}};
+  std::vector<std::uint8_t> input(kPlaintextReadSize);
+  std::vector<std::uint8_t> message(header.chunk_size);
+  std::size_t message_size = 0;
+  std::uint64_t consumed = 0;
+  bool input_done = false;
+  while (!input_done) {
+    auto [read_result, read_size] = plaintext_source(input);
+    if (!read_result.ok()) {
+      return read_result;
+    }
+    consumed += read_size;
+    input_done = read_size == 0;
+    if (consumed > plaintext_size ||
+        (input_done && consumed != plaintext_size)) {
+      return MakeError(FileCryptoError::kInputReadFailed,
+                       "Input size changed while encrypting.");
+    }
+
+    ZSTD_inBuffer compress_input{input.data(), read_size, 0};
+    const ZSTD_EndDirective kDirective =
+        input_done ? ZSTD_e_end : ZSTD_e_continue;
+    std::size_t remaining = 0;
+    do {
+      ZSTD_outBuffer compress_output{message.data(), message.size(),
+                                     message_size};
+      remaining = ZSTD_compressStream2(kCompressor.get(), &compress_output,
+                                       &compress_input, kDirective);
+      if (ZSTD_isError(remaining) != 0U) {
+        return MakeError(FileCryptoError::kCompressionFailed,
+                         "zstd compression failed.");
+      }
+      message_size = compress_output.pos;
+      if (message_size == message.size()) {
+        if (const auto kPushResult = writer.Push(message, false);
+            !kPushResult.ok()) {
+          return kPushResult;
+        }
+        message_size = 0;
+      }
+    } while (input_done ? remaining != 0
+                        : compress_input.pos != compress_input.size);
+
+    if (reporter != nullptr) {
+      if (const auto kProgressResult =
+              reporter->UpdateCurrentFileProgress(consumed);
+          !kProgressResult.ok()) {
+        return kProgressResult;
+      }
+    }
   }
-  sodium_memzero(key.data(), key.size());
-  ciphertext.resize(static_cast<std::size_t>(ciphertext_size));
-  header.ciphertext_size = static_cast<std::uint64_t>(ciphertext.size());
 
-  auto output_bytes = BuildHeaderBytes(header);
-  output_bytes.insert(output_bytes.end(), ciphertext.begin(), ciphertext.end());
-  return {{}, std::move(output_bytes)};
+  return writer.Push(
+      std::span<const std::uint8_t>(message.data(), message_size), true);
 #else
+  (void)plaintext_source;
+  (void)plaintext_size;
+  (void)sink;
   (void)passphrase;
   (void)security_level;
   (void)reporter;
   (void)batch_session;
-  return {MakeError(FileCryptoError::kCryptoBackendUnavailable,
-                    "File crypto backend is unavailable (build without "
-                    "libsodium/zstd)."),
-          {}};
+  return MakeError(FileCryptoError::kCryptoBackendUnavailable,
+                   "File crypto backend is unavailable (build without "
+                   "libsodium/zstd).");
 #endif
 }
 
+auto EncryptBytesInternal(std::span<const std::uint8_t> plaintext_bytes,
+                          std::string_view passphrase,
+                          FileCryptoSecurityLevel security_level,
+                          ProgressReporter* reporter,
+                          BatchCryptoSession* batch_session)
+    -> std::pair<FileCryptoResult, std::vector<std::uint8_t>> {
+  std::vector<std::uint8_t> output_bytes;
+  const FileCryptoWriteCallback kSink =
+      [&output_bytes](std::span<const std::uint8_t> bytes) -> FileCryptoResult {
+    output_bytes.insert(output_bytes.end(), bytes.begin(), bytes.end());
+    return {};
+  };
+  const auto kResult = EncryptStreamInternal(
+      MakeSpanSource(plaintext_bytes),
+      static_cast<std::uint64_t>(plaintext_bytes.size()), kSink, passphrase,
+      security_level, reporter, batch_session);
+  if (!kResult.ok()) {
+    return {kResult, {}};
+  }
+  return {{}, std::move(output_bytes)};
+}
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
 auto EncryptFileInternal(const fs::path& input_txt_path,
                          const fs::path& output_tracer_path,
@@ -141,16 +296,32 @@ auto EncryptFileInternal(const fs::path& input_txt_path,
       return kPhaseResult;
     }
   }
-  auto [read_result, plaintext] = ReadAllBytes(input_txt_path, reporter);
-  if (!read_result.ok()) {
-    return read_result;
+  std::ifstream input(input_txt_path, std::ios::binary);
+  std::error_code size_error;
+  const auto kInputSize = fs::file_size(input_txt_path, size_error);
+  if (!input.is_open()) {
+    return MakeError(FileCryptoError::kInputReadFailed,
+                     "Failed to open input file.");
+  }
+  if (size_error) {
+    return MakeError(FileCryptoError::kInputReadFailed,
+                     "Failed to read input file size.");
   }
 
-  auto [encrypt_result, encrypted_bytes] =
-      EncryptBytesInternal(plaintext, passphrase, security_level, reporter,
-                           batch_session);
-  if (!encrypt_result.ok()) {
-    return encrypt_result;
+  StagedOutputFile output;
+  if (const auto kOpenResult = output.Open(output_tracer_path);
+      !kOpenResult.ok()) {
+    return kOpenResult;
+  }
+  const FileCryptoWriteCallback kSink =
+      [&output](std::span<const std::uint8_t> bytes) -> FileCryptoResult {
+    return output.Write(bytes);
+  };
+  if (const auto kEncryptResult = EncryptStreamInternal(
+          MakeStreamSource(input), static_cast<std::uint64_t>(kInputSize),
+          kSink, passphrase, security_level, reporter, batch_session);
+      !kEncryptResult.ok()) {
+    return kEncryptResult;
   }
 
   if (reporter != nullptr) {
@@ -160,9 +331,8 @@ auto EncryptFileInternal(const fs::path& input_txt_path,
       return kPhaseResult;
     }
   }
-  const auto kWriteResult = WriteAllBytes(output_tracer_path, encrypted_bytes);
-  if (!kWriteResult.ok()) {
-    return kWriteResult;
+  if (const auto kCommitResult = output.Commit(); !kCommitResult.ok()) {
+    return kCommitResult;
   }
 
   if (reporter != nullptr) {
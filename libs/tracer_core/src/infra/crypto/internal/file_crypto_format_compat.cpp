@@ -13,6 +13,10 @@ constexpr std::size_t kV2PlaintextSizeOffset = 60;
 constexpr std::size_t kV2CiphertextSizeOffset = 68;
 constexpr std::array<std::size_t, 7> kV2ReservedOffsets = {9,  10, 11, 76,
                                                            77, 78, 79};
+constexpr std::size_t kV3ChunkSizeOffset = 68;
+constexpr std::size_t kV3StreamHeaderOffset = 80;
+constexpr std::array<std::size_t, 11> kV3ReservedOffsets = {
+    9, 10, 11, 72, 73, 74, 75, 76, 77, 78, 79};
 constexpr std::uint32_t kByteMask = 0xFFU;
 constexpr unsigned kShiftBits8 = 8U;
 constexpr unsigned kShiftBits16 = 16U;
@@ -52,7 +56,7 @@ void AppendU64LE(std::vector<std::uint8_t>& out, std::uint64_t value) {
   }
 }
 
-auto ReadU32LE(const std::vector<std::uint8_t>& data, std::size_t offset)
+auto ReadU32LE(std::span<const std::uint8_t> data, std::size_t offset)
     -> std::uint32_t {
   std::uint32_t value = 0;
   value |= static_cast<std::uint32_t>(data[offset + 0]);
@@ -62,7 +66,7 @@ auto ReadU32LE(const std::vector<std::uint8_t>& data, std::size_t offset)
   return value;
 }
 
-auto ReadU64LE(const std::vector<std::uint8_t>& data, std::size_t offset)
+auto ReadU64LE(std::span<const std::uint8_t> data, std::size_t offset)
     -> std::uint64_t {
   std::uint64_t value = 0;
   for (std::size_t index = 0; index < kU64ByteCount; ++index) {
@@ -92,7 +96,8 @@ auto BuildHeaderBytes(const TracerFileHeader& header)
     return bytes;
   }
 
-  bytes.reserve(kHeaderSizeV2);
+  const bool kIsV3 = header.kVersion == kFormatVersionV3;
+  bytes.reserve(kIsV3 ? kHeaderSizeV3 : kHeaderSizeV2);
   bytes.insert(bytes.end(), header.magic.begin(), header.magic.end());
   bytes.push_back(header.kVersion);
   bytes.push_back(header.kdf_id);
@@ -107,6 +112,14 @@ auto BuildHeaderBytes(const TracerFileHeader& header)
   bytes.insert(bytes.end(), header.salt.begin(), header.salt.end());
   bytes.insert(bytes.end(), header.nonce.begin(), header.nonce.end());
   AppendU64LE(bytes, header.plaintext_size);
+  if (kIsV3) {
+    AppendU32LE(bytes, header.chunk_size);
+    AppendU32LE(bytes, 0);
+    AppendU32LE(bytes, 0);
+    bytes.insert(bytes.end(), header.stream_header.begin(),
+                 header.stream_header.end());
+    return bytes;
+  }
   AppendU64LE(bytes, header.ciphertext_size);
   bytes.push_back(0);
   bytes.push_back(0);
@@ -116,8 +129,8 @@ auto BuildHeaderBytes(const TracerFileHeader& header)
 }
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-auto ParseHeader(const std::vector<std::uint8_t>& data,
-                 TracerFileHeader& header) -> FileCryptoResult {
+auto ParseHeader(std::span<const std::uint8_t> data, TracerFileHeader& header)
+    -> FileCryptoResult {
   if (data.size() < kMinHeaderPrefixSize) {
     return MakeError(FileCryptoError::kUnsupportedFormat,
                      "Encrypted file is too small to contain a valid header.");
@@ -229,8 +242,70 @@ auto ParseHeader(const std::vector<std::uint8_t>& data,
     return {};
   }
 
+  if (kVersion == kFormatVersionV3) {
+    if (data.size() < kHeaderSizeV3) {
+      return MakeError(FileCryptoError::kUnsupportedFormat,
+                       "Encrypted file is too small for v3 header.");
+    }
+    header.kVersion = kVersion;
+    header.kdf_id = data[kV2KdfOffset];
+    header.cipher_id = data[kV2CipherOffset];
+    header.compression_id = data[kV2CompressionIdOffset];
+    header.compression_level = data[kV2CompressionLevelOffset];
+    header.ops_limit = ReadU32LE(data, kV2OpsLimitOffset);
+    header.mem_limit_kib = ReadU32LE(data, kV2MemLimitOffset);
+    std::copy_n(data.begin() + kV2SaltOffset, header.salt.size(),
+                header.salt.begin());
+    std::copy_n(data.begin() + kV2NonceOffset, header.nonce.size(),
+                header.nonce.begin());
+    header.plaintext_size = ReadU64LE(data, kV2PlaintextSizeOffset);
+    header.ciphertext_size = 0;
+    header.chunk_size = ReadU32LE(data, kV3ChunkSizeOffset);
+    std::copy_n(data.begin() + kV3StreamHeaderOffset,
+                header.stream_header.size(), header.stream_header.begin());
+    header.header_size = kHeaderSizeV3;
+
+    if ((header.kdf_id != kKdfArgon2id &&
+         header.kdf_id != kKdfArgon2idBatchSubkey) ||
+        header.cipher_id != kCipherXChaCha20Poly1305SecretStream) {
+      return MakeError(
+          FileCryptoError::kUnsupportedFormat,
+          "Unsupported KDF or cipher identifier in encrypted v3 file.");
+    }
+    if (header.compression_id != kCompressionZstd) {
+      return MakeError(
+          FileCryptoError::kUnsupportedFormat,
+          "Unsupported compression identifier in encrypted v3 file.");
+    }
+    if (header.compression_level == 0) {
+      return MakeError(FileCryptoError::kUnsupportedFormat,
+                       "Encrypted v3 compression level must be non-zero.");
+    }
+    if (!std::ranges::all_of(
+            kV3ReservedOffsets,
+            [&](std::size_t index) -> bool { return data[index] == 0; })) {
+      return MakeError(FileCryptoError::kUnsupportedFormat,
+                       "Encrypted v3 reserved fields must be zero.");
+    }
+    if (header.ops_limit == 0 || header.mem_limit_kib == 0) {
+      return MakeError(FileCryptoError::kUnsupportedFormat,
+                       "Encrypted v3 KDF parameters are invalid.");
+    }
+    if (header.chunk_size == 0 || header.chunk_size > kMaxStreamChunkSize) {
+      return MakeError(FileCryptoError::kUnsupportedFormat,
+                       "Encrypted v3 chunk size is invalid.");
+    }
+    return {};
+  }
+
   return MakeError(FileCryptoError::kUnsupportedFormat,
                    "Unsupported encrypted file version.");
 }
 
+auto IsStreamFormatPrefix(std::span<const std::uint8_t> data) -> bool {
+  return data.size() >= kMinHeaderPrefixSize &&
+         std::equal(kTracerMagic.begin(), kTracerMagic.end(), data.begin()) &&
+         data[kVersionOffset] == kFormatVersionV3;
+}
+
 }  // namespace tracer_core::infrastructure::crypto::internal
@@ -5,6 +5,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 #include "infra/crypto/file_crypto_service.hpp"
@@ -14,17 +15,24 @@ namespace tracer_core::infrastructure::crypto::internal {
 constexpr std::array<char, 4> kTracerMagic = {'T', 'T', 'R', 'C'};
 constexpr std::uint8_t kFormatVersionV1 = 1;
 constexpr std::uint8_t kFormatVersionV2 = 2;
+constexpr std::uint8_t kFormatVersionV3 = 3;
 constexpr std::uint8_t kKdfArgon2id = 1;
 constexpr std::uint8_t kKdfArgon2idBatchSubkey = 2;
 constexpr std::uint8_t kCipherXChaCha20Poly1305 = 1;
+constexpr std::uint8_t kCipherXChaCha20Poly1305SecretStream = 2;
 constexpr std::uint8_t kCompressionNone = 0;
 constexpr std::uint8_t kCompressionZstd = 1;
 constexpr std::uint8_t kDefaultCompressionLevel = 1;
 
 constexpr std::size_t kHeaderSizeV1 = 64;
 constexpr std::size_t kHeaderSizeV2 = 80;
+constexpr std::size_t kHeaderSizeV3 = 104;
 constexpr std::size_t kSaltSize = 16;
 constexpr std::size_t kNonceSize = 24;
+constexpr std::size_t kStreamHeaderSize = 24;
+constexpr std::size_t kStreamRecordLengthSize = 4;
+constexpr std::uint32_t kDefaultStreamChunkSize = 1024U * 1024U;
+constexpr std::uint32_t kMaxStreamChunkSize = 16U * 1024U * 1024U;
 
 struct TracerFileHeader {
   std::array<char, 4> magic = kTracerMagic;
@@ -39,14 +47,19 @@ struct TracerFileHeader {
   std::array<std::uint8_t, kNonceSize> nonce{};
   std::uint64_t plaintext_size = 0;
   std::uint64_t ciphertext_size = 0;
+  std::uint32_t chunk_size = 0;
+  std::array<std::uint8_t, kStreamHeaderSize> stream_header{};
   std::size_t header_size = kHeaderSizeV2;
 };
 
 auto BuildHeaderBytes(const TracerFileHeader& header)
     -> std::vector<std::uint8_t>;
 
-auto ParseHeader(const std::vector<std::uint8_t>& data,
-                 TracerFileHeader& header) -> FileCryptoResult;
+auto ParseHeader(std::span<const std::uint8_t> data, TracerFileHeader& header)
+    -> FileCryptoResult;
+
+[[nodiscard]] auto IsStreamFormatPrefix(std::span<const std::uint8_t> data)
+    -> bool;
 
 }  // namespace tracer_core::infrastructure::crypto::internal
 
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <system_error>
 
 #include "infra/crypto/internal/file_crypto_common.hpp"
 
@@ -74,39 +75,116 @@ auto ReadAllBytes(const fs::path& path, ProgressReporter* reporter)
   return {{}, std::move(bytes)};
 }
 
-auto WriteAllBytes(const fs::path& path, const std::vector<std::uint8_t>& bytes)
-    -> FileCryptoResult {
+auto WriteAllBytes(const FileCryptoWriteCallback& write_callback,
+                   std::span<const std::uint8_t> bytes) -> FileCryptoResult {
+  if (!write_callback) {
+    return MakeError(FileCryptoError::kInvalidArgument,
+                     "Output writer callback is required.");
+  }
+  return write_callback(bytes);
+}
+
+auto MakeStreamSource(std::istream& input) -> CryptoByteSource {
+  return [&input](std::span<std::uint8_t> buffer)
+             -> std::pair<FileCryptoResult, std::size_t> {
+    if (buffer.empty() || input.eof()) {
+      return {{}, 0};
+    }
+    input.read(reinterpret_cast<char*>(buffer.data()),
+               static_cast<std::streamsize>(buffer.size()));
+    if (input.bad()) {
+      return {MakeError(FileCryptoError::kInputReadFailed,
+                        "Failed to read input file bytes."),
+              0};
+    }
+    return {{}, static_cast<std::size_t>(input.gcount())};
+  };
+}
+
+auto MakeSpanSource(std::span<const std::uint8_t> bytes) -> CryptoByteSource {
+  return [bytes, offset = std::size_t{0}](
+             std::span<std::uint8_t> buffer) mutable
+             -> std::pair<FileCryptoResult, std::size_t> {
+    const std::size_t kCount = std::min(buffer.size(), bytes.size() - offset);
+    std::copy_n(bytes.begin() + static_cast<std::ptrdiff_t>(offset), kCount,
+                buffer.begin());
+    offset += kCount;
+    return {{}, kCount};
+  };
+}
+
+auto ReadExactly(const CryptoByteSource& source, std::span<std::uint8_t> buffer)
+    -> std::pair<FileCryptoResult, std::size_t> {
+  std::size_t filled = 0;
+  while (filled < buffer.size()) {
+    auto [read_result, count] = source(buffer.subspan(filled));
+    if (!read_result.ok()) {
+      return {read_result, filled};
+    }
+    if (count == 0) {
+      break;
+    }
+    filled += count;
+  }
+  return {{}, filled};
+}
+
+StagedOutputFile::~StagedOutputFile() {
+  if (!committed_) {
+    Discard();
+  }
+}
+
+auto StagedOutputFile::Open(const fs::path& path) -> FileCryptoResult {
   if (const auto kDirResult = EnsureParentDirectory(path); !kDirResult.ok()) {
     return kDirResult;
   }
-
-  std::ofstream output(path, std::ios::binary | std::ios::trunc);
-  if (!output.is_open()) {
+  target_path_ = path;
+  staging_path_ = path;
+  staging_path_ += ".part";
+  output_.open(staging_path_, std::ios::binary | std::ios::trunc);
+  if (!output_.is_open()) {
     return MakeError(FileCryptoError::kOutputWriteFailed,
                      "Failed to open output file.");
   }
+  return {};
+}
 
-  std::size_t offset = 0;
-  while (offset < bytes.size()) {
-    const std::size_t kChunk = std::min(kIoChunkSize, bytes.size() - offset);
-    output.write(reinterpret_cast<const char*>(bytes.data() + offset),
-                 static_cast<std::streamsize>(kChunk));
-    if (!output.good()) {
-      return MakeError(FileCryptoError::kOutputWriteFailed,
-                       "Failed to write output file.");
-    }
-    offset += kChunk;
+auto StagedOutputFile::Write(std::span<const std::uint8_t> bytes)
+    -> FileCryptoResult {
+  output_.write(reinterpret_cast<const char*>(bytes.data()),
+                static_cast<std::streamsize>(bytes.size()));
+  if (!output_.good()) {
+    return MakeError(FileCryptoError::kOutputWriteFailed,
+                     "Failed to write output file.");
   }
   return {};
 }
 
-auto WriteAllBytes(const FileCryptoWriteCallback& write_callback,
-                   std::span<const std::uint8_t> bytes) -> FileCryptoResult {
-  if (!write_callback) {
-    return MakeError(FileCryptoError::kInvalidArgument,
-                     "Output writer callback is required.");
+auto StagedOutputFile::Commit() -> FileCryptoResult {
+  output_.close();
+  if (output_.fail()) {
+    return MakeError(FileCryptoError::kOutputWriteFailed,
+                     "Failed to write output file.");
+  }
+  std::error_code error;
+  fs::rename(staging_path_, target_path_, error);
+  if (error) {
+    return MakeError(FileCryptoError::kOutputWriteFailed,
+                     "Failed to replace output file.");
+  }
+  committed_ = true;
+  return {};
+}
+
+auto StagedOutputFile::Discard() -> void {
+  if (output_.is_open()) {
+    output_.close();
+  }
+  if (!staging_path_.empty()) {
+    std::error_code error;
+    fs::remove(staging_path_, error);
   }
-  return write_callback(bytes);
 }
 
 }  // namespace tracer_core::infrastructure::crypto::internal
@@ -2,8 +2,13 @@
 #ifndef INFRASTRUCTURE_CRYPTO_INTERNAL_FILE_CRYPTO_IO_HPP_
 #define INFRASTRUCTURE_CRYPTO_INTERNAL_FILE_CRYPTO_IO_HPP_
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -17,12 +22,43 @@ namespace fs = std::filesystem;
 auto ReadAllBytes(const fs::path& path, ProgressReporter* reporter)
     -> std::pair<FileCryptoResult, std::vector<std::uint8_t>>;
 
-auto WriteAllBytes(const fs::path& path, const std::vector<std::uint8_t>& bytes)
-    -> FileCryptoResult;
-
 auto WriteAllBytes(const FileCryptoWriteCallback& write_callback,
                    std::span<const std::uint8_t> bytes) -> FileCryptoResult;
 
+// 最多填满 buffer，返回读到的字节数；0 表示输入结束。
+using CryptoByteSource = std::function<std::pair<FileCryptoResult, std::size_t>(
+    std::span<std::uint8_t>)>;
+
+auto MakeStreamSource(std::istream& input) -> CryptoByteSource;
+
+auto MakeSpanSource(std::span<const std::uint8_t> bytes) -> CryptoByteSource;
+
+// 反复读取直到 buffer 填满或输入结束。
+auto ReadExactly(const CryptoByteSource& source, std::span<std::uint8_t> buffer)
+    -> std::pair<FileCryptoResult, std::size_t>;
+
+// 先写 "<path>.part"，Commit() 时改名覆盖目标；
+// 未提交的临时文件在析构时删除。
+class StagedOutputFile {
+ public:
+  StagedOutputFile() = default;
+  StagedOutputFile(const StagedOutputFile&) = delete;
+  auto operator=(const StagedOutputFile&) -> StagedOutputFile& = delete;
+  ~StagedOutputFile();
+
+  auto Open(const fs::path& path) -> FileCryptoResult;
+  auto Write(std::span<const std::uint8_t> bytes) -> FileCryptoResult;
+  auto Commit() -> FileCryptoResult;
+
+ private:
+  auto Discard() -> void;
+
+  fs::path target_path_;
+  fs::path staging_path_;
+  std::ofstream output_;
+  bool committed_ = false;
+};
+
 }  // namespace tracer_core::infrastructure::crypto::internal
 
 #endif  // INFRASTRUCTURE_CRYPTO_INTERNAL_FILE_CRYPTO_IO_HPP_
@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <mutex>
 #include <utility>
 
 #include "infra/crypto/internal/file_crypto_backend_engine_internal.hpp"
@@ -188,6 +189,10 @@ auto GetOrDeriveMasterKeyForHeader(std::string_view passphrase,
                                    const TracerFileHeader& header,
                                    BatchCryptoSession* batch_session)
     -> std::pair<FileCryptoResult, std::vector<std::uint8_t>> {
+  std::unique_lock<std::mutex> cache_lock;
+  if (batch_session != nullptr && batch_session->decrypt_master_key_mutex) {
+    cache_lock = std::unique_lock(*batch_session->decrypt_master_key_mutex);
+  }
   if (auto* cached = FindCachedMasterKey(batch_session, header);
       cached != nullptr) {
     return {{}, *cached};
@@ -206,7 +211,7 @@ auto GetOrDeriveMasterKeyForHeader(std::string_view passphrase,
   return {{}, std::move(derived_key)};
 }
 
-auto BuildDefaultHeaderV2(FileCryptoSecurityLevel security_level,
+auto BuildDefaultHeaderV3(FileCryptoSecurityLevel security_level,
                           std::uint8_t kdf_id,
                           const std::array<std::uint8_t, kSaltSize>* fixed_salt)
     -> std::pair<FileCryptoResult, TracerFileHeader> {
@@ -219,7 +224,7 @@ auto BuildDefaultHeaderV2(FileCryptoSecurityLevel security_level,
   const auto kOpsLimit = kLimits.ops_limit;
   if (kOpsLimit > kOpsLimitMax) {
     return {MakeError(FileCryptoError::kCryptoOperationFailed,
-                      "libsodium opslimit exceeds v2 header capacity."),
+                      "libsodium opslimit exceeds v3 header capacity."),
             {}};
   }
 
@@ -229,18 +234,19 @@ auto BuildDefaultHeaderV2(FileCryptoSecurityLevel security_level,
       kMemLimitKiB > static_cast<std::uint64_t>(
                          std::numeric_limits<std::uint32_t>::max())) {
     return {MakeError(FileCryptoError::kCryptoOperationFailed,
-                      "libsodium memlimit exceeds v2 header capacity."),
+                      "libsodium memlimit exceeds v3 header capacity."),
             {}};
   }
 
-  header.kVersion = kFormatVersionV2;
+  header.kVersion = kFormatVersionV3;
   header.kdf_id = kdf_id;
-  header.cipher_id = kCipherXChaCha20Poly1305;
+  header.cipher_id = kCipherXChaCha20Poly1305SecretStream;
   header.compression_id = kCompressionZstd;
   header.compression_level = kDefaultCompressionLevel;
   header.ops_limit = static_cast<std::uint32_t>(kOpsLimit);
   header.mem_limit_kib = static_cast<std::uint32_t>(kMemLimitKiB);
-  header.header_size = kHeaderSizeV2;
+  header.chunk_size = kDefaultStreamChunkSize;
+  header.header_size = kHeaderSizeV3;
   if (fixed_salt != nullptr) {
     header.salt = *fixed_salt;
   } else {
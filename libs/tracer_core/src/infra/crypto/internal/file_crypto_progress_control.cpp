@@ -90,6 +90,23 @@ auto ProgressReporter::MarkFailed() -> FileCryptoResult {
   return Emit(true);
 }
 
+auto ProgressReporter::PublishFileSnapshot(
+    const FileCryptoProgressSnapshot& file_snapshot,
+    std::uint64_t overall_done_bytes, bool force_emit) -> FileCryptoResult {
+  snapshot_.phase = file_snapshot.phase;
+  snapshot_.current_input_path = file_snapshot.current_input_path;
+  snapshot_.current_output_path = file_snapshot.current_output_path;
+  snapshot_.current_group_label = file_snapshot.current_group_label;
+  snapshot_.group_index = file_snapshot.group_index;
+  snapshot_.file_index_in_group = file_snapshot.file_index_in_group;
+  snapshot_.file_count_in_group = file_snapshot.file_count_in_group;
+  snapshot_.current_file_index = file_snapshot.current_file_index;
+  snapshot_.current_file_done_bytes = file_snapshot.current_file_done_bytes;
+  snapshot_.current_file_total_bytes = file_snapshot.current_file_total_bytes;
+  snapshot_.overall_done_bytes = overall_done_bytes;
+  return Emit(force_emit);
+}
+
 auto ProgressReporter::CurrentOverallDoneBytes() const -> std::uint64_t {
   return snapshot_.overall_done_bytes;
 }
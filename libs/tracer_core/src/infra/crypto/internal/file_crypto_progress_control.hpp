@@ -48,6 +48,11 @@ class ProgressReporter {
   auto MarkCancelled() -> FileCryptoResult;
   auto MarkFailed() -> FileCryptoResult;
 
+  // 并行目录任务用：以某个文件的快照和聚合后的总进度发出一次事件。
+  auto PublishFileSnapshot(const FileCryptoProgressSnapshot& file_snapshot,
+                           std::uint64_t overall_done_bytes, bool force_emit)
+      -> FileCryptoResult;
+
   [[nodiscard]] auto CurrentOverallDoneBytes() const -> std::uint64_t;
 
  private:
@@ -3,20 +3,28 @@
 #include <algorithm>
 #include <cstdint>
 #include <map>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <system_error>
+#include <utility>
 #include <vector>
 
+#include "application/dto/ingest_input_model.hpp"
+
 import tracer.core.infrastructure.exchange;
 
 namespace tracer_core::infrastructure::crypto::tracer_exchange_internal {
 
 namespace {
 
+namespace app_ingest = tracer_core::application::dto;
+
+// Package payload collection, converter config staging, and managed month
+// discovery.
 #include "infra/exchange/detail/tracer_exchange_service_import_payloads_impl.inc"
 
-// Backup, rollback, effective-root assembly, and managed text updates.
+// Backup, rollback, effective ingest input assembly, and managed text updates.
 #include "infra/exchange/detail/tracer_exchange_service_import_text_root_impl.inc"
 
 // Transaction path layout, progress emission, rollback orchestration, and
@@ -74,7 +82,7 @@ auto TracerExchangeService::RunImport(
     EmitImportTransactionProgress(
         request.progress_observer, "decrypt_package", 1U, kPhaseCount,
         kInputPath.filename().string(), 0U, 1U, kInputPath, kActiveTextRoot,
-        kInputPath, kTransactionPaths.extracted_root);
+        kInputPath, kTransactionPaths.transaction_root);
     const file_crypto::FileCryptoPathContext kPathContext{
         .input_root_path = kInputPath.parent_path(),
         .output_root_path = kTransactionPaths.transaction_root,
@@ -90,36 +98,35 @@ auto TracerExchangeService::RunImport(
     EmitImportTransactionProgress(
         request.progress_observer, "decrypt_package", 1U, kPhaseCount,
         kInputPath.filename().string(), 1U, 1U, kInputPath, kActiveTextRoot,
-        kInputPath, kTransactionPaths.extracted_root);
+        kInputPath, kTransactionPaths.transaction_root);
 
     EmitImportTransactionProgress(
         request.progress_observer, "validate_package_contract", 2U, kPhaseCount,
         kInputPath.filename().string(), 0U, 1U, kInputPath, kActiveTextRoot,
-        kInputPath, kTransactionPaths.extracted_root);
+        kInputPath, kTransactionPaths.transaction_root);
     const exchange_pkg::DecodedTracerExchangePackage kPackage =
         DecodePackageBytes(package_bytes);
     EmitImportTransactionProgress(
         request.progress_observer, "validate_package_contract", 2U, kPhaseCount,
         kInputPath.filename().string(), 1U, 1U, kInputPath, kActiveTextRoot,
-        kInputPath, kTransactionPaths.extracted_root);
+        kInputPath, kTransactionPaths.transaction_root);
 
-    WriteDecodedPackageToRoot(kPackage, kTransactionPaths.extracted_root);
+    WritePackageConverterConfigToRoot(kPackage,
+                                      kTransactionPaths.package_config_root);
+    const fs::path kPackageConverterMainPath =
+        kTransactionPaths.package_config_root /
+        fs::path(exchange_pkg::kConverterMainPath);
     EmitImportTransactionProgress(
         request.progress_observer, "validate_converter_config", 3U, kPhaseCount,
         "converter_config", 0U, 1U, kInputPath, kActiveTextRoot,
-        kTransactionPaths.extracted_root /
-            fs::path(exchange_pkg::kConverterMainPath),
-        request.active_converter_main_config_path);
-    ValidatePackageConverterConfig(kTransactionPaths.extracted_root);
+        kPackageConverterMainPath, request.active_converter_main_config_path);
+    ValidatePackageConverterConfig(kTransactionPaths.package_config_root);
     EmitImportTransactionProgress(
         request.progress_observer, "validate_converter_config", 3U, kPhaseCount,
         "converter_config", 1U, 1U, kInputPath, kActiveTextRoot,
-        kTransactionPaths.extracted_root /
-            fs::path(exchange_pkg::kConverterMainPath),
-        request.active_converter_main_config_path);
+        kPackageConverterMainPath, request.active_converter_main_config_path);
 
-    imported_payloads =
-        CollectImportedPayloadFiles(kTransactionPaths.extracted_root);
+    imported_payloads = CollectImportedPayloads(kPackage);
     if (imported_payloads.empty()) {
       throw std::runtime_error(
           "Tracer exchange package must contain at least one canonical payload "
@@ -128,20 +135,23 @@ auto TracerExchangeService::RunImport(
     const std::map<std::string, fs::path> kManagedMonthFiles =
         CollectManagedMonthFiles(kActiveTextRoot);
 
+    // The effective text view (imported months over preserved months) is
+    // validated and ingested from memory; only the final TXT files and the
+    // backups are written to storage.
     const std::size_t kEffectiveTextEntryCount =
         kManagedMonthFiles.size() + imported_payloads.size();
     EmitImportTransactionProgress(
         request.progress_observer, "build_effective_text_view", 4U, kPhaseCount,
-        "effective_text_root", 0U, kEffectiveTextEntryCount, kInputPath,
-        kActiveTextRoot, kActiveTextRoot,
-        kTransactionPaths.effective_text_root);
-    BuildEffectiveTextRoot(kManagedMonthFiles, imported_payloads,
-                           kTransactionPaths.effective_text_root);
+        "effective_text_view", 0U, kEffectiveTextEntryCount, kInputPath,
+        kActiveTextRoot, kActiveTextRoot, kActiveTextRoot);
+    std::vector<app_ingest::IngestInputModel> effective_inputs =
+        BuildEffectiveIngestInputs(kActiveTextRoot, kManagedMonthFiles,
+                                   imported_payloads);
     EmitImportTransactionProgress(
         request.progress_observer, "build_effective_text_view", 4U, kPhaseCount,
-        "effective_text_root", kEffectiveTextEntryCount,
-        kEffectiveTextEntryCount, kInputPath, kActiveTextRoot,
-        kActiveTextRoot, kTransactionPaths.effective_text_root);
+        "effective_text_view", kEffectiveTextEntryCount,
+        kEffectiveTextEntryCount, kInputPath, kActiveTextRoot, kActiveTextRoot,
+        kActiveTextRoot);
 
     const ActiveConverterConfigPaths kActivePaths =
         ResolveActiveConverterConfigPaths(
@@ -151,61 +161,54 @@ auto TracerExchangeService::RunImport(
     BackupManagedTextFiles(kActiveTextRoot, imported_payloads,
                            kManagedMonthFiles,
                            kTransactionPaths.backup_text_root);
+    // With an unchanged converter config only months whose canonical text
+    // changed (plus their boundary months) are rebuilt; a new config changes
+    // how every month converts, so the database is rebuilt from scratch.
+    const bool kConverterConfigUnchanged =
+        PackageConverterConfigMatchesActive(
+            kTransactionPaths.package_config_root,
+            kTransactionPaths.backup_config_root);
 
     EmitImportTransactionProgress(
         request.progress_observer, "apply_converter_config", 5U, kPhaseCount,
         "converter_config", 0U, 1U, kInputPath, kActiveTextRoot,
-        kTransactionPaths.extracted_root /
-            fs::path(exchange_pkg::kConverterMainPath),
-        request.active_converter_main_config_path);
+        kPackageConverterMainPath, request.active_converter_main_config_path);
     config_applied = true;
     workflow_handler_.InstallActiveConverterConfig({
-        .source_main_config_path =
-            (kTransactionPaths.extracted_root /
-             fs::path(exchange_pkg::kConverterMainPath))
-                .string(),
+        .source_main_config_path = kPackageConverterMainPath.string(),
         .target_main_config_path =
             request.active_converter_main_config_path.string(),
     });
     EmitImportTransactionProgress(
         request.progress_observer, "apply_converter_config", 5U, kPhaseCount,
         "converter_config", 1U, 1U, kInputPath, kActiveTextRoot,
-        kTransactionPaths.extracted_root /
-            fs::path(exchange_pkg::kConverterMainPath),
-        request.active_converter_main_config_path);
+        kPackageConverterMainPath, request.active_converter_main_config_path);
 
     EmitImportTransactionProgress(
         request.progress_observer, "validate_text_structure", 6U, kPhaseCount,
-        kTransactionPaths.effective_text_root.string(), 0U, 1U, kInputPath,
-        kActiveTextRoot, kTransactionPaths.effective_text_root,
-        kActiveTextRoot);
-    workflow_handler_.RunValidateStructure(
-        kTransactionPaths.effective_text_root.string());
+        "effective_text_view", 0U, 1U, kInputPath, kActiveTextRoot,
+        kActiveTextRoot, kActiveTextRoot);
+    workflow_handler_.RunValidateStructureFromInputs(effective_inputs);
     EmitImportTransactionProgress(
         request.progress_observer, "validate_text_structure", 6U, kPhaseCount,
-        kTransactionPaths.effective_text_root.string(), 1U, 1U, kInputPath,
-        kActiveTextRoot, kTransactionPaths.effective_text_root,
-        kActiveTextRoot);
+        "effective_text_view", 1U, 1U, kInputPath, kActiveTextRoot,
+        kActiveTextRoot, kActiveTextRoot);
 
     EmitImportTransactionProgress(
         request.progress_observer, "validate_text_logic", 7U, kPhaseCount,
-        kTransactionPaths.effective_text_root.string(), 0U, 1U, kInputPath,
-        kActiveTextRoot, kTransactionPaths.effective_text_root,
-        kActiveTextRoot);
-    workflow_handler_.RunValidateLogic(
-        kTransactionPaths.effective_text_root.string(),
-        request.date_check_mode);
+        "effective_text_view", 0U, 1U, kInputPath, kActiveTextRoot,
+        kActiveTextRoot, kActiveTextRoot);
+    workflow_handler_.RunValidateLogicFromInputs(effective_inputs,
+                                                 request.date_check_mode);
     EmitImportTransactionProgress(
         request.progress_observer, "validate_text_logic", 7U, kPhaseCount,
-        kTransactionPaths.effective_text_root.string(), 1U, 1U, kInputPath,
-        kActiveTextRoot, kTransactionPaths.effective_text_root,
-        kActiveTextRoot);
+        "effective_text_view", 1U, 1U, kInputPath, kActiveTextRoot,
+        kActiveTextRoot, kActiveTextRoot);
 
     EmitImportTransactionProgress(
         request.progress_observer, "replace_managed_text", 8U, kPhaseCount,
         kActiveTextRoot.string(), 0U, imported_payloads.size(), kInputPath,
-        kActiveTextRoot, kTransactionPaths.effective_text_root,
-        kActiveTextRoot);
+        kActiveTextRoot, kInputPath, kActiveTextRoot);
     text_root_updated = true;
     WriteImportedPayloadsToActiveTextRoot(kActiveTextRoot,
                                           kManagedMonthFiles,
@@ -213,24 +216,24 @@ auto TracerExchangeService::RunImport(
     EmitImportTransactionProgress(
         request.progress_observer, "replace_managed_text", 8U, kPhaseCount,
         kActiveTextRoot.string(), imported_payloads.size(),
-        imported_payloads.size(), kInputPath, kActiveTextRoot,
-        kTransactionPaths.effective_text_root, kActiveTextRoot);
+        imported_payloads.size(), kInputPath, kActiveTextRoot, kInputPath,
+        kActiveTextRoot);
 
     EmitImportTransactionProgress(
         request.progress_observer, "rebuild_database", kRebuildDatabasePhase,
-        kPhaseCount,
-        kTransactionPaths.effective_text_root.string(), 0U, 1U, kInputPath,
-        kActiveTextRoot, kTransactionPaths.effective_text_root,
-        kActiveTextRoot);
-    workflow_handler_.RunIngestReplacingAll(
-        kTransactionPaths.effective_text_root.string(), request.date_check_mode,
-        false);
+        kPhaseCount, "effective_text_view", 0U, 1U, kInputPath,
+        kActiveTextRoot, kActiveTextRoot, kActiveTextRoot);
+    if (kConverterConfigUnchanged) {
+      workflow_handler_.RunIngestChangedMonthsFromInputs(
+          std::move(effective_inputs), request.date_check_mode);
+    } else {
+      workflow_handler_.RunIngestReplacingAllFromInputs(
+          std::move(effective_inputs), request.date_check_mode);
+    }
     EmitImportTransactionProgress(
         request.progress_observer, "rebuild_database", kRebuildDatabasePhase,
-        kPhaseCount,
-        kTransactionPaths.effective_text_root.string(), 1U, 1U, kInputPath,
-        kActiveTextRoot, kTransactionPaths.effective_text_root,
-        kActiveTextRoot);
+        kPhaseCount, "effective_text_view", 1U, 1U, kInputPath,
+        kActiveTextRoot, kActiveTextRoot, kActiveTextRoot);
 
     EmitImportTransactionProgress(
         request.progress_observer, "cleanup", kCleanupPhase, kPhaseCount,
@@ -10,9 +10,9 @@ namespace tracer_core::infrastructure::crypto::tracer_exchange_internal {
 
 namespace {
 
-using exchange_pkg::DecodePackageBytes;
+using exchange_pkg::DecodePackageIndex;
 
-auto FindEntrySummary(const exchange_pkg::DecodedTracerExchangePackage& package,
+auto FindEntrySummary(const exchange_pkg::TracerExchangePackageIndex& package,
                       std::string_view path)
     -> app_dto::TracerExchangeInspectEntrySummary {
   app_dto::TracerExchangeInspectEntrySummary summary{};
@@ -20,7 +20,7 @@ auto FindEntrySummary(const exchange_pkg::DecodedTracerExchangePackage& package,
   for (const auto& entry : package.entries) {
     if (entry.relative_path == path) {
       summary.present = true;
-      summary.size_bytes = static_cast<std::uint64_t>(entry.data.size());
+      summary.size_bytes = entry.raw_size;
       break;
     }
   }
@@ -29,7 +29,7 @@ auto FindEntrySummary(const exchange_pkg::DecodedTracerExchangePackage& package,
 
 auto BuildInspectResult(
     const fs::path& input_path, const file_crypto::TracerFileMetadata& metadata,
-    const exchange_pkg::DecodedTracerExchangePackage& package)
+    const exchange_pkg::TracerExchangePackageIndex& package)
     -> app_dto::TracerExchangeInspectResult {
   app_dto::TracerExchangeInspectResult result{};
   result.ok = true;
@@ -109,8 +109,10 @@ auto TracerExchangeService::RunInspect(
       BuildCryptoOptions(app_dto::TracerExchangeSecurityLevel::kInteractive,
                          request.progress_observer));
   EnsureCryptoResultOk(decrypt_result, "Inspect", kInputPath);
-  const exchange_pkg::DecodedTracerExchangePackage kPackage =
-      DecodePackageBytes(package_bytes);
+  // Inspect only needs the manifest and entry sizes; payload entries are
+  // neither decompressed nor hashed.
+  const exchange_pkg::TracerExchangePackageIndex kPackage =
+      DecodePackageIndex(package_bytes);
   return BuildInspectResult(kInputPath, metadata, kPackage);
 }
 
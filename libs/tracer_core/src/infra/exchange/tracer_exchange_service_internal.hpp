@@ -47,7 +47,8 @@ struct ParsedMonthInfo {
 };
 
 struct ImportedPayloadFile {
-  fs::path source_path;
+  // Canonical month TXT text; kept in memory for the whole import.
+  std::string content;
   std::string relative_package_path;
   std::string month_key;
   int year = 0;
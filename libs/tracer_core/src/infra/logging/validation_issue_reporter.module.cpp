@@ -162,7 +162,8 @@ void ValidationIssueReporter::ReportStructureErrors(
 
       if (error.source_span.has_value() &&
           !error.source_span->raw_text.empty()) {
-        const std::string kRawLine = "    > " + error.source_span->raw_text;
+        const std::string kRawLine =
+            "    > " + error.source_span->raw_text.str();
         modports::EmitError(kRawLine);
         report_stream << kRawLine << "\n";
       }
@@ -204,7 +205,7 @@ void ValidationIssueReporter::ReportLogicDiagnostics(
       if (diagnostic.source_span.has_value() &&
           !diagnostic.source_span->raw_text.empty()) {
         const std::string kRawLine =
-            "    > " + diagnostic.source_span->raw_text;
+            "    > " + diagnostic.source_span->raw_text.str();
         modports::EmitError(kRawLine);
         report_stream << kRawLine << "\n";
       }
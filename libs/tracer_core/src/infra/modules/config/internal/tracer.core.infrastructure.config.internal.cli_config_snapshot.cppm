@@ -1,5 +1,6 @@
 module;
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
 #include <string>
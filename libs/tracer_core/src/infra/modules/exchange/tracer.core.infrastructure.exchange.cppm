@@ -17,6 +17,12 @@ module;
 #include <sodium.h>
 #endif
 
+#if defined(TT_HAS_ZSTD) && TT_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+#include "shared/utils/work_stealing_executor.hpp"
+
 #include <toml++/toml.h>
 
 export module tracer.core.infrastructure.exchange;
@@ -44,6 +50,11 @@ inline constexpr std::uint16_t kEntryFlagText = 0x0002U;
 inline constexpr std::uint16_t kStandardEntryFlags =
     kEntryFlagRequired | kEntryFlagText;
 
+// Per-entry storage codec of the v4 binary layout; v3 entries are always
+// stored.
+inline constexpr std::uint8_t kEntryCodecStored = 0U;
+inline constexpr std::uint8_t kEntryCodecZstd = 1U;
+
 struct TracerExchangeManifest {
   std::string package_type = "tracer_exchange";
   // v4 extends converter packaging from a fixed three-file layout
@@ -77,14 +88,49 @@ struct DecodedTracerExchangePackage {
   std::vector<TracerExchangePackageEntry> entries;
 };
 
+// Location and digest of one entry, read from the v3 TOC or the v4 trailing
+// index without touching the entry data.
+struct TracerExchangePackageIndexEntry {
+  std::string relative_path;
+  std::uint16_t entry_flags = kStandardEntryFlags;
+  std::uint8_t codec = kEntryCodecStored;
+  // Absolute offset of the stored (possibly compressed) bytes in the package.
+  std::uint64_t stored_offset = 0U;
+  std::uint64_t stored_size = 0U;
+  std::uint64_t raw_size = 0U;
+  // SHA-256 of the raw (decompressed) entry bytes.
+  std::array<std::uint8_t, 32> sha256{};
+};
+
+struct TracerExchangePackageIndex {
+  std::uint8_t format_version = 0U;
+  TracerExchangeManifest manifest;
+  std::vector<TracerExchangePackageIndexEntry> entries;
+};
+
 [[nodiscard]] auto BuildManifestText(const TracerExchangeManifest& manifest)
     -> std::string;
 [[nodiscard]] auto ParseManifestText(std::string_view manifest_text)
     -> TracerExchangeManifest;
 
+// Encodes the current (v4) binary layout.
 [[nodiscard]] auto EncodePackageBytes(
     const std::vector<TracerExchangePackageEntry>& entries)
     -> std::vector<std::uint8_t>;
+// Encodes the legacy v3 binary layout; kept for compatibility fixtures.
+[[nodiscard]] auto EncodePackageBytesV3(
+    const std::vector<TracerExchangePackageEntry>& entries)
+    -> std::vector<std::uint8_t>;
+// Reads the header, index and manifest only (v3 or v4). Only the manifest
+// entry is decoded and verified.
+[[nodiscard]] auto DecodePackageIndex(std::span<const std::uint8_t> bytes)
+    -> TracerExchangePackageIndex;
+// Decodes and verifies one entry located by DecodePackageIndex.
+[[nodiscard]] auto DecodePackageEntry(
+    std::span<const std::uint8_t> bytes,
+    const TracerExchangePackageIndexEntry& index_entry)
+    -> TracerExchangePackageEntry;
+// Decodes and verifies every entry (v3 or v4).
 [[nodiscard]] auto DecodePackageBytes(std::span<const std::uint8_t> bytes)
     -> DecodedTracerExchangePackage;
 
@@ -108,10 +154,20 @@ struct PackageEntryRecord {
 namespace {
 
 constexpr std::string_view kPackageMagic = "TTPKG";
-constexpr std::uint8_t kPackageVersion = 3U;
+constexpr std::uint8_t kPackageVersionV3 = 3U;
+constexpr std::uint8_t kPackageVersion = 4U;
 constexpr std::uint16_t kPackageHeaderSize = 32U;
 constexpr std::uint16_t kPackageFlags = 0U;
 constexpr std::uint16_t kManifestIndex = 0U;
+constexpr std::size_t kSha256Size = 32U;
+constexpr std::size_t kV3TocRecordFixedSize = 2U + 2U + 8U + 8U + kSha256Size;
+constexpr std::size_t kV4IndexRecordFixedSize =
+    2U + 2U + 1U + 1U + 8U + 8U + 8U + kSha256Size;
+constexpr int kEntryCompressionLevel = 3;
+// Decompression-bomb guard: no legitimate config or month TXT comes close.
+constexpr std::uint64_t kMaxEntryRawSize = 1ULL << 30U;
+// Below this much stored data, thread start-up costs more than hashing.
+constexpr std::uint64_t kParallelDecodeMinBytes = 1ULL << 20U;
 
 constexpr std::string_view kMalformedPackagePrefix =
     "unsupported/malformed tracer package";
@@ -302,9 +358,12 @@ auto ValidateAliasMappingFiles(
   }
 }
 
-auto ValidatePackageEntryLayout(
-    const std::vector<TracerExchangePackageEntry>& entries,
-    const TracerExchangeManifest& manifest) -> void {
+// Works on decoded entries and on index entries; both carry relative_path
+// and entry_flags.
+template <typename Entry>
+auto ValidatePackageEntryLayout(const std::vector<Entry>& entries,
+                                const TracerExchangeManifest& manifest)
+    -> void {
   const std::size_t expected_entry_count =
       kRequiredPackagePaths.size() +
       manifest.converter_alias_mapping_files.size() + manifest.payload_files.size();
@@ -351,7 +410,7 @@ auto ValidatePackageEntryLayout(
   }
 }
 
-[[nodiscard]] auto BuildPackageBytesInternal(
+[[nodiscard]] auto BuildPackageBytesV3(
     const std::vector<TracerExchangePackageEntry>& entries)
     -> std::vector<std::uint8_t> {
   std::vector<detail::PackageEntryRecord> records;
@@ -395,7 +454,7 @@ auto ValidatePackageEntryLayout(
   }
 
   std::copy(kPackageMagic.begin(), kPackageMagic.end(), bytes.begin());
-  bytes[5U] = kPackageVersion;
+  bytes[5U] = kPackageVersionV3;
   WriteU16LE(bytes, 6U, kPackageHeaderSize);
   WriteU16LE(bytes, 8U, kPackageFlags);
   if (records.size() > static_cast<std::size_t>(UINT16_MAX)) {
@@ -410,6 +469,306 @@ auto ValidatePackageEntryLayout(
   return bytes;
 }
 
+[[nodiscard]] auto CompressEntry(const std::vector<std::uint8_t>& raw,
+                               std::uint8_t& codec)
+    -> std::vector<std::uint8_t> {
+  codec = kEntryCodecStored;
+#if defined(TT_HAS_ZSTD) && TT_HAS_ZSTD
+  if (raw.empty()) {
+    return raw;
+  }
+  std::vector<std::uint8_t> compressed(ZSTD_compressBound(raw.size()));
+  const std::size_t kCompressedSize =
+      ZSTD_compress(compressed.data(), compressed.size(), raw.data(),
+                    raw.size(), kEntryCompressionLevel);
+  if (ZSTD_isError(kCompressedSize) != 0U) {
+    throw std::runtime_error("Failed to compress tracer exchange entry.");
+  }
+  // Entries that do not shrink are stored as-is.
+  if (kCompressedSize >= raw.size()) {
+    return raw;
+  }
+  compressed.resize(kCompressedSize);
+  codec = kEntryCodecZstd;
+  return compressed;
+#else
+  return raw;
+#endif
+}
+
+[[nodiscard]] auto DecompressEntry(std::span<const std::uint8_t> stored,
+                                   std::uint64_t raw_size)
+    -> std::vector<std::uint8_t> {
+#if defined(TT_HAS_ZSTD) && TT_HAS_ZSTD
+  std::vector<std::uint8_t> raw(static_cast<std::size_t>(raw_size));
+  const std::size_t kDecompressedSize = ZSTD_decompress(
+      raw.data(), raw.size(), stored.data(), stored.size());
+  if (ZSTD_isError(kDecompressedSize) != 0U ||
+      kDecompressedSize != raw.size()) {
+    ThrowMalformedPackage("entry decompression failed.");
+  }
+  return raw;
+#else
+  (void)stored;
+  (void)raw_size;
+  throw std::runtime_error(
+      "Tracer exchange compressed entries require zstd support.");
+#endif
+}
+
+// v4: header | entry data | index | SHA-256(header + index).
+// The trailing digest lets readers trust the index (and through its per-entry
+// hashes, any single entry) without hashing the data section.
+[[nodiscard]] auto BuildPackageBytesV4(
+    const std::vector<TracerExchangePackageEntry>& entries)
+    -> std::vector<std::uint8_t> {
+  if (entries.size() > static_cast<std::size_t>(UINT16_MAX)) {
+    throw std::runtime_error("Tracer exchange entry count exceeds UINT16_MAX.");
+  }
+
+  std::vector<std::uint8_t> bytes(kPackageHeaderSize, 0U);
+  std::vector<std::uint8_t> index;
+  for (const auto& entry : entries) {
+    if (entry.relative_path.size() > static_cast<std::size_t>(UINT16_MAX)) {
+      throw std::runtime_error("Tracer exchange path is too long: " +
+                               entry.relative_path);
+    }
+    std::uint8_t codec = kEntryCodecStored;
+    const std::vector<std::uint8_t> stored = CompressEntry(entry.data, codec);
+
+    AppendU16LE(index, static_cast<std::uint16_t>(entry.relative_path.size()));
+    AppendU16LE(index, entry.entry_flags);
+    index.push_back(codec);
+    index.push_back(0U);
+    AppendU64LE(index, static_cast<std::uint64_t>(bytes.size() -
+                                                  kPackageHeaderSize));
+    AppendU64LE(index, static_cast<std::uint64_t>(stored.size()));
+    AppendU64LE(index, static_cast<std::uint64_t>(entry.data.size()));
+    AppendBytes(index, ComputeSha256(entry.data));
+    AppendBytes(index, std::span<const std::uint8_t>(
+                           reinterpret_cast<const std::uint8_t*>(
+                               entry.relative_path.data()),
+                           entry.relative_path.size()));
+    AppendBytes(bytes, stored);
+  }
+  if (index.size() > static_cast<std::size_t>(UINT32_MAX)) {
+    throw std::runtime_error("Tracer exchange index exceeds UINT32_MAX.");
+  }
+
+  const std::uint64_t kIndexOffset = static_cast<std::uint64_t>(bytes.size());
+  std::copy(kPackageMagic.begin(), kPackageMagic.end(), bytes.begin());
+  bytes[5U] = kPackageVersion;
+  WriteU16LE(bytes, 6U, kPackageHeaderSize);
+  WriteU16LE(bytes, 8U, kPackageFlags);
+  WriteU16LE(bytes, 10U, static_cast<std::uint16_t>(entries.size()));
+  WriteU16LE(bytes, 12U, kManifestIndex);
+  WriteU16LE(bytes, 14U, 0U);
+  WriteU32LE(bytes, 16U, static_cast<std::uint32_t>(index.size()));
+  WriteU64LE(bytes, 20U, kIndexOffset);
+  WriteU32LE(bytes, 28U, 0U);
+
+  std::vector<std::uint8_t> digest_input(bytes.begin(),
+                                         bytes.begin() + kPackageHeaderSize);
+  AppendBytes(digest_input, index);
+  AppendBytes(bytes, index);
+  AppendBytes(bytes, ComputeSha256(digest_input));
+  return bytes;
+}
+
+struct PackageHeader {
+  std::uint8_t version = 0U;
+  std::uint16_t entry_count = 0U;
+  // v3: toc_size_bytes / data_section_size; v4: index_size / index_offset.
+  std::uint32_t table_size = 0U;
+  std::uint64_t section_value = 0U;
+};
+
+[[nodiscard]] auto ParsePackageHeader(std::span<const std::uint8_t> bytes)
+    -> PackageHeader {
+  if (bytes.size() < kPackageHeaderSize) {
+    ThrowMalformedPackage("package header is truncated.");
+  }
+  if (!std::equal(
+          kPackageMagic.begin(), kPackageMagic.end(), bytes.begin(),
+          bytes.begin() + static_cast<std::ptrdiff_t>(kPackageMagic.size()))) {
+    ThrowMalformedPackage("magic must be `TTPKG`.");
+  }
+  if (bytes[5U] != kPackageVersionV3 && bytes[5U] != kPackageVersion) {
+    ThrowMalformedPackage("unsupported package version.");
+  }
+  if (ReadU16LE(bytes, 6U) != kPackageHeaderSize) {
+    ThrowMalformedPackage("header_size must be 32.");
+  }
+  if (ReadU16LE(bytes, 8U) != kPackageFlags) {
+    ThrowMalformedPackage("package flags must be zero.");
+  }
+
+  PackageHeader header{};
+  header.version = bytes[5U];
+  header.entry_count = ReadU16LE(bytes, 10U);
+  const std::uint16_t manifest_index = ReadU16LE(bytes, 12U);
+  const std::uint16_t reserved_u16 = ReadU16LE(bytes, 14U);
+  header.table_size = ReadU32LE(bytes, 16U);
+  header.section_value = ReadU64LE(bytes, 20U);
+  const std::uint32_t reserved_u32 = ReadU32LE(bytes, 28U);
+
+  if (header.entry_count < kRequiredPackagePaths.size() + 1U) {
+    ThrowMalformedPackage(
+        "entry_count must include manifest, converter files, "
+        "and at least one payload text file.");
+  }
+  if (manifest_index != kManifestIndex) {
+    ThrowMalformedPackage("manifest_index must be 0.");
+  }
+  if (reserved_u16 != 0U || reserved_u32 != 0U) {
+    ThrowMalformedPackage("reserved header fields must be zero.");
+  }
+  return header;
+}
+
+[[nodiscard]] auto ReadIndexPath(std::span<const std::uint8_t> bytes,
+                                 std::size_t cursor, std::uint16_t path_len)
+    -> std::string {
+  const char* path_ptr = reinterpret_cast<const char*>(
+      bytes.data() + static_cast<std::ptrdiff_t>(cursor));
+  return std::string(path_ptr, path_ptr + path_len);
+}
+
+[[nodiscard]] auto ParseV3Toc(std::span<const std::uint8_t> bytes,
+                              const PackageHeader& header)
+    -> std::vector<TracerExchangePackageIndexEntry> {
+  const std::uint64_t data_section_size = header.section_value;
+  const std::size_t data_section_start =
+      static_cast<std::size_t>(kPackageHeaderSize) +
+      static_cast<std::size_t>(header.table_size);
+  if (data_section_start > bytes.size()) {
+    ThrowMalformedPackage("TOC extends beyond package size.");
+  }
+  if (data_section_start + static_cast<std::size_t>(data_section_size) !=
+      bytes.size()) {
+    ThrowMalformedPackage("data_section_size does not match package size.");
+  }
+
+  std::size_t cursor = kPackageHeaderSize;
+  std::vector<TracerExchangePackageIndexEntry> entries;
+  entries.reserve(header.entry_count);
+  for (std::size_t index = 0; index < header.entry_count; ++index) {
+    TracerExchangePackageIndexEntry entry{};
+    const std::uint16_t path_len = ReadU16LE(bytes, cursor);
+    entry.entry_flags = ReadU16LE(bytes, cursor + 2U);
+    const std::uint64_t data_offset = ReadU64LE(bytes, cursor + 4U);
+    const std::uint64_t data_size = ReadU64LE(bytes, cursor + 12U);
+    cursor += kV3TocRecordFixedSize - kSha256Size;
+
+    if (cursor + kSha256Size + path_len > data_section_start) {
+      ThrowMalformedPackage("TOC entry exceeds declared TOC size.");
+    }
+    std::copy(bytes.begin() + static_cast<std::ptrdiff_t>(cursor),
+              bytes.begin() + static_cast<std::ptrdiff_t>(cursor + kSha256Size),
+              entry.sha256.begin());
+    cursor += kSha256Size;
+    entry.relative_path = ReadIndexPath(bytes, cursor, path_len);
+    cursor += path_len;
+
+    if (entry.entry_flags != kStandardEntryFlags) {
+      ThrowMalformedPackage("entry_flags must be required|text for all files.");
+    }
+    if (data_offset + data_size > data_section_size) {
+      ThrowMalformedPackage("entry data exceeds data section bounds.");
+    }
+    entry.codec = kEntryCodecStored;
+    entry.stored_offset = data_section_start + data_offset;
+    entry.stored_size = data_size;
+    entry.raw_size = data_size;
+    entries.push_back(std::move(entry));
+  }
+
+  if (cursor != data_section_start) {
+    ThrowMalformedPackage("TOC size does not match parsed entry metadata.");
+  }
+  return entries;
+}
+
+[[nodiscard]] auto ParseV4Index(std::span<const std::uint8_t> bytes,
+                                const PackageHeader& header)
+    -> std::vector<TracerExchangePackageIndexEntry> {
+  const std::uint64_t index_offset = header.section_value;
+  const std::uint64_t index_size = header.table_size;
+  if (index_offset < kPackageHeaderSize || index_offset > bytes.size() ||
+      bytes.size() - index_offset != index_size + kSha256Size) {
+    ThrowMalformedPackage("index_offset/index_size do not match package size.");
+  }
+
+  const std::size_t index_start = static_cast<std::size_t>(index_offset);
+  const std::size_t index_end =
+      index_start + static_cast<std::size_t>(index_size);
+  std::vector<std::uint8_t> digest_input(bytes.begin(),
+                                         bytes.begin() + kPackageHeaderSize);
+  digest_input.insert(digest_input.end(),
+                      bytes.begin() + static_cast<std::ptrdiff_t>(index_start),
+                      bytes.begin() + static_cast<std::ptrdiff_t>(index_end));
+  if (!std::equal(bytes.begin() + static_cast<std::ptrdiff_t>(index_end),
+                  bytes.end(), ComputeSha256(digest_input).begin())) {
+    ThrowMalformedPackage("index digest mismatch.");
+  }
+
+  const std::uint64_t data_section_size = index_offset - kPackageHeaderSize;
+  std::size_t cursor = index_start;
+  std::vector<TracerExchangePackageIndexEntry> entries;
+  entries.reserve(header.entry_count);
+  for (std::size_t index = 0; index < header.entry_count; ++index) {
+    if (cursor + kV4IndexRecordFixedSize > index_end) {
+      ThrowMalformedPackage("index entry exceeds declared index size.");
+    }
+    TracerExchangePackageIndexEntry entry{};
+    const std::uint16_t path_len = ReadU16LE(bytes, cursor);
+    entry.entry_flags = ReadU16LE(bytes, cursor + 2U);
+    entry.codec = bytes[cursor + 4U];
+    const std::uint8_t reserved_u8 = bytes[cursor + 5U];
+    const std::uint64_t data_offset = ReadU64LE(bytes, cursor + 6U);
+    entry.stored_size = ReadU64LE(bytes, cursor + 14U);
+    entry.raw_size = ReadU64LE(bytes, cursor + 22U);
+    cursor += kV4IndexRecordFixedSize - kSha256Size;
+    std::copy(bytes.begin() + static_cast<std::ptrdiff_t>(cursor),
+              bytes.begin() + static_cast<std::ptrdiff_t>(cursor + kSha256Size),
+              entry.sha256.begin());
+    cursor += kSha256Size;
+    if (cursor + path_len > index_end) {
+      ThrowMalformedPackage("index entry exceeds declared index size.");
+    }
+    entry.relative_path = ReadIndexPath(bytes, cursor, path_len);
+    cursor += path_len;
+
+    if (entry.entry_flags != kStandardEntryFlags) {
+      ThrowMalformedPackage("entry_flags must be required|text for all files.");
+    }
+    if (reserved_u8 != 0U) {
+      ThrowMalformedPackage("reserved index fields must be zero.");
+    }
+    if (entry.codec != kEntryCodecStored && entry.codec != kEntryCodecZstd) {
+      ThrowMalformedPackage("unsupported entry codec.");
+    }
+    if (entry.codec == kEntryCodecStored &&
+        entry.raw_size != entry.stored_size) {
+      ThrowMalformedPackage("stored entry raw_size must equal stored_size.");
+    }
+    if (entry.raw_size > kMaxEntryRawSize) {
+      ThrowMalformedPackage("entry raw_size exceeds the supported limit.");
+    }
+    if (data_offset > data_section_size ||
+        entry.stored_size > data_section_size - data_offset) {
+      ThrowMalformedPackage("entry data exceeds data section bounds.");
+    }
+    entry.stored_offset = kPackageHeaderSize + data_offset;
+    entries.push_back(std::move(entry));
+  }
+
+  if (cursor != index_end) {
+    ThrowMalformedPackage("index size does not match parsed entry metadata.");
+  }
+  return entries;
+}
+
 [[nodiscard]] auto ParseExpectedString(const toml::table& table,
                                        std::string_view key) -> std::string {
   const auto value = table[std::string(key)].value<std::string>();
@@ -542,8 +901,10 @@ auto ParseManifestText(std::string_view manifest_text)
   return manifest;
 }
 
-auto EncodePackageBytes(const std::vector<TracerExchangePackageEntry>& entries)
-    -> std::vector<std::uint8_t> {
+namespace {
+
+auto ValidateEntriesForEncode(
+    const std::vector<TracerExchangePackageEntry>& entries) -> void {
   if (entries.empty() || entries.front().relative_path != kManifestPath) {
     ThrowMalformedPackage("entry order or fixed path set is invalid.");
   }
@@ -551,124 +912,97 @@ auto EncodePackageBytes(const std::vector<TracerExchangePackageEntry>& entries)
       reinterpret_cast<const char*>(entries.front().data.data()),
       entries.front().data.size()));
   ValidatePackageEntryLayout(entries, manifest);
-  return BuildPackageBytesInternal(entries);
 }
 
-auto DecodePackageBytes(std::span<const std::uint8_t> bytes)
-    -> DecodedTracerExchangePackage {
-  if (bytes.size() < kPackageHeaderSize) {
-    ThrowMalformedPackage("package header is truncated.");
-  }
-  if (!std::equal(
-          kPackageMagic.begin(), kPackageMagic.end(), bytes.begin(),
-          bytes.begin() + static_cast<std::ptrdiff_t>(kPackageMagic.size()))) {
-    ThrowMalformedPackage("magic must be `TTPKG`.");
-  }
-  if (bytes[5U] != kPackageVersion) {
-    ThrowMalformedPackage("unsupported package version.");
-  }
-  if (ReadU16LE(bytes, 6U) != kPackageHeaderSize) {
-    ThrowMalformedPackage("header_size must be 32.");
-  }
-  if (ReadU16LE(bytes, 8U) != kPackageFlags) {
-    ThrowMalformedPackage("package flags must be zero.");
-  }
-
-  const std::uint16_t entry_count = ReadU16LE(bytes, 10U);
-  const std::uint16_t manifest_index = ReadU16LE(bytes, 12U);
-  const std::uint16_t reserved_u16 = ReadU16LE(bytes, 14U);
-  const std::uint32_t toc_size_bytes = ReadU32LE(bytes, 16U);
-  const std::uint64_t data_section_size = ReadU64LE(bytes, 20U);
-  const std::uint32_t reserved_u32 = ReadU32LE(bytes, 28U);
-
-  if (entry_count < kRequiredPackagePaths.size() + 1U) {
-    ThrowMalformedPackage(
-        "entry_count must include manifest, converter files, "
-        "and at least one payload text file.");
-  }
-  if (manifest_index != kManifestIndex) {
-    ThrowMalformedPackage("manifest_index must be 0.");
-  }
-  if (reserved_u16 != 0U || reserved_u32 != 0U) {
-    ThrowMalformedPackage("reserved header fields must be zero.");
-  }
-
-  const std::size_t data_section_start =
-      static_cast<std::size_t>(kPackageHeaderSize) +
-      static_cast<std::size_t>(toc_size_bytes);
-  if (data_section_start > bytes.size()) {
-    ThrowMalformedPackage("TOC extends beyond package size.");
-  }
-  if (data_section_start + static_cast<std::size_t>(data_section_size) !=
-      bytes.size()) {
-    ThrowMalformedPackage("data_section_size does not match package size.");
-  }
+}  // namespace
 
-  std::size_t cursor = kPackageHeaderSize;
-  std::vector<TracerExchangePackageEntry> entries;
-  entries.reserve(entry_count);
-  for (std::size_t index = 0; index < entry_count; ++index) {
-    const std::uint16_t path_len = ReadU16LE(bytes, cursor);
-    cursor += 2U;
-    const std::uint16_t entry_flags = ReadU16LE(bytes, cursor);
-    cursor += 2U;
-    const std::uint64_t data_offset = ReadU64LE(bytes, cursor);
-    cursor += 8U;
-    const std::uint64_t data_size = ReadU64LE(bytes, cursor);
-    cursor += 8U;
-
-    if (cursor + 32U + path_len > data_section_start) {
-      ThrowMalformedPackage("TOC entry exceeds declared TOC size.");
-    }
+auto EncodePackageBytes(const std::vector<TracerExchangePackageEntry>& entries)
+    -> std::vector<std::uint8_t> {
+  ValidateEntriesForEncode(entries);
+  return BuildPackageBytesV4(entries);
+}
 
-    std::array<std::uint8_t, 32> sha256{};
-    std::copy(bytes.begin() + static_cast<std::ptrdiff_t>(cursor),
-              bytes.begin() + static_cast<std::ptrdiff_t>(cursor + 32U),
-              sha256.begin());
-    cursor += 32U;
+auto EncodePackageBytesV3(
+    const std::vector<TracerExchangePackageEntry>& entries)
+    -> std::vector<std::uint8_t> {
+  ValidateEntriesForEncode(entries);
+  return BuildPackageBytesV3(entries);
+}
 
-    const char* path_ptr = reinterpret_cast<const char*>(
-        bytes.data() + static_cast<std::ptrdiff_t>(cursor));
-    std::string relative_path(path_ptr, path_ptr + path_len);
-    cursor += path_len;
+auto DecodePackageEntry(std::span<const std::uint8_t> bytes,
+                        const TracerExchangePackageIndexEntry& index_entry)
+    -> TracerExchangePackageEntry {
+  if (index_entry.stored_offset > bytes.size() ||
+      index_entry.stored_size > bytes.size() - index_entry.stored_offset) {
+    ThrowMalformedPackage("entry data exceeds data section bounds.");
+  }
+  const std::span<const std::uint8_t> stored = bytes.subspan(
+      static_cast<std::size_t>(index_entry.stored_offset),
+      static_cast<std::size_t>(index_entry.stored_size));
+
+  TracerExchangePackageEntry entry{};
+  entry.relative_path = index_entry.relative_path;
+  entry.entry_flags = index_entry.entry_flags;
+  entry.sha256 = index_entry.sha256;
+  if (index_entry.codec == kEntryCodecZstd) {
+    entry.data = DecompressEntry(stored, index_entry.raw_size);
+  } else {
+    entry.data.assign(stored.begin(), stored.end());
+  }
+  if (ComputeSha256(entry.data) != index_entry.sha256) {
+    ThrowMalformedPackage("entry SHA-256 mismatch.");
+  }
+  return entry;
+}
 
-    if (entry_flags != kStandardEntryFlags) {
-      ThrowMalformedPackage("entry_flags must be required|text for all files.");
-    }
-    if (data_offset + data_size > data_section_size) {
-      ThrowMalformedPackage("entry data exceeds data section bounds.");
-    }
+auto DecodePackageIndex(std::span<const std::uint8_t> bytes)
+    -> TracerExchangePackageIndex {
+  const PackageHeader kHeader = ParsePackageHeader(bytes);
+
+  TracerExchangePackageIndex index{};
+  index.format_version = kHeader.version;
+  index.entries = kHeader.version == kPackageVersionV3
+                      ? ParseV3Toc(bytes, kHeader)
+                      : ParseV4Index(bytes, kHeader);
+
+  const TracerExchangePackageEntry kManifestEntry =
+      DecodePackageEntry(bytes, index.entries.front());
+  index.manifest = ParseManifestText(std::string_view(
+      reinterpret_cast<const char*>(kManifestEntry.data.data()),
+      kManifestEntry.data.size()));
+  ValidatePackageEntryLayout(index.entries, index.manifest);
+  return index;
+}
 
-    const std::size_t absolute_offset =
-        data_section_start + static_cast<std::size_t>(data_offset);
-    const std::size_t absolute_end =
-        absolute_offset + static_cast<std::size_t>(data_size);
-    const auto computed_sha256 = ComputeSha256(std::span<const std::uint8_t>(
-        bytes.data() + static_cast<std::ptrdiff_t>(absolute_offset),
-        static_cast<std::size_t>(data_size)));
-    if (computed_sha256 != sha256) {
-      ThrowMalformedPackage("entry SHA-256 mismatch.");
+auto DecodePackageBytes(std::span<const std::uint8_t> bytes)
+    -> DecodedTracerExchangePackage {
+  TracerExchangePackageIndex index = DecodePackageIndex(bytes);
+
+  std::vector<TracerExchangePackageEntry> entries(index.entries.size());
+  const auto kDecodeEntry = [&](std::size_t entry_index) -> void {
+    entries[entry_index] =
+        DecodePackageEntry(bytes, index.entries[entry_index]);
+  };
+  std::uint64_t stored_bytes = 0U;
+  for (const auto& entry : index.entries) {
+    stored_bytes += entry.stored_size;
+  }
+  // Entries verify independently; errors are rethrown in entry order, so the
+  // reported failure matches a serial decode.
+  if (stored_bytes < kParallelDecodeMinBytes) {
+    for (std::size_t entry_index = 0; entry_index < entries.size();
+         ++entry_index) {
+      kDecodeEntry(entry_index);
     }
-
-    TracerExchangePackageEntry entry{};
-    entry.relative_path = std::move(relative_path);
-    entry.entry_flags = entry_flags;
-    entry.sha256 = sha256;
-    entry.data.assign(
-        bytes.begin() + static_cast<std::ptrdiff_t>(absolute_offset),
-        bytes.begin() + static_cast<std::ptrdiff_t>(absolute_end));
-    entries.push_back(std::move(entry));
-  }
-
-  if (cursor != data_section_start) {
-    ThrowMalformedPackage("TOC size does not match parsed entry metadata.");
+  } else {
+    namespace concurrency = tracer::core::shared::concurrency;
+    concurrency::WorkStealingExecutor executor(
+        std::min(concurrency::ResolveWorkerCount(0), entries.size()));
+    executor.ParallelFor(entries.size(), kDecodeEntry);
   }
 
   DecodedTracerExchangePackage package{};
-  package.manifest = ParseManifestText(std::string_view(
-      reinterpret_cast<const char*>(entries.front().data.data()),
-      entries.front().data.size()));
-  ValidatePackageEntryLayout(entries, package.manifest);
+  package.manifest = std::move(index.manifest);
   package.entries = std::move(entries);
   return package;
 }
@@ -0,0 +1,26 @@
+module;
+
+#include "infra/persistence/sqlite/project_dictionary.hpp"
+
+export module tracer.core.infrastructure.persistence.runtime
+    .project_dictionary;
+
+export namespace tracer::core::infrastructure::persistence {
+
+using ::tracer::core::infrastructure::persistence::AcquireProjectDictionary;
+using ::tracer::core::infrastructure::persistence::ActiveProjectClassRules;
+using ::tracer::core::infrastructure::persistence::
+    BumpProjectDictionaryGeneration;
+using ::tracer::core::infrastructure::persistence::ClassifyProjectPath;
+using ::tracer::core::infrastructure::persistence::DatabaseSnapshotKey;
+using ::tracer::core::infrastructure::persistence::DayFlagRollupMatchesRules;
+using ::tracer::core::infrastructure::persistence::DefaultProjectClassRules;
+using ::tracer::core::infrastructure::persistence::InstallProjectClassRules;
+using ::tracer::core::infrastructure::persistence::ProjectClass;
+using ::tracer::core::infrastructure::persistence::ProjectClassPathSql;
+using ::tracer::core::infrastructure::persistence::ProjectClassRule;
+using ::tracer::core::infrastructure::persistence::ProjectClassRulesFingerprint;
+using ::tracer::core::infrastructure::persistence::ProjectDictionary;
+using ::tracer::core::infrastructure::persistence::ReleaseSnapshotConnection;
+
+}  // namespace tracer::core::infrastructure::persistence
@@ -0,0 +1,13 @@
+module;
+
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
+
+export module tracer.core.infrastructure.persistence.runtime
+    .sqlite_read_connection_pool;
+
+export namespace tracer::core::infrastructure::persistence {
+
+using ::tracer::core::infrastructure::persistence::SqliteReadConnectionOptions;
+using ::tracer::core::infrastructure::persistence::SqliteReadConnectionPool;
+
+}  // namespace tracer::core::infrastructure::persistence
@@ -0,0 +1,13 @@
+module;
+
+#include "infra/persistence/sqlite/record_column_snapshot.hpp"
+
+export module tracer.core.infrastructure.persistence.runtime
+    .record_column_snapshot;
+
+export namespace tracer::core::infrastructure::persistence {
+
+using ::tracer::core::infrastructure::persistence::AcquireRecordColumnSnapshot;
+using ::tracer::core::infrastructure::persistence::RecordColumnSnapshot;
+
+}  // namespace tracer::core::infrastructure::persistence
@@ -4,3 +4,9 @@ export import tracer.core.infrastructure.persistence.runtime
     .sqlite_project_repository;
 export import tracer.core.infrastructure.persistence.runtime
     .sqlite_database_health_checker;
+export import tracer.core.infrastructure.persistence.runtime
+    .sqlite_read_connection_pool;
+export import tracer.core.infrastructure.persistence.runtime
+    .project_dictionary;
+export import tracer.core.infrastructure.persistence.runtime
+    .record_column_snapshot;
@@ -8,3 +8,9 @@ export import tracer.core.infrastructure.persistence.write.importer.sqlite
     .writer;
 export import tracer.core.infrastructure.persistence.write.importer.sqlite
     .project_resolver;
+export import tracer.core.infrastructure.persistence.write.importer.sqlite
+    .rollup;
+export import tracer.core.infrastructure.persistence.write.importer.sqlite
+    .search_index;
+export import tracer.core.infrastructure.persistence.write.importer.sqlite
+    .report_generation;
@@ -7,7 +7,14 @@ export module tracer.core.infrastructure.persistence.write.importer.sqlite
 
 export namespace tracer::core::infrastructure::persistence::importer::sqlite {
 
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    BulkLoadScope;
 using ::tracer::core::infrastructure::persistence::importer::sqlite::Connection;
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    CreateSecondaryIndexes;
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    DropSecondaryIndexes;
 using ::tracer::core::infrastructure::persistence::importer::sqlite::ExecuteSql;
+using ::tracer::core::infrastructure::persistence::importer::sqlite::TableExists;
 
 }  // namespace tracer::core::infrastructure::persistence::importer::sqlite
@@ -0,0 +1,15 @@
+module;
+
+#include "infra/persistence/importer/sqlite/report_generation.hpp"
+
+export module tracer.core.infrastructure.persistence.write.importer.sqlite
+    .report_generation;
+
+export namespace tracer::core::infrastructure::persistence::importer::sqlite {
+
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    BumpReportGenerations;
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    EnsureReportGenerations;
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
@@ -0,0 +1,19 @@
+module;
+
+#include "infra/persistence/importer/sqlite/rollup.hpp"
+
+export module tracer.core.infrastructure.persistence.write.importer.sqlite
+    .rollup;
+
+export namespace tracer::core::infrastructure::persistence::importer::sqlite {
+
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    EnsureRollupTables;
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    ExecuteDateRangeSql;
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    RebuildRollups;
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    RollupDateRange;
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
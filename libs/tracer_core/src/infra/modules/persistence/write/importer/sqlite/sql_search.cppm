@@ -0,0 +1,15 @@
+module;
+
+#include "infra/persistence/importer/sqlite/search_index.hpp"
+
+export module tracer.core.infrastructure.persistence.write.importer.sqlite
+    .search_index;
+
+export namespace tracer::core::infrastructure::persistence::importer::sqlite {
+
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    EnsureSearchIndex;
+using ::tracer::core::infrastructure::persistence::importer::sqlite::
+    RebuildSearchIndex;
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
@@ -2,6 +2,7 @@ module;
 
 #include "infra/sqlite_fwd.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -23,6 +24,11 @@ class Writer {
 
   ~Writer();
 
+  // 设置多行 INSERT 语句；未设置时退回逐行插入。
+  auto SetBatchStatements(sqlite3_stmt* stmt_day_batch,
+                          sqlite3_stmt* stmt_record_batch,
+                          std::size_t batch_rows) -> void;
+
   auto InsertDays(const std::vector<DayData>& days) -> void;
   auto InsertRecords(const std::vector<TimeRecordInternal>& records) -> void;
 
@@ -31,6 +37,9 @@ class Writer {
   sqlite3_stmt* stmt_insert_day_;
   sqlite3_stmt* stmt_insert_record_;
   sqlite3_stmt* stmt_insert_project_;
+  sqlite3_stmt* stmt_insert_day_batch_ = nullptr;
+  sqlite3_stmt* stmt_insert_record_batch_ = nullptr;
+  std::size_t batch_rows_ = 0;
 
   std::unique_ptr<ProjectResolver> project_resolver_;
 };
@@ -7,8 +7,6 @@ export module tracer.core.infrastructure.query.data.internal.request;
 export namespace tracer::core::infrastructure::query::data::internal {
 
 using ::tracer::core::infrastructure::query::data::internal::BuildCliFilters;
-using ::tracer::core::infrastructure::query::data::internal::
-    EnsureDbConnectionOrThrow;
 using ::tracer::core::infrastructure::query::data::internal::FormatIsoDate;
 using ::tracer::core::infrastructure::query::data::internal::
     NormalizeBoundaryDate;
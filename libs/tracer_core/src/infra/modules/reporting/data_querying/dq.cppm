@@ -4,3 +4,5 @@ export import tracer.core.infrastructure.reporting.data_querying
     .lazy_sqlite_report_data_query_service;
 export import tracer.core.infrastructure.reporting.data_querying
     .sqlite_report_data_query_service;
+export import tracer.core.infrastructure.reporting.data_querying
+    .rendered_report_cache;
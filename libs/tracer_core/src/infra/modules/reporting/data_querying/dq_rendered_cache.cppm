@@ -0,0 +1,13 @@
+module;
+
+#include "infra/reporting/rendered_report_cache.hpp"
+
+export module tracer.core.infrastructure.reporting.data_querying
+    .rendered_report_cache;
+
+export namespace tracer::core::infrastructure::reports {
+
+using ::tracer::core::infrastructure::reports::FingerprintReportConfigFiles;
+using ::tracer::core::infrastructure::reports::RenderedReportCache;
+
+}  // namespace tracer::core::infrastructure::reports
@@ -38,6 +38,13 @@ class Repository {
                       const std::vector<TimeRecordInternal>& records) -> void;
   auto ReplaceMonthData(int year, int month, const std::vector<DayData>& days,
                         const std::vector<TimeRecordInternal>& records) -> void;
+  // 单事务替换多个月份并同步写入对应的摄入同步行。
+  auto ReplaceMonthsData(
+      const std::vector<ReplaceMonthTarget>& months,
+      const std::vector<DayData>& days,
+      const std::vector<TimeRecordInternal>& records,
+      const std::vector<tracer_core::core::dto::IngestSyncStatusEntry>&
+          sync_entries) -> void;
   auto UpsertIngestSyncStatus(
       const tracer_core::core::dto::IngestSyncStatusEntry& entry) -> void;
   auto ReplaceIngestSyncStatuses(
@@ -1,12 +1,17 @@
 #include <sqlite3.h>
 
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <format>
-#include <cstdint>
 #include <optional>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -14,6 +19,7 @@
 #include "infra/persistence/importer/repository_ingest_sync_sql.hpp"
 #include "application/pipeline/importer/model/import_models.hpp"
 #include "infra/persistence/sqlite/db_manager.hpp"
+#include "infra/persistence/sqlite/project_dictionary.hpp"
 #include "infra/schema/day_schema.hpp"
 #include "infra/schema/sqlite_schema.hpp"
 
@@ -27,6 +33,120 @@ using tracer_core::core::dto::IngestSyncStatusRequest;
 
 namespace {
 
+constexpr std::size_t kYearMonthLength = 7;
+constexpr std::string_view kMonthLastDaySuffix = "-31";
+
+// 本次导入覆盖的日期范围，用于限定汇总表的重算区间。
+auto CollectImportDateRange(const std::vector<DayData>& days,
+                            const std::vector<TimeRecordInternal>& records)
+    -> std::optional<sqlite::RollupDateRange> {
+  std::optional<sqlite::RollupDateRange> range;
+  const auto kExtend = [&range](const std::string& date) -> void {
+    if (date.empty()) {
+      return;
+    }
+    if (!range.has_value()) {
+      range = sqlite::RollupDateRange{.first_date = date, .last_date = date};
+      return;
+    }
+    range->first_date = std::min(range->first_date, date);
+    range->last_date = std::max(range->last_date, date);
+  };
+  for (const auto& day : days) {
+    kExtend(day.date);
+  }
+  for (const auto& record : records) {
+    kExtend(record.date);
+  }
+  return range;
+}
+
+// 连续月份合并后的日期区间：[first_date, next_month_start_date)。
+struct MonthSpan {
+  std::string first_date;
+  std::string next_month_start_date;
+  std::string last_date;
+};
+
+using YearMonth = std::pair<int, int>;
+
+auto TryParseYearMonth(std::string_view date) -> std::optional<YearMonth> {
+  constexpr std::size_t kYearLength = 4;
+  if (date.size() < kYearMonthLength || date[kYearLength] != '-') {
+    return std::nullopt;
+  }
+  int year = 0;
+  int month = 0;
+  const char* year_begin = date.data();
+  const char* month_begin = date.data() + kYearLength + 1;
+  if (std::from_chars(year_begin, year_begin + kYearLength, year).ec !=
+          std::errc{} ||
+      std::from_chars(month_begin, date.data() + kYearMonthLength, month)
+              .ec != std::errc{}) {
+    return std::nullopt;
+  }
+  return YearMonth{year, month};
+}
+
+// 相邻月份合并成一个区间，删除与汇总重算按区间各执行一次。
+auto BuildMonthSpans(const std::set<YearMonth>& months)
+    -> std::vector<MonthSpan> {
+  std::vector<MonthSpan> spans;
+  for (const auto& [year, month] : months) {
+    const auto kBoundary = detail::BuildMonthBoundary(year, month);
+    if (!kBoundary.has_value()) {
+      throw std::runtime_error("Invalid replace-month target.");
+    }
+    std::string last_date = kBoundary->start_date.substr(0, kYearMonthLength) +
+                            std::string(kMonthLastDaySuffix);
+    if (!spans.empty() &&
+        spans.back().next_month_start_date == kBoundary->start_date) {
+      spans.back().next_month_start_date = kBoundary->next_month_start_date;
+      spans.back().last_date = std::move(last_date);
+      continue;
+    }
+    spans.push_back({.first_date = kBoundary->start_date,
+                     .next_month_start_date = kBoundary->next_month_start_date,
+                     .last_date = std::move(last_date)});
+  }
+  return spans;
+}
+
+auto DeleteDateRangeRows(sqlite3* sqlite_db, const MonthSpan& span) -> void {
+  const std::string kDeleteRecordsSql = std::format(
+      "DELETE FROM {0} WHERE {1} >= '{2}' AND {1} < '{3}';",
+      schema::time_records::db::kTable, schema::time_records::db::kDate,
+      span.first_date, span.next_month_start_date);
+  if (!sqlite::ExecuteSql(sqlite_db, kDeleteRecordsSql,
+                          "Delete month rows from time_records")) {
+    throw std::runtime_error("Failed to delete month data from time_records.");
+  }
+
+  const std::string kDeleteDaysSql =
+      std::format("DELETE FROM {0} WHERE {1} >= '{2}' AND {1} < '{3}';",
+                  schema::day::db::kTable, schema::day::db::kDate,
+                  span.first_date, span.next_month_start_date);
+  if (!sqlite::ExecuteSql(sqlite_db, kDeleteDaysSql,
+                          "Delete month rows from days")) {
+    throw std::runtime_error("Failed to delete month data from days.");
+  }
+}
+
+// range 为空表示整库重建（全量替换）。
+auto RefreshDerivedTables(sqlite3* sqlite_db,
+                          const std::optional<sqlite::RollupDateRange>& range)
+    -> void {
+  if (!sqlite::RebuildRollups(sqlite_db, range)) {
+    throw std::runtime_error("Failed to update rollup tables.");
+  }
+  if (!sqlite::RebuildSearchIndex(sqlite_db, range)) {
+    throw std::runtime_error("Failed to update text search index.");
+  }
+  if (!sqlite::BumpReportGenerations(sqlite_db, range)) {
+    throw std::runtime_error("Failed to bump report generations.");
+  }
+}
+
 }  // namespace
 
 Repository::Repository(std::string db_path) : db_path_(std::move(db_path)) {}
@@ -58,13 +178,18 @@ auto Repository::EnsureWriteRepositoryReady() -> void {
       connection_manager_->GetDb(), statement_manager_->GetInsertDayStmt(),
       statement_manager_->GetInsertRecordStmt(),
       statement_manager_->GetInsertProjectStmt());
+  data_inserter_->SetBatchStatements(
+      statement_manager_->GetInsertDayBatchStmt(),
+      statement_manager_->GetInsertRecordBatchStmt(),
+      sqlite::Statement::kInsertBatchRows);
 }
 
 auto Repository::ImportData(const std::vector<DayData>& days,
                             const std::vector<TimeRecordInternal>& records)
     -> void {
   EnsureWriteRepositoryReady();
-
+  // 追加导入只写入部分日期：保持逐行外键检查，不为此切换日志模式，
+  // 也避免提交前对整库做一次 foreign_key_check。
   if (!connection_manager_->BeginTransaction()) {
     throw std::runtime_error("Failed to begin transaction.");
   }
@@ -72,10 +197,15 @@ auto Repository::ImportData(const std::vector<DayData>& days,
   try {
     data_inserter_->InsertDays(days);
     data_inserter_->InsertRecords(records);
+    if (const auto kRange = CollectImportDateRange(days, records);
+        kRange.has_value()) {
+      RefreshDerivedTables(connection_manager_->GetDb(), kRange);
+    }
 
     if (!connection_manager_->CommitTransaction()) {
       throw std::runtime_error("Failed to commit transaction.");
     }
+    BumpProjectDictionaryGeneration();
   } catch (const std::exception&) {
     connection_manager_->RollbackTransaction();
     throw;
@@ -86,12 +216,18 @@ auto Repository::ReplaceAllData(const std::vector<DayData>& days,
                                 const std::vector<TimeRecordInternal>& records)
     -> void {
   EnsureWriteRepositoryReady();
+  const sqlite::BulkLoadScope kBulkLoad(connection_manager_->GetDb());
 
   if (!connection_manager_->BeginTransaction()) {
     throw std::runtime_error("Failed to begin transaction.");
   }
 
   try {
+    // 全量替换时逐行维护二级索引代价最高：先删除，导入后在同一事务内重建。
+    if (!sqlite::DropSecondaryIndexes(connection_manager_->GetDb())) {
+      throw std::runtime_error("Failed to drop secondary indexes.");
+    }
+
     const std::string delete_records_sql =
         std::format("DELETE FROM {0};", schema::time_records::db::kTable);
     if (!sqlite::ExecuteSql(connection_manager_->GetDb(), delete_records_sql,
@@ -116,9 +252,16 @@ auto Repository::ReplaceAllData(const std::vector<DayData>& days,
     data_inserter_->InsertDays(days);
     data_inserter_->InsertRecords(records);
 
+    if (!sqlite::CreateSecondaryIndexes(connection_manager_->GetDb())) {
+      throw std::runtime_error("Failed to rebuild secondary indexes.");
+    }
+    RefreshDerivedTables(connection_manager_->GetDb(), std::nullopt);
+    kBulkLoad.VerifyForeignKeys();
+
     if (!connection_manager_->CommitTransaction()) {
       throw std::runtime_error("Failed to commit transaction.");
     }
+    BumpProjectDictionaryGeneration();
   } catch (const std::exception&) {
     connection_manager_->RollbackTransaction();
     throw;
@@ -140,31 +283,91 @@ auto Repository::ReplaceMonthData(
   }
 
   try {
-    const std::string kDeleteRecordsSql = std::format(
-        "DELETE FROM {0} WHERE {1} >= '{2}' AND {1} < '{3}';",
-        schema::time_records::db::kTable, schema::time_records::db::kDate,
-        kBoundary->start_date, kBoundary->next_month_start_date);
-    if (!sqlite::ExecuteSql(connection_manager_->GetDb(), kDeleteRecordsSql,
-                            "Delete month rows from time_records")) {
-      throw std::runtime_error(
-          "Failed to delete month data from time_records.");
+    DeleteDateRangeRows(connection_manager_->GetDb(),
+                        MonthSpan{.first_date = kBoundary->start_date,
+                                  .next_month_start_date =
+                                      kBoundary->next_month_start_date,
+                                  .last_date = {}});
+
+    data_inserter_->InsertDays(days);
+    data_inserter_->InsertRecords(records);
+
+    // 导入数据按月归属，但仍以实际日期范围兜底，避免越界行漏算。
+    sqlite::RollupDateRange rollup_range{
+        .first_date = kBoundary->start_date,
+        .last_date = kBoundary->start_date.substr(0, kYearMonthLength) +
+                     std::string(kMonthLastDaySuffix)};
+    if (const auto kImported = CollectImportDateRange(days, records);
+        kImported.has_value()) {
+      rollup_range.first_date =
+          std::min(rollup_range.first_date, kImported->first_date);
+      rollup_range.last_date =
+          std::max(rollup_range.last_date, kImported->last_date);
     }
+    RefreshDerivedTables(connection_manager_->GetDb(), rollup_range);
 
-    const std::string kDeleteDaysSql =
-        std::format("DELETE FROM {0} WHERE {1} >= '{2}' AND {1} < '{3}';",
-                    schema::day::db::kTable, schema::day::db::kDate,
-                    kBoundary->start_date, kBoundary->next_month_start_date);
-    if (!sqlite::ExecuteSql(connection_manager_->GetDb(), kDeleteDaysSql,
-                            "Delete month rows from days")) {
-      throw std::runtime_error("Failed to delete month data from days.");
+    if (!connection_manager_->CommitTransaction()) {
+      throw std::runtime_error("Failed to commit transaction.");
+    }
+    BumpProjectDictionaryGeneration();
+  } catch (const std::exception&) {
+    connection_manager_->RollbackTransaction();
+    throw;
+  }
+}
+
+auto Repository::ReplaceMonthsData(
+    const std::vector<ReplaceMonthTarget>& months,
+    const std::vector<DayData>& days,
+    const std::vector<TimeRecordInternal>& records,
+    const std::vector<IngestSyncStatusEntry>& sync_entries) -> void {
+  EnsureWriteRepositoryReady();
+
+  std::set<YearMonth> target_months;
+  for (const auto& target : months) {
+    target_months.emplace(target.kYear, target.kMonth);
+  }
+  const std::vector<MonthSpan> kDeleteSpans = BuildMonthSpans(target_months);
+
+  // 汇总重算覆盖目标月份以及导入行实际落入的月份，按区间而非全表重算。
+  std::set<YearMonth> rollup_months = target_months;
+  for (const auto& day : days) {
+    rollup_months.emplace(day.year, day.month);
+  }
+  for (const auto& record : records) {
+    if (const auto kMonth = TryParseYearMonth(record.date);
+        kMonth.has_value()) {
+      rollup_months.insert(*kMonth);
+    }
+  }
+  const std::vector<MonthSpan> kRollupSpans = BuildMonthSpans(rollup_months);
+
+  if (!connection_manager_->BeginTransaction()) {
+    throw std::runtime_error("Failed to begin transaction.");
+  }
+
+  try {
+    for (const auto& span : kDeleteSpans) {
+      DeleteDateRangeRows(connection_manager_->GetDb(), span);
     }
 
     data_inserter_->InsertDays(days);
     data_inserter_->InsertRecords(records);
 
+    for (const auto& span : kRollupSpans) {
+      RefreshDerivedTables(
+          connection_manager_->GetDb(),
+          sqlite::RollupDateRange{.first_date = span.first_date,
+                                  .last_date = span.last_date});
+    }
+    for (const auto& entry : sync_entries) {
+      detail::UpsertIngestSyncStatusRow(connection_manager_->GetDb(), entry);
+    }
+
     if (!connection_manager_->CommitTransaction()) {
       throw std::runtime_error("Failed to commit transaction.");
     }
+    BumpProjectDictionaryGeneration();
   } catch (const std::exception&) {
     connection_manager_->RollbackTransaction();
     throw;
@@ -79,16 +79,19 @@ auto UpsertIngestSyncStatusRow(sqlite3* sqlite_db,
                                const IngestSyncStatusEntry& entry) -> void {
   sqlite3_stmt* statement = nullptr;
   const std::string sql = std::format(
-      "INSERT INTO {0} ({1}, {2}, {3}, {4}) VALUES (?1, ?2, ?3, ?4) "
+      "INSERT INTO {0} ({1}, {2}, {3}, {4}, {5}) "
+      "VALUES (?1, ?2, ?3, ?4, ?5) "
       "ON CONFLICT({1}) DO UPDATE SET "
       "{2}=excluded.{2}, "
       "{3}=excluded.{3}, "
-      "{4}=excluded.{4};",
+      "{4}=excluded.{4}, "
+      "{5}=excluded.{5};",
       schema::ingest_month_sync::db::kTable,
       schema::ingest_month_sync::db::kMonthKey,
       schema::ingest_month_sync::db::kTxtRelativePath,
       schema::ingest_month_sync::db::kTxtContentHashSha256,
-      schema::ingest_month_sync::db::kIngestedAtUnixMs);
+      schema::ingest_month_sync::db::kIngestedAtUnixMs,
+      schema::ingest_month_sync::db::kConverterConfigFingerprint);
   ThrowIfPrepareFailed(sqlite_db, &statement, sql,
                        "Prepare ingest sync upsert statement failed");
 
@@ -100,6 +103,8 @@ auto UpsertIngestSyncStatusRow(sqlite3* sqlite_db,
              "Bind txt_content_hash_sha256 failed");
     BindInt64(statement, 4, entry.ingested_at_unix_ms,
               "Bind ingested_at_unix_ms failed");
+    BindText(statement, 5, entry.converter_config_fingerprint,
+             "Bind converter_config_fingerprint failed");
     ExecuteStatement(sqlite_db, statement, "Execute ingest sync upsert failed");
   } catch (...) {
     sqlite3_finalize(statement);
@@ -112,12 +117,13 @@ auto ListIngestSyncStatusRows(sqlite3* sqlite_db,
                               const IngestSyncStatusRequest& request)
     -> IngestSyncStatusOutput {
   std::string sql = std::format(
-      "SELECT {1}, {2}, {3}, {4} FROM {0}",
+      "SELECT {1}, {2}, {3}, {4}, {5} FROM {0}",
       schema::ingest_month_sync::db::kTable,
       schema::ingest_month_sync::db::kMonthKey,
       schema::ingest_month_sync::db::kTxtRelativePath,
       schema::ingest_month_sync::db::kTxtContentHashSha256,
-      schema::ingest_month_sync::db::kIngestedAtUnixMs);
+      schema::ingest_month_sync::db::kIngestedAtUnixMs,
+      schema::ingest_month_sync::db::kConverterConfigFingerprint);
 
   if (!request.months.empty()) {
     sql += " WHERE ";
@@ -156,6 +162,8 @@ auto ListIngestSyncStatusRows(sqlite3* sqlite_db,
       const auto* month_key = sqlite3_column_text(statement, 0);
       const auto* txt_relative_path = sqlite3_column_text(statement, 1);
       const auto* txt_content_hash_sha256 = sqlite3_column_text(statement, 2);
+      const auto* converter_config_fingerprint =
+          sqlite3_column_text(statement, 4);
       output.items.push_back(IngestSyncStatusEntry{
           .month_key = month_key == nullptr
                            ? std::string{}
@@ -170,6 +178,11 @@ auto ListIngestSyncStatusRows(sqlite3* sqlite_db,
                   : reinterpret_cast<const char*>(txt_content_hash_sha256),
           .ingested_at_unix_ms = static_cast<std::int64_t>(
               sqlite3_column_int64(statement, 3)),
+          .converter_config_fingerprint =
+              converter_config_fingerprint == nullptr
+                  ? std::string{}
+                  : reinterpret_cast<const char*>(
+                        converter_config_fingerprint),
       });
     }
 
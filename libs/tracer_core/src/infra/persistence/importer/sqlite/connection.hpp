@@ -2,9 +2,12 @@
 #ifndef INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_CONNECTION_H_
 #define INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_CONNECTION_H_
 
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 #include "infra/sqlite_fwd.hpp"
 
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace tracer::core::infrastructure::persistence::importer::sqlite {
 class Connection {
@@ -21,6 +24,37 @@ class Connection {
   sqlite3* db_{nullptr};
 };
 
+// 全量替换期间临时调优连接：WAL、synchronous=NORMAL、大页缓存、内存临时表，
+// 并关闭逐行外键检查（改为提交前一次性 VerifyForeignKeys）。整库校验只在
+// 全量重写时划算，追加或按月导入不要使用。
+// 必须在事务外构造/析构；析构时恢复原有设置。
+class BulkLoadScope {
+ public:
+  explicit BulkLoadScope(sqlite3* sqlite_db);
+  ~BulkLoadScope();
+
+  BulkLoadScope(const BulkLoadScope&) = delete;
+  auto operator=(const BulkLoadScope&) -> BulkLoadScope& = delete;
+
+  // 在事务内提交前调用；存在外键违例时抛出 std::runtime_error。
+  auto VerifyForeignKeys() const -> void;
+
+ private:
+  sqlite3* db_;
+  std::optional<std::string> previous_journal_mode_;
+  std::optional<int> previous_synchronous_;
+  std::optional<int> previous_cache_size_;
+  std::optional<int> previous_temp_store_;
+};
+
+// 非唯一二级索引（days(year, month)、time_records 的两个查询索引）。
+// 全量替换时先删除、导入后重建，避免逐行维护索引。
+auto CreateSecondaryIndexes(sqlite3* sqlite_db) -> bool;
+auto DropSecondaryIndexes(sqlite3* sqlite_db) -> bool;
+
+// 只读连接池一侧也要探测表，实现放在运行时库。
+using tracer::core::infrastructure::persistence::TableExists;
+
 // NOLINTBEGIN(bugprone-easily-swappable-parameters)
 auto ExecuteSql(sqlite3* sqlite_db, const std::string& sql_query,
                 const std::string& error_context = "") -> bool;
@@ -30,8 +64,15 @@ auto ExecuteSql(sqlite3* sqlite_db, const std::string& sql_query,
 
 namespace infrastructure::persistence::importer::sqlite {
 
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    BulkLoadScope;
 using tracer::core::infrastructure::persistence::importer::sqlite::Connection;
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    CreateSecondaryIndexes;
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    DropSecondaryIndexes;
 using tracer::core::infrastructure::persistence::importer::sqlite::ExecuteSql;
+using tracer::core::infrastructure::persistence::importer::sqlite::TableExists;
 
 }  // namespace infrastructure::persistence::importer::sqlite
 
@@ -2,10 +2,15 @@
 
 #include <format>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 
 #include "infra/persistence/importer/sqlite/connection.hpp"
+#include "infra/persistence/importer/sqlite/report_generation.hpp"
+#include "infra/persistence/importer/sqlite/rollup.hpp"
+#include "infra/persistence/importer/sqlite/search_index.hpp"
+#include "infra/persistence/sqlite/project_dictionary.hpp"
 #include "infra/schema/day_schema.hpp"
 #include "infra/schema/sqlite_schema.hpp"
 
@@ -14,6 +19,12 @@ import tracer.core.domain.ports.diagnostics;
 namespace tracer::core::infrastructure::persistence::importer::sqlite {
 namespace {
 
+constexpr int kBulkLoadCacheKiB = 64 * 1024;
+constexpr std::string_view kRecordsDateProjectIndex =
+    "idx_time_records_date_project";
+constexpr std::string_view kRecordsDatePathSnapshotIndex =
+    "idx_time_records_date_path_snapshot";
+
 auto QueryPragmaInt(sqlite3* sqlite_db, std::string_view sql)
     -> std::optional<int> {
   sqlite3_stmt* stmt = nullptr;
@@ -31,6 +42,49 @@ auto QueryPragmaInt(sqlite3* sqlite_db, std::string_view sql)
   return result;
 }
 
+auto QueryPragmaText(sqlite3* sqlite_db, std::string_view sql)
+    -> std::optional<std::string> {
+  sqlite3_stmt* stmt = nullptr;
+  const std::string kSql(sql);
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    return std::nullopt;
+  }
+
+  std::optional<std::string> result;
+  if (sqlite3_step(stmt) == SQLITE_ROW) {
+    const unsigned char* text = sqlite3_column_text(stmt, 0);
+    if (text != nullptr) {
+      result = reinterpret_cast<const char*>(text);
+    }
+  }
+  sqlite3_finalize(stmt);
+  return result;
+}
+
+// 旧库的同步表缺少指纹列；补上的列为空串，与任何配置都不匹配，
+// 下次增量摄入会先整体重建一次。
+auto EnsureIngestSyncFingerprintColumn(sqlite3* sqlite_db) -> bool {
+  const auto kColumnCount = QueryPragmaInt(
+      sqlite_db,
+      std::format("SELECT COUNT(*) FROM pragma_table_info('{}') "
+                  "WHERE name = '{}';",
+                  schema::ingest_month_sync::db::kTable,
+                  schema::ingest_month_sync::db::kConverterConfigFingerprint));
+  if (!kColumnCount.has_value()) {
+    return false;
+  }
+  if (*kColumnCount > 0) {
+    return true;
+  }
+  return ExecuteSql(
+      sqlite_db,
+      std::format("ALTER TABLE {} ADD COLUMN {} TEXT NOT NULL DEFAULT '';",
+                  schema::ingest_month_sync::db::kTable,
+                  schema::ingest_month_sync::db::kConverterConfigFingerprint),
+      "Add ingest_month_sync fingerprint column");
+}
+
 void LogForeignKeyStatus(sqlite3* sqlite_db) {
   const auto kStatus = QueryPragmaInt(sqlite_db, "PRAGMA foreign_keys;");
   if (!kStatus.has_value()) {
@@ -66,12 +120,6 @@ Connection::Connection(const std::string& db_path) {
         schema::day::db::kRemark, schema::day::db::kGetupTime);
     ExecuteSql(db_, kCreateDaysSql, "Create days table");
 
-    const std::string kCreateIndexSql =
-        std::format("CREATE INDEX IF NOT EXISTS {0} ON {1} ({2}, {3});",
-                    schema::day::db::kIndexYearMonth, schema::day::db::kTable,
-                    schema::day::db::kYear, schema::day::db::kMonth);
-    ExecuteSql(db_, kCreateIndexSql, "Create index on days(year, month)");
-
     const std::string kCreateProjectsSql = std::format(
         "CREATE TABLE IF NOT EXISTS {0} ("
         "{1} INTEGER PRIMARY KEY AUTOINCREMENT, "
@@ -126,43 +174,138 @@ Connection::Connection(const std::string& db_path) {
         schema::projects::db::kId);
     ExecuteSql(db_, kCreateRecordsSql, "Create time_records table");
 
-    const std::string kCreateRecordsDateProjectIndexSql = std::format(
-        "CREATE INDEX IF NOT EXISTS idx_time_records_date_project ON {0} "
-        "({1}, {2});",
-        schema::time_records::db::kTable, schema::time_records::db::kDate,
-        schema::time_records::db::kProjectId);
-    ExecuteSql(db_, kCreateRecordsDateProjectIndexSql,
-               "Create index on time_records(date, project_id)");
-
-    const std::string kCreateRecordsDatePathSnapshotIndexSql = std::format(
-        "CREATE INDEX IF NOT EXISTS idx_time_records_date_path_snapshot ON "
-        "{0} ({1}, {2});",
-        schema::time_records::db::kTable, schema::time_records::db::kDate,
-        schema::time_records::db::kProjectPathSnapshot);
-    ExecuteSql(db_, kCreateRecordsDatePathSnapshotIndexSql,
-               "Create index on time_records(date, project_path_snapshot)");
+    CreateSecondaryIndexes(db_);
 
     const std::string kCreateIngestMonthSyncSql = std::format(
         "CREATE TABLE IF NOT EXISTS {0} ("
         "{1} TEXT PRIMARY KEY, "
         "{2} TEXT NOT NULL, "
         "{3} TEXT NOT NULL, "
-        "{4} INTEGER NOT NULL);",
+        "{4} INTEGER NOT NULL, "
+        "{5} TEXT NOT NULL DEFAULT '');",
         schema::ingest_month_sync::db::kTable,
         schema::ingest_month_sync::db::kMonthKey,
         schema::ingest_month_sync::db::kTxtRelativePath,
         schema::ingest_month_sync::db::kTxtContentHashSha256,
-        schema::ingest_month_sync::db::kIngestedAtUnixMs);
+        schema::ingest_month_sync::db::kIngestedAtUnixMs,
+        schema::ingest_month_sync::db::kConverterConfigFingerprint);
     ExecuteSql(db_, kCreateIngestMonthSyncSql, "Create ingest_month_sync table");
+    if (!EnsureIngestSyncFingerprintColumn(db_)) {
+      tracer::core::domain::ports::EmitWarn(
+          "[sqlite importer] failed to add ingest_month_sync fingerprint "
+          "column.");
+    }
+
+    if (!EnsureRollupTables(db_)) {
+      tracer::core::domain::ports::EmitWarn(
+          "[sqlite importer] failed to prepare rollup tables.");
+    }
+    // 全文索引可选：不可用时查询回退到 LIKE，这里不报警告。
+    (void)EnsureSearchIndex(db_);
+    if (!EnsureReportGenerations(db_)) {
+      tracer::core::domain::ports::EmitWarn(
+          "[sqlite importer] failed to prepare report generations.");
+    }
   }
 }
 
 Connection::~Connection() {
   if (db_ != nullptr) {
+    ReleaseSnapshotConnection(db_);
     sqlite3_close(db_);
   }
 }
 
+BulkLoadScope::BulkLoadScope(sqlite3* sqlite_db)
+    : db_(sqlite_db),
+      previous_journal_mode_(QueryPragmaText(db_, "PRAGMA journal_mode;")),
+      previous_synchronous_(QueryPragmaInt(db_, "PRAGMA synchronous;")),
+      previous_cache_size_(QueryPragmaInt(db_, "PRAGMA cache_size;")),
+      previous_temp_store_(QueryPragmaInt(db_, "PRAGMA temp_store;")) {
+  ExecuteSql(db_, "PRAGMA journal_mode = WAL;", "Bulk load journal_mode");
+  ExecuteSql(db_, "PRAGMA synchronous = NORMAL;", "Bulk load synchronous");
+  ExecuteSql(db_, std::format("PRAGMA cache_size = -{};", kBulkLoadCacheKiB),
+             "Bulk load cache_size");
+  ExecuteSql(db_, "PRAGMA temp_store = MEMORY;", "Bulk load temp_store");
+  ExecuteSql(db_, "PRAGMA foreign_keys = OFF;", "Bulk load foreign_keys");
+}
+
+BulkLoadScope::~BulkLoadScope() {
+  ExecuteSql(db_, "PRAGMA foreign_keys = ON;", "Restore foreign_keys");
+  if (previous_temp_store_.has_value()) {
+    ExecuteSql(db_,
+               std::format("PRAGMA temp_store = {};", *previous_temp_store_),
+               "Restore temp_store");
+  }
+  if (previous_cache_size_.has_value()) {
+    ExecuteSql(db_,
+               std::format("PRAGMA cache_size = {};", *previous_cache_size_),
+               "Restore cache_size");
+  }
+  if (previous_synchronous_.has_value()) {
+    ExecuteSql(db_,
+               std::format("PRAGMA synchronous = {};", *previous_synchronous_),
+               "Restore synchronous");
+  }
+  // 切回原日志模式会把 WAL 内容写回主库；若有其他连接占用导致失败，
+  // 至少截断 WAL，保证单独拷贝 .db 文件时数据完整。
+  if (previous_journal_mode_.has_value() && *previous_journal_mode_ != "wal" &&
+      !ExecuteSql(db_,
+                  std::format("PRAGMA journal_mode = {};",
+                              *previous_journal_mode_),
+                  "Restore journal_mode")) {
+    tracer::core::domain::ports::EmitWarn(
+        "[sqlite importer] failed to restore journal_mode after bulk load.");
+    ExecuteSql(db_, "PRAGMA wal_checkpoint(TRUNCATE);", "Checkpoint WAL");
+  }
+}
+
+auto BulkLoadScope::VerifyForeignKeys() const -> void {
+  const auto kViolation = QueryPragmaText(db_, "PRAGMA foreign_key_check;");
+  if (kViolation.has_value()) {
+    throw std::runtime_error("Foreign key check failed after bulk load: " +
+                             *kViolation);
+  }
+}
+
+auto CreateSecondaryIndexes(sqlite3* sqlite_db) -> bool {
+  const std::string kCreateIndexSql =
+      std::format("CREATE INDEX IF NOT EXISTS {0} ON {1} ({2}, {3});",
+                  schema::day::db::kIndexYearMonth, schema::day::db::kTable,
+                  schema::day::db::kYear, schema::day::db::kMonth);
+  const std::string kCreateRecordsDateProjectIndexSql = std::format(
+      "CREATE INDEX IF NOT EXISTS {0} ON {1} ({2}, {3});",
+      kRecordsDateProjectIndex, schema::time_records::db::kTable,
+      schema::time_records::db::kDate, schema::time_records::db::kProjectId);
+  const std::string kCreateRecordsDatePathSnapshotIndexSql = std::format(
+      "CREATE INDEX IF NOT EXISTS {0} ON {1} ({2}, {3});",
+      kRecordsDatePathSnapshotIndex, schema::time_records::db::kTable,
+      schema::time_records::db::kDate,
+      schema::time_records::db::kProjectPathSnapshot);
+  return ExecuteSql(sqlite_db, kCreateIndexSql,
+                    "Create index on days(year, month)") &&
+         ExecuteSql(sqlite_db, kCreateRecordsDateProjectIndexSql,
+                    "Create index on time_records(date, project_id)") &&
+         ExecuteSql(
+             sqlite_db, kCreateRecordsDatePathSnapshotIndexSql,
+             "Create index on time_records(date, project_path_snapshot)");
+}
+
+auto DropSecondaryIndexes(sqlite3* sqlite_db) -> bool {
+  return ExecuteSql(sqlite_db,
+                    std::format("DROP INDEX IF EXISTS {0};",
+                                schema::day::db::kIndexYearMonth),
+                    "Drop index on days(year, month)") &&
+         ExecuteSql(sqlite_db,
+                    std::format("DROP INDEX IF EXISTS {0};",
+                                kRecordsDateProjectIndex),
+                    "Drop index on time_records(date, project_id)") &&
+         ExecuteSql(sqlite_db,
+                    std::format("DROP INDEX IF EXISTS {0};",
+                                kRecordsDatePathSnapshotIndex),
+                    "Drop index on time_records(date, project_path_snapshot)");
+}
+
 auto Connection::GetDb() const -> sqlite3* {
   return db_;
 }
@@ -0,0 +1,34 @@
+// infra/persistence/importer/sqlite/report_generation.hpp
+#ifndef INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_REPORT_GENERATION_H_
+#define INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_REPORT_GENERATION_H_
+
+#include "infra/sqlite_fwd.hpp"
+
+#include <optional>
+
+#include "infra/persistence/importer/sqlite/rollup.hpp"
+
+namespace tracer::core::infrastructure::persistence::importer::sqlite {
+
+// 创建 report_generations 表并写入全库纪元行（随机初值）。
+// 已渲染报表缓存以这些代次作为键的一部分。
+auto EnsureReportGenerations(sqlite3* sqlite_db) -> bool;
+
+// 为范围覆盖到的每个月把代次加一；range 为空时只推进全库纪元，
+// 使所有月份的缓存同时失效。应在写入明细的同一事务内调用。
+auto BumpReportGenerations(sqlite3* sqlite_db,
+                           const std::optional<RollupDateRange>& range)
+    -> bool;
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
+
+namespace infrastructure::persistence::importer::sqlite {
+
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    BumpReportGenerations;
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    EnsureReportGenerations;
+
+}  // namespace infrastructure::persistence::importer::sqlite
+
+#endif  // INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_REPORT_GENERATION_H_
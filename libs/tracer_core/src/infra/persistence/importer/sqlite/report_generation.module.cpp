@@ -0,0 +1,67 @@
+#include <sqlite3.h>
+
+#include <format>
+#include <optional>
+#include <string>
+
+#include "infra/persistence/importer/sqlite/connection.hpp"
+#include "infra/persistence/importer/sqlite/report_generation.hpp"
+#include "infra/persistence/importer/sqlite/rollup.hpp"
+#include "infra/schema/sqlite_schema.hpp"
+
+namespace tracer::core::infrastructure::persistence::importer::sqlite {
+namespace {
+
+namespace generations = schema::report_generations::db;
+
+auto UpsertGenerationSql(const std::string& select_scopes) -> std::string {
+  // INSERT ... SELECT 带 UPSERT 时需要 WHERE 子句消除语法歧义。
+  return std::format(
+      "INSERT INTO {0} ({1}, {2}) {3} "
+      "ON CONFLICT({1}) DO UPDATE SET {2} = {2} + 1;",
+      generations::kTable, generations::kScope, generations::kGeneration,
+      select_scopes);
+}
+
+}  // namespace
+
+auto EnsureReportGenerations(sqlite3* sqlite_db) -> bool {
+  const std::string kCreateSql = std::format(
+      "CREATE TABLE IF NOT EXISTS {0} ("
+      "{1} TEXT PRIMARY KEY NOT NULL, "
+      "{2} INTEGER NOT NULL);",
+      generations::kTable, generations::kScope, generations::kGeneration);
+  // 纪元取随机初值：删库重建后代次从 1 重新计数也不会与旧缓存键相撞。
+  const std::string kSeedSql = std::format(
+      "INSERT OR IGNORE INTO {0} ({1}, {2}) "
+      "VALUES ('{3}', abs(random() % 1000000000000));",
+      generations::kTable, generations::kScope, generations::kGeneration,
+      generations::kGlobalScope);
+  return ExecuteSql(sqlite_db, kCreateSql, "Create report_generations") &&
+         ExecuteSql(sqlite_db, kSeedSql, "Seed report_generations");
+}
+
+auto BumpReportGenerations(sqlite3* sqlite_db,
+                           const std::optional<RollupDateRange>& range)
+    -> bool {
+  if (!range.has_value()) {
+    return ExecuteSql(
+        sqlite_db,
+        UpsertGenerationSql(std::format("SELECT '{0}', 1 WHERE 1",
+                                        generations::kGlobalScope)),
+        "Bump report generation epoch");
+  }
+
+  // 递归 CTE 枚举范围覆盖的每个月（YYYY-MM），逐月推进代次。
+  const std::string kBumpMonthsSql =
+      "WITH RECURSIVE months(month_start) AS ("
+      "SELECT date(substr(?1, 1, 7) || '-01') "
+      "UNION ALL SELECT date(month_start, '+1 month') FROM months "
+      "WHERE month_start < date(substr(?2, 1, 7) || '-01')) " +
+      UpsertGenerationSql(
+          "SELECT substr(month_start, 1, 7), 1 FROM months "
+          "WHERE month_start IS NOT NULL");
+  return ExecuteDateRangeSql(sqlite_db, kBumpMonthsSql, range);
+}
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
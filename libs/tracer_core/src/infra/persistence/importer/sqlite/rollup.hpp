@@ -0,0 +1,48 @@
+// infra/persistence/importer/sqlite/rollup.hpp
+#ifndef INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_ROLLUP_H_
+#define INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_ROLLUP_H_
+
+#include "infra/sqlite_fwd.hpp"
+
+#include <optional>
+#include <string>
+
+namespace tracer::core::infrastructure::persistence::importer::sqlite {
+
+// 闭区间日期范围，格式 YYYY-MM-DD；按字典序比较。
+struct RollupDateRange {
+  std::string first_date;
+  std::string last_date;
+};
+
+// 创建汇总表（project_daily_rollup / project_monthly_rollup /
+// day_flag_rollup）。表是首次创建或 rollup_meta 中的分类规则指纹与当前
+// 规则不同时从已有 time_records 全量回填，保证旧库升级、规则调整后
+// 汇总表与明细一致。
+auto EnsureRollupTables(sqlite3* sqlite_db) -> bool;
+
+// 删除并按 time_records 重算范围内的汇总行；range 为空时全量重算。
+// 月汇总按范围覆盖到的整月重算。应在写入明细的同一事务内调用。
+auto RebuildRollups(sqlite3* sqlite_db,
+                    const std::optional<RollupDateRange>& range) -> bool;
+
+// 执行带 ?1/?2 日期参数的语句；range 为空时语句不含参数。
+auto ExecuteDateRangeSql(sqlite3* sqlite_db, const std::string& sql,
+                         const std::optional<RollupDateRange>& range) -> bool;
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
+
+namespace infrastructure::persistence::importer::sqlite {
+
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    EnsureRollupTables;
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    ExecuteDateRangeSql;
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    RebuildRollups;
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    RollupDateRange;
+
+}  // namespace infrastructure::persistence::importer::sqlite
+
+#endif  // INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_ROLLUP_H_
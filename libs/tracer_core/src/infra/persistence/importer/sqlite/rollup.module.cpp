@@ -0,0 +1,213 @@
+#include <sqlite3.h>
+
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "infra/persistence/importer/sqlite/connection.hpp"
+#include "infra/persistence/importer/sqlite/rollup.hpp"
+#include "infra/persistence/sqlite/project_dictionary.hpp"
+#include "infra/schema/sqlite_schema.hpp"
+
+import tracer.core.domain.ports.diagnostics;
+
+namespace tracer::core::infrastructure::persistence::importer::sqlite {
+namespace {
+
+namespace daily = schema::project_daily_rollup::db;
+namespace monthly = schema::project_monthly_rollup::db;
+namespace flags = schema::day_flag_rollup::db;
+namespace records = schema::time_records::db;
+namespace meta = schema::rollup_meta::db;
+
+// 当天任一记录的项目路径快照命中该分类即记 1。
+auto DayFlagSql(std::uint32_t project_class) -> std::string {
+  return std::format(
+      "COALESCE(MAX({}), 0)",
+      ProjectClassPathSql(project_class, records::kProjectPathSnapshot));
+}
+
+auto DateFilterSql(std::string_view column,
+                   const std::optional<RollupDateRange>& range)
+    -> std::string {
+  if (!range.has_value()) {
+    return "";
+  }
+  return std::format(" WHERE {0} >= ?1 AND {0} <= ?2", column);
+}
+
+auto MonthFilterSql(const std::optional<RollupDateRange>& range)
+    -> std::string {
+  if (!range.has_value()) {
+    return "";
+  }
+  return std::format(
+      " WHERE {0} >= substr(?1, 1, 7) AND {0} <= substr(?2, 1, 7)",
+      monthly::kYearMonth);
+}
+
+// 记录本次重算所用分类规则的指纹，与重算在同一事务内。
+auto StoreRulesFingerprint(sqlite3* sqlite_db) -> bool {
+  const std::string kSql =
+      std::format("INSERT OR REPLACE INTO {} ({}, {}) VALUES (?1, ?2);",
+                  meta::kTable, meta::kKey, meta::kValue);
+  const std::string kFingerprint = ProjectClassRulesFingerprint();
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    return false;
+  }
+  sqlite3_bind_text(stmt, 1, meta::kProjectClassRulesKey.data(),
+                    static_cast<int>(meta::kProjectClassRulesKey.size()),
+                    SQLITE_STATIC);
+  sqlite3_bind_text(stmt, 2, kFingerprint.c_str(), -1, SQLITE_TRANSIENT);
+  const bool kOk = sqlite3_step(stmt) == SQLITE_DONE;
+  sqlite3_finalize(stmt);
+  return kOk;
+}
+
+}  // namespace
+
+auto ExecuteDateRangeSql(sqlite3* sqlite_db, const std::string& sql,
+                         const std::optional<RollupDateRange>& range)
+    -> bool {
+  if (!range.has_value()) {
+    return ExecuteSql(sqlite_db, sql);
+  }
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(sqlite_db, sql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    return false;
+  }
+  sqlite3_bind_text(stmt, 1, range->first_date.c_str(), -1, SQLITE_TRANSIENT);
+  sqlite3_bind_text(stmt, 2, range->last_date.c_str(), -1, SQLITE_TRANSIENT);
+  const bool kOk = sqlite3_step(stmt) == SQLITE_DONE;
+  sqlite3_finalize(stmt);
+  return kOk;
+}
+
+auto EnsureRollupTables(sqlite3* sqlite_db) -> bool {
+  const bool kAlreadyPresent = TableExists(sqlite_db, daily::kTable) &&
+                               TableExists(sqlite_db, monthly::kTable) &&
+                               TableExists(sqlite_db, flags::kTable);
+
+  const std::string kCreateDailySql = std::format(
+      "CREATE TABLE IF NOT EXISTS {0} ("
+      "{1} TEXT NOT NULL, "
+      "{2} TEXT NOT NULL, "
+      "{3} INTEGER NOT NULL, "
+      "{4} INTEGER NOT NULL, "
+      "{5} INTEGER NOT NULL, "
+      "PRIMARY KEY ({1}, {3})) WITHOUT ROWID;",
+      daily::kTable, daily::kDate, daily::kYearMonth, daily::kProjectId,
+      daily::kDuration, daily::kRecordCount);
+  const std::string kCreateMonthlySql = std::format(
+      "CREATE TABLE IF NOT EXISTS {0} ("
+      "{1} TEXT NOT NULL, "
+      "{2} INTEGER NOT NULL, "
+      "{3} INTEGER NOT NULL, "
+      "{4} INTEGER NOT NULL, "
+      "{5} INTEGER NOT NULL, "
+      "PRIMARY KEY ({1}, {2})) WITHOUT ROWID;",
+      monthly::kTable, monthly::kYearMonth, monthly::kProjectId,
+      monthly::kDuration, monthly::kRecordCount, monthly::kActiveDays);
+  const std::string kCreateFlagsSql = std::format(
+      "CREATE TABLE IF NOT EXISTS {0} ("
+      "{1} TEXT PRIMARY KEY, "
+      "{2} TEXT NOT NULL, "
+      "{3} INTEGER NOT NULL, "
+      "{4} INTEGER NOT NULL, "
+      "{5} INTEGER NOT NULL, "
+      "{6} INTEGER NOT NULL) WITHOUT ROWID;",
+      flags::kTable, flags::kDate, flags::kYearMonth, flags::kStudy,
+      flags::kExercise, flags::kCardio, flags::kAnaerobic);
+  const std::string kCreateFlagsMonthIndexSql = std::format(
+      "CREATE INDEX IF NOT EXISTS idx_{0}_year_month ON {0} ({1});",
+      flags::kTable, flags::kYearMonth);
+  const std::string kCreateMetaSql = std::format(
+      "CREATE TABLE IF NOT EXISTS {0} ("
+      "{1} TEXT PRIMARY KEY, "
+      "{2} TEXT NOT NULL) WITHOUT ROWID;",
+      meta::kTable, meta::kKey, meta::kValue);
+
+  if (!ExecuteSql(sqlite_db, kCreateDailySql,
+                  "Create project_daily_rollup table") ||
+      !ExecuteSql(sqlite_db, kCreateMonthlySql,
+                  "Create project_monthly_rollup table") ||
+      !ExecuteSql(sqlite_db, kCreateFlagsSql,
+                  "Create day_flag_rollup table") ||
+      !ExecuteSql(sqlite_db, kCreateFlagsMonthIndexSql,
+                  "Create index on day_flag_rollup(year_month)") ||
+      !ExecuteSql(sqlite_db, kCreateMetaSql, "Create rollup_meta table")) {
+    return false;
+  }
+  // 分类规则变化后（含升级前没有记录指纹的库）同样全量重算，
+  // 否则 day_flag_rollup 仍是旧规则的结果。
+  if (kAlreadyPresent && DayFlagRollupMatchesRules(sqlite_db)) {
+    return true;
+  }
+
+  if (!ExecuteSql(sqlite_db, "BEGIN TRANSACTION;", "Begin rollup backfill")) {
+    return false;
+  }
+  if (!RebuildRollups(sqlite_db, std::nullopt) ||
+      !StoreRulesFingerprint(sqlite_db)) {
+    ExecuteSql(sqlite_db, "ROLLBACK;", "Rollback rollup backfill");
+    tracer::core::domain::ports::EmitWarn(
+        "[sqlite importer] failed to backfill rollup tables.");
+    return false;
+  }
+  return ExecuteSql(sqlite_db, "COMMIT;", "Commit rollup backfill");
+}
+
+auto RebuildRollups(sqlite3* sqlite_db,
+                    const std::optional<RollupDateRange>& range) -> bool {
+  const std::string kDeleteDailySql =
+      std::format("DELETE FROM {0}{1};", daily::kTable,
+                  DateFilterSql(daily::kDate, range));
+  const std::string kDeleteFlagsSql =
+      std::format("DELETE FROM {0}{1};", flags::kTable,
+                  DateFilterSql(flags::kDate, range));
+  const std::string kDeleteMonthlySql = std::format(
+      "DELETE FROM {0}{1};", monthly::kTable, MonthFilterSql(range));
+
+  const std::string kInsertDailySql = std::format(
+      "INSERT INTO {0} ({1}, {2}, {3}, {4}, {5}) "
+      "SELECT {6}, substr({6}, 1, 7), {7}, SUM({8}), COUNT(*) "
+      "FROM {9}{10} GROUP BY {6}, {7};",
+      daily::kTable, daily::kDate, daily::kYearMonth, daily::kProjectId,
+      daily::kDuration, daily::kRecordCount, records::kDate,
+      records::kProjectId, records::kDuration, records::kTable,
+      DateFilterSql(records::kDate, range));
+  const std::string kInsertFlagsSql = std::format(
+      "INSERT INTO {0} ({1}, {2}, {3}, {4}, {5}, {6}) "
+      "SELECT {7}, substr({7}, 1, 7), {8}, {9}, {10}, {11} "
+      "FROM {12}{13} GROUP BY {7};",
+      flags::kTable, flags::kDate, flags::kYearMonth, flags::kStudy,
+      flags::kExercise, flags::kCardio, flags::kAnaerobic, records::kDate,
+      DayFlagSql(kProjectClassStudy), DayFlagSql(kProjectClassExercise),
+      DayFlagSql(kProjectClassCardio), DayFlagSql(kProjectClassAnaerobic),
+      records::kTable, DateFilterSql(records::kDate, range));
+  // 月汇总由日汇总聚合而来；范围外的日汇总未变，整月重算结果仍然正确。
+  const std::string kInsertMonthlySql = std::format(
+      "INSERT INTO {0} ({1}, {2}, {3}, {4}, {5}) "
+      "SELECT {6}, {7}, SUM({8}), SUM({9}), COUNT(*) "
+      "FROM {10}{11} GROUP BY {6}, {7};",
+      monthly::kTable, monthly::kYearMonth, monthly::kProjectId,
+      monthly::kDuration, monthly::kRecordCount, monthly::kActiveDays,
+      daily::kYearMonth, daily::kProjectId, daily::kDuration,
+      daily::kRecordCount, daily::kTable, MonthFilterSql(range));
+
+  return ExecuteDateRangeSql(sqlite_db, kDeleteDailySql, range) &&
+         ExecuteDateRangeSql(sqlite_db, kDeleteFlagsSql, range) &&
+         ExecuteDateRangeSql(sqlite_db, kDeleteMonthlySql, range) &&
+         ExecuteDateRangeSql(sqlite_db, kInsertDailySql, range) &&
+         ExecuteDateRangeSql(sqlite_db, kInsertFlagsSql, range) &&
+         ExecuteDateRangeSql(sqlite_db, kInsertMonthlySql, range);
+}
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
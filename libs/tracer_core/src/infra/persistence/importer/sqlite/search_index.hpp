@@ -0,0 +1,34 @@
+// infra/persistence/importer/sqlite/search_index.hpp
+#ifndef INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_SEARCH_INDEX_H_
+#define INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_SEARCH_INDEX_H_
+
+#include "infra/sqlite_fwd.hpp"
+
+#include <optional>
+
+#include "infra/persistence/importer/sqlite/rollup.hpp"
+
+namespace tracer::core::infrastructure::persistence::importer::sqlite {
+
+// 创建 text_search 全文索引并在首次建表时从已有数据回填。
+// 索引是可选的：SQLite 未编译 FTS5 或 trigram 分词器时不建表并返回
+// false，查询侧照常使用 LIKE。回填失败时删除半成品表，同样返回 false。
+auto EnsureSearchIndex(sqlite3* sqlite_db) -> bool;
+
+// 删除并按 time_records / days 重建范围内的索引行；range 为空时全量重建。
+// 库中没有索引表时直接返回 true。应在写入明细的同一事务内调用。
+auto RebuildSearchIndex(sqlite3* sqlite_db,
+                        const std::optional<RollupDateRange>& range) -> bool;
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
+
+namespace infrastructure::persistence::importer::sqlite {
+
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    EnsureSearchIndex;
+using tracer::core::infrastructure::persistence::importer::sqlite::
+    RebuildSearchIndex;
+
+}  // namespace infrastructure::persistence::importer::sqlite
+
+#endif  // INFRASTRUCTURE_PERSISTENCE_IMPORTER_SQLITE_SEARCH_INDEX_H_
@@ -0,0 +1,98 @@
+#include <sqlite3.h>
+
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "infra/persistence/importer/sqlite/connection.hpp"
+#include "infra/persistence/importer/sqlite/rollup.hpp"
+#include "infra/persistence/importer/sqlite/search_index.hpp"
+#include "infra/schema/day_schema.hpp"
+#include "infra/schema/sqlite_schema.hpp"
+
+import tracer.core.domain.ports.diagnostics;
+
+namespace tracer::core::infrastructure::persistence::importer::sqlite {
+namespace {
+
+namespace search = schema::text_search::db;
+namespace records = schema::time_records::db;
+namespace days = schema::day::db;
+
+auto DateFilterSql(std::string_view column,
+                   const std::optional<RollupDateRange>& range,
+                   std::string_view conjunction) -> std::string {
+  if (!range.has_value()) {
+    return "";
+  }
+  return std::format(" {0} {1} >= ?1 AND {1} <= ?2", conjunction, column);
+}
+
+}  // namespace
+
+auto EnsureSearchIndex(sqlite3* sqlite_db) -> bool {
+  if (TableExists(sqlite_db, search::kTable)) {
+    return true;
+  }
+
+  // trigram 分词器按任意三字符切分，MATCH 可以做与 LIKE '%…%' 等价的
+  // 子串预筛，中文备注同样适用。
+  const std::string kCreateSql = std::format(
+      "CREATE VIRTUAL TABLE {0} USING fts5("
+      "{1} UNINDEXED, {2} UNINDEXED, {3}, {4}, {5}, "
+      "tokenize = 'trigram');",
+      search::kTable, search::kDate, search::kRecordId,
+      search::kActivityRemark, search::kDayRemark, search::kProjectPath);
+  if (!ExecuteSql(sqlite_db, kCreateSql, "Create text_search index")) {
+    return false;
+  }
+
+  if (!ExecuteSql(sqlite_db, "BEGIN TRANSACTION;",
+                  "Begin text_search backfill")) {
+    return false;
+  }
+  if (!RebuildSearchIndex(sqlite_db, std::nullopt)) {
+    ExecuteSql(sqlite_db, "ROLLBACK;", "Rollback text_search backfill");
+    ExecuteSql(sqlite_db, std::format("DROP TABLE {0};", search::kTable),
+               "Drop text_search index");
+    tracer::core::domain::ports::EmitWarn(
+        "[sqlite importer] failed to backfill text search index.");
+    return false;
+  }
+  return ExecuteSql(sqlite_db, "COMMIT;", "Commit text_search backfill");
+}
+
+auto RebuildSearchIndex(sqlite3* sqlite_db,
+                        const std::optional<RollupDateRange>& range) -> bool {
+  if (!TableExists(sqlite_db, search::kTable)) {
+    return true;
+  }
+
+  // date 不参与索引，按范围删除需要扫描索引表自身；全量重建直接清空。
+  const std::string kDeleteSql =
+      std::format("DELETE FROM {0}{1};", search::kTable,
+                  DateFilterSql(search::kDate, range, "WHERE"));
+  const std::string kInsertRecordsSql = std::format(
+      "INSERT INTO {0} ({1}, {2}, {3}, {4}, {5}) "
+      "SELECT {6}, {7}, {8}, NULL, {9} FROM {10}{11};",
+      search::kTable, search::kDate, search::kRecordId,
+      search::kActivityRemark, search::kDayRemark, search::kProjectPath,
+      records::kDate, records::kLogicalId, records::kActivityRemark,
+      records::kProjectPathSnapshot, records::kTable,
+      DateFilterSql(records::kDate, range, "WHERE"));
+  const std::string kInsertDaysSql = std::format(
+      "INSERT INTO {0} ({1}, {2}, {3}, {4}, {5}) "
+      "SELECT {6}, NULL, NULL, {7}, NULL FROM {8} "
+      "WHERE {7} IS NOT NULL AND {7} <> ''{9};",
+      search::kTable, search::kDate, search::kRecordId,
+      search::kActivityRemark, search::kDayRemark, search::kProjectPath,
+      days::kDate, days::kRemark, days::kTable,
+      DateFilterSql(days::kDate, range, "AND"));
+
+  return ExecuteDateRangeSql(sqlite_db, kDeleteSql, range) &&
+         ExecuteDateRangeSql(sqlite_db, kInsertRecordsSql, range) &&
+         ExecuteDateRangeSql(sqlite_db, kInsertDaysSql, range);
+}
+
+}  // namespace tracer::core::infrastructure::persistence::importer::sqlite
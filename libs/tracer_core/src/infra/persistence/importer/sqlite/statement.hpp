@@ -4,6 +4,8 @@
 
 #include "infra/sqlite_fwd.hpp"
 
+#include <cstddef>
+
 namespace tracer::core::infrastructure::persistence::importer::sqlite {
 class Statement {
  public:
@@ -13,12 +15,21 @@ class Statement {
   [[nodiscard]] auto GetInsertDayStmt() const -> sqlite3_stmt*;
   [[nodiscard]] auto GetInsertRecordStmt() const -> sqlite3_stmt*;
   [[nodiscard]] auto GetInsertProjectStmt() const -> sqlite3_stmt*;
+  // 一次插入 kInsertBatchRows 行的多行 INSERT；参数总数保持在 999 以内。
+  [[nodiscard]] auto GetInsertDayBatchStmt() const -> sqlite3_stmt*;
+  [[nodiscard]] auto GetInsertRecordBatchStmt() const -> sqlite3_stmt*;
+
+  static constexpr std::size_t kDayColumnCount = 6;
+  static constexpr std::size_t kRecordColumnCount = 10;
+  static constexpr std::size_t kInsertBatchRows = 64;
 
  private:
   sqlite3* db_;
   sqlite3_stmt* stmt_insert_day_ = nullptr;
   sqlite3_stmt* stmt_insert_record_ = nullptr;
   sqlite3_stmt* stmt_insert_project_ = nullptr;
+  sqlite3_stmt* stmt_insert_day_batch_ = nullptr;
+  sqlite3_stmt* stmt_insert_record_batch_ = nullptr;
 
   auto PrepareStatements() -> void;
   auto FinalizeStatements() -> void;
@@ -2,6 +2,7 @@ module;
 
 #include <sqlite3.h>
 
+#include <cstddef>
 #include <format>
 #include <stdexcept>
 #include <string>
@@ -12,35 +13,34 @@ module;
 module tracer.core.infrastructure.persistence.write.importer.sqlite.statement;
 
 namespace tracer::core::infrastructure::persistence::importer::sqlite {
+namespace {
 
-Statement::Statement(sqlite3* sqlite_db) : db_(sqlite_db) {
-  PrepareStatements();
-}
-
-Statement::~Statement() {
-  FinalizeStatements();
-}
-
-auto Statement::GetInsertDayStmt() const -> sqlite3_stmt* {
-  return stmt_insert_day_;
-}
-
-auto Statement::GetInsertRecordStmt() const -> sqlite3_stmt* {
-  return stmt_insert_record_;
-}
+// 生成 "(?, ?, ...), (?, ?, ...)" 形式的多行 VALUES 占位符。
+auto BuildValuesPlaceholders(std::size_t rows, std::size_t columns)
+    -> std::string {
+  std::string row = "(";
+  for (std::size_t column = 0; column < columns; ++column) {
+    row += column == 0 ? "?" : ", ?";
+  }
+  row += ")";
 
-auto Statement::GetInsertProjectStmt() const -> sqlite3_stmt* {
-  return stmt_insert_project_;
+  std::string values;
+  values.reserve(rows * (row.size() + 2));
+  for (std::size_t index = 0; index < rows; ++index) {
+    if (index > 0) {
+      values += ", ";
+    }
+    values += row;
+  }
+  return values;
 }
 
-auto Statement::PrepareStatements() -> void {
-  const std::string kInsertDaySql = std::format(
+auto BuildInsertDaySql(std::size_t rows) -> std::string {
+  return std::format(
       "INSERT INTO {0} ("
       "{1}, {2}, {3}, {4}, {5}, {6}"
       ") "
-      "VALUES ("
-      "?, ?, ?, ?, ?, ?"
-      ") "
+      "VALUES {7} "
       "ON CONFLICT({1}) DO UPDATE SET "
       "{2}=excluded.{2}, "
       "{3}=excluded.{3}, "
@@ -49,16 +49,15 @@ auto Statement::PrepareStatements() -> void {
       "{6}=excluded.{6};",
       schema::day::db::kTable, schema::day::db::kDate, schema::day::db::kYear,
       schema::day::db::kMonth, schema::day::db::kWakeAnchor,
-      schema::day::db::kRemark, schema::day::db::kGetupTime);
-  if (sqlite3_prepare_v2(db_, kInsertDaySql.c_str(), -1, &stmt_insert_day_,
-                         nullptr) != SQLITE_OK) {
-    throw std::runtime_error("Failed to prepare day insert statement.");
-  }
+      schema::day::db::kRemark, schema::day::db::kGetupTime,
+      BuildValuesPlaceholders(rows, Statement::kDayColumnCount));
+}
 
-  const std::string kInsertRecordSql = std::format(
+auto BuildInsertRecordSql(std::size_t rows) -> std::string {
+  return std::format(
       "INSERT INTO {0} "
       "({1}, {2}, {3}, {4}, {5}, {6}, {7}, {8}, {9}, {10}) "
-      "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?) "
+      "VALUES {11} "
       "ON CONFLICT({1}) DO UPDATE SET "
       "{2}=excluded.{2}, "
       "{3}=excluded.{3}, "
@@ -75,11 +74,60 @@ auto Statement::PrepareStatements() -> void {
       schema::time_records::db::kStart, schema::time_records::db::kEnd,
       schema::time_records::db::kProjectId, schema::time_records::db::kDuration,
       schema::time_records::db::kProjectPathSnapshot,
-      schema::time_records::db::kActivityRemark);
-  if (sqlite3_prepare_v2(db_, kInsertRecordSql.c_str(), -1,
+      schema::time_records::db::kActivityRemark,
+      BuildValuesPlaceholders(rows, Statement::kRecordColumnCount));
+}
+
+}  // namespace
+
+Statement::Statement(sqlite3* sqlite_db) : db_(sqlite_db) {
+  PrepareStatements();
+}
+
+Statement::~Statement() {
+  FinalizeStatements();
+}
+
+auto Statement::GetInsertDayStmt() const -> sqlite3_stmt* {
+  return stmt_insert_day_;
+}
+
+auto Statement::GetInsertRecordStmt() const -> sqlite3_stmt* {
+  return stmt_insert_record_;
+}
+
+auto Statement::GetInsertProjectStmt() const -> sqlite3_stmt* {
+  return stmt_insert_project_;
+}
+
+auto Statement::GetInsertDayBatchStmt() const -> sqlite3_stmt* {
+  return stmt_insert_day_batch_;
+}
+
+auto Statement::GetInsertRecordBatchStmt() const -> sqlite3_stmt* {
+  return stmt_insert_record_batch_;
+}
+
+auto Statement::PrepareStatements() -> void {
+  if (sqlite3_prepare_v2(db_, BuildInsertDaySql(1).c_str(), -1,
+                         &stmt_insert_day_, nullptr) != SQLITE_OK) {
+    throw std::runtime_error("Failed to prepare day insert statement.");
+  }
+  if (sqlite3_prepare_v2(db_, BuildInsertDaySql(kInsertBatchRows).c_str(), -1,
+                         &stmt_insert_day_batch_, nullptr) != SQLITE_OK) {
+    throw std::runtime_error("Failed to prepare batched day insert statement.");
+  }
+
+  if (sqlite3_prepare_v2(db_, BuildInsertRecordSql(1).c_str(), -1,
                          &stmt_insert_record_, nullptr) != SQLITE_OK) {
     throw std::runtime_error("Failed to prepare time record insert statement.");
   }
+  if (sqlite3_prepare_v2(db_, BuildInsertRecordSql(kInsertBatchRows).c_str(),
+                         -1, &stmt_insert_record_batch_,
+                         nullptr) != SQLITE_OK) {
+    throw std::runtime_error(
+        "Failed to prepare batched time record insert statement.");
+  }
 
   const std::string kInsertProjectSql = std::format(
       "INSERT INTO {0} ({1}, {2}, {3}, {4}) VALUES (?, ?, ?, ?);",
@@ -102,6 +150,12 @@ auto Statement::FinalizeStatements() -> void {
   if (stmt_insert_project_ != nullptr) {
     sqlite3_finalize(stmt_insert_project_);
   }
+  if (stmt_insert_day_batch_ != nullptr) {
+    sqlite3_finalize(stmt_insert_day_batch_);
+  }
+  if (stmt_insert_record_batch_ != nullptr) {
+    sqlite3_finalize(stmt_insert_record_batch_);
+  }
 }
 
 }  // namespace tracer::core::infrastructure::persistence::importer::sqlite
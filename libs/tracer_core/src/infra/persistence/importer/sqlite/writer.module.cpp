@@ -1,5 +1,6 @@
 module;
 
+#include <cstddef>
 #include <cstdint>
 #include <sqlite3.h>
 
@@ -13,9 +14,10 @@ module;
 module tracer.core.infrastructure.persistence.write.importer.sqlite.writer;
 
 import tracer.core.infrastructure.persistence.write.importer.sqlite.project_resolver;
+import tracer.core.infrastructure.persistence.write.importer.sqlite.statement;
 
 namespace {
-// Day Table Bind Indices
+// Day Table Bind Indices (relative to the row offset)
 constexpr int kDayIdxDate = 1;
 constexpr int kDayIdxYear = 2;
 constexpr int kDayIdxMonth = 3;
@@ -23,7 +25,7 @@ constexpr int kDayIdxWakeAnchor = 4;
 constexpr int kDayIdxRemark = 5;
 constexpr int kDayIdxGetupTime = 6;
 
-// Record Table Bind Indices
+// Record Table Bind Indices (relative to the row offset)
 constexpr int kRecordIdxLogicalId = 1;
 constexpr int kRecordIdxStartTimestamp = 2;
 constexpr int kRecordIdxEndTimestamp = 3;
@@ -34,6 +36,75 @@ constexpr int kRecordIdxProjectId = 7;
 constexpr int kRecordIdxDuration = 8;
 constexpr int kRecordIdxProjectPathSnapshot = 9;
 constexpr int kRecordIdxRemark = 10;
+
+// 批量语句第 row 行的绑定偏移；列数与 Statement 生成的 VALUES 保持一致。
+auto RowOffset(std::size_t row, std::size_t column_count) -> int {
+  return static_cast<int>(row * column_count);
+}
+
+// 行数据在 step 期间保持不变，使用 SQLITE_STATIC 避免 SQLite 复制字符串；
+// 批次结束后由 ClearBindings 解除对调用方缓冲区的引用。
+auto BindText(sqlite3_stmt* stmt, int index, const std::string& value)
+    -> void {
+  sqlite3_bind_text(stmt, index, value.data(), static_cast<int>(value.size()),
+                    SQLITE_STATIC);
+}
+
+auto BindDayRow(sqlite3_stmt* stmt, int offset, const DayData& day_data)
+    -> void {
+  BindText(stmt, offset + kDayIdxDate, day_data.date);
+  sqlite3_bind_int(stmt, offset + kDayIdxYear, day_data.year);
+  sqlite3_bind_int(stmt, offset + kDayIdxMonth, day_data.month);
+  sqlite3_bind_int(stmt, offset + kDayIdxWakeAnchor, day_data.wake_anchor);
+  BindText(stmt, offset + kDayIdxRemark, day_data.remark);
+  if (!day_data.getup_time.has_value()) {
+    sqlite3_bind_null(stmt, offset + kDayIdxGetupTime);
+  } else {
+    BindText(stmt, offset + kDayIdxGetupTime, *day_data.getup_time);
+  }
+}
+
+auto BindRecordRow(sqlite3_stmt* stmt, int offset,
+                   const TimeRecordInternal& record_data,
+                   std::int64_t project_id) -> void {
+  sqlite3_bind_int64(stmt, offset + kRecordIdxLogicalId,
+                     record_data.logical_id);
+  sqlite3_bind_int64(stmt, offset + kRecordIdxStartTimestamp,
+                     record_data.start_timestamp);
+  sqlite3_bind_int64(stmt, offset + kRecordIdxEndTimestamp,
+                     record_data.end_timestamp);
+  BindText(stmt, offset + kRecordIdxDate, record_data.date);
+  BindText(stmt, offset + kRecordIdxStartTimeStr, record_data.start_time_str);
+  BindText(stmt, offset + kRecordIdxEndTimeStr, record_data.end_time_str);
+  sqlite3_bind_int64(stmt, offset + kRecordIdxProjectId, project_id);
+  sqlite3_bind_int(stmt, offset + kRecordIdxDuration,
+                   record_data.duration_seconds);
+  // Persist canonical '_' path and keep connector replacement in display
+  // layer.
+  BindText(stmt, offset + kRecordIdxProjectPathSnapshot,
+           record_data.project_path);
+  if (record_data.remark.has_value()) {
+    BindText(stmt, offset + kRecordIdxRemark, *record_data.remark);
+  } else {
+    sqlite3_bind_null(stmt, offset + kRecordIdxRemark);
+  }
+}
+
+auto StepAndReset(sqlite3_stmt* stmt, const char* error_message) -> void {
+  const int kStepResult = sqlite3_step(stmt);
+  sqlite3_reset(stmt);
+  if (kStepResult != SQLITE_DONE) {
+    throw std::runtime_error(error_message);
+  }
+}
+
+auto ClearBindings(sqlite3_stmt* single_stmt, sqlite3_stmt* batch_stmt)
+    -> void {
+  sqlite3_clear_bindings(single_stmt);
+  if (batch_stmt != nullptr) {
+    sqlite3_clear_bindings(batch_stmt);
+  }
+}
 }  // namespace
 
 namespace tracer::core::infrastructure::persistence::importer::sqlite {
@@ -52,28 +123,31 @@ Writer::Writer(sqlite3* sqlite_db, sqlite3_stmt* stmt_day,
 
 Writer::~Writer() = default;
 
-auto Writer::InsertDays(const std::vector<DayData>& days) -> void {
-  for (const auto& day_data : days) {
-    sqlite3_bind_text(stmt_insert_day_, kDayIdxDate, day_data.date.c_str(), -1,
-                      SQLITE_TRANSIENT);
-    sqlite3_bind_int(stmt_insert_day_, kDayIdxYear, day_data.year);
-    sqlite3_bind_int(stmt_insert_day_, kDayIdxMonth, day_data.month);
-    sqlite3_bind_int(stmt_insert_day_, kDayIdxWakeAnchor, day_data.wake_anchor);
-    sqlite3_bind_text(stmt_insert_day_, kDayIdxRemark, day_data.remark.c_str(),
-                      -1, SQLITE_TRANSIENT);
-
-    if (!day_data.getup_time.has_value()) {
-      sqlite3_bind_null(stmt_insert_day_, kDayIdxGetupTime);
-    } else {
-      sqlite3_bind_text(stmt_insert_day_, kDayIdxGetupTime,
-                        day_data.getup_time->c_str(), -1, SQLITE_TRANSIENT);
-    }
+auto Writer::SetBatchStatements(sqlite3_stmt* stmt_day_batch,
+                                sqlite3_stmt* stmt_record_batch,
+                                std::size_t batch_rows) -> void {
+  stmt_insert_day_batch_ = stmt_day_batch;
+  stmt_insert_record_batch_ = stmt_record_batch;
+  batch_rows_ = batch_rows;
+}
 
-    if (sqlite3_step(stmt_insert_day_) != SQLITE_DONE) {
-      throw std::runtime_error("Error inserting day row.");
+auto Writer::InsertDays(const std::vector<DayData>& days) -> void {
+  std::size_t index = 0;
+  if (stmt_insert_day_batch_ != nullptr && batch_rows_ > 1) {
+    for (; index + batch_rows_ <= days.size(); index += batch_rows_) {
+      for (std::size_t row = 0; row < batch_rows_; ++row) {
+        BindDayRow(stmt_insert_day_batch_,
+                   RowOffset(row, Statement::kDayColumnCount),
+                   days[index + row]);
+      }
+      StepAndReset(stmt_insert_day_batch_, "Error inserting day rows.");
     }
-    sqlite3_reset(stmt_insert_day_);
   }
+  for (; index < days.size(); ++index) {
+    BindDayRow(stmt_insert_day_, 0, days[index]);
+    StepAndReset(stmt_insert_day_, "Error inserting day row.");
+  }
+  ClearBindings(stmt_insert_day_, stmt_insert_day_batch_);
 }
 
 auto Writer::InsertRecords(const std::vector<TimeRecordInternal>& records)
@@ -90,43 +164,26 @@ auto Writer::InsertRecords(const std::vector<TimeRecordInternal>& records)
 
   project_resolver_->PreloadAndResolve(paths);
 
-  for (const auto& record_data : records) {
-    std::int64_t project_id = project_resolver_->GetId(record_data.project_path);
-
-    sqlite3_bind_int64(stmt_insert_record_, kRecordIdxLogicalId,
-                       record_data.logical_id);
-    sqlite3_bind_int64(stmt_insert_record_, kRecordIdxStartTimestamp,
-                       record_data.start_timestamp);
-    sqlite3_bind_int64(stmt_insert_record_, kRecordIdxEndTimestamp,
-                       record_data.end_timestamp);
-    sqlite3_bind_text(stmt_insert_record_, kRecordIdxDate,
-                      record_data.date.c_str(), -1, SQLITE_TRANSIENT);
-
-    sqlite3_bind_text(stmt_insert_record_, kRecordIdxStartTimeStr,
-                      record_data.start_time_str.c_str(), -1, SQLITE_TRANSIENT);
-    sqlite3_bind_text(stmt_insert_record_, kRecordIdxEndTimeStr,
-                      record_data.end_time_str.c_str(), -1, SQLITE_TRANSIENT);
-
-    sqlite3_bind_int64(stmt_insert_record_, kRecordIdxProjectId, project_id);
-    sqlite3_bind_int(stmt_insert_record_, kRecordIdxDuration,
-                     record_data.duration_seconds);
-    // Persist canonical '_' path and keep connector replacement in display
-    // layer.
-    sqlite3_bind_text(stmt_insert_record_, kRecordIdxProjectPathSnapshot,
-                      record_data.project_path.c_str(), -1, SQLITE_TRANSIENT);
-
-    if (record_data.remark.has_value()) {
-      sqlite3_bind_text(stmt_insert_record_, kRecordIdxRemark,
-                        record_data.remark->c_str(), -1, SQLITE_TRANSIENT);
-    } else {
-      sqlite3_bind_null(stmt_insert_record_, kRecordIdxRemark);
+  std::size_t index = 0;
+  if (stmt_insert_record_batch_ != nullptr && batch_rows_ > 1) {
+    for (; index + batch_rows_ <= records.size(); index += batch_rows_) {
+      for (std::size_t row = 0; row < batch_rows_; ++row) {
+        const auto& record_data = records[index + row];
+        BindRecordRow(stmt_insert_record_batch_,
+                      RowOffset(row, Statement::kRecordColumnCount),
+                      record_data,
+                      project_resolver_->GetId(record_data.project_path));
+      }
+      StepAndReset(stmt_insert_record_batch_, "Error inserting record rows.");
     }
-
-    if (sqlite3_step(stmt_insert_record_) != SQLITE_DONE) {
-      throw std::runtime_error("Error inserting record row.");
-    }
-    sqlite3_reset(stmt_insert_record_);
   }
+  for (; index < records.size(); ++index) {
+    const auto& record_data = records[index];
+    BindRecordRow(stmt_insert_record_, 0, record_data,
+                  project_resolver_->GetId(record_data.project_path));
+    StepAndReset(stmt_insert_record_, "Error inserting record row.");
+  }
+  ClearBindings(stmt_insert_record_, stmt_insert_record_batch_);
 }
 
 }  // namespace tracer::core::infrastructure::persistence::importer::sqlite
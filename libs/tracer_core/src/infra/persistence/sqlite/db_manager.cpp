@@ -7,6 +7,8 @@
 #include <optional>
 #include <utility>
 
+#include "infra/persistence/sqlite/project_dictionary.hpp"
+
 import tracer.core.domain.ports.diagnostics;
 
 namespace modports = tracer::core::domain::ports;
@@ -72,6 +74,7 @@ auto DBManager::OpenDatabaseIfNeeded() -> bool {
 
 void DBManager::CloseDatabase() {
   if (db_ != nullptr) {
+    tracer::core::infrastructure::persistence::ReleaseSnapshotConnection(db_);
     sqlite3_close(db_);
     db_ = nullptr;
   }
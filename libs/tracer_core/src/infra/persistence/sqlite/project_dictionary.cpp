@@ -0,0 +1,617 @@
+// infra/persistence/sqlite/project_dictionary.cpp
+#include "infra/persistence/sqlite/project_dictionary.hpp"
+
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "infra/schema/sqlite_schema.hpp"
+
+import tracer.core.domain.ports.diagnostics;
+
+namespace modports = tracer::core::domain::ports;
+
+namespace tracer::core::infrastructure::persistence {
+namespace {
+
+// id 上限不超过行数的若干倍时使用按 id 下标的扁平数组。
+constexpr std::size_t kDenseIndexSlack = 1024;
+constexpr std::size_t kDenseIndexFactor = 4;
+
+// 文件头中 "file change counter" 的偏移与宽度（大端）。
+constexpr sqlite3_int64 kChangeCounterOffset = 24;
+constexpr int kChangeCounterBytes = 4;
+// 见证连接数上限；读连接池规模远小于此，满了丢弃最早的见证者。
+constexpr std::size_t kMaxSnapshotWitnesses = 16;
+
+struct PublishedDictionary {
+  DatabaseSnapshotKey key;
+  std::shared_ptr<const ProjectDictionary> dictionary;
+};
+
+auto Generation() -> std::atomic<std::uint64_t>& {
+  static std::atomic<std::uint64_t> generation{0};
+  return generation;
+}
+
+// 快照见证者的连接身份。同一连接在关闭前始终映射到同一身份；关闭时
+// 由 ReleaseSnapshotConnection 移除，复用该地址的新连接另分配身份。
+struct ConnectionIdentities {
+  std::mutex mutex;
+  std::uint64_t next_id = 0;
+  std::unordered_map<sqlite3*, std::uint64_t> ids;
+};
+
+auto Identities() -> ConnectionIdentities& {
+  static ConnectionIdentities identities;
+  return identities;
+}
+
+auto ConnectionIdentity(sqlite3* sqlite_db) -> std::uint64_t {
+  auto& identities = Identities();
+  std::scoped_lock lock(identities.mutex);
+  const auto [kIt, kInserted] =
+      identities.ids.try_emplace(sqlite_db, identities.next_id);
+  if (kInserted) {
+    ++identities.next_id;
+  }
+  return kIt->second;
+}
+
+// 临界区只有指针拷贝；libc++ 尚不支持 std::atomic<std::shared_ptr>。
+struct PublishedSlot {
+  std::mutex mutex;
+  PublishedDictionary current;
+};
+
+auto Published() -> PublishedSlot& {
+  static PublishedSlot slot;
+  return slot;
+}
+
+// 经 SQLite 已打开的文件句柄读取，避免按路径再开一次文件。
+auto ReadChangeCounter(sqlite3* sqlite_db) -> std::optional<std::uint32_t> {
+  sqlite3_file* file = nullptr;
+  if (sqlite3_file_control(sqlite_db, "main", SQLITE_FCNTL_FILE_POINTER,
+                           static_cast<void*>(&file)) != SQLITE_OK ||
+      file == nullptr || file->pMethods == nullptr) {
+    return std::nullopt;
+  }
+  std::array<unsigned char, kChangeCounterBytes> bytes{};
+  const int kRc = file->pMethods->xRead(file, bytes.data(), kChangeCounterBytes,
+                                        kChangeCounterOffset);
+  // 空库短读时 SQLite 以零填充，计数视为 0。
+  if (kRc != SQLITE_OK && kRc != SQLITE_IOERR_SHORT_READ) {
+    return std::nullopt;
+  }
+  std::uint32_t counter = 0;
+  for (const unsigned char kByte : bytes) {
+    counter = (counter << 8U) | kByte;
+  }
+  return counter;
+}
+
+auto ReadDataVersion(sqlite3* sqlite_db) -> std::optional<std::int64_t> {
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(sqlite_db, "PRAGMA data_version;", -1, &stmt,
+                         nullptr) != SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    return std::nullopt;
+  }
+  std::optional<std::int64_t> version;
+  if (sqlite3_step(stmt) == SQLITE_ROW) {
+    version = sqlite3_column_int64(stmt, 0);
+  }
+  sqlite3_finalize(stmt);
+  return version;
+}
+
+using Match = ProjectClassRule::Match;
+
+// 报表统计、记录快照与导入期日汇总使用同一套根项目划分；调整分类只需
+// 修改这张表（SQL 判定由 ProjectClassPathSql 从同一张表生成）。
+constexpr std::array kDefaultRules = {
+    ProjectClassRule{kProjectClassStudy, Match::kRoot, "study", ""},
+    ProjectClassRule{kProjectClassExercise, Match::kRoot, "exercise", ""},
+    ProjectClassRule{kProjectClassCardio, Match::kRoot, "exercise_cardio", ""},
+    ProjectClassRule{kProjectClassAnaerobic, Match::kRoot,
+                     "exercise_anaerobic", ""},
+    ProjectClassRule{kProjectClassSleepNight, Match::kExact, "sleep_night",
+                     ""},
+    ProjectClassRule{kProjectClassSleepDay, Match::kExact, "sleep_day", ""},
+    ProjectClassRule{kProjectClassRecreation, Match::kRoot, "recreation", ""},
+    ProjectClassRule{kProjectClassRecreationZhihu, Match::kRootAndLeaf,
+                     "recreation", "zhihu"},
+    ProjectClassRule{kProjectClassRecreationBilibili, Match::kRootAndLeaf,
+                     "recreation", "bilibili"},
+    ProjectClassRule{kProjectClassRecreationDouyin, Match::kRootAndLeaf,
+                     "recreation", "douyin"},
+    ProjectClassRule{kProjectClassGaming, Match::kRoot, "recreation_game", ""},
+    ProjectClassRule{kProjectClassToilet, Match::kRoot, "routine_toilet", ""},
+    ProjectClassRule{kProjectClassGrooming, Match::kRootAndSegment, "routine",
+                     "grooming"},
+    ProjectClassRule{kProjectClassGrooming, Match::kRootAndSegment, "routine",
+                     "body-hygiene"},
+    ProjectClassRule{kProjectClassGrooming, Match::kRootAndSegment, "routine",
+                     "personal-hygiene"},
+    ProjectClassRule{kProjectClassGrooming, Match::kRootAndSegment, "routine",
+                     "oral-hygiene"},
+};
+
+// [[project_classes]] 中的分类名与匹配方式。
+constexpr std::array<std::pair<std::string_view, std::uint32_t>, 13>
+    kClassNames = {{
+        {"study", kProjectClassStudy},
+        {"exercise", kProjectClassExercise},
+        {"cardio", kProjectClassCardio},
+        {"anaerobic", kProjectClassAnaerobic},
+        {"sleep_night", kProjectClassSleepNight},
+        {"sleep_day", kProjectClassSleepDay},
+        {"recreation", kProjectClassRecreation},
+        {"recreation_zhihu", kProjectClassRecreationZhihu},
+        {"recreation_bilibili", kProjectClassRecreationBilibili},
+        {"recreation_douyin", kProjectClassRecreationDouyin},
+        {"gaming", kProjectClassGaming},
+        {"toilet", kProjectClassToilet},
+        {"grooming", kProjectClassGrooming},
+    }};
+
+constexpr std::array<std::pair<std::string_view, Match>, 4> kMatchNames = {{
+    {"exact", Match::kExact},
+    {"root", Match::kRoot},
+    {"root_and_leaf", Match::kRootAndLeaf},
+    {"root_and_segment", Match::kRootAndSegment},
+}};
+
+// 安装过的规则集只追加不释放：规则中的 string_view 指向 texts，调用方
+// 取得的 span 因此不会悬空。安装只发生在启动期，累积量可以忽略。
+struct InstalledRuleSet {
+  std::deque<std::string> texts;
+  std::vector<ProjectClassRule> rules;
+};
+
+struct RuleRegistry {
+  std::mutex mutex;
+  std::deque<InstalledRuleSet> installed;
+  // 为空时使用内置表。
+  std::atomic<const InstalledRuleSet*> active{nullptr};
+};
+
+auto Rules() -> RuleRegistry& {
+  static RuleRegistry registry;
+  return registry;
+}
+
+template <typename Value, std::size_t kSize>
+auto LookupName(
+    const std::array<std::pair<std::string_view, Value>, kSize>& names,
+    std::string_view name, std::string_view field) -> Value {
+  const auto kIt = std::ranges::find(
+      names, name, &std::pair<std::string_view, Value>::first);
+  if (kIt == names.end()) {
+    throw std::runtime_error(std::format(
+        "Invalid converter config: unknown {} '{}' in 'project_classes'.",
+        field, name));
+  }
+  return kIt->second;
+}
+
+auto BuildRuleSet(std::span<const ProjectClassRuleConfig> configs)
+    -> InstalledRuleSet {
+  InstalledRuleSet rule_set;
+  for (const ProjectClassRuleConfig& config : configs) {
+    const std::uint32_t kMask =
+        LookupName(kClassNames, config.project_class, "class");
+    const Match kMatch = LookupName(kMatchNames, config.match, "match");
+    const bool kTakesToken =
+        kMatch == Match::kRootAndLeaf || kMatch == Match::kRootAndSegment;
+    if (config.root.empty() || kTakesToken == config.token.empty()) {
+      throw std::runtime_error(std::format(
+          "Invalid converter config: project class '{}' with match '{}' "
+          "needs a non-empty root and {}.",
+          config.project_class, config.match,
+          kTakesToken ? "a non-empty token" : "no token"));
+    }
+    // token 按一个路径段匹配；含 '_' 时 PathLeaf 与 SQL 的 GLOB '*_token'
+    // 会给出不同结果，直接拒绝。
+    if (config.token.contains('_')) {
+      throw std::runtime_error(std::format(
+          "Invalid converter config: project class '{}' token '{}' must be a "
+          "single path segment without '_'.",
+          config.project_class, config.token));
+    }
+    const std::string& root = rule_set.texts.emplace_back(config.root);
+    const std::string& token = rule_set.texts.emplace_back(config.token);
+    rule_set.rules.push_back(ProjectClassRule{kMask, kMatch, root, token});
+  }
+  return rule_set;
+}
+
+auto PathHasRoot(std::string_view path, std::string_view root) -> bool {
+  return path == root || (path.size() > root.size() &&
+                          path.starts_with(root) && path[root.size()] == '_');
+}
+
+auto PathLeaf(std::string_view path) -> std::string_view {
+  const std::size_t kSeparator = path.rfind('_');
+  return kSeparator == std::string_view::npos ? path
+                                              : path.substr(kSeparator + 1);
+}
+
+auto PathHasSegment(std::string_view path, std::string_view segment) -> bool {
+  std::size_t start = 0;
+  while (true) {
+    const std::size_t kSeparator = path.find('_', start);
+    if (path.substr(start, kSeparator == std::string_view::npos
+                               ? std::string_view::npos
+                               : kSeparator - start) == segment) {
+      return true;
+    }
+    if (kSeparator == std::string_view::npos) {
+      return false;
+    }
+    start = kSeparator + 1;
+  }
+}
+
+auto RuleMatches(const ProjectClassRule& rule, std::string_view path)
+    -> bool {
+  switch (rule.match) {
+    case Match::kExact:
+      return path == rule.root;
+    case Match::kRoot:
+      return PathHasRoot(path, rule.root);
+    case Match::kRootAndLeaf:
+      return PathHasRoot(path, rule.root) && PathLeaf(path) == rule.token;
+    case Match::kRootAndSegment:
+      return PathHasRoot(path, rule.root) && PathHasSegment(path, rule.token);
+  }
+  return false;
+}
+
+// 规则文本作为 GLOB 模式的字面量：元字符放进字符类，单引号按 SQL 转义。
+auto GlobLiteral(std::string_view text) -> std::string {
+  std::string literal;
+  literal.reserve(text.size());
+  for (const char kChar : text) {
+    switch (kChar) {
+      case '*':
+      case '?':
+      case '[':
+        literal += '[';
+        literal += kChar;
+        literal += ']';
+        break;
+      case '\'':
+        literal += "''";
+        break;
+      default:
+        literal += kChar;
+    }
+  }
+  return literal;
+}
+
+auto RuleSql(const ProjectClassRule& rule, std::string_view column)
+    -> std::string {
+  const std::string kRoot = GlobLiteral(rule.root);
+  const std::string kToken = GlobLiteral(rule.token);
+  const std::string kExact = std::format("{} = '{}'", column, kRoot);
+  const std::string kDescendant = std::format("{} GLOB '{}_*'", column, kRoot);
+  switch (rule.match) {
+    case Match::kExact:
+      return kExact;
+    case Match::kRoot:
+      return std::format("({} OR {})", kExact, kDescendant);
+    case Match::kRootAndLeaf: {
+      std::string sql = std::format("({} AND {} GLOB '*_{}')", kDescendant,
+                                    column, kToken);
+      if (PathLeaf(rule.root) == rule.token) {
+        sql = std::format("({} OR {})", kExact, sql);
+      }
+      return sql;
+    }
+    case Match::kRootAndSegment:
+      return std::format("(({} OR {}) AND ('_' || {} || '_') GLOB '*_{}_*')",
+                         kExact, kDescendant, column, kToken);
+  }
+  return "0";
+}
+
+}  // namespace
+
+auto DefaultProjectClassRules() -> std::span<const ProjectClassRule> {
+  return kDefaultRules;
+}
+
+auto ActiveProjectClassRules() -> std::span<const ProjectClassRule> {
+  const InstalledRuleSet* installed = Rules().active.load();
+  if (installed == nullptr) {
+    return DefaultProjectClassRules();
+  }
+  return installed->rules;
+}
+
+auto InstallProjectClassRules(std::span<const ProjectClassRuleConfig> rules)
+    -> void {
+  InstalledRuleSet rule_set = BuildRuleSet(rules);
+  const std::string kFingerprint = ProjectClassRulesFingerprint(
+      rule_set.rules.empty() ? DefaultProjectClassRules() : rule_set.rules);
+
+  auto& registry = Rules();
+  std::scoped_lock lock(registry.mutex);
+  if (kFingerprint == ProjectClassRulesFingerprint(ActiveProjectClassRules())) {
+    return;
+  }
+  if (rule_set.rules.empty()) {
+    registry.active.store(nullptr);
+  } else {
+    // 容器移动不搬动元素，rules 中的 string_view 仍指向有效文本。
+    registry.installed.push_back(std::move(rule_set));
+    registry.active.store(&registry.installed.back());
+  }
+  BumpProjectDictionaryGeneration();
+}
+
+auto ProjectClassRulesFingerprint(std::span<const ProjectClassRule> rules)
+    -> std::string {
+  std::string fingerprint;
+  for (const ProjectClassRule& rule : rules) {
+    // 文本带长度前缀，root/token 中出现分隔符也不会产生歧义。
+    fingerprint += std::format("{}/{}/{}:{}/{}:{};", rule.mask,
+                               std::to_underlying(rule.match),
+                               rule.root.size(), rule.root, rule.token.size(),
+                               rule.token);
+  }
+  return fingerprint;
+}
+
+auto DayFlagRollupMatchesRules(sqlite3* sqlite_db) -> bool {
+  namespace meta = schema::rollup_meta::db;
+  const std::string kSql =
+      std::format("SELECT {} FROM {} WHERE {} = ?1;", meta::kValue,
+                  meta::kTable, meta::kKey);
+  sqlite3_stmt* stmt = nullptr;
+  // 旧库没有 rollup_meta，准备失败即视为不一致。
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    return false;
+  }
+  sqlite3_bind_text(stmt, 1, meta::kProjectClassRulesKey.data(),
+                    static_cast<int>(meta::kProjectClassRulesKey.size()),
+                    SQLITE_STATIC);
+  bool matches = false;
+  if (sqlite3_step(stmt) == SQLITE_ROW) {
+    const auto* text =
+        reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+    const int kBytes = sqlite3_column_bytes(stmt, 0);
+    matches = text != nullptr &&
+              std::string_view(text, static_cast<std::size_t>(kBytes)) ==
+                  ProjectClassRulesFingerprint();
+  }
+  sqlite3_finalize(stmt);
+  return matches;
+}
+
+auto ClassifyProjectPath(std::string_view project_path,
+                         std::span<const ProjectClassRule> rules)
+    -> std::uint32_t {
+  std::uint32_t mask = 0;
+  if (project_path.empty()) {
+    return mask;
+  }
+  for (const ProjectClassRule& rule : rules) {
+    if ((mask & rule.mask) != rule.mask && RuleMatches(rule, project_path)) {
+      mask |= rule.mask;
+    }
+  }
+  return mask;
+}
+
+auto ProjectClassPathSql(std::uint32_t mask, std::string_view path_column,
+                         std::span<const ProjectClassRule> rules)
+    -> std::string {
+  std::string sql;
+  for (const ProjectClassRule& rule : rules) {
+    if ((rule.mask & mask) == 0U) {
+      continue;
+    }
+    sql += sql.empty() ? "(" : " OR ";
+    sql += RuleSql(rule, path_column);
+  }
+  return sql.empty() ? "0" : sql + ")";
+}
+
+auto ProjectDictionary::Load(sqlite3* sqlite_db)
+    -> std::shared_ptr<const ProjectDictionary> {
+  auto dictionary = std::make_shared<ProjectDictionary>();
+  if (sqlite_db == nullptr) {
+    modports::EmitError("Failed to load projects: database handle is null.");
+    return dictionary;
+  }
+
+  const std::string kSql = std::format(
+      "SELECT {0}, {1}, {2} FROM {3}", schema::projects::db::kId,
+      schema::projects::db::kName, schema::projects::db::kParentId,
+      schema::projects::db::kTable);
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    modports::EmitError("Failed to load projects: " +
+                        std::string(sqlite3_errmsg(sqlite_db)));
+    sqlite3_finalize(stmt);
+    return dictionary;
+  }
+
+  auto& entries = dictionary->entries_;
+  std::unordered_map<std::int64_t, std::uint32_t> positions;
+  std::int64_t max_id = 0;
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    Entry entry;
+    entry.id = sqlite3_column_int64(stmt, 0);
+    const unsigned char* name_text = sqlite3_column_text(stmt, 1);
+    entry.name =
+        (name_text != nullptr) ? reinterpret_cast<const char*>(name_text) : "";
+    if (sqlite3_column_type(stmt, 2) != SQLITE_NULL) {
+      entry.parent_id = sqlite3_column_int64(stmt, 2);
+    }
+    max_id = std::max(max_id, entry.id);
+    positions.emplace(entry.id, static_cast<std::uint32_t>(entries.size()));
+    entries.push_back(std::move(entry));
+  }
+  sqlite3_finalize(stmt);
+
+  // 与逐级回溯的语义一致：父项目缺失（或成环）处即为路径起点。
+  for (auto& entry : entries) {
+    std::vector<const Entry*> chain;
+    std::int64_t current = entry.id;
+    while (current != 0 && chain.size() <= entries.size()) {
+      const auto kIt = positions.find(current);
+      if (kIt == positions.end()) {
+        break;
+      }
+      const Entry& node = entries[kIt->second];
+      chain.push_back(&node);
+      current = node.parent_id;
+    }
+    std::ranges::reverse(chain);
+    entry.path_parts.reserve(chain.size());
+    for (const Entry* node : chain) {
+      if (!entry.path_parts.empty()) {
+        entry.full_path += '_';
+      }
+      entry.full_path += node->name;
+      entry.path_parts.push_back(node->name);
+    }
+    entry.root_id = chain.empty() ? entry.id : chain.front()->id;
+    entry.depth = chain.empty() ? 0 : static_cast<int>(chain.size()) - 1;
+    entry.class_mask = ClassifyProjectPath(entry.full_path);
+  }
+
+  const auto kMaxId = static_cast<std::size_t>(max_id);
+  if (max_id >= 0 &&
+      kMaxId <= (entries.size() * kDenseIndexFactor) + kDenseIndexSlack) {
+    dictionary->dense_index_.assign(kMaxId + 1, kNoEntry);
+    for (const auto& [id, position] : positions) {
+      if (id >= 0) {
+        dictionary->dense_index_[static_cast<std::size_t>(id)] = position;
+      } else {
+        dictionary->sparse_index_.emplace(id, position);
+      }
+    }
+  } else {
+    dictionary->sparse_index_ = std::move(positions);
+  }
+  dictionary->loaded_ = true;
+  return dictionary;
+}
+
+auto ProjectDictionary::Find(std::int64_t project_id) const -> const Entry* {
+  if (project_id >= 0 &&
+      static_cast<std::size_t>(project_id) < dense_index_.size()) {
+    const std::uint32_t kPosition =
+        dense_index_[static_cast<std::size_t>(project_id)];
+    return kPosition == kNoEntry ? nullptr : &entries_[kPosition];
+  }
+  const auto kIt = sparse_index_.find(project_id);
+  return kIt == sparse_index_.end() ? nullptr : &entries_[kIt->second];
+}
+
+auto ProjectDictionary::Size() const -> std::size_t {
+  return entries_.size();
+}
+
+auto ProjectDictionary::Loaded() const -> bool {
+  return loaded_;
+}
+
+auto DatabaseSnapshotKey::Read(sqlite3* sqlite_db)
+    -> std::optional<DatabaseSnapshotKey> {
+  const char* db_file =
+      sqlite_db != nullptr ? sqlite3_db_filename(sqlite_db, "main") : nullptr;
+  if (db_file == nullptr || *db_file == '\0') {
+    return std::nullopt;
+  }
+  // 先读代次与版本再加载：加载期间若有提交，键已过时，下一位读者会重载。
+  const std::uint64_t kGeneration = Generation().load();
+  const auto kChangeCounter = ReadChangeCounter(sqlite_db);
+  const auto kDataVersion = ReadDataVersion(sqlite_db);
+  if (!kChangeCounter.has_value() || !kDataVersion.has_value()) {
+    return std::nullopt;
+  }
+  DatabaseSnapshotKey key;
+  key.generation_ = kGeneration;
+  key.db_file_ = db_file;
+  key.change_counter_ = *kChangeCounter;
+  key.witnesses_.emplace_back(ConnectionIdentity(sqlite_db), *kDataVersion);
+  return key;
+}
+
+auto DatabaseSnapshotKey::Admits(const DatabaseSnapshotKey& current) -> bool {
+  if (current.witnesses_.empty() || generation_ != current.generation_ ||
+      change_counter_ != current.change_counter_ ||
+      db_file_ != current.db_file_) {
+    return false;
+  }
+  const auto& [connection_id, data_version] = current.witnesses_.front();
+  const auto kIt =
+      std::ranges::find(witnesses_, connection_id,
+                        &std::pair<std::uint64_t, std::int64_t>::first);
+  if (kIt != witnesses_.end()) {
+    return kIt->second == data_version;
+  }
+  if (witnesses_.size() >= kMaxSnapshotWitnesses) {
+    witnesses_.erase(witnesses_.begin());
+  }
+  witnesses_.emplace_back(connection_id, data_version);
+  return true;
+}
+
+auto AcquireProjectDictionary(sqlite3* sqlite_db)
+    -> std::shared_ptr<const ProjectDictionary> {
+  auto key = DatabaseSnapshotKey::Read(sqlite_db);
+  if (!key.has_value()) {
+    return ProjectDictionary::Load(sqlite_db);
+  }
+
+  auto& slot = Published();
+  {
+    std::scoped_lock lock(slot.mutex);
+    if (slot.current.dictionary && slot.current.key.Admits(*key)) {
+      return slot.current.dictionary;
+    }
+  }
+
+  auto dictionary = ProjectDictionary::Load(sqlite_db);
+  if (!dictionary->Loaded()) {
+    return dictionary;
+  }
+  std::scoped_lock lock(slot.mutex);
+  slot.current =
+      PublishedDictionary{.key = std::move(*key), .dictionary = dictionary};
+  return dictionary;
+}
+
+auto BumpProjectDictionaryGeneration() -> void {
+  Generation().fetch_add(1);
+}
+
+auto ReleaseSnapshotConnection(sqlite3* sqlite_db) -> void {
+  auto& identities = Identities();
+  std::scoped_lock lock(identities.mutex);
+  identities.ids.erase(sqlite_db);
+}
+
+}  // namespace tracer::core::infrastructure::persistence
@@ -0,0 +1,217 @@
+// infra/persistence/sqlite/project_dictionary.hpp
+#ifndef INFRASTRUCTURE_PERSISTENCE_SQLITE_PROJECT_DICTIONARY_H_
+#define INFRASTRUCTURE_PERSISTENCE_SQLITE_PROJECT_DICTIONARY_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "domain/types/converter_config.hpp"
+#include "infra/sqlite_fwd.hpp"
+
+namespace tracer::core::infrastructure::persistence {
+
+// 项目分类位。字典加载时按分类规则为每个项目算好掩码，报表与快照
+// 按 id 取掩码做位运算，不再逐条记录比较路径字符串。
+enum ProjectClass : std::uint32_t {
+  kProjectClassStudy = 1U << 0U,
+  kProjectClassExercise = 1U << 1U,
+  kProjectClassCardio = 1U << 2U,
+  kProjectClassAnaerobic = 1U << 3U,
+  kProjectClassSleepNight = 1U << 4U,
+  kProjectClassSleepDay = 1U << 5U,
+  kProjectClassRecreation = 1U << 6U,
+  kProjectClassRecreationZhihu = 1U << 7U,
+  kProjectClassRecreationBilibili = 1U << 8U,
+  kProjectClassRecreationDouyin = 1U << 9U,
+  kProjectClassGaming = 1U << 10U,
+  kProjectClassToilet = 1U << 11U,
+  kProjectClassGrooming = 1U << 12U,
+};
+
+/**
+ * @brief 一条分类规则：路径满足匹配条件时并入 mask。
+ *
+ * 路径以 '_' 分段；"以根开头" 指路径等于 root 或以 "root_" 开头。
+ * kRootAndLeaf / kRootAndSegment 额外要求末段 / 任一段等于 token。
+ */
+struct ProjectClassRule {
+  enum class Match : std::uint8_t {
+    kExact,
+    kRoot,
+    kRootAndLeaf,
+    kRootAndSegment,
+  };
+
+  std::uint32_t mask = 0;
+  Match match = Match::kRoot;
+  std::string_view root;
+  std::string_view token;
+};
+
+// 内置分类规则表；converter 配置未给出 [[project_classes]] 时使用。
+[[nodiscard]] auto DefaultProjectClassRules()
+    -> std::span<const ProjectClassRule>;
+
+// 当前生效的分类规则表，所有按项目路径分类的地方共用这一份。
+[[nodiscard]] auto ActiveProjectClassRules()
+    -> std::span<const ProjectClassRule>;
+
+/**
+ * @brief 安装 converter 配置中的分类规则，替换当前生效的规则表。
+ *
+ * 分类名取 ProjectClass 去掉前缀的小写形式（如 "recreation_zhihu"），
+ * 匹配方式为 exact / root / root_and_leaf / root_and_segment。rules 为空时
+ * 恢复内置表。规则与当前相同时什么都不做，否则使已发布的字典与快照
+ * 失效。名称无法识别时抛出 std::runtime_error，当前规则保持不变。
+ * 之前取得的 ActiveProjectClassRules() 在进程内始终有效。
+ */
+auto InstallProjectClassRules(std::span<const ProjectClassRuleConfig> rules)
+    -> void;
+
+// 规则表的文本指纹；day_flag_rollup 记录生成时的指纹，规则变化后
+// 读取方不再使用旧汇总，导入器重建它。
+[[nodiscard]] auto ProjectClassRulesFingerprint(
+    std::span<const ProjectClassRule> rules = ActiveProjectClassRules())
+    -> std::string;
+
+// 数据库 rollup_meta 中记录的规则指纹是否与当前生效的规则一致；
+// 缺表或缺记录（旧库）时为 false。
+[[nodiscard]] auto DayFlagRollupMatchesRules(sqlite3* sqlite_db) -> bool;
+
+// 按规则表计算路径的分类掩码；空路径得到 0。
+[[nodiscard]] auto ClassifyProjectPath(
+    std::string_view project_path,
+    std::span<const ProjectClassRule> rules = ActiveProjectClassRules())
+    -> std::uint32_t;
+
+/**
+ * @brief 生成与 ClassifyProjectPath 等价的 SQL 布尔表达式。
+ *
+ * path_column 命中 mask 中任一类别的规则时为真；用 GLOB 保持与 C++ 判定
+ * 一致的大小写敏感。导入期汇总与无汇总表时的报表回退都由它生成，
+ * 两条路径的按日标记因此出自同一份规则。
+ */
+[[nodiscard]] auto ProjectClassPathSql(
+    std::uint32_t mask, std::string_view path_column,
+    std::span<const ProjectClassRule> rules = ActiveProjectClassRules())
+    -> std::string;
+
+// day_flag_rollup 的 study/exercise/cardio/anaerobic 列对应的分类，按列序。
+inline constexpr std::array<std::uint32_t, 4> kDayFlagClasses = {
+    kProjectClassStudy, kProjectClassExercise, kProjectClassCardio,
+    kProjectClassAnaerobic};
+
+/**
+ * @brief `projects` 表的不可变快照。
+ *
+ * 加载时一次性算出每个项目的完整路径（以 '_' 连接）、路径分段、深度、
+ * 根项目、父项目与分类掩码，查询时不再逐级回溯。id 连续时按 id 直接
+ * 下标访问，过于稀疏时退化为哈希索引。
+ */
+class ProjectDictionary {
+ public:
+  struct Entry {
+    std::int64_t id = 0;
+    std::int64_t parent_id = 0;
+    std::int64_t root_id = 0;
+    int depth = 0;
+    std::string name;
+    std::string full_path;
+    std::vector<std::string> path_parts;
+    // ProjectClass 位的组合，按加载时生效的分类规则计算。
+    std::uint32_t class_mask = 0;
+  };
+
+  // 读取失败时返回 Loaded() 为 false 的空字典（错误已上报诊断）。
+  [[nodiscard]] static auto Load(sqlite3* sqlite_db)
+      -> std::shared_ptr<const ProjectDictionary>;
+
+  // 未知 id 返回 nullptr。
+  [[nodiscard]] auto Find(std::int64_t project_id) const -> const Entry*;
+  [[nodiscard]] auto Size() const -> std::size_t;
+  [[nodiscard]] auto Loaded() const -> bool;
+
+ private:
+  static constexpr std::uint32_t kNoEntry = UINT32_MAX;
+
+  std::vector<Entry> entries_;
+  std::vector<std::uint32_t> dense_index_;
+  std::unordered_map<std::int64_t, std::uint32_t> sparse_index_;
+  bool loaded_ = false;
+};
+
+/**
+ * @brief 取得进程内共享的项目字典快照。
+ *
+ * 同一数据库文件在 DatabaseSnapshotKey 不变期间只加载一次，并发读者
+ * 共享同一份不可变快照；内存库或临时库每次单独加载。
+ */
+[[nodiscard]] auto AcquireProjectDictionary(sqlite3* sqlite_db)
+    -> std::shared_ptr<const ProjectDictionary>;
+
+// 导入提交后调用，使已发布的项目字典与记录快照失效。
+auto BumpProjectDictionaryGeneration() -> void;
+
+// 关闭连接前调用，回收它在快照见证表中的身份；之后在同一地址上打开的
+// 连接会分到新身份，不会继承旧连接记下的 data_version。
+auto ReleaseSnapshotConnection(sqlite3* sqlite_db) -> void;
+
+/**
+ * @brief 进程内共享快照的有效性键。
+ *
+ * 由导入代次、数据库文件、文件头变更计数与读取连接的 data_version
+ * 组成。回滚日志模式下任何连接（含其他进程）提交都会推进变更计数；
+ * WAL 模式下变更计数不随提交前进，改由见证过该快照的连接的
+ * data_version 发现外部提交。见证者按进程内单调递增的连接身份记录，
+ * 而不是 sqlite3* 地址：地址在连接关闭后可能被新连接复用。
+ */
+class DatabaseSnapshotKey {
+ public:
+  // 读取 sqlite_db 当前的键；内存库、临时库或读取失败时返回空。
+  [[nodiscard]] static auto Read(sqlite3* sqlite_db)
+      -> std::optional<DatabaseSnapshotKey>;
+
+  // 以本键发布的快照对 current 所在连接是否仍然有效；首次出现的连接
+  // 记为见证者，之后它的 data_version 一旦变化即判为失效。
+  [[nodiscard]] auto Admits(const DatabaseSnapshotKey& current) -> bool;
+
+ private:
+  std::uint64_t generation_ = 0;
+  std::string db_file_;
+  std::uint32_t change_counter_ = 0;
+  std::vector<std::pair<std::uint64_t, std::int64_t>> witnesses_;
+};
+
+}  // namespace tracer::core::infrastructure::persistence
+
+namespace infrastructure::persistence {
+
+using tracer::core::infrastructure::persistence::AcquireProjectDictionary;
+using tracer::core::infrastructure::persistence::ActiveProjectClassRules;
+using tracer::core::infrastructure::persistence::
+    BumpProjectDictionaryGeneration;
+using tracer::core::infrastructure::persistence::ClassifyProjectPath;
+using tracer::core::infrastructure::persistence::DatabaseSnapshotKey;
+using tracer::core::infrastructure::persistence::DayFlagRollupMatchesRules;
+using tracer::core::infrastructure::persistence::DefaultProjectClassRules;
+using tracer::core::infrastructure::persistence::InstallProjectClassRules;
+using tracer::core::infrastructure::persistence::kDayFlagClasses;
+using tracer::core::infrastructure::persistence::ProjectClass;
+using tracer::core::infrastructure::persistence::ProjectClassPathSql;
+using tracer::core::infrastructure::persistence::ProjectClassRule;
+using tracer::core::infrastructure::persistence::ProjectClassRulesFingerprint;
+using tracer::core::infrastructure::persistence::ProjectDictionary;
+using tracer::core::infrastructure::persistence::ReleaseSnapshotConnection;
+
+}  // namespace infrastructure::persistence
+
+#endif  // INFRASTRUCTURE_PERSISTENCE_SQLITE_PROJECT_DICTIONARY_H_
@@ -0,0 +1,348 @@
+// infra/persistence/sqlite/record_column_snapshot.cpp
+#include "infra/persistence/sqlite/record_column_snapshot.hpp"
+
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "infra/persistence/sqlite/project_dictionary.hpp"
+#include "infra/schema/sqlite_schema.hpp"
+#include "shared/utils/civil_time.hpp"
+
+namespace tracer::core::infrastructure::persistence {
+namespace {
+
+namespace civil_time = tracer::core::shared::civil_time;
+namespace records = schema::time_records::db;
+
+// 与项目字典相同的稠密度要求：分组数组按最大 id 分配，不能过于稀疏。
+constexpr std::size_t kDenseIdSlack = 1024;
+constexpr std::size_t kDenseIdFactor = 4;
+
+struct PublishedSnapshot {
+  DatabaseSnapshotKey key;
+  std::shared_ptr<const RecordColumnSnapshot> snapshot;
+};
+
+struct PublishedSlot {
+  std::mutex mutex;
+  PublishedSnapshot current;
+};
+
+auto Published() -> PublishedSlot& {
+  static PublishedSlot slot;
+  return slot;
+}
+
+auto FitsInt32(std::int64_t value) -> bool {
+  return value >= std::numeric_limits<std::int32_t>::min() &&
+         value <= std::numeric_limits<std::int32_t>::max();
+}
+
+auto PathHasRoot(std::string_view path, std::string_view root) -> bool {
+  return path == root || (path.size() > root.size() &&
+                          path.starts_with(root) && path[root.size()] == '_');
+}
+
+constexpr std::uint32_t kRecordFlagMask =
+    kProjectClassStudy | kProjectClassExercise | kProjectClassCardio |
+    kProjectClassAnaerobic;
+static_assert(
+    std::uint32_t{RecordColumnSnapshot::kStudyFlag} == kProjectClassStudy &&
+    std::uint32_t{RecordColumnSnapshot::kExerciseFlag} ==
+        kProjectClassExercise &&
+    std::uint32_t{RecordColumnSnapshot::kCardioFlag} == kProjectClassCardio &&
+    std::uint32_t{RecordColumnSnapshot::kAnaerobicFlag} ==
+        kProjectClassAnaerobic);
+
+auto ClassifyPath(std::string_view path) -> std::uint8_t {
+  return static_cast<std::uint8_t>(ClassifyProjectPath(path) &
+                                   kRecordFlagMask);
+}
+
+auto ToSize(std::int32_t value) -> std::size_t {
+  return static_cast<std::size_t>(value);
+}
+
+// 读取 days 表的全部日期；任一日期无法解析时返回 false。
+auto LoadCalendarDays(sqlite3* sqlite_db, std::vector<std::int32_t>& days)
+    -> bool {
+  const std::string kSql =
+      std::format("SELECT {0} FROM {1} ORDER BY {0}", schema::day::db::kDate,
+                  schema::day::db::kTable);
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    return false;
+  }
+  bool valid = true;
+  int step_result = SQLITE_ROW;
+  while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+    const auto* date_text =
+        reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+    const auto kDate = date_text != nullptr
+                           ? civil_time::ParseIsoDate(date_text)
+                           : std::optional<civil_time::CivilDate>{};
+    if (!kDate.has_value()) {
+      valid = false;
+      break;
+    }
+    days.push_back(
+        static_cast<std::int32_t>(civil_time::DaysFromCivil(*kDate)));
+  }
+  sqlite3_finalize(stmt);
+  return valid && step_result == SQLITE_DONE;
+}
+
+}  // namespace
+
+auto RecordColumnSnapshot::Load(sqlite3* sqlite_db)
+    -> std::shared_ptr<const RecordColumnSnapshot> {
+  auto snapshot = std::make_shared<RecordColumnSnapshot>();
+  if (sqlite_db == nullptr) {
+    return snapshot;
+  }
+
+  // 旧库没有 project_path_snapshot 列时准备失败，直接交回 SQL 路径处理。
+  const std::string kSql = std::format(
+      "SELECT {0}, {1}, {2}, {3} FROM {4} ORDER BY {0}", records::kDate,
+      records::kProjectId, records::kDuration, records::kProjectPathSnapshot,
+      records::kTable);
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    return snapshot;
+  }
+
+  std::unordered_map<std::string, std::int32_t> path_ids;
+  std::vector<std::uint8_t> path_flags;
+  std::string last_date;
+  std::int32_t last_day = 0;
+  std::int64_t max_project_id = 0;
+  bool valid = true;
+  int step_result = SQLITE_ROW;
+  while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+    const auto* date_text =
+        reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+    const std::int64_t kProjectId = sqlite3_column_int64(stmt, 1);
+    const std::int64_t kDuration = sqlite3_column_int64(stmt, 2);
+    if (date_text == nullptr || kProjectId < 0 || !FitsInt32(kProjectId) ||
+        !FitsInt32(kDuration)) {
+      valid = false;
+      break;
+    }
+
+    // 同一天的行连续出现，只在日期变化时重新解析。
+    if (last_date.empty() || last_date != date_text) {
+      const auto kDate = civil_time::ParseIsoDate(date_text);
+      if (!kDate.has_value()) {
+        valid = false;
+        break;
+      }
+      last_date = date_text;
+      last_day = static_cast<std::int32_t>(civil_time::DaysFromCivil(*kDate));
+    }
+
+    const auto* path_text =
+        reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+    std::string path = path_text != nullptr ? path_text : "";
+    auto [path_it, inserted] = path_ids.try_emplace(
+        std::move(path), static_cast<std::int32_t>(snapshot->paths_.size()));
+    if (inserted) {
+      snapshot->paths_.push_back(path_it->first);
+      path_flags.push_back(ClassifyPath(path_it->first));
+    }
+
+    max_project_id = std::max(max_project_id, kProjectId);
+    snapshot->days_.push_back(last_day);
+    snapshot->project_ids_.push_back(static_cast<std::int32_t>(kProjectId));
+    snapshot->durations_.push_back(static_cast<std::int32_t>(kDuration));
+    snapshot->path_ids_.push_back(path_it->second);
+    snapshot->flags_.push_back(path_flags[ToSize(path_it->second)]);
+  }
+  sqlite3_finalize(stmt);
+
+  const auto kMaxProjectId = static_cast<std::size_t>(max_project_id);
+  if (!valid || step_result != SQLITE_DONE ||
+      kMaxProjectId > (snapshot->Size() * kDenseIdFactor) + kDenseIdSlack ||
+      !LoadCalendarDays(sqlite_db, snapshot->calendar_days_)) {
+    return std::make_shared<RecordColumnSnapshot>();
+  }
+  snapshot->max_project_id_ = static_cast<std::int32_t>(max_project_id);
+  snapshot->loaded_ = true;
+  return snapshot;
+}
+
+auto RecordColumnSnapshot::Loaded() const -> bool {
+  return loaded_;
+}
+
+auto RecordColumnSnapshot::Size() const -> std::size_t {
+  return days_.size();
+}
+
+auto RecordColumnSnapshot::Days() const -> std::span<const std::int32_t> {
+  return days_;
+}
+
+auto RecordColumnSnapshot::CalendarDays() const
+    -> std::span<const std::int32_t> {
+  return calendar_days_;
+}
+
+auto RecordColumnSnapshot::ProjectIds() const
+    -> std::span<const std::int32_t> {
+  return project_ids_;
+}
+
+auto RecordColumnSnapshot::Durations() const
+    -> std::span<const std::int32_t> {
+  return durations_;
+}
+
+auto RecordColumnSnapshot::PathIds() const -> std::span<const std::int32_t> {
+  return path_ids_;
+}
+
+auto RecordColumnSnapshot::Flags() const -> std::span<const std::uint8_t> {
+  return flags_;
+}
+
+auto RecordColumnSnapshot::Paths() const -> const std::vector<std::string>& {
+  return paths_;
+}
+
+auto RecordColumnSnapshot::MaxProjectId() const -> std::int32_t {
+  return max_project_id_;
+}
+
+auto RecordColumnSnapshot::RowsInDays(std::int32_t first_day,
+                                      std::int32_t last_day) const
+    -> RowRange {
+  if (first_day > last_day) {
+    return {};
+  }
+  const auto kBegin = std::ranges::lower_bound(days_, first_day);
+  const auto kEnd = std::upper_bound(kBegin, days_.end(), last_day);
+  return {.begin = static_cast<std::size_t>(kBegin - days_.begin()),
+          .end = static_cast<std::size_t>(kEnd - days_.begin())};
+}
+
+auto RecordColumnSnapshot::MatchRootPaths(std::string_view root) const
+    -> std::vector<std::uint8_t> {
+  std::vector<std::uint8_t> mask(paths_.size(), 0);
+  for (std::size_t index = 0; index < paths_.size(); ++index) {
+    mask[index] = PathHasRoot(paths_[index], root) ? 1U : 0U;
+  }
+  return mask;
+}
+
+auto RecordColumnSnapshot::SumDurations(RowRange rows) const -> std::int64_t {
+  const std::int32_t* durations = durations_.data();
+  std::int64_t total = 0;
+  for (std::size_t index = rows.begin; index < rows.end; ++index) {
+    total += durations[index];
+  }
+  return total;
+}
+
+auto RecordColumnSnapshot::SumByProject(RowRange rows) const
+    -> GroupTotals {
+  return GroupByKey(project_ids_.data(), 0, ToSize(max_project_id_) + 1, rows,
+                    {});
+}
+
+auto RecordColumnSnapshot::SumByPath(RowRange rows,
+                                     std::span<const std::uint8_t> path_mask)
+    const -> GroupTotals {
+  return GroupByKey(path_ids_.data(), 0, paths_.size(), rows, path_mask);
+}
+
+auto RecordColumnSnapshot::SumByDay(RowRange rows, std::int32_t first_day,
+                                    std::size_t day_count,
+                                    std::span<const std::uint8_t> path_mask)
+    const -> GroupTotals {
+  return GroupByKey(days_.data(), first_day, day_count, rows, path_mask);
+}
+
+auto RecordColumnSnapshot::GroupByKey(const std::int32_t* keys,
+                                      std::int32_t key_base,
+                                      std::size_t key_count, RowRange rows,
+                                      std::span<const std::uint8_t> path_mask)
+    const -> GroupTotals {
+  GroupTotals totals{.durations = std::vector<std::int64_t>(key_count, 0),
+                     .row_counts = std::vector<std::int32_t>(key_count, 0)};
+  const std::int32_t* durations = durations_.data();
+  std::int64_t* out_durations = totals.durations.data();
+  std::int32_t* out_counts = totals.row_counts.data();
+  if (path_mask.empty()) {
+    for (std::size_t index = rows.begin; index < rows.end; ++index) {
+      const std::size_t kSlot = ToSize(keys[index] - key_base);
+      out_durations[kSlot] += durations[index];
+      ++out_counts[kSlot];
+    }
+    return totals;
+  }
+  // 掩码乘到时长与计数上，代替逐行分支。
+  const std::int32_t* path_ids = path_ids_.data();
+  const std::uint8_t* mask = path_mask.data();
+  for (std::size_t index = rows.begin; index < rows.end; ++index) {
+    const std::size_t kSlot = ToSize(keys[index] - key_base);
+    const std::uint8_t kKeep = mask[ToSize(path_ids[index])];
+    out_durations[kSlot] += static_cast<std::int64_t>(durations[index]) * kKeep;
+    out_counts[kSlot] += kKeep;
+  }
+  return totals;
+}
+
+auto RecordColumnSnapshot::CountDays(RowRange rows,
+                                     std::uint8_t flag_mask) const -> int {
+  int count = 0;
+  std::size_t index = rows.begin;
+  while (index < rows.end) {
+    const std::int32_t kDay = days_[index];
+    std::uint8_t day_flags = 0;
+    for (; index < rows.end && days_[index] == kDay; ++index) {
+      day_flags |= flags_[index];
+    }
+    if (flag_mask == 0 || (day_flags & flag_mask) != 0) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+auto AcquireRecordColumnSnapshot(sqlite3* sqlite_db)
+    -> std::shared_ptr<const RecordColumnSnapshot> {
+  auto key = DatabaseSnapshotKey::Read(sqlite_db);
+  if (!key.has_value()) {
+    return nullptr;
+  }
+
+  auto& slot = Published();
+  {
+    std::scoped_lock lock(slot.mutex);
+    if (slot.current.snapshot && slot.current.key.Admits(*key)) {
+      return slot.current.snapshot->Loaded() ? slot.current.snapshot
+                                             : nullptr;
+    }
+  }
+
+  // 加载失败也发布出去，键不变时不再重复扫描整表。
+  auto snapshot = RecordColumnSnapshot::Load(sqlite_db);
+  std::scoped_lock lock(slot.mutex);
+  slot.current =
+      PublishedSnapshot{.key = std::move(*key), .snapshot = snapshot};
+  return snapshot->Loaded() ? snapshot : nullptr;
+}
+
+}  // namespace tracer::core::infrastructure::persistence
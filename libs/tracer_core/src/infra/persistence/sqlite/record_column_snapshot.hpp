@@ -0,0 +1,128 @@
+// infra/persistence/sqlite/record_column_snapshot.hpp
+#ifndef INFRASTRUCTURE_PERSISTENCE_SQLITE_RECORD_COLUMN_SNAPSHOT_H_
+#define INFRASTRUCTURE_PERSISTENCE_SQLITE_RECORD_COLUMN_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "infra/sqlite_fwd.hpp"
+
+namespace tracer::core::infrastructure::persistence {
+
+/**
+ * @brief `time_records` 的只读列式快照。
+ *
+ * 每行拆成等长的连续数组：日序号（自 1970-01-01 起的天数）、项目 id、
+ * 时长、路径快照编号与根项目标记位，行按日期升序排列。日期区间先二分
+ * 定位行区间，再在连续数组上做求和与分组，循环体内没有分支与字符串比较。
+ * 任一列超出 int32 范围、日期非法或缺少 project_path_snapshot 列时
+ * 放弃加载，调用方应回退到 SQL 查询。
+ */
+class RecordColumnSnapshot {
+ public:
+  // 取项目分类掩码的低位（与 ProjectClass 同值），判定与导入时
+  // day_flag_rollup 一致：路径等于根名或以 "根名_" 开头。
+  enum RecordFlag : std::uint8_t {
+    kStudyFlag = 1U << 0U,
+    kExerciseFlag = 1U << 1U,
+    kCardioFlag = 1U << 2U,
+    kAnaerobicFlag = 1U << 3U,
+  };
+
+  struct RowRange {
+    std::size_t begin = 0;
+    std::size_t end = 0;
+  };
+
+  // 分组结果：下标为分组键，未出现的键时长与行数均为 0。
+  struct GroupTotals {
+    std::vector<std::int64_t> durations;
+    std::vector<std::int32_t> row_counts;
+  };
+
+  [[nodiscard]] static auto Load(sqlite3* sqlite_db)
+      -> std::shared_ptr<const RecordColumnSnapshot>;
+
+  [[nodiscard]] auto Loaded() const -> bool;
+  [[nodiscard]] auto Size() const -> std::size_t;
+
+  [[nodiscard]] auto Days() const -> std::span<const std::int32_t>;
+  // days 表中的全部日期（日序号，升序），包括没有任何记录的空日。
+  [[nodiscard]] auto CalendarDays() const -> std::span<const std::int32_t>;
+  [[nodiscard]] auto ProjectIds() const -> std::span<const std::int32_t>;
+  [[nodiscard]] auto Durations() const -> std::span<const std::int32_t>;
+  [[nodiscard]] auto PathIds() const -> std::span<const std::int32_t>;
+  [[nodiscard]] auto Flags() const -> std::span<const std::uint8_t>;
+
+  // 按编号排列的去重路径快照；NULL 记为空串。
+  [[nodiscard]] auto Paths() const -> const std::vector<std::string>&;
+  // 项目 id 均为非负且足够稠密，可直接作为分组数组下标。
+  [[nodiscard]] auto MaxProjectId() const -> std::int32_t;
+
+  // 闭区间 [first_day, last_day] 内的行。
+  [[nodiscard]] auto RowsInDays(std::int32_t first_day,
+                                std::int32_t last_day) const -> RowRange;
+  // 按路径编号给出的掩码：路径等于 root 或以 "root_" 开头时为 1。
+  [[nodiscard]] auto MatchRootPaths(std::string_view root) const
+      -> std::vector<std::uint8_t>;
+
+  [[nodiscard]] auto SumDurations(RowRange rows) const -> std::int64_t;
+  // 按项目 id 分组，长度为 MaxProjectId() + 1。
+  [[nodiscard]] auto SumByProject(RowRange rows) const -> GroupTotals;
+  // 按路径编号分组，长度为 Paths().size()；path_mask 非空时只统计掩码为 1
+  // 的路径，下同。
+  [[nodiscard]] auto SumByPath(RowRange rows,
+                               std::span<const std::uint8_t> path_mask = {})
+      const -> GroupTotals;
+  // 按日分组，下标 i 对应日序号 first_day + i；区间须落在这 day_count 天内。
+  [[nodiscard]] auto SumByDay(RowRange rows, std::int32_t first_day,
+                              std::size_t day_count,
+                              std::span<const std::uint8_t> path_mask = {})
+      const -> GroupTotals;
+  // 区间内有记录的天数；flag_mask 非 0 时只计至少一行带有其中标记的天。
+  [[nodiscard]] auto CountDays(RowRange rows, std::uint8_t flag_mask = 0) const
+      -> int;
+
+ private:
+  [[nodiscard]] auto GroupByKey(const std::int32_t* keys,
+                                std::int32_t key_base, std::size_t key_count,
+                                RowRange rows,
+                                std::span<const std::uint8_t> path_mask) const
+      -> GroupTotals;
+
+  std::vector<std::int32_t> days_;
+  std::vector<std::int32_t> calendar_days_;
+  std::vector<std::int32_t> project_ids_;
+  std::vector<std::int32_t> durations_;
+  std::vector<std::int32_t> path_ids_;
+  std::vector<std::uint8_t> flags_;
+  std::vector<std::string> paths_;
+  std::int32_t max_project_id_ = 0;
+  bool loaded_ = false;
+};
+
+/**
+ * @brief 取得进程内共享的记录列式快照。
+ *
+ * 与项目字典共用 DatabaseSnapshotKey：键不变期间同一数据库文件只加载
+ * 一次。
+ * 内存库、临时库或加载失败时返回 nullptr，由调用方走 SQL 路径。
+ */
+[[nodiscard]] auto AcquireRecordColumnSnapshot(sqlite3* sqlite_db)
+    -> std::shared_ptr<const RecordColumnSnapshot>;
+
+}  // namespace tracer::core::infrastructure::persistence
+
+namespace infrastructure::persistence {
+
+using tracer::core::infrastructure::persistence::AcquireRecordColumnSnapshot;
+using tracer::core::infrastructure::persistence::RecordColumnSnapshot;
+
+}  // namespace infrastructure::persistence
+
+#endif  // INFRASTRUCTURE_PERSISTENCE_SQLITE_RECORD_COLUMN_SNAPSHOT_H_
@@ -0,0 +1,281 @@
+// infra/persistence/sqlite/sqlite_read_connection_pool.cpp
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
+
+#include <sqlite3.h>
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "infra/persistence/sqlite/project_dictionary.hpp"
+
+import tracer.core.domain.ports.diagnostics;
+
+namespace modports = tracer::core::domain::ports;
+
+namespace tracer::core::infrastructure::persistence {
+
+struct PooledSqliteConnection {
+  PooledSqliteConnection(sqlite3* sqlite_db, std::uint64_t conn_generation);
+  ~PooledSqliteConnection();
+
+  PooledSqliteConnection(const PooledSqliteConnection&) = delete;
+  auto operator=(const PooledSqliteConnection&)
+      -> PooledSqliteConnection& = delete;
+
+  sqlite3* db;
+  std::uint64_t generation;
+  std::mutex cache_mutex;
+  std::unordered_map<std::string, sqlite3_stmt*> statements;
+  std::unordered_map<std::string, bool> capabilities;
+};
+
+namespace {
+
+// 连接句柄到池内连接的登记表，使只拿到 sqlite3* 的查询代码也能找到
+// 所属连接的语句缓存。
+auto RegistryMutex() -> std::mutex& {
+  static std::mutex mutex;
+  return mutex;
+}
+
+auto Registry() -> std::unordered_map<sqlite3*, PooledSqliteConnection*>& {
+  static std::unordered_map<sqlite3*, PooledSqliteConnection*> registry;
+  return registry;
+}
+
+auto FindPooledConnection(sqlite3* sqlite_db) -> PooledSqliteConnection* {
+  if (sqlite_db == nullptr) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  const auto kIt = Registry().find(sqlite_db);
+  return kIt == Registry().end() ? nullptr : kIt->second;
+}
+
+auto OpenReadConnection(const std::filesystem::path& db_path,
+                        const SqliteReadConnectionOptions& options)
+    -> sqlite3* {
+  const std::string kDbName = db_path.string();
+  if (!std::filesystem::exists(db_path)) {
+    modports::EmitError("错误: 数据库文件 '" + kDbName +
+                        "' 不存在。请先导入数据。");
+    return nullptr;
+  }
+
+  // 不带 SQLITE_OPEN_CREATE，且由 query_only 保证只读；不使用
+  // SQLITE_OPEN_READONLY 是为了在 WAL 库缺少 -shm 文件时仍能打开。
+  sqlite3* sqlite_db = nullptr;
+  if (sqlite3_open_v2(kDbName.c_str(), &sqlite_db, SQLITE_OPEN_READWRITE,
+                      nullptr) != SQLITE_OK) {
+    modports::EmitError("错误: 无法打开数据库 " + kDbName + ": " +
+                        sqlite3_errmsg(sqlite_db));
+    sqlite3_close(sqlite_db);
+    return nullptr;
+  }
+
+  std::string pragmas = "PRAGMA foreign_keys = ON;";
+  if (options.mmap_size_bytes > 0) {
+    pragmas += "PRAGMA mmap_size = " +
+               std::to_string(options.mmap_size_bytes) + ";";
+  }
+  pragmas += "PRAGMA query_only = ON;";
+  char* err_msg = nullptr;
+  if (sqlite3_exec(sqlite_db, pragmas.c_str(), nullptr, nullptr, &err_msg) !=
+      SQLITE_OK) {
+    const std::string kError =
+        (err_msg != nullptr) ? err_msg : "unknown sqlite error";
+    sqlite3_free(err_msg);
+    modports::EmitWarn("警告: 只读连接初始化 PRAGMA 失败: " + kError);
+  }
+  return sqlite_db;
+}
+
+}  // namespace
+
+PooledSqliteConnection::PooledSqliteConnection(sqlite3* sqlite_db,
+                                               std::uint64_t conn_generation)
+    : db(sqlite_db), generation(conn_generation) {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  Registry()[db] = this;
+}
+
+PooledSqliteConnection::~PooledSqliteConnection() {
+  {
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    Registry().erase(db);
+  }
+  for (auto& [sql, statement] : statements) {
+    sqlite3_finalize(statement);
+  }
+  ReleaseSnapshotConnection(db);
+  sqlite3_close(db);
+}
+
+SqliteReadConnectionPool::Lease::Lease(
+    SqliteReadConnectionPool* pool,
+    std::unique_ptr<PooledSqliteConnection> connection)
+    : pool_(pool), connection_(std::move(connection)) {}
+
+SqliteReadConnectionPool::Lease::Lease(Lease&& other) noexcept
+    : pool_(std::exchange(other.pool_, nullptr)),
+      connection_(std::move(other.connection_)) {}
+
+auto SqliteReadConnectionPool::Lease::operator=(Lease&& other) noexcept
+    -> Lease& {
+  if (this != &other) {
+    Release();
+    pool_ = std::exchange(other.pool_, nullptr);
+    connection_ = std::move(other.connection_);
+  }
+  return *this;
+}
+
+SqliteReadConnectionPool::Lease::~Lease() {
+  Release();
+}
+
+auto SqliteReadConnectionPool::Lease::Connection() const -> sqlite3* {
+  return connection_ ? connection_->db : nullptr;
+}
+
+auto SqliteReadConnectionPool::Lease::Release() -> void {
+  if (pool_ != nullptr && connection_) {
+    pool_->Return(std::move(connection_));
+  }
+  pool_ = nullptr;
+  connection_.reset();
+}
+
+SqliteReadConnectionPool::SqliteReadConnectionPool(
+    std::filesystem::path db_path, SqliteReadConnectionOptions options)
+    : db_path_(std::move(db_path)), options_(options) {}
+
+SqliteReadConnectionPool::~SqliteReadConnectionPool() = default;
+
+auto SqliteReadConnectionPool::TryAcquire() -> std::optional<Lease> {
+  const std::uint64_t kGeneration = generation_.load();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!idle_.empty()) {
+      auto connection = std::move(idle_.back());
+      idle_.pop_back();
+      if (connection->generation == kGeneration) {
+        return Lease(this, std::move(connection));
+      }
+    }
+  }
+
+  sqlite3* sqlite_db = OpenReadConnection(db_path_, options_);
+  if (sqlite_db == nullptr) {
+    return std::nullopt;
+  }
+  return Lease(this, std::make_unique<PooledSqliteConnection>(sqlite_db,
+                                                              kGeneration));
+}
+
+auto SqliteReadConnectionPool::Invalidate() -> void {
+  std::vector<std::unique_ptr<PooledSqliteConnection>> stale;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_.fetch_add(1);
+    stale.swap(idle_);
+  }
+}
+
+auto SqliteReadConnectionPool::DbPath() const -> const std::filesystem::path& {
+  return db_path_;
+}
+
+auto SqliteReadConnectionPool::Return(
+    std::unique_ptr<PooledSqliteConnection> connection) -> void {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (connection->generation != generation_.load() ||
+      idle_.size() >= options_.max_idle_connections) {
+    return;
+  }
+  idle_.push_back(std::move(connection));
+}
+
+CachedSqliteStatement::CachedSqliteStatement(sqlite3* sqlite_db,
+                                             const std::string& sql)
+    : owner_(FindPooledConnection(sqlite_db)) {
+  if (owner_ != nullptr) {
+    std::lock_guard<std::mutex> lock(owner_->cache_mutex);
+    auto node = owner_->statements.extract(sql);
+    if (!node.empty()) {
+      sql_ = std::move(node.key());
+      statement_ = node.mapped();
+      return;
+    }
+  }
+  if (sqlite3_prepare_v2(sqlite_db, sql.c_str(), -1, &statement_, nullptr) !=
+      SQLITE_OK) {
+    sqlite3_finalize(statement_);
+    statement_ = nullptr;
+    return;
+  }
+  if (owner_ != nullptr) {
+    sql_ = sql;
+  }
+}
+
+CachedSqliteStatement::~CachedSqliteStatement() {
+  if (statement_ == nullptr) {
+    return;
+  }
+  if (owner_ == nullptr) {
+    sqlite3_finalize(statement_);
+    return;
+  }
+  sqlite3_reset(statement_);
+  sqlite3_clear_bindings(statement_);
+  std::lock_guard<std::mutex> lock(owner_->cache_mutex);
+  // 同一 SQL 被嵌套借用时只保留一份，多出的直接释放。
+  if (!owner_->statements.try_emplace(std::move(sql_), statement_).second) {
+    sqlite3_finalize(statement_);
+  }
+}
+
+auto CachedSqliteStatement::Get() const -> sqlite3_stmt* {
+  return statement_;
+}
+
+auto CachedSqliteCapability(sqlite3* sqlite_db, std::string_view key,
+                            const std::function<bool(sqlite3*)>& probe)
+    -> bool {
+  PooledSqliteConnection* owner = FindPooledConnection(sqlite_db);
+  if (owner == nullptr) {
+    return probe(sqlite_db);
+  }
+  {
+    std::lock_guard<std::mutex> lock(owner->cache_mutex);
+    const auto kIt = owner->capabilities.find(std::string(key));
+    if (kIt != owner->capabilities.end()) {
+      return kIt->second;
+    }
+  }
+  const bool kResult = probe(sqlite_db);
+  std::lock_guard<std::mutex> lock(owner->cache_mutex);
+  owner->capabilities.insert_or_assign(std::string(key), kResult);
+  return kResult;
+}
+
+auto TableExists(sqlite3* sqlite_db, std::string_view table) -> bool {
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(sqlite_db,
+                         "SELECT 1 FROM sqlite_master "
+                         "WHERE type = 'table' AND name = ?1;",
+                         -1, &stmt, nullptr) != SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    return false;
+  }
+  sqlite3_bind_text(stmt, 1, table.data(), static_cast<int>(table.size()),
+                    SQLITE_TRANSIENT);
+  const bool kExists = sqlite3_step(stmt) == SQLITE_ROW;
+  sqlite3_finalize(stmt);
+  return kExists;
+}
+
+}  // namespace tracer::core::infrastructure::persistence
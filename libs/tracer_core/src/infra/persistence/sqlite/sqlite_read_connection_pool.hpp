@@ -0,0 +1,140 @@
+// infra/persistence/sqlite/sqlite_read_connection_pool.hpp
+#ifndef INFRASTRUCTURE_PERSISTENCE_SQLITE_SQLITE_READ_CONNECTION_POOL_H_
+#define INFRASTRUCTURE_PERSISTENCE_SQLITE_SQLITE_READ_CONNECTION_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "infra/sqlite_fwd.hpp"
+
+namespace tracer::core::infrastructure::persistence {
+
+struct PooledSqliteConnection;
+
+struct SqliteReadConnectionOptions {
+  // 空闲连接上限；并发借出超过该值时多出的连接在归还时关闭。
+  std::size_t max_idle_connections = 4;
+  // PRAGMA mmap_size；0 表示沿用 SQLite 默认值。
+  std::int64_t mmap_size_bytes = std::int64_t{64} * 1024 * 1024;
+};
+
+/**
+ * @brief 运行时持有的只读 SQLite 连接池。
+ *
+ * 连接以只读方式打开并设置 `query_only`、`mmap_size` 与 `foreign_keys`，
+ * 每条连接附带按 SQL 文本索引的预编译语句缓存和模式能力探测缓存，
+ * 供 `CachedSqliteStatement` 与 `CachedSqliteCapability` 使用。
+ * 写入方完成导入后调用 `Invalidate`，旧连接（连同语句和探测缓存）
+ * 不再被复用，下一次借出时重新打开。
+ */
+class SqliteReadConnectionPool {
+ public:
+  class Lease {
+   public:
+    Lease(Lease&& other) noexcept;
+    auto operator=(Lease&& other) noexcept -> Lease&;
+    Lease(const Lease&) = delete;
+    auto operator=(const Lease&) -> Lease& = delete;
+    ~Lease();
+
+    [[nodiscard]] auto Connection() const -> sqlite3*;
+
+   private:
+    friend class SqliteReadConnectionPool;
+    Lease(SqliteReadConnectionPool* pool,
+          std::unique_ptr<PooledSqliteConnection> connection);
+
+    auto Release() -> void;
+
+    SqliteReadConnectionPool* pool_ = nullptr;
+    std::unique_ptr<PooledSqliteConnection> connection_;
+  };
+
+  explicit SqliteReadConnectionPool(std::filesystem::path db_path,
+                                    SqliteReadConnectionOptions options = {});
+  ~SqliteReadConnectionPool();
+
+  SqliteReadConnectionPool(const SqliteReadConnectionPool&) = delete;
+  auto operator=(const SqliteReadConnectionPool&)
+      -> SqliteReadConnectionPool& = delete;
+
+  /**
+   * @brief 借出一条只读连接。
+   * @return 数据库文件不存在或无法打开时返回 std::nullopt（错误已上报诊断）。
+   */
+  [[nodiscard]] auto TryAcquire() -> std::optional<Lease>;
+
+  // 丢弃全部空闲连接，并使当前借出的连接在归还时关闭。
+  auto Invalidate() -> void;
+
+  [[nodiscard]] auto DbPath() const -> const std::filesystem::path&;
+
+ private:
+  auto Return(std::unique_ptr<PooledSqliteConnection> connection) -> void;
+
+  std::filesystem::path db_path_;
+  SqliteReadConnectionOptions options_;
+  std::atomic<std::uint64_t> generation_{0};
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<PooledSqliteConnection>> idle_;
+};
+
+/**
+ * @brief 借用连接上缓存的预编译语句。
+ *
+ * 连接来自连接池时语句在析构时 reset 并放回缓存；其他连接上退化为
+ * 普通的 prepare/finalize，因此调用方无需区分连接来源。
+ */
+class CachedSqliteStatement {
+ public:
+  CachedSqliteStatement(sqlite3* sqlite_db, const std::string& sql);
+  ~CachedSqliteStatement();
+
+  CachedSqliteStatement(const CachedSqliteStatement&) = delete;
+  auto operator=(const CachedSqliteStatement&)
+      -> CachedSqliteStatement& = delete;
+
+  // prepare 失败时返回 nullptr。
+  [[nodiscard]] auto Get() const -> sqlite3_stmt*;
+
+ private:
+  PooledSqliteConnection* owner_ = nullptr;
+  std::string sql_;
+  sqlite3_stmt* statement_ = nullptr;
+};
+
+/**
+ * @brief 按键缓存连接级的模式能力探测结果（如列是否存在）。
+ *
+ * 非连接池连接每次都直接调用 `probe`。
+ */
+[[nodiscard]] auto CachedSqliteCapability(
+    sqlite3* sqlite_db, std::string_view key,
+    const std::function<bool(sqlite3*)>& probe) -> bool;
+
+// sqlite_master 中是否存在名为 table 的表（含虚拟表）。
+[[nodiscard]] auto TableExists(sqlite3* sqlite_db, std::string_view table)
+    -> bool;
+
+}  // namespace tracer::core::infrastructure::persistence
+
+namespace infrastructure::persistence {
+
+using tracer::core::infrastructure::persistence::CachedSqliteCapability;
+using tracer::core::infrastructure::persistence::CachedSqliteStatement;
+using tracer::core::infrastructure::persistence::SqliteReadConnectionOptions;
+using tracer::core::infrastructure::persistence::SqliteReadConnectionPool;
+using tracer::core::infrastructure::persistence::TableExists;
+
+}  // namespace infrastructure::persistence
+
+#endif  // INFRASTRUCTURE_PERSISTENCE_SQLITE_SQLITE_READ_CONNECTION_POOL_H_
@@ -2,18 +2,23 @@
 #ifndef INFRASTRUCTURE_PERSISTENCE_SQLITE_TIME_SHEET_REPOSITORY_H_
 #define INFRASTRUCTURE_PERSISTENCE_SQLITE_TIME_SHEET_REPOSITORY_H_
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 
 #include "application/ports/pipeline/i_time_sheet_repository.hpp"
 #include "infra/persistence/importer/repository.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 
 namespace tracer::core::infrastructure::persistence {
 class SqliteTimeSheetRepository final
     : public tracer_core::application::ports::ITimeSheetRepository {
  public:
-  explicit SqliteTimeSheetRepository(const std::string& db_path);
+  // read_pool 非空时，每次写入后使其失效，查询侧随后重新打开连接。
+  explicit SqliteTimeSheetRepository(
+      const std::string& db_path,
+      std::shared_ptr<SqliteReadConnectionPool> read_pool = nullptr);
 
   [[nodiscard]] auto IsDbOpen() const -> bool override;
   auto ImportData(const std::vector<DayData>& days,
@@ -25,6 +30,12 @@ class SqliteTimeSheetRepository final
   auto ReplaceMonthData(int year, int month, const std::vector<DayData>& days,
                         const std::vector<TimeRecordInternal>& records)
       -> void override;
+  auto ReplaceMonthsData(
+      const std::vector<ReplaceMonthTarget>& months,
+      const std::vector<DayData>& days,
+      const std::vector<TimeRecordInternal>& records,
+      const std::vector<tracer_core::core::dto::IngestSyncStatusEntry>&
+          sync_entries) -> void override;
   auto UpsertIngestSyncStatus(
       const tracer_core::core::dto::IngestSyncStatusEntry& entry)
       -> void override;
@@ -41,6 +52,7 @@ class SqliteTimeSheetRepository final
 
  private:
   importer::Repository repository_;
+  std::shared_ptr<SqliteReadConnectionPool> read_pool_;
 };
 
 }  // namespace tracer::core::infrastructure::persistence
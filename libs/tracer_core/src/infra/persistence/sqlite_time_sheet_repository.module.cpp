@@ -1,6 +1,8 @@
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "infra/persistence/sqlite_time_sheet_repository.hpp"
@@ -10,8 +12,39 @@ import tracer.core.infrastructure.persistence.write.importer.repository;
 
 namespace tracer::core::infrastructure::persistence {
 
-SqliteTimeSheetRepository::SqliteTimeSheetRepository(const std::string& db_path)
-    : repository_(db_path) {}
+SqliteTimeSheetRepository::SqliteTimeSheetRepository(
+    const std::string& db_path,
+    std::shared_ptr<SqliteReadConnectionPool> read_pool)
+    : repository_(db_path), read_pool_(std::move(read_pool)) {}
+
+namespace {
+
+// Closes idle read connections before a write: while they stay open,
+// BulkLoadScope cannot switch journal_mode back and falls back to a WAL
+// truncate. Invalidates again afterwards so connections opened during the
+// write, with capability probes cached against the old schema, are dropped.
+class ReadPoolWriteGuard {
+ public:
+  explicit ReadPoolWriteGuard(SqliteReadConnectionPool* read_pool)
+      : read_pool_(read_pool) {
+    Invalidate();
+  }
+  ~ReadPoolWriteGuard() { Invalidate(); }
+
+  ReadPoolWriteGuard(const ReadPoolWriteGuard&) = delete;
+  auto operator=(const ReadPoolWriteGuard&) -> ReadPoolWriteGuard& = delete;
+
+ private:
+  auto Invalidate() -> void {
+    if (read_pool_ != nullptr) {
+      read_pool_->Invalidate();
+    }
+  }
+
+  SqliteReadConnectionPool* read_pool_;
+};
+
+}  // namespace
 
 auto SqliteTimeSheetRepository::IsDbOpen() const -> bool {
   // Repository construction must not be treated as a write-side side effect.
@@ -23,33 +56,49 @@ auto SqliteTimeSheetRepository::IsDbOpen() const -> bool {
 auto SqliteTimeSheetRepository::ImportData(
     const std::vector<DayData>& days,
     const std::vector<TimeRecordInternal>& records) -> void {
+  const ReadPoolWriteGuard kGuard(read_pool_.get());
   repository_.ImportData(days, records);
 }
 
 auto SqliteTimeSheetRepository::ReplaceAllData(
     const std::vector<DayData>& days,
     const std::vector<TimeRecordInternal>& records) -> void {
+  const ReadPoolWriteGuard kGuard(read_pool_.get());
   repository_.ReplaceAllData(days, records);
 }
 
 auto SqliteTimeSheetRepository::ReplaceMonthData(
     int year, int month, const std::vector<DayData>& days,
     const std::vector<TimeRecordInternal>& records) -> void {
+  const ReadPoolWriteGuard kGuard(read_pool_.get());
   repository_.ReplaceMonthData(year, month, days, records);
 }
 
+auto SqliteTimeSheetRepository::ReplaceMonthsData(
+    const std::vector<ReplaceMonthTarget>& months,
+    const std::vector<DayData>& days,
+    const std::vector<TimeRecordInternal>& records,
+    const std::vector<tracer_core::core::dto::IngestSyncStatusEntry>&
+        sync_entries) -> void {
+  const ReadPoolWriteGuard kGuard(read_pool_.get());
+  repository_.ReplaceMonthsData(months, days, records, sync_entries);
+}
+
 auto SqliteTimeSheetRepository::UpsertIngestSyncStatus(
     const tracer_core::core::dto::IngestSyncStatusEntry& entry) -> void {
+  const ReadPoolWriteGuard kGuard(read_pool_.get());
   repository_.UpsertIngestSyncStatus(entry);
 }
 
 auto SqliteTimeSheetRepository::ReplaceIngestSyncStatuses(
     const std::vector<tracer_core::core::dto::IngestSyncStatusEntry>& entries)
     -> void {
+  const ReadPoolWriteGuard kGuard(read_pool_.get());
   repository_.ReplaceIngestSyncStatuses(entries);
 }
 
 auto SqliteTimeSheetRepository::ClearIngestSyncStatus() -> void {
+  const ReadPoolWriteGuard kGuard(read_pool_.get());
   repository_.ClearIngestSyncStatus();
 }
 
@@ -0,0 +1,241 @@
+// infra/query/data/data_query_columnar.cpp
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "infra/persistence/sqlite/record_column_snapshot.hpp"
+#include "infra/query/data/data_query_repository_internal.hpp"
+#include "shared/utils/civil_time.hpp"
+
+namespace tracer_core::infrastructure::query::data::internal {
+namespace {
+
+using tracer::core::infrastructure::persistence::AcquireRecordColumnSnapshot;
+using tracer::core::infrastructure::persistence::RecordColumnSnapshot;
+namespace civil_time = tracer::core::shared::civil_time;
+
+constexpr int kMonthsPerYear = 12;
+constexpr int kLastDayOfDecember = 31;
+
+struct DayBounds {
+  std::int32_t first_day = 0;
+  std::int32_t last_day = 0;
+};
+
+auto ToDayNumber(const civil_time::CivilDate& date) -> std::int32_t {
+  return static_cast<std::int32_t>(civil_time::DaysFromCivil(date));
+}
+
+auto ParseDayNumber(std::string_view value) -> std::optional<std::int32_t> {
+  const auto kDate = civil_time::ParseIsoDate(value);
+  if (!kDate.has_value()) {
+    return std::nullopt;
+  }
+  return ToDayNumber(*kDate);
+}
+
+// 快照中最早到最晚记录的日期；空快照得到空区间。
+auto DataBounds(const RecordColumnSnapshot& snapshot) -> DayBounds {
+  const auto kDays = snapshot.Days();
+  if (kDays.empty()) {
+    return {.first_day = 0, .last_day = -1};
+  }
+  return {.first_day = kDays.front(), .last_day = kDays.back()};
+}
+
+auto Intersect(DayBounds bounds, std::int32_t first_day,
+               std::int32_t last_day) -> DayBounds {
+  return {.first_day = std::max(bounds.first_day, first_day),
+          .last_day = std::min(bounds.last_day, last_day)};
+}
+
+// 快照只覆盖日期与根项目条件；其余过滤或无法换算成连续日期区间的条件
+// （单独的月份、非法日期字符串）返回 std::nullopt，交给 SQL 处理。
+auto ResolveSnapshotBounds(const RecordColumnSnapshot& snapshot,
+                           const QueryFilters& filters)
+    -> std::optional<DayBounds> {
+  if (filters.remark.has_value() || filters.day_remark.has_value() ||
+      filters.project.has_value() || filters.exercise.has_value() ||
+      filters.status.has_value() || filters.overnight ||
+      (filters.kMonth.has_value() && !filters.kYear.has_value())) {
+    return std::nullopt;
+  }
+
+  DayBounds bounds = DataBounds(snapshot);
+  if (filters.kMonth.has_value() &&
+      (*filters.kMonth < 1 || *filters.kMonth > kMonthsPerYear)) {
+    return std::nullopt;
+  }
+  if (filters.kYear.has_value()) {
+    const int kFirstMonth = filters.kMonth.value_or(1);
+    const int kLastMonth = filters.kMonth.value_or(kMonthsPerYear);
+    const civil_time::CivilDate kFirst{
+        .year = *filters.kYear, .month = kFirstMonth, .day = 1};
+    const civil_time::CivilDate kLast{
+        .year = *filters.kYear,
+        .month = kLastMonth,
+        .day = filters.kMonth.has_value()
+                   ? civil_time::DaysInMonth(*filters.kYear, kLastMonth)
+                   : kLastDayOfDecember};
+    if (!civil_time::IsValidDate(kFirst) || !civil_time::IsValidDate(kLast)) {
+      return std::nullopt;
+    }
+    bounds = Intersect(bounds, ToDayNumber(kFirst), ToDayNumber(kLast));
+  }
+  if (filters.from_date.has_value()) {
+    const auto kFirstDay = ParseDayNumber(*filters.from_date);
+    if (!kFirstDay.has_value()) {
+      return std::nullopt;
+    }
+    bounds = Intersect(bounds, *kFirstDay, bounds.last_day);
+  }
+  if (filters.to_date.has_value()) {
+    const auto kLastDay = ParseDayNumber(*filters.to_date);
+    if (!kLastDay.has_value()) {
+      return std::nullopt;
+    }
+    bounds = Intersect(bounds, bounds.first_day, *kLastDay);
+  }
+  return bounds;
+}
+
+auto RootMask(const RecordColumnSnapshot& snapshot,
+              const std::optional<std::string>& root)
+    -> std::vector<std::uint8_t> {
+  return root.has_value() ? snapshot.MatchRootPaths(*root)
+                          : std::vector<std::uint8_t>{};
+}
+
+// 按日汇总，只输出至少有一行（满足根项目条件）记录的日期，按日期升序。
+auto CollectDayRows(const RecordColumnSnapshot& snapshot, DayBounds bounds,
+                    std::span<const std::uint8_t> path_mask)
+    -> std::vector<DayDurationRow> {
+  std::vector<DayDurationRow> rows;
+  if (bounds.first_day > bounds.last_day) {
+    return rows;
+  }
+  const auto kDayCount =
+      static_cast<std::size_t>(bounds.last_day - bounds.first_day) + 1;
+  const auto kTotals = snapshot.SumByDay(
+      snapshot.RowsInDays(bounds.first_day, bounds.last_day), bounds.first_day,
+      kDayCount, path_mask);
+  for (std::size_t offset = 0; offset < kDayCount; ++offset) {
+    if (kTotals.row_counts[offset] == 0) {
+      continue;
+    }
+    rows.push_back(
+        {.date = civil_time::FormatIsoDate(civil_time::CivilFromDays(
+             bounds.first_day + static_cast<std::int64_t>(offset))),
+         .total_seconds = kTotals.durations[offset]});
+  }
+  return rows;
+}
+
+// 与 days LEFT JOIN time_records 一致：区间内 days 表中的每一天都输出，
+// 没有（满足根项目条件的）记录时总时长为 0。
+auto CollectCalendarDayRows(const RecordColumnSnapshot& snapshot,
+                            std::int32_t first_day, std::int32_t last_day,
+                            std::span<const std::uint8_t> path_mask)
+    -> std::vector<DayDurationRow> {
+  std::vector<DayDurationRow> rows;
+  const auto kCalendar = snapshot.CalendarDays();
+  const auto kBegin = std::ranges::lower_bound(kCalendar, first_day);
+  const auto kEnd = std::upper_bound(kBegin, kCalendar.end(), last_day);
+  if (kBegin == kEnd) {
+    return rows;
+  }
+  const std::int32_t kBase = *kBegin;
+  const auto kTotals = snapshot.SumByDay(
+      snapshot.RowsInDays(kBase, *(kEnd - 1)), kBase,
+      static_cast<std::size_t>(*(kEnd - 1) - kBase) + 1, path_mask);
+  rows.reserve(static_cast<std::size_t>(kEnd - kBegin));
+  for (auto it = kBegin; it != kEnd; ++it) {
+    rows.push_back(
+        {.date = civil_time::FormatIsoDate(civil_time::CivilFromDays(*it)),
+         .total_seconds =
+             kTotals.durations[static_cast<std::size_t>(*it - kBase)]});
+  }
+  return rows;
+}
+
+}  // namespace
+
+auto TryQueryDayDurationsFromSnapshot(sqlite3* db_conn,
+                                      const QueryFilters& filters)
+    -> std::optional<std::vector<DayDurationRow>> {
+  const auto kSnapshot = AcquireRecordColumnSnapshot(db_conn);
+  if (kSnapshot == nullptr) {
+    return std::nullopt;
+  }
+  const auto kBounds = ResolveSnapshotBounds(*kSnapshot, filters);
+  if (!kBounds.has_value()) {
+    return std::nullopt;
+  }
+
+  const auto kMask = RootMask(*kSnapshot, filters.root);
+  std::vector<DayDurationRow> rows =
+      CollectDayRows(*kSnapshot, *kBounds, kMask);
+  // 行已按日期升序，稳定排序后同时长的日期仍按日期先后排列。
+  std::ranges::stable_sort(rows, [&filters](const DayDurationRow& left,
+                                            const DayDurationRow& right) {
+    return filters.reverse ? left.total_seconds > right.total_seconds
+                           : left.total_seconds < right.total_seconds;
+  });
+  if (filters.limit.has_value() && *filters.limit > 0 &&
+      rows.size() > static_cast<std::size_t>(*filters.limit)) {
+    rows.resize(static_cast<std::size_t>(*filters.limit));
+  }
+  return rows;
+}
+
+auto TryQueryRootDayDurationsFromSnapshot(
+    sqlite3* db_conn, const std::optional<std::string>& root,
+    const DateRangeBounds& date_range)
+    -> std::optional<std::vector<DayDurationRow>> {
+  const auto kSnapshot = AcquireRecordColumnSnapshot(db_conn);
+  const auto kFirstDay = ParseDayNumber(date_range.from_date);
+  const auto kLastDay = ParseDayNumber(date_range.to_date);
+  if (kSnapshot == nullptr || !kFirstDay.has_value() ||
+      !kLastDay.has_value()) {
+    return std::nullopt;
+  }
+  const auto kMask = (root.has_value() && !root->empty())
+                         ? kSnapshot->MatchRootPaths(*root)
+                         : std::vector<std::uint8_t>{};
+  return CollectCalendarDayRows(*kSnapshot, *kFirstDay, *kLastDay, kMask);
+}
+
+auto TryQueryProjectTreeRecordsFromSnapshot(sqlite3* db_conn,
+                                            const QueryFilters& filters)
+    -> std::optional<std::vector<std::pair<std::string, std::int64_t>>> {
+  const auto kSnapshot = AcquireRecordColumnSnapshot(db_conn);
+  if (kSnapshot == nullptr) {
+    return std::nullopt;
+  }
+  const auto kBounds = ResolveSnapshotBounds(*kSnapshot, filters);
+  if (!kBounds.has_value()) {
+    return std::nullopt;
+  }
+
+  std::vector<std::pair<std::string, std::int64_t>> records;
+  if (kBounds->first_day > kBounds->last_day) {
+    return records;
+  }
+  const auto kMask = RootMask(*kSnapshot, filters.root);
+  const auto kTotals = kSnapshot->SumByPath(
+      kSnapshot->RowsInDays(kBounds->first_day, kBounds->last_day), kMask);
+  const auto& paths = kSnapshot->Paths();
+  for (std::size_t path_id = 0; path_id < paths.size(); ++path_id) {
+    if (kTotals.row_counts[path_id] != 0 && !paths[path_id].empty()) {
+      records.emplace_back(paths[path_id], kTotals.durations[path_id]);
+    }
+  }
+  std::ranges::sort(records);
+  return records;
+}
+
+}  // namespace tracer_core::infrastructure::query::data::internal
@@ -69,6 +69,11 @@ auto QueryDatesByFilters(sqlite3* db_conn, const QueryFilters& filters)
 
 auto QueryDayDurations(sqlite3* db_conn, const QueryFilters& filters)
     -> std::vector<DayDurationRow> {
+  if (auto rows =
+          query_data_internal::TryQueryDayDurationsFromSnapshot(db_conn,
+                                                                filters)) {
+    return std::move(*rows);
+  }
   std::vector<query_data_detail::SqlParam> params;
   const std::string kSql =
       query_data_internal::BuildDayDurationsSql(db_conn, filters, params);
@@ -92,6 +97,10 @@ auto QueryDayDurationsByRootInDateRange(sqlite3* db_conn,
       .from_date = from_date,
       .to_date = to_date,
   };
+  if (auto rows = query_data_internal::TryQueryRootDayDurationsFromSnapshot(
+          db_conn, root, kDateRange)) {
+    return std::move(*rows);
+  }
   const std::string kSql =
       query_data_internal::BuildDayDurationsByRootInDateRangeSql(
           db_conn, root, kDateRange, params);
@@ -125,11 +134,18 @@ auto QueryLatestTrackedDate(sqlite3* db_conn) -> std::optional<std::string> {
 
 auto QueryProjectTree(sqlite3* db_conn, const QueryFilters& filters)
     -> reporting::ProjectTree {
-  std::vector<query_data_detail::SqlParam> params;
-  const std::string kSql =
-      query_data_internal::BuildProjectTreeSql(db_conn, filters, params);
-  std::vector<std::pair<std::string, std::int64_t>> records =
-      query_data_internal::ExecuteProjectTreeRecords(db_conn, kSql, params);
+  std::vector<std::pair<std::string, std::int64_t>> records;
+  if (auto snapshot_records =
+          query_data_internal::TryQueryProjectTreeRecordsFromSnapshot(
+              db_conn, filters)) {
+    records = std::move(*snapshot_records);
+  } else {
+    std::vector<query_data_detail::SqlParam> params;
+    const std::string kSql =
+        query_data_internal::BuildProjectTreeSql(db_conn, filters, params);
+    records =
+        query_data_internal::ExecuteProjectTreeRecords(db_conn, kSql, params);
+  }
 
   reporting::ProjectTree tree;
   query_data_internal::BuildProjectTreeFromRecords(tree, records);
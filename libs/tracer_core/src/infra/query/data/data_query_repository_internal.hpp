@@ -91,6 +91,22 @@ auto AppendOptionalLimitClause(std::string& sql,
     const ActivitySuggestionQueryOptions& options, int lookback_days, int limit)
     -> std::vector<ActivitySuggestionRow>;
 
+// 以下三个查询在能取到记录列式快照、且过滤条件只涉及日期与根项目时
+// 直接在快照上计算，否则返回 std::nullopt 由调用方执行 SQL。
+[[nodiscard]] auto TryQueryDayDurationsFromSnapshot(sqlite3* db_conn,
+                                                    const QueryFilters& filters)
+    -> std::optional<std::vector<DayDurationRow>>;
+
+// 与 SQL 版本一致：区间内 days 表中的空日也输出，总时长为 0。
+[[nodiscard]] auto TryQueryRootDayDurationsFromSnapshot(
+    sqlite3* db_conn, const std::optional<std::string>& root,
+    const DateRangeBounds& date_range)
+    -> std::optional<std::vector<DayDurationRow>>;
+
+[[nodiscard]] auto TryQueryProjectTreeRecordsFromSnapshot(
+    sqlite3* db_conn, const QueryFilters& filters)
+    -> std::optional<std::vector<std::pair<std::string, std::int64_t>>>;
+
 [[nodiscard]] auto ExecuteProjectTreeRecords(
     sqlite3* db_conn, const std::string& sql,
     const std::vector<detail::SqlParam>& params)
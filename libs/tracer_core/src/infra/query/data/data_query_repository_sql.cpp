@@ -3,21 +3,86 @@
 
 #include <sqlite3.h>
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 #include "infra/schema/day_schema.hpp"
 #include "infra/schema/sqlite_schema.hpp"
 
 namespace tracer_core::infrastructure::query::data::detail {
 namespace {
 
+using tracer::core::infrastructure::persistence::CachedSqliteStatement;
+using tracer::core::infrastructure::persistence::TableExists;
+
 constexpr int kThresholdTwoDigits = 10;
 constexpr size_t kProjectDateJoinReserve = 192;
 constexpr size_t kDerivedRootExistsClauseReserve = 256;
+// trigram 分词器无法为不足三个字符的查询使用索引。
+constexpr size_t kTrigramMinCodepoints = 3;
+
+[[nodiscard]] auto ProbeTextSearchIndex(sqlite3* db_conn) -> bool {
+  return TableExists(db_conn, schema::text_search::db::kTable);
+}
+
+[[nodiscard]] auto CountCodepoints(std::string_view value) -> size_t {
+  return static_cast<size_t>(
+      std::ranges::count_if(value, [](char character) -> bool {
+        return (static_cast<unsigned char>(character) & 0xC0U) != 0x80U;
+      }));
+}
+
+// 未转义的 LIKE 参数（remark/day_remark）里 % 与 _ 是通配符，
+// 子串预筛无法表达，只有不含通配符时才走全文索引。
+[[nodiscard]] auto CanPrefilter(const std::string& value, bool raw_like)
+    -> bool {
+  if (raw_like && value.find_first_of("%_") != std::string::npos) {
+    return false;
+  }
+  return CountCodepoints(value) >= kTrigramMinCodepoints;
+}
+
+// FTS5 列过滤加短语查询：`column : "value"`，短语内的双引号加倍转义。
+[[nodiscard]] auto BuildColumnPhraseQuery(std::string_view column,
+                                          const std::string& value)
+    -> std::string {
+  std::string query(column);
+  query += " : \"";
+  for (char character : value) {
+    if (character == '"') {
+      query.push_back('"');
+    }
+    query.push_back(character);
+  }
+  query.push_back('"');
+  return query;
+}
+
+// 全文索引只用于缩小候选集，原 LIKE 条件仍然保留，结果与无索引时一致。
+auto AppendTextSearchPrefilter(std::string_view outer_column,
+                               std::string_view search_key,
+                               std::string_view search_column,
+                               const std::string& value,
+                               std::vector<std::string>& clauses,
+                               std::vector<SqlParam>& params) -> void {
+  std::string clause(outer_column);
+  clause += " IN (SELECT ";
+  clause += search_key;
+  clause += " FROM ";
+  clause += schema::text_search::db::kTable;
+  clause += " WHERE ";
+  clause += schema::text_search::db::kTable;
+  clause += " MATCH ?)";
+  clauses.push_back(std::move(clause));
+  params.push_back({.type = SqlParam::Type::kText,
+                    .text_value = BuildColumnPhraseQuery(search_column, value),
+                    .int_value = 0});
+}
 
 [[nodiscard]] auto EscapeLikeLiteral(const std::string& value) -> std::string {
   std::string escaped;
@@ -115,9 +180,18 @@ auto BuildProjectDateJoinSql() -> std::string {
   return sql;
 }
 
+auto HasTextSearchIndex(sqlite3* db_conn) -> bool {
+  return tracer::core::infrastructure::persistence::CachedSqliteCapability(
+      db_conn, "text_search", ProbeTextSearchIndex);
+}
+
 auto BuildWhereClauses(const QueryFilters& filters,
-                       std::vector<SqlParam>& params)
+                       std::vector<SqlParam>& params, bool use_text_search)
     -> std::vector<std::string> {
+  const std::string kRecordIdColumn =
+      BuildQualifiedName("tr", schema::time_records::db::kLogicalId);
+  const std::string kDayDateColumn =
+      BuildQualifiedName("d", schema::day::db::kDate);
   std::vector<std::string> clauses;
   if (filters.kYear.has_value()) {
     clauses.emplace_back(
@@ -148,12 +222,23 @@ auto BuildWhereClauses(const QueryFilters& filters,
                       .int_value = 0});
   }
   if (filters.day_remark.has_value()) {
+    if (use_text_search && CanPrefilter(*filters.day_remark, true)) {
+      AppendTextSearchPrefilter(kDayDateColumn, schema::text_search::db::kDate,
+                                schema::text_search::db::kDayRemark,
+                                *filters.day_remark, clauses, params);
+    }
     clauses.emplace_back(
         BuildQualifiedClause("d", schema::day::db::kRemark, "LIKE"));
     params.push_back({.type = SqlParam::Type::kText,
                       .text_value = "%" + *filters.day_remark + "%"});
   }
   if (filters.project.has_value()) {
+    if (use_text_search && CanPrefilter(*filters.project, false)) {
+      AppendTextSearchPrefilter(kRecordIdColumn,
+                                schema::text_search::db::kRecordId,
+                                schema::text_search::db::kProjectPath,
+                                *filters.project, clauses, params);
+    }
     std::string clause = BuildQualifiedClause(
         "tr", schema::time_records::db::kProjectPathSnapshot, "LIKE");
     clause += " ESCAPE '\\'";
@@ -176,6 +261,12 @@ auto BuildWhereClauses(const QueryFilters& filters,
                       .int_value = 0});
   }
   if (filters.remark.has_value()) {
+    if (use_text_search && CanPrefilter(*filters.remark, true)) {
+      AppendTextSearchPrefilter(kRecordIdColumn,
+                                schema::text_search::db::kRecordId,
+                                schema::text_search::db::kActivityRemark,
+                                *filters.remark, clauses, params);
+    }
     clauses.emplace_back(BuildQualifiedClause(
         "tr", schema::time_records::db::kActivityRemark, "LIKE"));
     params.push_back({.type = SqlParam::Type::kText,
@@ -206,9 +297,9 @@ auto QueryStringColumn(sqlite3* db_conn, const std::string& sql,
                        const std::vector<SqlParam>& params)
     -> std::vector<std::string> {
   std::vector<std::string> results;
-  sqlite3_stmt* stmt = nullptr;
-  if (sqlite3_prepare_v2(db_conn, sql.c_str(), -1, &stmt, nullptr) !=
-      SQLITE_OK) {
+  const CachedSqliteStatement kStatement(db_conn, sql);
+  sqlite3_stmt* stmt = kStatement.Get();
+  if (stmt == nullptr) {
     throw std::runtime_error("Failed to prepare query.");
   }
 
@@ -232,10 +323,8 @@ auto QueryStringColumn(sqlite3* db_conn, const std::string& sql,
   }
   if (step_result != SQLITE_DONE) {
     const std::string kErrorMessage = sqlite3_errmsg(db_conn);
-    sqlite3_finalize(stmt);
     throw std::runtime_error("Failed to execute query: " + kErrorMessage);
   }
-  sqlite3_finalize(stmt);
   return results;
 }
 
@@ -243,9 +332,9 @@ auto QueryYearMonth(sqlite3* db_conn, const std::string& sql,
                     const std::vector<SqlParam>& params)
     -> std::vector<std::pair<int, int>> {
   std::vector<std::pair<int, int>> results;
-  sqlite3_stmt* stmt = nullptr;
-  if (sqlite3_prepare_v2(db_conn, sql.c_str(), -1, &stmt, nullptr) !=
-      SQLITE_OK) {
+  const CachedSqliteStatement kStatement(db_conn, sql);
+  sqlite3_stmt* stmt = kStatement.Get();
+  if (stmt == nullptr) {
     throw std::runtime_error("Failed to prepare query.");
   }
 
@@ -268,10 +357,8 @@ auto QueryYearMonth(sqlite3* db_conn, const std::string& sql,
   }
   if (step_result != SQLITE_DONE) {
     const std::string kErrorMessage = sqlite3_errmsg(db_conn);
-    sqlite3_finalize(stmt);
     throw std::runtime_error("Failed to execute query: " + kErrorMessage);
   }
-  sqlite3_finalize(stmt);
   return results;
 }
 
@@ -280,9 +367,9 @@ auto QueryRowsWithTotalDuration(sqlite3* db_conn, const std::string& sql,
     -> std::vector<DayDurationRow> {
   std::vector<DayDurationRow> rows;
 
-  sqlite3_stmt* stmt = nullptr;
-  if (sqlite3_prepare_v2(db_conn, sql.c_str(), -1, &stmt, nullptr) !=
-      SQLITE_OK) {
+  const CachedSqliteStatement kStatement(db_conn, sql);
+  sqlite3_stmt* stmt = kStatement.Get();
+  if (stmt == nullptr) {
     throw std::runtime_error("Failed to prepare query.");
   }
 
@@ -309,11 +396,9 @@ auto QueryRowsWithTotalDuration(sqlite3* db_conn, const std::string& sql,
   }
   if (step_result != SQLITE_DONE) {
     const std::string kErrorMessage = sqlite3_errmsg(db_conn);
-    sqlite3_finalize(stmt);
     throw std::runtime_error("Failed to execute query: " + kErrorMessage);
   }
 
-  sqlite3_finalize(stmt);
   return rows;
 }
 
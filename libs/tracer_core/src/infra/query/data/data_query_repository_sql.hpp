@@ -29,8 +29,14 @@ struct DateParts {
 
 [[nodiscard]] auto BuildProjectDateJoinSql() -> std::string;
 
+// 库中是否有导入器维护的 text_search 全文索引；按连接缓存探测结果。
+[[nodiscard]] auto HasTextSearchIndex(sqlite3* db_conn) -> bool;
+
+// use_text_search 为 true 时，remark/day_remark/project 条件先经全文索引
+// 预筛候选行，再保留原 LIKE 条件。
 [[nodiscard]] auto BuildWhereClauses(const QueryFilters& filters,
-                                     std::vector<SqlParam>& params)
+                                     std::vector<SqlParam>& params,
+                                     bool use_text_search)
     -> std::vector<std::string>;
 
 [[nodiscard]] auto QueryStringColumn(sqlite3* db_conn, const std::string& sql,
@@ -7,11 +7,14 @@
 #include <utility>
 #include <vector>
 
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 #include "infra/query/data/data_query_repository_internal.hpp"
 
 namespace tracer_core::infrastructure::query::data::internal {
 namespace {
 
+using tracer::core::infrastructure::persistence::CachedSqliteStatement;
+
 constexpr int kDurationScoreMode = 1;
 
 [[nodiscard]] auto EscapeLikeLiteral(const std::string& value) -> std::string {
@@ -26,14 +29,12 @@ constexpr int kDurationScoreMode = 1;
   return escaped;
 }
 
-auto PrepareStatementOrThrow(sqlite3* db_conn, const std::string& sql)
+auto RequirePreparedStatement(const CachedSqliteStatement& cached)
     -> sqlite3_stmt* {
-  sqlite3_stmt* statement = nullptr;
-  if (sqlite3_prepare_v2(db_conn, sql.c_str(), -1, &statement, nullptr) !=
-      SQLITE_OK) {
+  if (cached.Get() == nullptr) {
     throw std::runtime_error("Failed to prepare query.");
   }
-  return statement;
+  return cached.Get();
 }
 
 auto BindSqlParams(sqlite3_stmt* statement,
@@ -127,33 +128,19 @@ auto ExecuteActivitySuggestions(sqlite3* db_conn, const std::string& sql,
                                 const ActivitySuggestionQueryOptions& options,
                                 int lookback_days, int limit)
     -> std::vector<ActivitySuggestionRow> {
-  sqlite3_stmt* statement = PrepareStatementOrThrow(db_conn, sql);
-  try {
-    BindActivitySuggestions(statement, options, lookback_days, limit);
-    std::vector<ActivitySuggestionRow> rows =
-        ReadActivitySuggestionRows(db_conn, statement);
-    sqlite3_finalize(statement);
-    return rows;
-  } catch (...) {
-    sqlite3_finalize(statement);
-    throw;
-  }
+  const CachedSqliteStatement kStatement(db_conn, sql);
+  sqlite3_stmt* statement = RequirePreparedStatement(kStatement);
+  BindActivitySuggestions(statement, options, lookback_days, limit);
+  return ReadActivitySuggestionRows(db_conn, statement);
 }
 
 auto ExecuteProjectTreeRecords(sqlite3* db_conn, const std::string& sql,
                                const std::vector<detail::SqlParam>& params)
     -> std::vector<std::pair<std::string, std::int64_t>> {
-  sqlite3_stmt* statement = PrepareStatementOrThrow(db_conn, sql);
-  try {
-    BindSqlParams(statement, params);
-    std::vector<std::pair<std::string, std::int64_t>> records =
-        ReadProjectTreeRecords(db_conn, statement);
-    sqlite3_finalize(statement);
-    return records;
-  } catch (...) {
-    sqlite3_finalize(statement);
-    throw;
-  }
+  const CachedSqliteStatement kStatement(db_conn, sql);
+  sqlite3_stmt* statement = RequirePreparedStatement(kStatement);
+  BindSqlParams(statement, params);
+  return ReadProjectTreeRecords(db_conn, statement);
 }
 
 }  // namespace tracer_core::infrastructure::query::data::internal
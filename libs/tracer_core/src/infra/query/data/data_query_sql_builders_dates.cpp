@@ -50,8 +50,8 @@ auto BuildDatesByFiltersSql(sqlite3* db_conn, const QueryFilters& filters,
     sql += " d";
   }
 
-  const std::vector<std::string> kClauses =
-      detail::BuildWhereClauses(filters, params);
+  const std::vector<std::string> kClauses = detail::BuildWhereClauses(
+      filters, params, detail::HasTextSearchIndex(db_conn));
   AppendWhereClauses(sql, kClauses);
 
   sql += " ORDER BY d.";
@@ -89,8 +89,8 @@ auto BuildDayDurationsSql(sqlite3* db_conn, const QueryFilters& filters,
   sql += " = d.";
   sql += schema::day::db::kDate;
 
-  const std::vector<std::string> kClauses =
-      detail::BuildWhereClauses(filters, params);
+  const std::vector<std::string> kClauses = detail::BuildWhereClauses(
+      filters, params, detail::HasTextSearchIndex(db_conn));
   AppendWhereClauses(sql, kClauses);
 
   sql += " GROUP BY d.";
@@ -212,7 +212,8 @@ auto BuildProjectTreeSql(sqlite3* db_conn, const QueryFilters& filters,
   sql += " = d.";
   sql += schema::day::db::kDate;
 
-  std::vector<std::string> clauses = detail::BuildWhereClauses(filters, params);
+  std::vector<std::string> clauses = detail::BuildWhereClauses(
+      filters, params, detail::HasTextSearchIndex(db_conn));
   AddRootNotEmptyClauses(clauses);
   AppendWhereClauses(sql, clauses);
 
@@ -6,12 +6,15 @@
 #include <string>
 #include <string_view>
 
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 #include "infra/query/data/data_query_repository_internal.hpp"
 #include "infra/schema/sqlite_schema.hpp"
 
 namespace tracer_core::infrastructure::query::data::internal {
 namespace {
 
+using tracer::core::infrastructure::persistence::CachedSqliteCapability;
+
 [[nodiscard]] auto EscapeLikeLiteral(const std::string& value) -> std::string {
   std::string escaped;
   escaped.reserve(value.size());
@@ -24,7 +27,7 @@ namespace {
   return escaped;
 }
 
-[[nodiscard]] auto HasProjectPathSnapshotColumn(sqlite3* db_conn) -> bool {
+[[nodiscard]] auto ProbeProjectPathSnapshotColumn(sqlite3* db_conn) -> bool {
   const std::string kSql =
       std::format("PRAGMA table_info({});", schema::time_records::db::kTable);
 
@@ -67,7 +70,9 @@ auto BuildRootPrefixLikePattern(std::string_view root) -> std::string {
 auto EnsureProjectPathSnapshotColumnOrThrow(sqlite3* db_conn,
                                             std::string_view query_name)
     -> void {
-  if (HasProjectPathSnapshotColumn(db_conn)) {
+  // 探测结果按连接缓存，连接池连接上每条连接只执行一次 PRAGMA table_info。
+  if (CachedSqliteCapability(db_conn, "time_records.project_path_snapshot",
+                             ProbeProjectPathSnapshotColumn)) {
     return;
   }
   throw std::runtime_error(std::string(query_name) +
@@ -13,8 +13,6 @@
 #include "infra/query/data/data_query_models.hpp"
 #include "infra/query/data/data_query_types.hpp"
 
-class DBManager;
-
 namespace tracer::core::infrastructure::query::data::internal {
 
 #include "infra/query/data/internal/detail/request_decl.inc"
@@ -24,8 +22,6 @@ namespace tracer::core::infrastructure::query::data::internal {
 namespace tracer::core::infrastructure::query::data::repository::internal {
 
 using tracer::core::infrastructure::query::data::internal::BuildCliFilters;
-using tracer::core::infrastructure::query::data::internal::
-    EnsureDbConnectionOrThrow;
 using tracer::core::infrastructure::query::data::internal::FormatIsoDate;
 using tracer::core::infrastructure::query::data::internal::
     NormalizeBoundaryDate;
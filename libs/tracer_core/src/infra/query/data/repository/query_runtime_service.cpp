@@ -1,11 +1,12 @@
 // infra/query/data/repository/query_runtime_service.cpp
 #include "infra/query/data/repository/query_runtime_service.hpp"
 
+#include <memory>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
-#include "infra/persistence/sqlite/db_manager.hpp"
 #include "infra/query/data/repository/query_runtime_service_internal.hpp"
 
 import tracer.core.infrastructure.query.data.renderers;
@@ -18,9 +19,16 @@ namespace runtime_service_internal =
 
 QueryRuntimeService::QueryRuntimeService(
     std::filesystem::path db_path,
-    std::optional<std::filesystem::path> converter_config_toml_path)
+    std::optional<std::filesystem::path> converter_config_toml_path,
+    std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool)
     : db_path_(std::move(db_path)),
-      converter_config_toml_path_(std::move(converter_config_toml_path)) {}
+      converter_config_toml_path_(std::move(converter_config_toml_path)),
+      read_pool_(std::move(read_pool)) {
+  if (!read_pool_) {
+    read_pool_ =
+        std::make_shared<persistence::SqliteReadConnectionPool>(db_path_);
+  }
+}
 
 auto QueryRuntimeService::RunDataQuery(
     const tracer_core::core::dto::DataQueryRequest& request)
@@ -68,9 +76,12 @@ auto QueryRuntimeService::RunDataQuery(
     runtime_service_internal::ValidateReportCompositionRequest(request);
   }
 
-  DBManager db_manager(db_path_.string());
-  sqlite3* db_conn =
-      runtime_service_internal::EnsureDbConnectionOrThrow(db_manager, db_path_);
+  const auto kLease = read_pool_->TryAcquire();
+  if (!kLease.has_value()) {
+    throw std::runtime_error("Failed to open database at: " +
+                             db_path_.string());
+  }
+  sqlite3* db_conn = kLease->Connection();
 
   const auto kAction =
       runtime_service_internal::ToCliDataQueryAction(request.action);
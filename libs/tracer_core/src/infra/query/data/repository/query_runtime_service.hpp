@@ -3,18 +3,23 @@
 #define INFRASTRUCTURE_QUERY_DATA_REPOSITORY_QUERY_RUNTIME_SERVICE_H_
 
 #include <filesystem>
+#include <memory>
 #include <optional>
 
 #include "application/ports/query/i_data_query_service.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 
 namespace tracer::core::infrastructure::query::data::repository {
 
 class QueryRuntimeService final
     : public tracer_core::application::ports::IDataQueryService {
  public:
-  explicit QueryRuntimeService(std::filesystem::path db_path,
-                               std::optional<std::filesystem::path>
-                                   converter_config_toml_path = std::nullopt);
+  explicit QueryRuntimeService(
+      std::filesystem::path db_path,
+      std::optional<std::filesystem::path> converter_config_toml_path =
+          std::nullopt,
+      std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool =
+          nullptr);
 
   auto RunDataQuery(const tracer_core::core::dto::DataQueryRequest& request)
       -> tracer_core::core::dto::TextOutput override;
@@ -22,6 +27,7 @@ class QueryRuntimeService final
  private:
   std::filesystem::path db_path_;
   std::optional<std::filesystem::path> converter_config_toml_path_;
+  std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool_;
 };
 
 }  // namespace tracer::core::infrastructure::query::data::repository
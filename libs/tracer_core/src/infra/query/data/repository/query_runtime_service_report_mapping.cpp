@@ -1,7 +1,6 @@
 // infra/query/data/repository/query_runtime_service_report_mapping.cpp
 #include <nlohmann/json.hpp>
 #include <algorithm>
-#include <chrono>
 #include <cstdint>
 #include <optional>
 #include <numeric>
@@ -14,6 +13,7 @@
 
 #include "domain/reports/models/project_tree.hpp"
 #include "infra/query/data/internal/report_mapping.hpp"
+#include "shared/utils/civil_time.hpp"
 
 import tracer.core.infrastructure.config.file_converter_config_provider;
 import tracer.core.domain.types.converter_config;
@@ -27,6 +27,7 @@ namespace infra_data_query_orchestrators =
 namespace infra_data_query_stats =
     tracer::core::infrastructure::query::data::stats;
 namespace modtypes = tracer::core::domain::modtypes;
+namespace civil_time = tracer::core::shared::civil_time;
 using FileConverterConfigProvider =
     tracer::core::infrastructure::config::FileConverterConfigProvider;
 
@@ -52,30 +53,19 @@ struct CompositionRootSlice {
   std::int64_t duration_seconds = 0;
 };
 
-auto ParseIsoDateOrThrow(std::string_view value) -> std::chrono::sys_days {
-  if (value.size() != 10 || value[4] != '-' || value[7] != '-') {
+auto ParseIsoDateDaysOrThrow(std::string_view value) -> std::int64_t {
+  const auto date = civil_time::ParseIsoDate(value);
+  if (!date.has_value()) {
     throw std::runtime_error("Invalid ISO date boundary: " + std::string(value));
   }
-
-  const int year = std::stoi(std::string(value.substr(0, 4)));
-  const unsigned month =
-      static_cast<unsigned>(std::stoi(std::string(value.substr(5, 2))));
-  const unsigned day =
-      static_cast<unsigned>(std::stoi(std::string(value.substr(8, 2))));
-  const std::chrono::year_month_day ymd{
-      std::chrono::year{year}, std::chrono::month{month},
-      std::chrono::day{day}};
-  if (!ymd.ok()) {
-    throw std::runtime_error("Invalid ISO date boundary: " + std::string(value));
-  }
-  return std::chrono::sys_days{ymd};
+  return civil_time::DaysFromCivil(*date);
 }
 
 auto InclusiveRangeDays(std::string_view start_date, std::string_view end_date)
     -> int {
-  const auto start = ParseIsoDateOrThrow(start_date);
-  const auto end = ParseIsoDateOrThrow(end_date);
-  return static_cast<int>((end - start).count()) + 1;
+  const auto start = ParseIsoDateDaysOrThrow(start_date);
+  const auto end = ParseIsoDateDaysOrThrow(end_date);
+  return static_cast<int>(end - start) + 1;
 }
 
 auto LoadConverterConfigOrThrow(
@@ -10,7 +10,6 @@
 #include <string_view>
 
 #include "domain/utils/time_utils.hpp"
-#include "infra/persistence/sqlite/db_manager.hpp"
 #include "infra/query/data/internal/request.hpp"
 
 namespace infra_data_query = tracer::core::infrastructure::query::data;
@@ -211,20 +210,6 @@ auto NormalizeBoundaryDate(std::string_view input, bool is_end) -> std::string {
       "Invalid date boundary. Use YYYY, YYYYMM, YYYYMMDD or YYYY-MM-DD.");
 }
 
-auto EnsureDbConnectionOrThrow(DBManager& db_manager,
-                               const std::filesystem::path& db_path)
-    -> sqlite3* {
-  if (!db_manager.OpenDatabaseIfNeeded()) {
-    throw std::runtime_error("Failed to open database at: " + db_path.string());
-  }
-
-  sqlite3* db_conn = db_manager.GetDbConnection();
-  if (db_conn == nullptr) {
-    throw std::runtime_error("Database connection is null.");
-  }
-  return db_conn;
-}
-
 auto ToCliDataQueryAction(tracer_core::core::dto::DataQueryAction action)
     -> infra_data_query::DataQueryAction {
   using CoreAction = tracer_core::core::dto::DataQueryAction;
@@ -10,6 +10,8 @@
 #include <utility>
 #include <vector>
 
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
+#include "infra/reporting/data/queriers/utils/rollup_tables.hpp"
 #include "infra/schema/day_schema.hpp"
 #include "infra/schema/sqlite_schema.hpp"
 
@@ -41,6 +43,9 @@ class BaseQuerier {
   }
 
  protected:
+  using CachedSqliteStatement =
+      tracer::core::infrastructure::persistence::CachedSqliteStatement;
+
   struct DayFlagCounts {
     int status_true_days = 0;
     int wake_anchor_true_days = 0;
@@ -72,24 +77,26 @@ class BaseQuerier {
   }
 
   void FetchRecordsAndDuration(ReportDataType& data) {
-    sqlite3_stmt* stmt;
-
     // Report total_duration is defined as the sum of persisted activity
     // durations. It is not "first start -> last end", so in overnight-heavy
     // day buckets it may legitimately exceed 24 hours.
+    // 汇总表与 time_records 的列名一致，日期条件可直接复用。
     std::string sql = "SELECT ";
     sql += schema::time_records::db::kProjectId;
     sql += ", SUM(";
     sql += schema::time_records::db::kDuration;
     sql += ") FROM ";
-    sql += schema::time_records::db::kTable;
+    sql += UseRollups() ? schema::project_daily_rollup::db::kTable
+                        : schema::time_records::db::kTable;
     sql += " WHERE ";
     sql += GetDateConditionSql();
     sql += " GROUP BY ";
     sql += schema::time_records::db::kProjectId;
     sql += ";";
 
-    if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+    const CachedSqliteStatement kStatement(db_, sql);
+    sqlite3_stmt* stmt = kStatement.Get();
+    if (stmt != nullptr) {
       BindSqlParameters(stmt);
       while (sqlite3_step(stmt) == SQLITE_ROW) {
         std::int64_t project_id = sqlite3_column_int64(stmt, 0);
@@ -100,11 +107,9 @@ class BaseQuerier {
         data.total_duration += total_duration;
       }
     }
-    sqlite3_finalize(stmt);
   }
 
   [[nodiscard]] auto HasAnyDayRows() const -> bool {
-    sqlite3_stmt* stmt = nullptr;
     std::string sql = "SELECT 1 FROM ";
     sql += schema::day::db::kTable;
     sql += " WHERE ";
@@ -112,16 +117,16 @@ class BaseQuerier {
     sql += " LIMIT 1;";
 
     bool exists = false;
-    if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+    const CachedSqliteStatement kStatement(db_, sql);
+    sqlite3_stmt* stmt = kStatement.Get();
+    if (stmt != nullptr) {
       BindSqlParameters(stmt);
       exists = sqlite3_step(stmt) == SQLITE_ROW;
     }
-    sqlite3_finalize(stmt);
     return exists;
   }
 
   [[nodiscard]] auto FetchMatchedDayRowCount() const -> int {
-    sqlite3_stmt* stmt = nullptr;
     std::string sql = "SELECT COUNT(*) FROM ";
     sql += schema::day::db::kTable;
     sql += " WHERE ";
@@ -129,60 +134,74 @@ class BaseQuerier {
     sql += ";";
 
     int count = 0;
-    if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+    const CachedSqliteStatement kStatement(db_, sql);
+    sqlite3_stmt* stmt = kStatement.Get();
+    if (stmt != nullptr) {
       BindSqlParameters(stmt);
       if (sqlite3_step(stmt) == SQLITE_ROW) {
         count = sqlite3_column_int(stmt, 0);
       }
     }
-    sqlite3_finalize(stmt);
     return count;
   }
 
   [[nodiscard]] auto FetchMatchedRecordCount() const -> int {
-    sqlite3_stmt* stmt = nullptr;
-    std::string sql = "SELECT COUNT(*) FROM ";
-    sql += schema::time_records::db::kTable;
+    std::string sql;
+    if (UseRollups()) {
+      sql = "SELECT COALESCE(SUM(";
+      sql += schema::project_daily_rollup::db::kRecordCount;
+      sql += "), 0) FROM ";
+      sql += schema::project_daily_rollup::db::kTable;
+    } else {
+      sql = "SELECT COUNT(*) FROM ";
+      sql += schema::time_records::db::kTable;
+    }
     sql += " WHERE ";
     sql += GetDateConditionSql();
     sql += ";";
 
     int count = 0;
-    if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+    const CachedSqliteStatement kStatement(db_, sql);
+    sqlite3_stmt* stmt = kStatement.Get();
+    if (stmt != nullptr) {
       BindSqlParameters(stmt);
       if (sqlite3_step(stmt) == SQLITE_ROW) {
         count = sqlite3_column_int(stmt, 0);
       }
     }
-    sqlite3_finalize(stmt);
     return count;
   }
 
   // [FIX] This is now a helper for subclasses, not part of the main FetchData
   // flow.
   void FetchActualDays(ReportDataType& data) {
-    sqlite3_stmt* stmt;
-    std::string sql = "SELECT COUNT(DISTINCT ";
-    sql += schema::time_records::db::kDate;
-    sql += ") FROM ";
-    sql += schema::time_records::db::kTable;
+    std::string sql;
+    if (UseRollups()) {
+      // day_flag_rollup 每个有记录的日期恰好一行。
+      sql = "SELECT COUNT(*) FROM ";
+      sql += schema::day_flag_rollup::db::kTable;
+    } else {
+      sql = "SELECT COUNT(DISTINCT ";
+      sql += schema::time_records::db::kDate;
+      sql += ") FROM ";
+      sql += schema::time_records::db::kTable;
+    }
     sql += " WHERE ";
     sql += GetDateConditionSql();
     sql += ";";
 
-    if (sqlite3_prepare_v2(this->db_, sql.c_str(), -1, &stmt, nullptr) ==
-        SQLITE_OK) {
+    const CachedSqliteStatement kStatement(db_, sql);
+    sqlite3_stmt* stmt = kStatement.Get();
+    if (stmt != nullptr) {
       BindSqlParameters(stmt);
       if (sqlite3_step(stmt) == SQLITE_ROW) {
         data.actual_days = sqlite3_column_int(stmt, 0);
       }
     }
-    sqlite3_finalize(stmt);
   }
 
   [[nodiscard]] auto FetchDayFlagCounts() const -> DayFlagCounts {
     DayFlagCounts counts{};
-    sqlite3_stmt* stmt = nullptr;
     // Wake-anchor day counts come from persisted day metadata, not from
     // generated overnight sleep activities or arbitrary sleep_* records.
     std::string sql = "SELECT SUM(CASE WHEN ";
@@ -195,58 +214,43 @@ class BaseQuerier {
     sql += GetDateConditionSql();
     sql += ";";
 
-    if (sqlite3_prepare_v2(this->db_, sql.c_str(), -1, &stmt, nullptr) ==
-        SQLITE_OK) {
+    const CachedSqliteStatement kStatement(db_, sql);
+    sqlite3_stmt* stmt = kStatement.Get();
+    if (stmt != nullptr) {
       BindSqlParameters(stmt);
       if (sqlite3_step(stmt) == SQLITE_ROW) {
         counts.wake_anchor_true_days = sqlite3_column_int(stmt, 0);
       }
     }
-    sqlite3_finalize(stmt);
-
-    stmt = nullptr;
-    std::string record_sql =
-        "SELECT "
-        "COUNT(DISTINCT CASE WHEN (";
-    record_sql += schema::time_records::db::kProjectPathSnapshot;
-    record_sql += " = 'study' OR ";
-    record_sql += schema::time_records::db::kProjectPathSnapshot;
-    record_sql += " LIKE 'study\\_%' ESCAPE '\\') THEN ";
-    record_sql += schema::time_records::db::kDate;
-    record_sql +=
-        " END), "
-        "COUNT(DISTINCT CASE WHEN (";
-    record_sql += schema::time_records::db::kProjectPathSnapshot;
-    record_sql += " = 'exercise' OR ";
-    record_sql += schema::time_records::db::kProjectPathSnapshot;
-    record_sql += " LIKE 'exercise\\_%' ESCAPE '\\') THEN ";
-    record_sql += schema::time_records::db::kDate;
-    record_sql +=
-        " END), "
-        "COUNT(DISTINCT CASE WHEN (";
-    record_sql += schema::time_records::db::kProjectPathSnapshot;
-    record_sql += " = 'exercise_cardio' OR ";
-    record_sql += schema::time_records::db::kProjectPathSnapshot;
-    record_sql += " LIKE 'exercise_cardio\\_%' ESCAPE '\\') THEN ";
-    record_sql += schema::time_records::db::kDate;
-    record_sql +=
-        " END), "
-        "COUNT(DISTINCT CASE WHEN (";
-    record_sql += schema::time_records::db::kProjectPathSnapshot;
-    record_sql += " = 'exercise_anaerobic' OR ";
-    record_sql += schema::time_records::db::kProjectPathSnapshot;
-    record_sql += " LIKE 'exercise_anaerobic\\_%' ESCAPE '\\') THEN ";
-    record_sql += schema::time_records::db::kDate;
-    record_sql +=
-        " END) "
-        "FROM ";
-    record_sql += schema::time_records::db::kTable;
-    record_sql += " WHERE ";
-    record_sql += GetDateConditionSql();
-    record_sql += ";";
 
-    if (sqlite3_prepare_v2(this->db_, record_sql.c_str(), -1, &stmt, nullptr) ==
-        SQLITE_OK) {
+    FetchProjectDayFlagCounts(counts);
+    return counts;
+  }
+
+ private:
+  [[nodiscard]] auto UseRollups() const -> bool {
+    return reports::data::rollup::HasRollupTables(db_);
+  }
+
+  // 标记天数统一读按日标记源，有无汇总表判定一致。
+  void FetchProjectDayFlagCounts(DayFlagCounts& counts) const {
+    std::string sql = "SELECT COALESCE(SUM(";
+    sql += schema::day_flag_rollup::db::kStudy;
+    sql += "), 0), COALESCE(SUM(";
+    sql += schema::day_flag_rollup::db::kExercise;
+    sql += "), 0), COALESCE(SUM(";
+    sql += schema::day_flag_rollup::db::kCardio;
+    sql += "), 0), COALESCE(SUM(";
+    sql += schema::day_flag_rollup::db::kAnaerobic;
+    sql += "), 0) FROM ";
+    sql += reports::data::rollup::DayFlagSourceSql(db_);
+    sql += " WHERE ";
+    sql += GetDateConditionSql();
+    sql += ";";
+
+    const CachedSqliteStatement kStatement(db_, sql);
+    sqlite3_stmt* stmt = kStatement.Get();
+    if (stmt != nullptr) {
       BindSqlParameters(stmt);
       if (sqlite3_step(stmt) == SQLITE_ROW) {
         counts.status_true_days = sqlite3_column_int(stmt, 0);
@@ -255,8 +259,6 @@ class BaseQuerier {
         counts.anaerobic_true_days = sqlite3_column_int(stmt, 3);
       }
     }
-    sqlite3_finalize(stmt);
-    return counts;
   }
 };
 
@@ -6,6 +6,7 @@
 #include <format>
 #include <stdexcept>
 
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 #include "infra/reporting/data/cache/project_name_cache.hpp"
 #include "infra/reporting/data/utils/project_tree_builder.hpp"
 #include "infra/reporting/data/utils/time_derived_stats.hpp"
@@ -14,28 +15,18 @@
 #include "shared/types/reporting_errors.hpp"
 
 namespace {
+using tracer::core::infrastructure::persistence::CachedSqliteStatement;
 using tracer::core::infrastructure::reports::data::stats::
     DerivedTimeStatsAggregator;
 
-auto JoinPathParts(const std::vector<std::string>& parts) -> std::string {
-  if (parts.empty()) {
-    return "";
-  }
-  std::string path = parts[0];
-  for (size_t i = 1; i < parts.size(); ++i) {
-    path += "_" + parts[i];
-  }
-  return path;
-}
-
 auto BuildDailyStats(
     const std::vector<std::pair<std::int64_t, std::int64_t>>& project_stats,
     const IProjectInfoProvider& provider)
     -> std::map<std::string, std::int64_t> {
   DerivedTimeStatsAggregator aggregator;
   for (const auto& [project_id, duration_seconds] : project_stats) {
-    aggregator.AddPathDuration(JoinPathParts(provider.GetPathParts(project_id)),
-                               duration_seconds);
+    aggregator.AddClassifiedDuration(provider.GetClassMask(project_id),
+                                     duration_seconds);
   }
   return aggregator.BuildReportStatsMap();
 }
@@ -46,8 +37,8 @@ auto BuildDailyFlags(
     -> std::pair<std::string, std::string> {
   DerivedTimeStatsAggregator aggregator;
   for (const auto& [project_id, duration_seconds] : project_stats) {
-    aggregator.AddPathDuration(JoinPathParts(provider.GetPathParts(project_id)),
-                               duration_seconds);
+    aggregator.AddClassifiedDuration(provider.GetClassMask(project_id),
+                                     duration_seconds);
   }
   return {
       aggregator.HasStudyActivity() ? "1" : "0",
@@ -95,12 +86,12 @@ void DayQuerier::PrepareData(DailyReportData& data) const {
 }
 
 void DayQuerier::FetchMetadata(DailyReportData& data) {
-  sqlite3_stmt* stmt;
   std::string sql = std::format(
       "SELECT {}, {}, {} FROM {} WHERE {} = ?;", schema::day::db::kWakeAnchor,
       schema::day::db::kRemark, schema::day::db::kGetupTime,
       schema::day::db::kTable, schema::day::db::kDate);
-  if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+  const CachedSqliteStatement kStatement(db_, sql);
+  if (sqlite3_stmt* stmt = kStatement.Get(); stmt != nullptr) {
     sqlite3_bind_text(stmt, 1, param_.data(), static_cast<int>(param_.size()),
                       SQLITE_TRANSIENT);
     if (sqlite3_step(stmt) == SQLITE_ROW) {
@@ -115,12 +106,10 @@ void DayQuerier::FetchMetadata(DailyReportData& data) {
       }
     }
   }
-  sqlite3_finalize(stmt);
 }
 
 void DayQuerier::FetchDetailedRecords(DailyReportData& data,
                                       const IProjectInfoProvider& provider) {
-  sqlite3_stmt* stmt = nullptr;
   std::string sql = std::format(
       "SELECT {0}, {1}, {2}, {3}, {4} "
       "FROM {5} "
@@ -131,7 +120,8 @@ void DayQuerier::FetchDetailedRecords(DailyReportData& data,
       schema::time_records::db::kActivityRemark,
       schema::time_records::db::kTable, schema::time_records::db::kDate,
       schema::time_records::db::kLogicalId);
-  if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+  const CachedSqliteStatement kStatement(db_, sql);
+  if (sqlite3_stmt* stmt = kStatement.Get(); stmt != nullptr) {
     sqlite3_bind_text(stmt, 1, param_.data(), static_cast<int>(param_.size()),
                       SQLITE_TRANSIENT);
     while (sqlite3_step(stmt) == SQLITE_ROW) {
@@ -141,7 +131,7 @@ void DayQuerier::FetchDetailedRecords(DailyReportData& data,
       record.end_time =
           reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
       const std::int64_t kProjectId = sqlite3_column_int64(stmt, 2);
-      record.project_path = JoinPathParts(provider.GetPathParts(kProjectId));
+      record.project_path = provider.GetFullPath(kProjectId);
       record.duration_seconds = sqlite3_column_int64(stmt, 3);
       const unsigned char* remark_text = sqlite3_column_text(stmt, 4);
       if (remark_text != nullptr) {
@@ -150,7 +140,6 @@ void DayQuerier::FetchDetailedRecords(DailyReportData& data,
       data.detailed_records.push_back(record);
     }
   }
-  sqlite3_finalize(stmt);
 }
 
 BatchDayDataFetcher::BatchDayDataFetcher(sqlite3* sqlite_db,
@@ -268,8 +257,7 @@ void BatchDayDataFetcher::FetchTimeRecords(BatchDataResult& result) {
       record.activityRemark = reinterpret_cast<const char*>(remark_ptr);
     }
 
-    std::vector<std::string> parts = provider_.GetPathParts(project_id);
-    record.project_path = JoinPathParts(parts);
+    record.project_path = provider_.GetFullPath(project_id);
 
     data.detailed_records.push_back(record);
     data.total_duration += record.duration_seconds;
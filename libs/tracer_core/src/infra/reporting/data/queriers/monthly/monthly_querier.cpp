@@ -6,32 +6,25 @@
 #include <cctype>
 #include <cstdint>
 #include <format>
-#include <set>
 #include <stdexcept>
 
 #include "infra/reporting/data/cache/project_name_cache.hpp"
 #include "infra/reporting/data/queriers/utils/batch_aggregation.hpp"
-#include "infra/reporting/data/utils/time_derived_stats.hpp"
+#include "infra/reporting/data/queriers/utils/rollup_tables.hpp"
 #include "infra/schema/day_schema.hpp"
 #include "infra/schema/sqlite_schema.hpp"
 #include "shared/types/reporting_errors.hpp"
 
 namespace {
-using tracer::core::infrastructure::reports::data::stats::
-    IsAnaerobicProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsCardioProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsExerciseProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsStudyProjectPath;
-
-auto JoinPathParts(const std::vector<std::string>& parts) -> std::string {
-  if (parts.empty()) {
-    return "";
-  }
-  std::string path = parts[0];
-  for (size_t i = 1; i < parts.size(); ++i) {
-    path += "_" + parts[i];
+
+void EnsureMonthInitialized(MonthlyReportData& data,
+                            const std::string& year_month) {
+  if (data.range_label.empty()) {
+    data.range_label = year_month;
+    data.start_date = year_month + "-01";
+    data.end_date = year_month + "-31";
+    data.requested_days = 0;
   }
-  return path;
 }
 }  // namespace
 
@@ -109,11 +102,14 @@ auto BatchMonthDataFetcher::FetchAllData()
   std::map<std::string, int> exercise_days;
   std::map<std::string, int> cardio_days;
   std::map<std::string, int> anaerobic_days;
-  FetchProjectStats(all_months_data, project_agg, status_days, exercise_days,
-                    cardio_days, anaerobic_days, name_cache);
-
   std::map<std::string, int> actual_days;
-  FetchActualDays(actual_days);
+  if (reports::data::rollup::HasRollupTables(db_)) {
+    FetchRollupProjectStats(all_months_data, project_agg);
+  } else {
+    FetchProjectStats(all_months_data, project_agg);
+  }
+  FetchDayStats(actual_days, status_days, exercise_days, cardio_days,
+                anaerobic_days);
 
   std::map<std::string, int> sleep_days;
   FetchSleepDays(sleep_days);
@@ -144,17 +140,13 @@ auto BatchMonthDataFetcher::FetchAllData()
 
 void BatchMonthDataFetcher::FetchProjectStats(
     std::map<std::string, MonthlyReportData>& all_months_data,
-    std::map<std::string, std::map<std::int64_t, std::int64_t>>& project_agg,
-    std::map<std::string, int>& status_days,
-    std::map<std::string, int>& exercise_days,
-    std::map<std::string, int>& cardio_days,
-    std::map<std::string, int>& anaerobic_days,
-    const IProjectInfoProvider& provider) {
+    std::map<std::string, std::map<std::int64_t, std::int64_t>>&
+        project_agg) {
   sqlite3_stmt* stmt = nullptr;
   const std::string kSql = std::format(
-      "SELECT strftime('%Y-%m', {0}) as ym, {0}, {1}, SUM({2}) "
+      "SELECT strftime('%Y-%m', {0}) as ym, {1}, SUM({2}) "
       "FROM {3} "
-      "GROUP BY ym, {0}, {1} "
+      "GROUP BY ym, {1} "
       "ORDER BY ym;",
       schema::time_records::db::kDate, schema::time_records::db::kProjectId,
       schema::time_records::db::kDuration, schema::time_records::db::kTable);
@@ -163,77 +155,41 @@ void BatchMonthDataFetcher::FetchProjectStats(
     throw std::runtime_error("Failed to prepare statement for monthly stats.");
   }
 
-  std::map<std::string, std::set<std::string>> status_dates;
-  std::map<std::string, std::set<std::string>> exercise_dates;
-  std::map<std::string, std::set<std::string>> cardio_dates;
-  std::map<std::string, std::set<std::string>> anaerobic_dates;
-
   while (sqlite3_step(stmt) == SQLITE_ROW) {
     const unsigned char* ym_ptr = sqlite3_column_text(stmt, 0);
-    const unsigned char* date_ptr = sqlite3_column_text(stmt, 1);
-    if (ym_ptr == nullptr || date_ptr == nullptr) {
+    if (ym_ptr == nullptr) {
       continue;
     }
 
     std::string year_month = reinterpret_cast<const char*>(ym_ptr);
-    std::string date = reinterpret_cast<const char*>(date_ptr);
-    std::int64_t project_id = sqlite3_column_int64(stmt, 2);
-    std::int64_t duration = sqlite3_column_int64(stmt, 3);
+    std::int64_t project_id = sqlite3_column_int64(stmt, 1);
+    std::int64_t duration = sqlite3_column_int64(stmt, 2);
 
     MonthlyReportData& data = all_months_data[year_month];
-    if (data.range_label.empty()) {
-      data.range_label = year_month;
-      data.start_date = year_month + "-01";
-      data.end_date = year_month + "-31";
-      data.requested_days = 0;
-    }
+    EnsureMonthInitialized(data, year_month);
 
     project_agg[year_month][project_id] += duration;
     data.total_duration += duration;
-
-    const std::string project_path =
-        JoinPathParts(provider.GetPathParts(project_id));
-    if (IsStudyProjectPath(project_path)) {
-      status_dates[year_month].insert(date);
-    }
-    if (IsExerciseProjectPath(project_path)) {
-      exercise_dates[year_month].insert(date);
-    }
-    if (IsCardioProjectPath(project_path)) {
-      cardio_dates[year_month].insert(date);
-    }
-    if (IsAnaerobicProjectPath(project_path)) {
-      anaerobic_dates[year_month].insert(date);
-    }
   }
   sqlite3_finalize(stmt);
-
-  for (const auto& [year_month, dates] : status_dates) {
-    status_days[year_month] = static_cast<int>(dates.size());
-  }
-  for (const auto& [year_month, dates] : exercise_dates) {
-    exercise_days[year_month] = static_cast<int>(dates.size());
-  }
-  for (const auto& [year_month, dates] : cardio_dates) {
-    cardio_days[year_month] = static_cast<int>(dates.size());
-  }
-  for (const auto& [year_month, dates] : anaerobic_dates) {
-    anaerobic_days[year_month] = static_cast<int>(dates.size());
-  }
 }
 
-void BatchMonthDataFetcher::FetchActualDays(
-    std::map<std::string, int>& actual_days) {
+void BatchMonthDataFetcher::FetchRollupProjectStats(
+    std::map<std::string, MonthlyReportData>& all_months_data,
+    std::map<std::string, std::map<std::int64_t, std::int64_t>>&
+        project_agg) {
   sqlite3_stmt* stmt = nullptr;
   const std::string kSql = std::format(
-      "SELECT strftime('%Y-%m', {0}) as ym, COUNT(DISTINCT {0}) "
-      "FROM {1} "
-      "GROUP BY ym;",
-      schema::time_records::db::kDate, schema::time_records::db::kTable);
+      "SELECT {0}, {1}, {2} FROM {3} ORDER BY {0};",
+      schema::project_monthly_rollup::db::kYearMonth,
+      schema::project_monthly_rollup::db::kProjectId,
+      schema::project_monthly_rollup::db::kDuration,
+      schema::project_monthly_rollup::db::kTable);
 
   if (sqlite3_prepare_v2(db_, kSql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    sqlite3_finalize(stmt);
     throw std::runtime_error(
-        "Failed to prepare statement for monthly actual days.");
+        "Failed to prepare statement for monthly rollup stats.");
   }
 
   while (sqlite3_step(stmt) == SQLITE_ROW) {
@@ -243,14 +199,56 @@ void BatchMonthDataFetcher::FetchActualDays(
     }
 
     std::string year_month = reinterpret_cast<const char*>(ym_ptr);
-    int days = sqlite3_column_int(stmt, 1);
+    std::int64_t project_id = sqlite3_column_int64(stmt, 1);
+    std::int64_t duration = sqlite3_column_int64(stmt, 2);
 
-    actual_days[year_month] = days;
+    MonthlyReportData& data = all_months_data[year_month];
+    EnsureMonthInitialized(data, year_month);
+    project_agg[year_month][project_id] += duration;
+    data.total_duration += duration;
   }
   sqlite3_finalize(stmt);
 }
 
 // NOLINTBEGIN(bugprone-easily-swappable-parameters)
+void BatchMonthDataFetcher::FetchDayStats(
+    std::map<std::string, int>& actual_days,
+    std::map<std::string, int>& status_days,
+    std::map<std::string, int>& exercise_days,
+    std::map<std::string, int>& cardio_days,
+    std::map<std::string, int>& anaerobic_days) {
+  sqlite3_stmt* stmt = nullptr;
+  const std::string kSql = std::format(
+      "SELECT {0}, COUNT(*), SUM({1}), SUM({2}), SUM({3}), SUM({4}) "
+      "FROM {5} GROUP BY {0};",
+      schema::day_flag_rollup::db::kYearMonth,
+      schema::day_flag_rollup::db::kStudy,
+      schema::day_flag_rollup::db::kExercise,
+      schema::day_flag_rollup::db::kCardio,
+      schema::day_flag_rollup::db::kAnaerobic,
+      reports::data::rollup::DayFlagSourceSql(db_));
+
+  if (sqlite3_prepare_v2(db_, kSql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    throw std::runtime_error("Failed to prepare statement for monthly days.");
+  }
+
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    const unsigned char* ym_ptr = sqlite3_column_text(stmt, 0);
+    if (ym_ptr == nullptr) {
+      continue;
+    }
+
+    std::string year_month = reinterpret_cast<const char*>(ym_ptr);
+    actual_days[year_month] = sqlite3_column_int(stmt, 1);
+    status_days[year_month] = sqlite3_column_int(stmt, 2);
+    exercise_days[year_month] = sqlite3_column_int(stmt, 3);
+    cardio_days[year_month] = sqlite3_column_int(stmt, 4);
+    anaerobic_days[year_month] = sqlite3_column_int(stmt, 5);
+  }
+  sqlite3_finalize(stmt);
+}
+
 void BatchMonthDataFetcher::FetchSleepDays(
     std::map<std::string, int>& sleep_days) {
   sqlite3_stmt* stmt = nullptr;
@@ -43,13 +43,19 @@ class BatchMonthDataFetcher {
 
   void FetchProjectStats(
       std::map<std::string, MonthlyReportData>& all_months_data,
-      std::map<std::string, std::map<std::int64_t, std::int64_t>>& project_agg,
-      std::map<std::string, int>& status_days,
-      std::map<std::string, int>& exercise_days,
-      std::map<std::string, int>& cardio_days,
-      std::map<std::string, int>& anaerobic_days,
-      const IProjectInfoProvider& provider);
-  void FetchActualDays(std::map<std::string, int>& actual_days);
+      std::map<std::string, std::map<std::int64_t, std::int64_t>>&
+          project_agg);
+  // 汇总表路径：项目时长读月汇总。
+  void FetchRollupProjectStats(
+      std::map<std::string, MonthlyReportData>& all_months_data,
+      std::map<std::string, std::map<std::int64_t, std::int64_t>>&
+          project_agg);
+  // 天数与标记读按日标记源，有无汇总表判定一致。
+  void FetchDayStats(std::map<std::string, int>& actual_days,
+                     std::map<std::string, int>& status_days,
+                     std::map<std::string, int>& exercise_days,
+                     std::map<std::string, int>& cardio_days,
+                     std::map<std::string, int>& anaerobic_days);
   void FetchSleepDays(std::map<std::string, int>& sleep_days);
 };
 
@@ -3,26 +3,125 @@
 #include <sqlite3.h>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstdint>
 #include <format>
+#include <limits>
 #include <map>
-#include <set>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
+#include "infra/persistence/sqlite/record_column_snapshot.hpp"
 #include "infra/reporting/data/cache/project_name_cache.hpp"  // 引入名称缓存作为 Provider
 #include "infra/reporting/data/queriers/utils/batch_aggregation.hpp"
-#include "infra/reporting/data/utils/time_derived_stats.hpp"
+#include "infra/reporting/data/queriers/utils/rollup_tables.hpp"
+#include "infra/reporting/data/queriers/utils/trailing_window_aggregator.hpp"
 #include "infra/reporting/shared/utils/format/time_format.hpp"  // 需要用到 AddDaysToDateStr
 #include "infra/schema/day_schema.hpp"
 #include "infra/schema/sqlite_schema.hpp"
+#include "shared/utils/civil_time.hpp"
 
 namespace {
-using tracer::core::infrastructure::reports::data::stats::
-    IsAnaerobicProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsCardioProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsExerciseProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsStudyProjectPath;
+using tracer::core::infrastructure::persistence::RecordColumnSnapshot;
+using reports::data::window::TrailingWindowAggregator;
+namespace civil_time = tracer::core::shared::civil_time;
+
+// 记录标记沿用快照的位定义，起床锚点占用最高位。
+constexpr std::uint8_t kStudyBit = RecordColumnSnapshot::kStudyFlag;
+constexpr std::uint8_t kExerciseBit = RecordColumnSnapshot::kExerciseFlag;
+constexpr std::uint8_t kCardioBit = RecordColumnSnapshot::kCardioFlag;
+constexpr std::uint8_t kAnaerobicBit = RecordColumnSnapshot::kAnaerobicFlag;
+constexpr std::uint8_t kWakeAnchorBit = 1U << 7U;
+
+auto ToDayNumber(const civil_time::CivilDate& date) -> std::int32_t {
+  return static_cast<std::int32_t>(civil_time::DaysFromCivil(date));
+}
+
+auto FlagDays(const reports::data::window::WindowTotals& totals,
+              std::uint8_t flag) -> int {
+  return totals.flag_days[static_cast<std::size_t>(std::countr_zero(flag))];
+}
+
+// 结果集按日期聚集时只在日期变化时重新解析；无法解析的日期返回 nullopt。
+class DayNumberParser {
+ public:
+  auto Parse(const unsigned char* date_ptr) -> std::optional<std::int32_t> {
+    if (date_ptr == nullptr) {
+      return std::nullopt;
+    }
+    const auto* date_text = reinterpret_cast<const char*>(date_ptr);
+    if (last_text_ != date_text) {
+      last_text_ = date_text;
+      const auto kDate = civil_time::ParseIsoDate(last_text_);
+      last_day_ = kDate.has_value() ? std::optional(ToDayNumber(*kDate))
+                                    : std::nullopt;
+    }
+    return last_day_;
+  }
+
+ private:
+  std::string last_text_;
+  std::optional<std::int32_t> last_day_;
+};
+
+// 快照行已按日期升序，直接把起始日之后的行交给聚合器。
+auto AddSnapshotRecords(const RecordColumnSnapshot& snapshot,
+                        std::int32_t start_day,
+                        TrailingWindowAggregator& aggregator) -> void {
+  const auto kRows = snapshot.RowsInDays(
+      start_day, std::numeric_limits<std::int32_t>::max());
+  const auto kDays = snapshot.Days();
+  const auto kProjectIds = snapshot.ProjectIds();
+  const auto kDurations = snapshot.Durations();
+  const auto kFlags = snapshot.Flags();
+  aggregator.Reserve(kRows.end - kRows.begin);
+  for (std::size_t row = kRows.begin; row < kRows.end; ++row) {
+    aggregator.AddRecord(kDays[row], kProjectIds[row], kDurations[row],
+                         kFlags[row]);
+  }
+}
+
+// 无快照时项目标记按日读按日标记源，与快照同样以记录的项目路径快照为准。
+auto AddProjectDayFlags(sqlite3* sqlite_db, const std::string& start_date,
+                        TrailingWindowAggregator& aggregator) -> void {
+  const std::string kSql = std::format(
+      "SELECT {0}, {1}, {2}, {3}, {4} FROM {5} WHERE {0} >= ?",
+      schema::day_flag_rollup::db::kDate, schema::day_flag_rollup::db::kStudy,
+      schema::day_flag_rollup::db::kExercise,
+      schema::day_flag_rollup::db::kCardio,
+      schema::day_flag_rollup::db::kAnaerobic,
+      reports::data::rollup::DayFlagSourceSql(sqlite_db));
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    throw std::runtime_error(
+        "Failed to prepare statement for batch period project flags.");
+  }
+  sqlite3_bind_text(stmt, 1, start_date.c_str(), -1, SQLITE_TRANSIENT);
+
+  constexpr std::array<std::uint8_t, 4> kBits = {kStudyBit, kExerciseBit,
+                                                 kCardioBit, kAnaerobicBit};
+  DayNumberParser day_parser;
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    const auto kDay = day_parser.Parse(sqlite3_column_text(stmt, 0));
+    if (!kDay.has_value()) {
+      continue;
+    }
+    std::uint8_t flags = 0;
+    for (std::size_t index = 0; index < kBits.size(); ++index) {
+      if (sqlite3_column_int(stmt, static_cast<int>(index) + 1) != 0) {
+        flags |= kBits[index];
+      }
+    }
+    aggregator.AddDayFlags(*kDay, flags);
+  }
+  sqlite3_finalize(stmt);
+}
 }  // namespace
 
 BatchPeriodDataFetcher::BatchPeriodDataFetcher(
@@ -34,7 +133,6 @@ BatchPeriodDataFetcher::BatchPeriodDataFetcher(
   }
 }
 
-// NOLINTNEXTLINE(readability-function-cognitive-complexity)
 auto BatchPeriodDataFetcher::FetchAllData(const std::vector<int>& days_list)
     -> std::map<int, PeriodReportData> {
   std::map<int, PeriodReportData> results;
@@ -49,133 +147,113 @@ auto BatchPeriodDataFetcher::FetchAllData(const std::vector<int>& days_list)
   }
 
   std::string today_str = platform_clock_.TodayLocalDateIso();
+  const auto kToday = civil_time::ParseIsoDate(today_str);
+  if (!kToday.has_value()) {
+    throw std::runtime_error("Invalid local date for batch period data: " +
+                             today_str);
+  }
+  const std::int32_t kTodayDay = ToDayNumber(*kToday);
   // 计算最大范围的起始日期（包含今天，所以是 max_days - 1）
+  const std::int32_t kMaxStartDay = kTodayDay - (max_days - 1);
   std::string max_start_date = AddDaysToDateStr(today_str, -(max_days - 1));
 
   // 使用本次查询的本地快照，避免跨查询生命周期污染。
   ProjectNameCache name_cache;
   name_cache.EnsureLoaded(db_);
 
-  // 2. 执行一次 SQL 查询，获取最大范围内的所有数据
-  std::vector<RawRecord> raw_records;
-  struct RawDayFlag {
-    std::string date;
-    int sleep = 0;
-  };
-  std::vector<RawDayFlag> raw_day_flags;
-  sqlite3_stmt* stmt = nullptr;
-
-  // 查询：日期 >= max_start_date
-  const std::string kSql = std::format(
-      "SELECT {0}, {1}, {2} FROM {3} WHERE {0} >= ?",
-      schema::time_records::db::kDate, schema::time_records::db::kProjectId,
-      schema::time_records::db::kDuration, schema::time_records::db::kTable);
-
-  if (sqlite3_prepare_v2(db_, kSql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+  // 2. 把最大范围内的记录与起床锚点一次性交给窗口聚合器。
+  // 长驻进程里同一导入代次共享列式快照，直接取其中的连续数组；
+  // 取不到快照（内存库、旧库等）时执行一次 SQL 查询。
+  TrailingWindowAggregator aggregator;
+  const auto kSnapshot =
+      tracer::core::infrastructure::persistence::AcquireRecordColumnSnapshot(
+          db_);
+  if (kSnapshot != nullptr) {
+    AddSnapshotRecords(*kSnapshot, kMaxStartDay, aggregator);
+  } else {
+    // 有日汇总表时每天每项目只有一行，列名与 time_records 一致。
+    const std::string_view kSourceTable =
+        reports::data::rollup::HasRollupTables(db_)
+            ? schema::project_daily_rollup::db::kTable
+            : schema::time_records::db::kTable;
+    const std::string kSql = std::format(
+        "SELECT {0}, {1}, {2} FROM {3} WHERE {0} >= ? ORDER BY {0}",
+        schema::time_records::db::kDate, schema::time_records::db::kProjectId,
+        schema::time_records::db::kDuration, kSourceTable);
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db_, kSql.c_str(), -1, &stmt, nullptr) !=
+        SQLITE_OK) {
+      sqlite3_finalize(stmt);
+      throw std::runtime_error(
+          "Failed to prepare statement for batch period data.");
+    }
     sqlite3_bind_text(stmt, 1, max_start_date.c_str(), -1, SQLITE_TRANSIENT);
 
+    DayNumberParser day_parser;
     while (sqlite3_step(stmt) == SQLITE_ROW) {
-      const unsigned char* date_ptr = sqlite3_column_text(stmt, 0);
-      std::string date =
-          (date_ptr != nullptr) ? reinterpret_cast<const char*>(date_ptr) : "";
-      std::int64_t pid = sqlite3_column_int64(stmt, 1);
-      std::int64_t dur = sqlite3_column_int64(stmt, 2);
-
-      raw_records.push_back({std::move(date), pid, dur});
+      const auto kDay = day_parser.Parse(sqlite3_column_text(stmt, 0));
+      if (!kDay.has_value()) {
+        continue;
+      }
+      aggregator.AddRecord(*kDay, sqlite3_column_int64(stmt, 1),
+                           sqlite3_column_int64(stmt, 2), 0);
     }
     sqlite3_finalize(stmt);
-  } else {
-    throw std::runtime_error(
-        "Failed to prepare statement for batch period data.");
+    AddProjectDayFlags(db_, max_start_date, aggregator);
   }
 
   sqlite3_stmt* flag_stmt = nullptr;
   const std::string kFlagSql = std::format(
-      "SELECT {0}, {1} FROM {2} WHERE {0} >= ?", schema::day::db::kDate,
-      schema::day::db::kWakeAnchor, schema::day::db::kTable);
-  if (sqlite3_prepare_v2(db_, kFlagSql.c_str(), -1, &flag_stmt, nullptr) ==
+      "SELECT {0}, {1} FROM {2} WHERE {0} >= ? AND {1} != 0",
+      schema::day::db::kDate, schema::day::db::kWakeAnchor,
+      schema::day::db::kTable);
+  if (sqlite3_prepare_v2(db_, kFlagSql.c_str(), -1, &flag_stmt, nullptr) !=
       SQLITE_OK) {
-    sqlite3_bind_text(flag_stmt, 1, max_start_date.c_str(), -1,
-                      SQLITE_TRANSIENT);
-    while (sqlite3_step(flag_stmt) == SQLITE_ROW) {
-      const unsigned char* date_ptr = sqlite3_column_text(flag_stmt, 0);
-      std::string date =
-          (date_ptr != nullptr) ? reinterpret_cast<const char*>(date_ptr) : "";
-      int sleep = sqlite3_column_int(flag_stmt, 1);
-      raw_day_flags.push_back({std::move(date), sleep});
-    }
-    sqlite3_finalize(flag_stmt);
-  } else {
     sqlite3_finalize(flag_stmt);
     throw std::runtime_error(
         "Failed to prepare statement for batch period flags.");
   }
+  sqlite3_bind_text(flag_stmt, 1, max_start_date.c_str(), -1,
+                    SQLITE_TRANSIENT);
+  DayNumberParser flag_day_parser;
+  while (sqlite3_step(flag_stmt) == SQLITE_ROW) {
+    const auto kDay = flag_day_parser.Parse(sqlite3_column_text(flag_stmt, 0));
+    if (kDay.has_value()) {
+      aggregator.AddDayFlags(*kDay, kWakeAnchorBit);
+    }
+  }
+  sqlite3_finalize(flag_stmt);
 
-  // 3. 在内存中为每个 requested_days 进行聚合
+  // 3. 一次扫描得到所有窗口的累计值
+  std::vector<int> windows;
+  std::vector<std::int32_t> start_days;
   for (int days : days_list) {
-    if (days <= 0) {
-      continue;
+    if (days > 0) {
+      windows.push_back(days);
+      start_days.push_back(kTodayDay - (days - 1));
     }
+  }
+  auto totals = aggregator.Sweep(start_days);
 
-    PeriodReportData& data = results[days];
-    data.requested_days = days;
+  for (std::size_t index = 0; index < windows.size(); ++index) {
+    const int kDays = windows[index];
+    auto& window_totals = totals[index];
+    PeriodReportData& data = results[kDays];
+    data.requested_days = kDays;
     data.end_date = today_str;
-    data.start_date = AddDaysToDateStr(today_str, -(days - 1));
-    data.range_label = std::to_string(days) + " days";
-
-    // 临时聚合容器: Project ID -> Duration
-    std::map<std::int64_t, std::int64_t> project_agg;
-    std::set<std::string> distinct_dates;
-    std::set<std::string> status_dates;
-    std::set<std::string> exercise_dates;
-    std::set<std::string> cardio_dates;
-    std::set<std::string> anaerobic_dates;
-
-    for (const auto& record : raw_records) {
-      // 字符串日期比较： "2025-01-01" >= "2024-12-31" 依然成立（字典序）
-      if (record.date >= data.start_date) {
-        project_agg[record.project_id] += record.duration;
-        data.total_duration += record.duration;
-        distinct_dates.insert(record.date);
-
-        const auto kPathParts = name_cache.GetPathParts(record.project_id);
-        std::string project_path;
-        if (!kPathParts.empty()) {
-          project_path = kPathParts.front();
-          for (size_t index = 1; index < kPathParts.size(); ++index) {
-            project_path += "_" + kPathParts[index];
-          }
-        }
-        if (IsStudyProjectPath(project_path)) {
-          status_dates.insert(record.date);
-        }
-        if (IsExerciseProjectPath(project_path)) {
-          exercise_dates.insert(record.date);
-        }
-        if (IsCardioProjectPath(project_path)) {
-          cardio_dates.insert(record.date);
-        }
-        if (IsAnaerobicProjectPath(project_path)) {
-          anaerobic_dates.insert(record.date);
-        }
-      }
-    }
-
-    for (const auto& flag : raw_day_flags) {
-      if (flag.date >= data.start_date) {
-        if (flag.sleep != 0) {
-          data.wake_anchor_true_days++;
-        }
-      }
-    }
+    data.start_date = AddDaysToDateStr(today_str, -(kDays - 1));
+    data.range_label = std::to_string(kDays) + " days";
 
-    data.status_true_days = static_cast<int>(status_dates.size());
-    data.exercise_true_days = static_cast<int>(exercise_dates.size());
-    data.cardio_true_days = static_cast<int>(cardio_dates.size());
-    data.anaerobic_true_days = static_cast<int>(anaerobic_dates.size());
+    data.total_duration = window_totals.total_duration;
+    data.status_true_days = FlagDays(window_totals, kStudyBit);
+    data.exercise_true_days = FlagDays(window_totals, kExerciseBit);
+    data.cardio_true_days = FlagDays(window_totals, kCardioBit);
+    data.anaerobic_true_days = FlagDays(window_totals, kAnaerobicBit);
+    data.wake_anchor_true_days = FlagDays(window_totals, kWakeAnchorBit);
 
-    reports::data::batch::FinalizeAggregation(data, project_agg, distinct_dates,
-                                              name_cache);
+    reports::data::batch::FinalizeAggregation(
+        data, window_totals.project_durations, window_totals.record_days,
+        name_cache);
   }
 
   return results;
@@ -4,7 +4,6 @@
 
 #include "infra/sqlite_fwd.hpp"
 
-#include <cstdint>
 #include <map>
 #include <vector>
 
@@ -16,7 +15,9 @@
  * @brief 专用于批量获取周期报告数据。
  * * 优化策略：
  * 找出最大的周期天数，一次性从数据库获取该范围内的所有记录。
- * 然后在内存中为较短的周期进行过滤和聚合，避免重复查询数据库。
+ * 记录按日排序后从新到旧扫描一次，扫过各周期起始日时取出累计值，
+ * 周期个数不影响扫描次数。
+ * 能取到进程内的记录列式快照时不再查询 time_records，直接读取快照。
  */
 class BatchPeriodDataFetcher {
  public:
@@ -35,13 +36,6 @@ class BatchPeriodDataFetcher {
  private:
   sqlite3* db_;
   const tracer_core::application::ports::IPlatformClock& platform_clock_;
-
-  // 内部结构，用于存储原始查询结果
-  struct RawRecord {
-    std::string date;
-    std::int64_t project_id;
-    std::int64_t duration;
-  };
 };
 
 #endif  // INFRASTRUCTURE_REPORTS_DATA_QUERIERS_PERIOD_BATCH_PERIOD_DATA_FETCHER_H_
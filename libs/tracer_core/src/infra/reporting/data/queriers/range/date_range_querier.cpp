@@ -2,66 +2,19 @@
 #include "infra/reporting/data/queriers/range/date_range_querier.hpp"
 #include <sqlite3.h>
 
-#include <cctype>
-#include <chrono>
+#include <cstdint>
 #include <format>
 #include <limits>
 #include <string_view>
 
 #include "infra/schema/day_schema.hpp"
+#include "shared/utils/civil_time.hpp"
 
 namespace {
 
-constexpr size_t kIsoDateLength = 10;
-constexpr size_t kYearSeparatorIndex = 4;
-constexpr size_t kMonthSeparatorIndex = 7;
-constexpr size_t kYearLength = 4;
-constexpr size_t kMonthOffset = 5;
-constexpr size_t kDayOffset = 8;
-constexpr size_t kMonthDayLength = 2;
-constexpr int kDecimalBase = 10;
-constexpr int kInclusiveDaySpan = 1;
-
-auto ParseUnsigned(std::string_view value, int& out_value) -> bool {
-  if (value.empty()) {
-    return false;
-  }
-  int parsed = 0;
-  for (const char kCharacter : value) {
-    if (std::isdigit(static_cast<unsigned char>(kCharacter)) == 0) {
-      return false;
-    }
-    parsed = (parsed * kDecimalBase) + (kCharacter - '0');
-  }
-  out_value = parsed;
-  return true;
-}
+namespace civil_time = tracer::core::shared::civil_time;
 
-auto ParseIsoDate(std::string_view value, std::chrono::year_month_day& out_ymd)
-    -> bool {
-  if (value.size() != kIsoDateLength || value[kYearSeparatorIndex] != '-' ||
-      value[kMonthSeparatorIndex] != '-') {
-    return false;
-  }
-
-  int year = 0;
-  int month = 0;
-  int day = 0;
-  if (!ParseUnsigned(value.substr(0, kYearLength), year) ||
-      !ParseUnsigned(value.substr(kMonthOffset, kMonthDayLength), month) ||
-      !ParseUnsigned(value.substr(kDayOffset, kMonthDayLength), day)) {
-    return false;
-  }
-
-  const std::chrono::year_month_day kYmd(
-      std::chrono::year(year), std::chrono::month(static_cast<unsigned>(month)),
-      std::chrono::day(static_cast<unsigned>(day)));
-  if (!kYmd.ok()) {
-    return false;
-  }
-  out_ymd = kYmd;
-  return true;
-}
+constexpr int kInclusiveDaySpan = 1;
 
 }  // namespace
 
@@ -112,20 +65,19 @@ void DateRangeQuerier::BindSqlParameters(sqlite3_stmt* stmt) const {
 
 auto DateRangeQuerier::TryBuildRequestedDays(int& requested_days) const
     -> bool {
-  std::chrono::year_month_day start_ymd;
-  std::chrono::year_month_day end_ymd;
-  if (!ParseIsoDate(this->param_.start_date, start_ymd) ||
-      !ParseIsoDate(this->param_.end_date, end_ymd)) {
+  const auto kStartDate = civil_time::ParseIsoDate(this->param_.start_date);
+  const auto kEndDate = civil_time::ParseIsoDate(this->param_.end_date);
+  if (!kStartDate.has_value() || !kEndDate.has_value()) {
     return false;
   }
 
-  const auto kStartDays = std::chrono::sys_days(start_ymd);
-  const auto kEndDays = std::chrono::sys_days(end_ymd);
+  const std::int64_t kStartDays = civil_time::DaysFromCivil(*kStartDate);
+  const std::int64_t kEndDays = civil_time::DaysFromCivil(*kEndDate);
   if (kStartDays > kEndDays) {
     return false;
   }
 
-  const auto kSpanDays = (kEndDays - kStartDays).count() + kInclusiveDaySpan;
+  const std::int64_t kSpanDays = (kEndDays - kStartDays) + kInclusiveDaySpan;
   if (kSpanDays > std::numeric_limits<int>::max()) {
     return false;
   }
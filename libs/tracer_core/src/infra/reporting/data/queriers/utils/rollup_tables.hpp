@@ -0,0 +1,102 @@
+// infra/reporting/data/queriers/utils/rollup_tables.hpp
+#ifndef INFRASTRUCTURE_REPORTS_DATA_QUERIERS_UTILS_ROLLUP_TABLES_H_
+#define INFRASTRUCTURE_REPORTS_DATA_QUERIERS_UTILS_ROLLUP_TABLES_H_
+
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <string_view>
+
+#include "infra/persistence/sqlite/project_dictionary.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
+#include "infra/schema/sqlite_schema.hpp"
+
+namespace reports::data::rollup {
+
+namespace detail {
+
+[[nodiscard]] inline auto ProbeRollupTables(sqlite3* sqlite_db) -> bool {
+  constexpr std::array<std::string_view, 3> kTables = {
+      schema::project_daily_rollup::db::kTable,
+      schema::project_monthly_rollup::db::kTable,
+      schema::day_flag_rollup::db::kTable,
+  };
+
+  return std::ranges::all_of(
+      kTables, [sqlite_db](std::string_view table) -> bool {
+        return tracer::core::infrastructure::persistence::TableExists(
+            sqlite_db, table);
+      });
+}
+
+[[nodiscard]] inline auto ProbeDayFlagRollup(sqlite3* sqlite_db) -> bool {
+  return ProbeRollupTables(sqlite_db) &&
+         tracer::core::infrastructure::persistence::DayFlagRollupMatchesRules(
+             sqlite_db);
+}
+
+}  // namespace detail
+
+/**
+ * @brief 数据库是否带有导入时维护的汇总表。
+ *
+ * 汇总表由导入器在写明细的同一事务内维护，首次建表时全量回填；
+ * 缺表的旧库回退到直接聚合 time_records。
+ */
+[[nodiscard]] inline auto HasRollupTables(sqlite3* sqlite_db) -> bool {
+  return tracer::core::infrastructure::persistence::CachedSqliteCapability(
+      sqlite_db, "rollup_tables", detail::ProbeRollupTables);
+}
+
+/**
+ * @brief day_flag_rollup 是否按当前生效的分类规则生成。
+ *
+ * 分类规则改动后、下一次导入重建之前，旧汇总的标记列已过时；
+ * 日期行本身不受影响，HasRollupTables 的其他用途照常。
+ */
+[[nodiscard]] inline auto HasCurrentDayFlagRollup(sqlite3* sqlite_db)
+    -> bool {
+  return tracer::core::infrastructure::persistence::CachedSqliteCapability(
+      sqlite_db, "day_flag_rollup", detail::ProbeDayFlagRollup);
+}
+
+/**
+ * @brief 按日标记的数据源：每个有记录的日期一行，列同 day_flag_rollup。
+ *
+ * 汇总表按当前规则生成时即 day_flag_rollup；否则按记录的项目路径快照
+ * 现场聚合 time_records。两者的判定都由 ProjectClassPathSql 生成，标记
+ * 天数因此与是否存在汇总表无关。返回值可直接放在 FROM 之后。
+ */
+[[nodiscard]] inline auto DayFlagSourceSql(sqlite3* sqlite_db)
+    -> std::string {
+  namespace flags = schema::day_flag_rollup::db;
+  namespace records = schema::time_records::db;
+  if (HasCurrentDayFlagRollup(sqlite_db)) {
+    return std::string(flags::kTable);
+  }
+
+  constexpr std::array<std::string_view, 4> kFlagColumns = {
+      flags::kStudy, flags::kExercise, flags::kCardio, flags::kAnaerobic};
+  const auto& kFlagClasses =
+      tracer::core::infrastructure::persistence::kDayFlagClasses;
+  std::string sql = std::format("(SELECT {0} AS {1}, substr({0}, 1, 7) AS {2}",
+                                records::kDate, flags::kDate,
+                                flags::kYearMonth);
+  for (std::size_t index = 0; index < kFlagColumns.size(); ++index) {
+    sql += std::format(
+        ", COALESCE(MAX({}), 0) AS {}",
+        tracer::core::infrastructure::persistence::ProjectClassPathSql(
+            kFlagClasses[index], records::kProjectPathSnapshot),
+        kFlagColumns[index]);
+  }
+  sql += std::format(" FROM {} GROUP BY {})", records::kTable, records::kDate);
+  return sql;
+}
+
+}  // namespace reports::data::rollup
+
+#endif  // INFRASTRUCTURE_REPORTS_DATA_QUERIERS_UTILS_ROLLUP_TABLES_H_
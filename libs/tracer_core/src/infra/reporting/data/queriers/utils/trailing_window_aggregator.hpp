@@ -0,0 +1,133 @@
+// infra/reporting/data/queriers/utils/trailing_window_aggregator.hpp
+#ifndef INFRASTRUCTURE_REPORTS_DATA_QUERIERS_UTILS_TRAILING_WINDOW_AGGREGATOR_H_
+#define INFRASTRUCTURE_REPORTS_DATA_QUERIERS_UTILS_TRAILING_WINDOW_AGGREGATOR_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace reports::data::window {
+
+inline constexpr std::size_t kDayFlagBits = 8;
+
+// 一个窗口 [start_day, +∞) 的汇总。
+struct WindowTotals {
+  std::int64_t total_duration = 0;
+  // 至少有一条记录的天数。
+  int record_days = 0;
+  // flag_days[i]：当天任一条目带有第 i 位标记的天数。
+  std::array<int, kDayFlagBits> flag_days{};
+  // 窗口内出现过的项目（含时长为 0 的记录）。
+  std::map<std::int64_t, std::int64_t> project_durations;
+};
+
+/**
+ * @class TrailingWindowAggregator
+ * @brief 一次扫描回答任意多个尾部窗口。
+ *
+ * 条目按日序号排序一次，再从最新一天向最早一天扫描：逐日累加项目时长
+ * 并合并当天的标记位，扫过某个窗口的起始日时输出当时的累计值。
+ * 窗口之间天然嵌套，每条记录只被访问一次，与窗口个数无关。
+ * 标记位的含义由调用方决定，这里只按位统计天数。
+ */
+class TrailingWindowAggregator {
+ public:
+  auto Reserve(std::size_t entry_count) -> void {
+    entries_.reserve(entry_count);
+  }
+
+  auto AddRecord(std::int32_t day, std::int64_t project_id,
+                 std::int64_t duration, std::uint8_t flags) -> void {
+    auto [slot_it, inserted] = project_slots_.try_emplace(
+        project_id, static_cast<std::uint32_t>(slot_projects_.size()));
+    if (inserted) {
+      slot_projects_.push_back(project_id);
+    }
+    entries_.push_back({.day = day,
+                        .slot = slot_it->second,
+                        .duration = duration,
+                        .flags = flags,
+                        .is_record = true});
+  }
+
+  // 与记录无关的按日标记（例如 days 表中的起床锚点）。
+  auto AddDayFlags(std::int32_t day, std::uint8_t flags) -> void {
+    entries_.push_back({.day = day, .flags = flags});
+  }
+
+  // 结果与 start_days 一一对应；起始日可以任意顺序、允许重复。
+  [[nodiscard]] auto Sweep(std::span<const std::int32_t> start_days)
+      -> std::vector<WindowTotals> {
+    std::vector<WindowTotals> results(start_days.size());
+    std::vector<std::size_t> order(start_days.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::ranges::sort(order, [start_days](std::size_t left, std::size_t right) {
+      return start_days[left] > start_days[right];
+    });
+    std::ranges::sort(entries_, [](const Entry& left, const Entry& right) {
+      return left.day > right.day;
+    });
+
+    std::vector<std::int64_t> durations(slot_projects_.size(), 0);
+    std::vector<std::uint8_t> seen(slot_projects_.size(), 0);
+    WindowTotals running;
+    std::size_t pos = 0;
+    for (const std::size_t kIndex : order) {
+      const std::int32_t kStartDay = start_days[kIndex];
+      while (pos < entries_.size() && entries_[pos].day >= kStartDay) {
+        const std::int32_t kDay = entries_[pos].day;
+        std::uint8_t day_flags = 0;
+        bool has_record = false;
+        for (; pos < entries_.size() && entries_[pos].day == kDay; ++pos) {
+          const Entry& entry = entries_[pos];
+          day_flags |= entry.flags;
+          if (entry.is_record) {
+            durations[entry.slot] += entry.duration;
+            seen[entry.slot] = 1;
+            running.total_duration += entry.duration;
+            has_record = true;
+          }
+        }
+        running.record_days += has_record ? 1 : 0;
+        for (std::size_t bit = 0; bit < kDayFlagBits; ++bit) {
+          running.flag_days[bit] += (day_flags >> bit) & 1U;
+        }
+      }
+
+      WindowTotals& totals = results[kIndex];
+      totals.total_duration = running.total_duration;
+      totals.record_days = running.record_days;
+      totals.flag_days = running.flag_days;
+      for (std::size_t slot = 0; slot < seen.size(); ++slot) {
+        if (seen[slot] != 0) {
+          totals.project_durations.emplace(slot_projects_[slot],
+                                           durations[slot]);
+        }
+      }
+    }
+    return results;
+  }
+
+ private:
+  struct Entry {
+    std::int32_t day = 0;
+    std::uint32_t slot = 0;
+    std::int64_t duration = 0;
+    std::uint8_t flags = 0;
+    bool is_record = false;
+  };
+
+  std::vector<Entry> entries_;
+  std::unordered_map<std::int64_t, std::uint32_t> project_slots_;
+  std::vector<std::int64_t> slot_projects_;
+};
+
+}  // namespace reports::data::window
+
+#endif  // INFRASTRUCTURE_REPORTS_DATA_QUERIERS_UTILS_TRAILING_WINDOW_AGGREGATOR_H_
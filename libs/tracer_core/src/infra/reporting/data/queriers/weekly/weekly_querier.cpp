@@ -11,7 +11,7 @@
 
 #include "infra/reporting/data/cache/project_name_cache.hpp"
 #include "infra/reporting/data/queriers/utils/batch_aggregation.hpp"
-#include "infra/reporting/data/utils/time_derived_stats.hpp"
+#include "infra/reporting/data/queriers/utils/rollup_tables.hpp"
 #include "infra/schema/day_schema.hpp"
 #include "infra/schema/sqlite_schema.hpp"
 #include "shared/types/reporting_errors.hpp"
@@ -72,11 +72,6 @@ void WeekQuerier::BindSqlParameters(sqlite3_stmt* stmt) const {
 }
 
 namespace {
-using tracer::core::infrastructure::reports::data::stats::
-    IsAnaerobicProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsCardioProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsExerciseProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsStudyProjectPath;
 
 struct DayFlagCounts {
   int status_true_days = 0;
@@ -142,6 +137,36 @@ auto LoadWeeklyFlagCounts(sqlite3* sqlite_db)
   }
 
   sqlite3_finalize(flag_stmt);
+
+  // 项目标记读按日标记源，与月、年报表及汇总表判定一致。
+  sqlite3_stmt* day_stmt = nullptr;
+  const std::string kDaySql = std::format(
+      "SELECT {0}, {1}, {2}, {3}, {4} FROM {5};",
+      schema::day_flag_rollup::db::kDate, schema::day_flag_rollup::db::kStudy,
+      schema::day_flag_rollup::db::kExercise,
+      schema::day_flag_rollup::db::kCardio,
+      schema::day_flag_rollup::db::kAnaerobic,
+      reports::data::rollup::DayFlagSourceSql(sqlite_db));
+  if (sqlite3_prepare_v2(sqlite_db, kDaySql.c_str(), -1, &day_stmt,
+                         nullptr) != SQLITE_OK) {
+    sqlite3_finalize(day_stmt);
+    throw std::runtime_error(
+        "Failed to prepare statement for weekly project flags.");
+  }
+
+  while (sqlite3_step(day_stmt) == SQLITE_ROW) {
+    auto week_row = ParseWeekRow(sqlite3_column_text(day_stmt, kDateColumn));
+    if (!week_row.has_value()) {
+      continue;
+    }
+
+    auto& counts = flag_counts[week_row->week_label];
+    counts.status_true_days += sqlite3_column_int(day_stmt, 1);
+    counts.exercise_true_days += sqlite3_column_int(day_stmt, 2);
+    counts.cardio_true_days += sqlite3_column_int(day_stmt, 3);
+    counts.anaerobic_true_days += sqlite3_column_int(day_stmt, 4);
+  }
+  sqlite3_finalize(day_stmt);
   return flag_counts;
 }
 }  // namespace
@@ -175,10 +200,6 @@ auto BatchWeekDataFetcher::FetchAllData()
 
   std::map<std::string, std::map<std::int64_t, std::int64_t>> project_agg;
   std::map<std::string, std::set<std::string>> distinct_dates;
-  std::map<std::string, std::set<std::string>> status_dates;
-  std::map<std::string, std::set<std::string>> exercise_dates;
-  std::map<std::string, std::set<std::string>> cardio_dates;
-  std::map<std::string, std::set<std::string>> anaerobic_dates;
 
   while (sqlite3_step(stmt) == SQLITE_ROW) {
     auto week_row = ParseWeekRow(sqlite3_column_text(stmt, kDateColumn));
@@ -201,27 +222,6 @@ auto BatchWeekDataFetcher::FetchAllData()
     project_agg[week_row->week_label][project_id] += duration;
     data.total_duration += duration;
     distinct_dates[week_row->week_label].insert(week_row->date);
-
-    const auto kPathParts = name_cache.GetPathParts(project_id);
-    std::string project_path;
-    if (!kPathParts.empty()) {
-      project_path = kPathParts.front();
-      for (size_t index = 1; index < kPathParts.size(); ++index) {
-        project_path += "_" + kPathParts[index];
-      }
-    }
-    if (IsStudyProjectPath(project_path)) {
-      status_dates[week_row->week_label].insert(week_row->date);
-    }
-    if (IsExerciseProjectPath(project_path)) {
-      exercise_dates[week_row->week_label].insert(week_row->date);
-    }
-    if (IsCardioProjectPath(project_path)) {
-      cardio_dates[week_row->week_label].insert(week_row->date);
-    }
-    if (IsAnaerobicProjectPath(project_path)) {
-      anaerobic_dates[week_row->week_label].insert(week_row->date);
-    }
   }
   sqlite3_finalize(stmt);
 
@@ -235,13 +235,11 @@ auto BatchWeekDataFetcher::FetchAllData()
     if (flag_it == flag_counts.end()) {
       continue;
     }
-    data.status_true_days = static_cast<int>(status_dates[week_label].size());
+    data.status_true_days = flag_it->second.status_true_days;
     data.wake_anchor_true_days = flag_it->second.wake_anchor_true_days;
-    data.exercise_true_days =
-        static_cast<int>(exercise_dates[week_label].size());
-    data.cardio_true_days = static_cast<int>(cardio_dates[week_label].size());
-    data.anaerobic_true_days =
-        static_cast<int>(anaerobic_dates[week_label].size());
+    data.exercise_true_days = flag_it->second.exercise_true_days;
+    data.cardio_true_days = flag_it->second.cardio_true_days;
+    data.anaerobic_true_days = flag_it->second.anaerobic_true_days;
   }
 
   return results;
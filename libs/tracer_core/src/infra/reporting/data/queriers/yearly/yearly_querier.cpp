@@ -5,23 +5,163 @@
 #include <cstdint>
 #include <format>
 #include <map>
-#include <set>
 #include <stdexcept>
 #include <tuple>
 
 #include "infra/reporting/data/cache/project_name_cache.hpp"
 #include "infra/reporting/data/queriers/utils/batch_aggregation.hpp"
-#include "infra/reporting/data/utils/time_derived_stats.hpp"
+#include "infra/reporting/data/queriers/utils/rollup_tables.hpp"
 #include "infra/schema/day_schema.hpp"
 #include "infra/schema/sqlite_schema.hpp"
 #include "shared/types/reporting_errors.hpp"
 
 namespace {
-using tracer::core::infrastructure::reports::data::stats::
-    IsAnaerobicProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsCardioProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsExerciseProjectPath;
-using tracer::core::infrastructure::reports::data::stats::IsStudyProjectPath;
+
+using YearProjectAgg =
+    std::map<std::string, std::map<std::int64_t, std::int64_t>>;
+
+struct YearDayCounts {
+  int actual_days = 0;
+  int status_days = 0;
+  int exercise_days = 0;
+  int cardio_days = 0;
+  int anaerobic_days = 0;
+};
+
+// 返回对应年份的报表数据；年份无法解析时返回 nullptr。
+auto FindOrInitYear(std::map<std::string, YearlyReportData>& results,
+                    const std::string& year_str) -> YearlyReportData* {
+  int gregorian_year = 0;
+  if (!ParseGregorianYear(year_str, gregorian_year)) {
+    return nullptr;
+  }
+  YearlyReportData& data = results[year_str];
+  if (data.range_label.empty()) {
+    std::string label = FormatGregorianYear(gregorian_year);
+    data.range_label = label;
+    data.requested_days = 0;
+    data.start_date = label + "-01-01";
+    data.end_date = label + "-12-31";
+    data.is_valid = true;
+  }
+  return &data;
+}
+
+// 旧库（无汇总表）：按年按项目聚合 time_records。
+void FetchRecordProjectStats(sqlite3* sqlite_db,
+                             std::map<std::string, YearlyReportData>& results,
+                             YearProjectAgg& project_agg) {
+  sqlite3_stmt* stmt = nullptr;
+  const std::string kSql = std::format(
+      "SELECT strftime('%Y', {0}) as yy, {1}, SUM({2}) "
+      "FROM {3} "
+      "GROUP BY yy, {1} "
+      "ORDER BY yy;",
+      schema::time_records::db::kDate, schema::time_records::db::kProjectId,
+      schema::time_records::db::kDuration, schema::time_records::db::kTable);
+
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    throw std::runtime_error("Failed to prepare statement for yearly stats.");
+  }
+
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    const unsigned char* yy_ptr = sqlite3_column_text(stmt, 0);
+    if (yy_ptr == nullptr) {
+      continue;
+    }
+
+    std::string year_str = reinterpret_cast<const char*>(yy_ptr);
+    YearlyReportData* data = FindOrInitYear(results, year_str);
+    if (data == nullptr) {
+      continue;
+    }
+
+    std::int64_t project_id = sqlite3_column_int64(stmt, 1);
+    std::int64_t duration = sqlite3_column_int64(stmt, 2);
+    project_agg[year_str][project_id] += duration;
+    data->total_duration += duration;
+  }
+  sqlite3_finalize(stmt);
+}
+
+// 汇总表路径：项目时长读月汇总。
+void FetchRollupProjectStats(sqlite3* sqlite_db,
+                             std::map<std::string, YearlyReportData>& results,
+                             YearProjectAgg& project_agg) {
+  sqlite3_stmt* stmt = nullptr;
+  const std::string kSql = std::format(
+      "SELECT substr({0}, 1, 4) as yy, {1}, SUM({2}) "
+      "FROM {3} "
+      "GROUP BY yy, {1} "
+      "ORDER BY yy;",
+      schema::project_monthly_rollup::db::kYearMonth,
+      schema::project_monthly_rollup::db::kProjectId,
+      schema::project_monthly_rollup::db::kDuration,
+      schema::project_monthly_rollup::db::kTable);
+
+  if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    throw std::runtime_error(
+        "Failed to prepare statement for yearly rollup stats.");
+  }
+
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    const unsigned char* yy_ptr = sqlite3_column_text(stmt, 0);
+    if (yy_ptr == nullptr) {
+      continue;
+    }
+    std::string year_str = reinterpret_cast<const char*>(yy_ptr);
+    YearlyReportData* data = FindOrInitYear(results, year_str);
+    if (data == nullptr) {
+      continue;
+    }
+
+    std::int64_t project_id = sqlite3_column_int64(stmt, 1);
+    std::int64_t duration = sqlite3_column_int64(stmt, 2);
+    project_agg[year_str][project_id] += duration;
+    data->total_duration += duration;
+  }
+  sqlite3_finalize(stmt);
+}
+
+// 天数与标记读按日标记源，有无汇总表判定一致。
+void FetchDayCounts(sqlite3* sqlite_db,
+                    std::map<std::string, YearDayCounts>& day_counts) {
+  sqlite3_stmt* day_stmt = nullptr;
+  const std::string kDaySql = std::format(
+      "SELECT substr({0}, 1, 4) as yy, COUNT(*), SUM({1}), SUM({2}), "
+      "SUM({3}), SUM({4}) "
+      "FROM {5} "
+      "GROUP BY yy;",
+      schema::day_flag_rollup::db::kDate, schema::day_flag_rollup::db::kStudy,
+      schema::day_flag_rollup::db::kExercise,
+      schema::day_flag_rollup::db::kCardio,
+      schema::day_flag_rollup::db::kAnaerobic,
+      reports::data::rollup::DayFlagSourceSql(sqlite_db));
+
+  if (sqlite3_prepare_v2(sqlite_db, kDaySql.c_str(), -1, &day_stmt,
+                         nullptr) != SQLITE_OK) {
+    sqlite3_finalize(day_stmt);
+    throw std::runtime_error("Failed to prepare statement for yearly days.");
+  }
+
+  while (sqlite3_step(day_stmt) == SQLITE_ROW) {
+    const unsigned char* yy_ptr = sqlite3_column_text(day_stmt, 0);
+    if (yy_ptr == nullptr) {
+      continue;
+    }
+    YearDayCounts& counts =
+        day_counts[reinterpret_cast<const char*>(yy_ptr)];
+    counts.actual_days = sqlite3_column_int(day_stmt, 1);
+    counts.status_days = sqlite3_column_int(day_stmt, 2);
+    counts.exercise_days = sqlite3_column_int(day_stmt, 3);
+    counts.cardio_days = sqlite3_column_int(day_stmt, 4);
+    counts.anaerobic_days = sqlite3_column_int(day_stmt, 5);
+  }
+  sqlite3_finalize(day_stmt);
+}
 }  // namespace
 
 YearQuerier::YearQuerier(sqlite3* sqlite_db, std::string_view year_str)
@@ -94,82 +234,21 @@ auto BatchYearDataFetcher::FetchAllData()
   ProjectNameCache name_cache;
   name_cache.EnsureLoaded(db_);
 
-  sqlite3_stmt* stmt = nullptr;
-  const std::string kSql = std::format(
-      "SELECT strftime('%Y', {0}) as yy, {0}, {1}, SUM({2}) "
-      "FROM {3} "
-      "GROUP BY yy, {0}, {1} "
-      "ORDER BY yy;",
-      schema::time_records::db::kDate, schema::time_records::db::kProjectId,
-      schema::time_records::db::kDuration, schema::time_records::db::kTable);
-
-  if (sqlite3_prepare_v2(db_, kSql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-    throw std::runtime_error("Failed to prepare statement for yearly stats.");
+  YearProjectAgg project_agg;
+  std::map<std::string, YearDayCounts> day_counts;
+  if (reports::data::rollup::HasRollupTables(db_)) {
+    FetchRollupProjectStats(db_, results, project_agg);
+  } else {
+    FetchRecordProjectStats(db_, results, project_agg);
   }
+  FetchDayCounts(db_, day_counts);
 
-  std::map<std::string, std::map<std::int64_t, std::int64_t>> project_agg;
-  std::map<std::string, std::set<std::string>> distinct_dates;
-  std::map<std::string, std::set<std::string>> status_dates;
-  std::map<std::string, std::set<std::string>> exercise_dates;
-  std::map<std::string, std::set<std::string>> cardio_dates;
-  std::map<std::string, std::set<std::string>> anaerobic_dates;
-
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    const unsigned char* yy_ptr = sqlite3_column_text(stmt, 0);
-    const unsigned char* date_ptr = sqlite3_column_text(stmt, 1);
-    if (yy_ptr == nullptr || date_ptr == nullptr) {
-      continue;
-    }
-
-    std::string year_str = reinterpret_cast<const char*>(yy_ptr);
-    std::string date = reinterpret_cast<const char*>(date_ptr);
-    int gregorian_year = 0;
-    if (!ParseGregorianYear(year_str, gregorian_year)) {
-      continue;
-    }
-
-    std::int64_t project_id = sqlite3_column_int64(stmt, 2);
-    std::int64_t duration = sqlite3_column_int64(stmt, 3);
-
-    YearlyReportData& data = results[year_str];
-    if (data.range_label.empty()) {
-      std::string label = FormatGregorianYear(gregorian_year);
-      data.range_label = label;
-      data.requested_days = 0;
-      data.start_date = label + "-01-01";
-      data.end_date = label + "-12-31";
-      data.is_valid = true;
-    }
-
-    project_agg[year_str][project_id] += duration;
-    data.total_duration += duration;
-    distinct_dates[year_str].insert(date);
-
-    const auto kPathParts = name_cache.GetPathParts(project_id);
-    std::string project_path;
-    if (!kPathParts.empty()) {
-      project_path = kPathParts.front();
-      for (size_t index = 1; index < kPathParts.size(); ++index) {
-        project_path += "_" + kPathParts[index];
-      }
-    }
-    if (IsStudyProjectPath(project_path)) {
-      status_dates[year_str].insert(date);
-    }
-    if (IsExerciseProjectPath(project_path)) {
-      exercise_dates[year_str].insert(date);
-    }
-    if (IsCardioProjectPath(project_path)) {
-      cardio_dates[year_str].insert(date);
-    }
-    if (IsAnaerobicProjectPath(project_path)) {
-      anaerobic_dates[year_str].insert(date);
-    }
+  std::map<std::string, int> actual_days;
+  for (const auto& [year_str, counts] : day_counts) {
+    actual_days[year_str] = counts.actual_days;
   }
-  sqlite3_finalize(stmt);
-
-  reports::data::batch::FinalizeGroupedAggregation(results, project_agg,
-                                                   distinct_dates, name_cache);
+  reports::data::batch::FinalizeGroupedAggregationWithDays(
+      results, project_agg, actual_days, name_cache);
 
   sqlite3_stmt* flag_stmt = nullptr;
   const std::string kFlagSql = std::format(
@@ -198,15 +277,14 @@ auto BatchYearDataFetcher::FetchAllData()
   sqlite3_finalize(flag_stmt);
 
   for (auto& [year_label, data] : results) {
-    data.status_true_days = static_cast<int>(status_dates[year_label].size());
+    const YearDayCounts& counts = day_counts[year_label];
+    data.status_true_days = counts.status_days;
     const auto sleep_it = sleep_day_counts.find(year_label);
     data.wake_anchor_true_days =
         (sleep_it != sleep_day_counts.end()) ? sleep_it->second : 0;
-    data.exercise_true_days =
-        static_cast<int>(exercise_dates[year_label].size());
-    data.cardio_true_days = static_cast<int>(cardio_dates[year_label].size());
-    data.anaerobic_true_days =
-        static_cast<int>(anaerobic_dates[year_label].size());
+    data.exercise_true_days = counts.exercise_days;
+    data.cardio_true_days = counts.cardio_days;
+    data.anaerobic_true_days = counts.anaerobic_days;
   }
 
   return results;
@@ -7,127 +7,87 @@
 #include <string_view>
 
 #include "domain/model/time_data_models.hpp"
+#include "infra/persistence/sqlite/project_dictionary.hpp"
 #include "infra/schema/day_schema.hpp"
 
 namespace tracer::core::infrastructure::reports::data::stats {
 
-namespace detail {
-
-[[nodiscard]] inline auto PathEqualsOrPrefix(std::string_view path,
-                                             std::string_view prefix) -> bool {
-  return (path == prefix) ||
-         (path.size() > prefix.size() && path.starts_with(prefix) &&
-          path[prefix.size()] == '_');
-}
-
-[[nodiscard]] inline auto PathHasRoot(std::string_view path,
-                                      std::string_view root) -> bool {
-  return PathEqualsOrPrefix(path, root);
-}
+namespace persistence = tracer::core::infrastructure::persistence;
 
-[[nodiscard]] inline auto PathLeaf(std::string_view path) -> std::string_view {
-  const size_t separator = path.rfind('_');
-  if (separator == std::string_view::npos) {
-    return path;
-  }
-  return path.substr(separator + 1);
-}
+namespace detail {
 
-[[nodiscard]] inline auto PathHasSegment(std::string_view path,
-                                         std::string_view segment) -> bool {
-  size_t start = 0;
-  while (start <= path.size()) {
-    const size_t separator = path.find('_', start);
-    const std::string_view part = path.substr(
-        start, separator == std::string_view::npos ? std::string_view::npos
-                                                   : separator - start);
-    if (part == segment) {
-      return true;
-    }
-    if (separator == std::string_view::npos) {
-      return false;
-    }
-    start = separator + 1;
-  }
-  return false;
+[[nodiscard]] inline auto HasClass(std::uint32_t class_mask,
+                                   persistence::ProjectClass project_class)
+    -> bool {
+  return (class_mask & project_class) != 0U;
 }
 
 }  // namespace detail
 
 [[nodiscard]] inline auto IsCardioProjectPath(std::string_view project_path)
     -> bool {
-  return detail::PathHasRoot(project_path, "exercise_cardio");
+  return detail::HasClass(persistence::ClassifyProjectPath(project_path),
+                          persistence::kProjectClassCardio);
 }
 
 [[nodiscard]] inline auto IsAnaerobicProjectPath(std::string_view project_path)
     -> bool {
-  return detail::PathHasRoot(project_path, "exercise_anaerobic");
+  return detail::HasClass(persistence::ClassifyProjectPath(project_path),
+                          persistence::kProjectClassAnaerobic);
 }
 
 [[nodiscard]] inline auto IsStudyProjectPath(std::string_view project_path)
     -> bool {
-  return detail::PathHasRoot(project_path, "study");
+  return detail::HasClass(persistence::ClassifyProjectPath(project_path),
+                          persistence::kProjectClassStudy);
 }
 
 [[nodiscard]] inline auto IsExerciseProjectPath(std::string_view project_path)
     -> bool {
-  return detail::PathHasRoot(project_path, "exercise");
+  return detail::HasClass(persistence::ClassifyProjectPath(project_path),
+                          persistence::kProjectClassExercise);
 }
 
 class DerivedTimeStatsAggregator {
  public:
   auto AddPathDuration(std::string_view project_path,
                        std::int64_t duration_seconds) -> void {
-    if (project_path.empty() || duration_seconds <= 0) {
-      return;
-    }
-
-    if (project_path == "sleep_night") {
-      stats_.sleep_night_time += static_cast<int>(duration_seconds);
-    }
-    if (project_path == "sleep_day") {
-      stats_.sleep_day_time += static_cast<int>(duration_seconds);
-    }
-
-    if (IsStudyProjectPath(project_path)) {
-      stats_.study_time += static_cast<int>(duration_seconds);
-    }
+    AddClassifiedDuration(persistence::ClassifyProjectPath(project_path),
+                          duration_seconds);
+  }
 
-    if (IsExerciseProjectPath(project_path)) {
-      stats_.total_exercise_time += static_cast<int>(duration_seconds);
-    }
-    if (IsCardioProjectPath(project_path)) {
-      stats_.cardio_time += static_cast<int>(duration_seconds);
-    }
-    if (IsAnaerobicProjectPath(project_path)) {
-      stats_.anaerobic_time += static_cast<int>(duration_seconds);
+  // class_mask 取自项目字典（IProjectInfoProvider::GetClassMask），
+  // 同一项目的分类只在字典加载时计算一次。
+  auto AddClassifiedDuration(std::uint32_t class_mask,
+                             std::int64_t duration_seconds) -> void {
+    if (class_mask == 0U || duration_seconds <= 0) {
+      return;
     }
 
-    if (detail::PathHasRoot(project_path, "recreation")) {
-      stats_.recreation_time += static_cast<int>(duration_seconds);
-      const std::string_view kLeaf = detail::PathLeaf(project_path);
-      if (kLeaf == "zhihu") {
-        stats_.recreation_zhihu_time += static_cast<int>(duration_seconds);
-      } else if (kLeaf == "bilibili") {
-        stats_.recreation_bilibili_time += static_cast<int>(duration_seconds);
-      } else if (kLeaf == "douyin") {
-        stats_.recreation_douyin_time += static_cast<int>(duration_seconds);
+    const int kDuration = static_cast<int>(duration_seconds);
+    const auto kAddIf = [class_mask, kDuration](
+                            persistence::ProjectClass project_class,
+                            int& target) {
+      if (detail::HasClass(class_mask, project_class)) {
+        target += kDuration;
       }
-    }
-    if (detail::PathHasRoot(project_path, "recreation_game")) {
-      stats_.gaming_time += static_cast<int>(duration_seconds);
-    }
-
-    if (detail::PathHasRoot(project_path, "routine_toilet")) {
-      stats_.toilet_time += static_cast<int>(duration_seconds);
-    }
-    if (detail::PathHasRoot(project_path, "routine") &&
-        (detail::PathHasSegment(project_path, "grooming") ||
-         detail::PathHasSegment(project_path, "body-hygiene") ||
-         detail::PathHasSegment(project_path, "personal-hygiene") ||
-         detail::PathHasSegment(project_path, "oral-hygiene"))) {
-      stats_.grooming_time += static_cast<int>(duration_seconds);
-    }
+    };
+    kAddIf(persistence::kProjectClassSleepNight, stats_.sleep_night_time);
+    kAddIf(persistence::kProjectClassSleepDay, stats_.sleep_day_time);
+    kAddIf(persistence::kProjectClassStudy, stats_.study_time);
+    kAddIf(persistence::kProjectClassExercise, stats_.total_exercise_time);
+    kAddIf(persistence::kProjectClassCardio, stats_.cardio_time);
+    kAddIf(persistence::kProjectClassAnaerobic, stats_.anaerobic_time);
+    kAddIf(persistence::kProjectClassRecreation, stats_.recreation_time);
+    kAddIf(persistence::kProjectClassRecreationZhihu,
+           stats_.recreation_zhihu_time);
+    kAddIf(persistence::kProjectClassRecreationBilibili,
+           stats_.recreation_bilibili_time);
+    kAddIf(persistence::kProjectClassRecreationDouyin,
+           stats_.recreation_douyin_time);
+    kAddIf(persistence::kProjectClassGaming, stats_.gaming_time);
+    kAddIf(persistence::kProjectClassToilet, stats_.toilet_time);
+    kAddIf(persistence::kProjectClassGrooming, stats_.grooming_time);
   }
 
   [[nodiscard]] auto BuildActivityStats() const -> ActivityStats {
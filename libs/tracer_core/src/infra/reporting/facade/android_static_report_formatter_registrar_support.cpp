@@ -127,6 +127,12 @@ class RangeReportFormatterAdapter final
     return delegate_->FormatReport(static_cast<const RangeReportData&>(report));
   }
 
+  void FormatReportTo(const ReportDataType& report,
+                      std::string& output) const override {
+    delegate_->FormatReportTo(static_cast<const RangeReportData&>(report),
+                              output);
+  }
+
  private:
   std::unique_ptr<IReportFormatter<RangeReportData>> delegate_;
 };
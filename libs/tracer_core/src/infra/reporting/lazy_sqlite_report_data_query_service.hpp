@@ -6,6 +6,7 @@
 
 #include "application/ports/reporting/i_platform_clock.hpp"
 #include "application/ports/reporting/i_report_data_query_service.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 
 namespace tracer::core::infrastructure::reports {
 class LazySqliteReportDataQueryService final
@@ -14,7 +15,9 @@ class LazySqliteReportDataQueryService final
   LazySqliteReportDataQueryService(
       std::filesystem::path db_path,
       std::shared_ptr<tracer_core::application::ports::IPlatformClock>
-          platform_clock);
+          platform_clock,
+      std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool =
+          nullptr);
 
   auto QueryDaily(std::string_view date) -> DailyReportData override;
   auto QueryMonthly(std::string_view month) -> MonthlyReportData override;
@@ -40,6 +43,8 @@ class LazySqliteReportDataQueryService final
   std::filesystem::path db_path_;
   std::shared_ptr<tracer_core::application::ports::IPlatformClock>
       platform_clock_;
+  // 未注入时每个服务各自持有一个连接池。
+  std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool_;
 };
 
 }  // namespace tracer::core::infrastructure::reports
@@ -6,37 +6,33 @@
 #include "infra/reporting/lazy_sqlite_report_data_query_service.hpp"
 #include "application/ports/reporting/i_platform_clock.hpp"
 #include "application/ports/reporting/i_report_data_query_service.hpp"
-#include "infra/persistence/sqlite/db_manager.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 
 import tracer.core.infrastructure.reporting.data_querying.sqlite_report_data_query_service;
 
 namespace tracer::core::infrastructure::reports {
 namespace {
 
-auto EnsureReadableDbConnection(const std::filesystem::path& db_path,
-                                DBManager& db_manager) -> sqlite3* {
-  if (!db_manager.OpenDatabaseIfNeeded()) {
+auto AcquireReadableDbConnection(
+    persistence::SqliteReadConnectionPool& read_pool)
+    -> persistence::SqliteReadConnectionPool::Lease {
+  auto lease = read_pool.TryAcquire();
+  if (!lease.has_value()) {
     throw std::runtime_error("Report database is not available: " +
-                             db_path.string());
+                             read_pool.DbPath().string());
   }
-
-  sqlite3* db_connection = db_manager.GetDbConnection();
-  if (db_connection == nullptr) {
-    throw std::runtime_error("Report database connection is null: " +
-                             db_path.string());
-  }
-  return db_connection;
+  return std::move(*lease);
 }
 
 template <typename Callback>
 auto WithStructuredReportService(
-    const std::filesystem::path& db_path,
+    persistence::SqliteReadConnectionPool& read_pool,
     const std::shared_ptr<tracer_core::application::ports::IPlatformClock>&
         platform_clock,
     Callback&& callback) {
-  DBManager db_manager(db_path.string());
-  SqliteReportDataQueryService report_service(
-      EnsureReadableDbConnection(db_path, db_manager), platform_clock);
+  const auto kLease = AcquireReadableDbConnection(read_pool);
+  SqliteReportDataQueryService report_service(kLease.Connection(),
+                                              platform_clock);
   return std::forward<Callback>(callback)(report_service);
 }
 
@@ -45,12 +41,19 @@ auto WithStructuredReportService(
 LazySqliteReportDataQueryService::LazySqliteReportDataQueryService(
     std::filesystem::path db_path,
     std::shared_ptr<tracer_core::application::ports::IPlatformClock>
-        platform_clock)
-    : db_path_(std::move(db_path)), platform_clock_(std::move(platform_clock)) {
+        platform_clock,
+    std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool)
+    : db_path_(std::move(db_path)),
+      platform_clock_(std::move(platform_clock)),
+      read_pool_(std::move(read_pool)) {
   if (db_path_.empty()) {
     throw std::invalid_argument(
         "LazySqliteReportDataQueryService db_path is empty.");
   }
+  if (!read_pool_) {
+    read_pool_ =
+        std::make_shared<persistence::SqliteReadConnectionPool>(db_path_);
+  }
   if (!platform_clock_) {
     throw std::invalid_argument(
         "LazySqliteReportDataQueryService platform_clock must not be null.");
@@ -60,7 +63,7 @@ LazySqliteReportDataQueryService::LazySqliteReportDataQueryService(
 auto LazySqliteReportDataQueryService::QueryDaily(std::string_view date)
     -> DailyReportData {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service) -> DailyReportData {
         return report_service.QueryDaily(date);
       });
@@ -69,7 +72,7 @@ auto LazySqliteReportDataQueryService::QueryDaily(std::string_view date)
 auto LazySqliteReportDataQueryService::QueryMonthly(std::string_view month)
     -> MonthlyReportData {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service) -> MonthlyReportData {
         return report_service.QueryMonthly(month);
       });
@@ -78,7 +81,7 @@ auto LazySqliteReportDataQueryService::QueryMonthly(std::string_view month)
 auto LazySqliteReportDataQueryService::QueryPeriod(int days)
     -> PeriodReportData {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service) -> PeriodReportData {
         return report_service.QueryPeriod(days);
       });
@@ -88,7 +91,7 @@ auto LazySqliteReportDataQueryService::QueryRange(std::string_view start_date,
                                                   std::string_view end_date)
     -> PeriodReportData {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service) -> PeriodReportData {
         return report_service.QueryRange(start_date, end_date);
       });
@@ -97,7 +100,7 @@ auto LazySqliteReportDataQueryService::QueryRange(std::string_view start_date,
 auto LazySqliteReportDataQueryService::QueryWeekly(std::string_view iso_week)
     -> WeeklyReportData {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service) -> WeeklyReportData {
         return report_service.QueryWeekly(iso_week);
       });
@@ -106,7 +109,7 @@ auto LazySqliteReportDataQueryService::QueryWeekly(std::string_view iso_week)
 auto LazySqliteReportDataQueryService::QueryYearly(std::string_view year)
     -> YearlyReportData {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service) -> YearlyReportData {
         return report_service.QueryYearly(year);
       });
@@ -115,7 +118,7 @@ auto LazySqliteReportDataQueryService::QueryYearly(std::string_view year)
 auto LazySqliteReportDataQueryService::ListDailyTargets()
     -> std::vector<std::string> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::vector<std::string> {
         return report_service.ListDailyTargets();
@@ -125,7 +128,7 @@ auto LazySqliteReportDataQueryService::ListDailyTargets()
 auto LazySqliteReportDataQueryService::ListMonthlyTargets()
     -> std::vector<std::string> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::vector<std::string> {
         return report_service.ListMonthlyTargets();
@@ -135,7 +138,7 @@ auto LazySqliteReportDataQueryService::ListMonthlyTargets()
 auto LazySqliteReportDataQueryService::ListWeeklyTargets()
     -> std::vector<std::string> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::vector<std::string> {
         return report_service.ListWeeklyTargets();
@@ -145,7 +148,7 @@ auto LazySqliteReportDataQueryService::ListWeeklyTargets()
 auto LazySqliteReportDataQueryService::ListYearlyTargets()
     -> std::vector<std::string> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::vector<std::string> {
         return report_service.ListYearlyTargets();
@@ -155,7 +158,7 @@ auto LazySqliteReportDataQueryService::ListYearlyTargets()
 auto LazySqliteReportDataQueryService::QueryPeriodBatch(
     const std::vector<int>& days_list) -> std::map<int, PeriodReportData> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::map<int, PeriodReportData> {
         return report_service.QueryPeriodBatch(days_list);
@@ -165,7 +168,7 @@ auto LazySqliteReportDataQueryService::QueryPeriodBatch(
 auto LazySqliteReportDataQueryService::QueryAllDaily()
     -> std::map<std::string, DailyReportData> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::map<std::string, DailyReportData> {
         return report_service.QueryAllDaily();
@@ -175,7 +178,7 @@ auto LazySqliteReportDataQueryService::QueryAllDaily()
 auto LazySqliteReportDataQueryService::QueryAllMonthly()
     -> std::map<std::string, MonthlyReportData> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::map<std::string, MonthlyReportData> {
         return report_service.QueryAllMonthly();
@@ -185,7 +188,7 @@ auto LazySqliteReportDataQueryService::QueryAllMonthly()
 auto LazySqliteReportDataQueryService::QueryAllWeekly()
     -> std::map<std::string, WeeklyReportData> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::map<std::string, WeeklyReportData> {
         return report_service.QueryAllWeekly();
@@ -195,7 +198,7 @@ auto LazySqliteReportDataQueryService::QueryAllWeekly()
 auto LazySqliteReportDataQueryService::QueryAllYearly()
     -> std::map<std::string, YearlyReportData> {
   return WithStructuredReportService(
-      db_path_, platform_clock_,
+      *read_pool_, platform_clock_,
       [&](SqliteReportDataQueryService& report_service)
           -> std::map<std::string, YearlyReportData> {
         return report_service.QueryAllYearly();
@@ -7,6 +7,7 @@
 #include "application/compat/reporting/i_report_query_service.hpp"
 #include "application/ports/reporting/i_platform_clock.hpp"
 #include "infra/config/models/report_catalog.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 
 namespace tracer::core::infrastructure::reports {
 class LazySqliteReportQueryService final : public IReportQueryService {
@@ -15,7 +16,9 @@ class LazySqliteReportQueryService final : public IReportQueryService {
       std::filesystem::path db_path,
       std::shared_ptr<ReportCatalog> report_catalog,
       std::shared_ptr<tracer_core::application::ports::IPlatformClock>
-          platform_clock);
+          platform_clock,
+      std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool =
+          nullptr);
 
   [[nodiscard]] auto RunDailyQuery(std::string_view date_str,
                                    ReportFormat format) const
@@ -37,6 +40,8 @@ class LazySqliteReportQueryService final : public IReportQueryService {
   std::shared_ptr<ReportCatalog> report_catalog_;
   std::shared_ptr<tracer_core::application::ports::IPlatformClock>
       platform_clock_;
+  // 未注入时每个服务各自持有一个连接池。
+  std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool_;
 };
 
 }  // namespace tracer::core::infrastructure::reports
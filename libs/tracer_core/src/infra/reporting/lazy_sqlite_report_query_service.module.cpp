@@ -7,38 +7,34 @@
 #include "application/compat/reporting/i_report_query_service.hpp"
 #include "application/ports/reporting/i_platform_clock.hpp"
 #include "infra/config/models/report_catalog.hpp"
-#include "infra/persistence/sqlite/db_manager.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
 
 import tracer.core.infrastructure.reporting.querying.report_service;
 
 namespace tracer::core::infrastructure::reports {
 namespace {
 
-auto EnsureReadableDbConnection(const std::filesystem::path& db_path,
-                                DBManager& db_manager) -> sqlite3* {
-  if (!db_manager.OpenDatabaseIfNeeded()) {
+auto AcquireReadableDbConnection(
+    persistence::SqliteReadConnectionPool& read_pool)
+    -> persistence::SqliteReadConnectionPool::Lease {
+  auto lease = read_pool.TryAcquire();
+  if (!lease.has_value()) {
     throw std::runtime_error("Report database is not available: " +
-                             db_path.string());
+                             read_pool.DbPath().string());
   }
-
-  sqlite3* db_connection = db_manager.GetDbConnection();
-  if (db_connection == nullptr) {
-    throw std::runtime_error("Report database connection is null: " +
-                             db_path.string());
-  }
-  return db_connection;
+  return std::move(*lease);
 }
 
 template <typename Callback>
 auto WithReportService(
-    const std::filesystem::path& db_path,
+    persistence::SqliteReadConnectionPool& read_pool,
     const std::shared_ptr<ReportCatalog>& report_catalog,
     const std::shared_ptr<tracer_core::application::ports::IPlatformClock>&
         platform_clock,
     Callback&& callback) {
-  DBManager db_manager(db_path.string());
-  ReportService report_service(EnsureReadableDbConnection(db_path, db_manager),
-                               *report_catalog, platform_clock);
+  const auto kLease = AcquireReadableDbConnection(read_pool);
+  ReportService report_service(kLease.Connection(), *report_catalog,
+                               platform_clock);
   return std::forward<Callback>(callback)(report_service);
 }
 
@@ -48,14 +44,20 @@ LazySqliteReportQueryService::LazySqliteReportQueryService(
     std::filesystem::path db_path,
     std::shared_ptr<ReportCatalog> report_catalog,
     std::shared_ptr<tracer_core::application::ports::IPlatformClock>
-        platform_clock)
+        platform_clock,
+    std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool)
     : db_path_(std::move(db_path)),
       report_catalog_(std::move(report_catalog)),
-      platform_clock_(std::move(platform_clock)) {
+      platform_clock_(std::move(platform_clock)),
+      read_pool_(std::move(read_pool)) {
   if (db_path_.empty()) {
     throw std::invalid_argument(
         "LazySqliteReportQueryService db_path is empty.");
   }
+  if (!read_pool_) {
+    read_pool_ =
+        std::make_shared<persistence::SqliteReadConnectionPool>(db_path_);
+  }
   if (!report_catalog_) {
     throw std::invalid_argument(
         "LazySqliteReportQueryService report_catalog must not be null.");
@@ -70,7 +72,7 @@ auto LazySqliteReportQueryService::RunDailyQuery(std::string_view date_str,
                                                  ReportFormat format) const
     -> std::string {
   return WithReportService(
-      db_path_, report_catalog_, platform_clock_,
+      *read_pool_, report_catalog_, platform_clock_,
       [&](const ReportService& report_service) -> std::string {
         return report_service.RunDailyQuery(date_str, format);
       });
@@ -80,7 +82,7 @@ auto LazySqliteReportQueryService::RunPeriodQuery(int days,
                                                   ReportFormat format) const
     -> std::string {
   return WithReportService(
-      db_path_, report_catalog_, platform_clock_,
+      *read_pool_, report_catalog_, platform_clock_,
       [&](const ReportService& report_service) -> std::string {
         return report_service.RunPeriodQuery(days, format);
       });
@@ -89,7 +91,7 @@ auto LazySqliteReportQueryService::RunPeriodQuery(int days,
 auto LazySqliteReportQueryService::RunMonthlyQuery(
     std::string_view year_month_str, ReportFormat format) const -> std::string {
   return WithReportService(
-      db_path_, report_catalog_, platform_clock_,
+      *read_pool_, report_catalog_, platform_clock_,
       [&](const ReportService& report_service) -> std::string {
         return report_service.RunMonthlyQuery(year_month_str, format);
       });
@@ -99,7 +101,7 @@ auto LazySqliteReportQueryService::RunWeeklyQuery(std::string_view iso_week_str,
                                                   ReportFormat format) const
     -> std::string {
   return WithReportService(
-      db_path_, report_catalog_, platform_clock_,
+      *read_pool_, report_catalog_, platform_clock_,
       [&](const ReportService& report_service) -> std::string {
         return report_service.RunWeeklyQuery(iso_week_str, format);
       });
@@ -109,7 +111,7 @@ auto LazySqliteReportQueryService::RunYearlyQuery(std::string_view year_str,
                                                   ReportFormat format) const
     -> std::string {
   return WithReportService(
-      db_path_, report_catalog_, platform_clock_,
+      *read_pool_, report_catalog_, platform_clock_,
       [&](const ReportService& report_service) -> std::string {
         return report_service.RunYearlyQuery(year_str, format);
       });
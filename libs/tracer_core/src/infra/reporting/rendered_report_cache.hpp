@@ -0,0 +1,94 @@
+// infra/reporting/rendered_report_cache.hpp
+#ifndef INFRASTRUCTURE_REPORTS_RENDERED_REPORT_CACHE_H_
+#define INFRASTRUCTURE_REPORTS_RENDERED_REPORT_CACHE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "application/ports/reporting/i_rendered_report_cache.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
+
+namespace tracer::core::infrastructure::reports {
+
+/**
+ * @brief 磁盘上的已渲染报表缓存。
+ *
+ * 缓存键由核心构建版本、报表种类、覆盖日期、格式、报表配置指纹，以及
+ * 报表覆盖到的各月份数据代次（report_generations 表）组成；升级或重新
+ * 构建后渲染逻辑可能变化，旧版本写下的条目不再命中。导入只推进写入月份的
+ * 代次，因此某月导入只会让该月及其所在周、年的条目失效。
+ * 每个条目一个文件（键的 64 位哈希命名，文件头保存完整键以防碰撞），
+ * 按最近访问顺序做 LRU 淘汰，总大小不超过上限。目录在第一次写入时
+ * 才创建；所有文件系统错误都按未命中处理。
+ */
+class RenderedReportCache final
+    : public tracer_core::application::ports::IRenderedReportCache {
+ public:
+  static constexpr std::uintmax_t kDefaultMaxBytes =
+      std::uintmax_t{64} * 1024 * 1024;
+
+  RenderedReportCache(
+      std::filesystem::path cache_dir, std::string config_fingerprint,
+      std::string build_version,
+      std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool,
+      std::uintmax_t max_bytes = kDefaultMaxBytes);
+
+  auto Lookup(
+      const tracer_core::application::ports::RenderedReportRequest& request)
+      -> tracer_core::application::ports::RenderedReportLookup override;
+  auto Store(const std::string& entry_key, std::string_view content)
+      -> void override;
+
+ private:
+  struct Entry {
+    std::string file_name;
+    std::uintmax_t size = 0;
+  };
+  using EntryList = std::list<Entry>;
+
+  // 读取覆盖月份的数据代次；库或代次表不可用时返回 std::nullopt。
+  auto ReadGenerations(std::string_view first_date, std::string_view last_date)
+      -> std::optional<std::string>;
+
+  // 以下函数要求调用方持有 mutex_。
+  auto EnsureIndexLoadedLocked() -> void;
+  auto TouchLocked(EntryList::iterator entry) -> void;
+  auto EraseLocked(EntryList::iterator entry) -> void;
+  auto EvictLocked() -> void;
+
+  std::filesystem::path cache_dir_;
+  std::string config_fingerprint_;
+  std::string build_version_;
+  std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool_;
+  std::uintmax_t max_bytes_;
+
+  std::mutex mutex_;
+  bool index_loaded_ = false;
+  std::uintmax_t total_bytes_ = 0;
+  // 队首为最近访问的条目。
+  EntryList lru_;
+  std::unordered_map<std::string, EntryList::iterator> index_;
+};
+
+// 按文件内容为一组报表配置文件计算指纹；缺失的文件也参与计算。
+[[nodiscard]] auto FingerprintReportConfigFiles(
+    std::span<const std::filesystem::path> config_paths) -> std::string;
+
+}  // namespace tracer::core::infrastructure::reports
+
+namespace infrastructure::reports {
+
+using tracer::core::infrastructure::reports::FingerprintReportConfigFiles;
+using tracer::core::infrastructure::reports::RenderedReportCache;
+
+}  // namespace infrastructure::reports
+
+#endif  // INFRASTRUCTURE_REPORTS_RENDERED_REPORT_CACHE_H_
@@ -0,0 +1,334 @@
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "infra/reporting/rendered_report_cache.hpp"
+#include "application/ports/reporting/i_rendered_report_cache.hpp"
+#include "infra/persistence/sqlite/sqlite_read_connection_pool.hpp"
+#include "infra/schema/sqlite_schema.hpp"
+
+namespace tracer::core::infrastructure::reports {
+namespace {
+
+namespace fs = std::filesystem;
+namespace generations = schema::report_generations::db;
+
+using tracer_core::application::ports::RenderedReportLookup;
+using tracer_core::application::ports::RenderedReportRequest;
+
+// 缓存文件布局变化时递增，旧文件自然不再命中并随 LRU 淘汰。
+constexpr std::string_view kCacheFormatVersion = "v1";
+constexpr std::string_view kEntryExtension = ".report";
+constexpr std::string_view kTempExtension = ".tmp";
+constexpr std::size_t kYearMonthLength = 7;
+
+constexpr std::uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
+
+auto Fnv1a64(std::string_view bytes, std::uint64_t hash = kFnvOffsetBasis)
+    -> std::uint64_t {
+  for (const char kByte : bytes) {
+    hash ^= static_cast<unsigned char>(kByte);
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+auto EntryFileName(std::string_view entry_key) -> std::string {
+  return std::format("{:016x}{}", Fnv1a64(entry_key), kEntryExtension);
+}
+
+auto FormatTag(ReportFormat format) -> std::string_view {
+  switch (format) {
+    case ReportFormat::kMarkdown:
+      return "md";
+    case ReportFormat::kLaTeX:
+      return "tex";
+    case ReportFormat::kTyp:
+      return "typ";
+  }
+  return "unknown";
+}
+
+auto ReadWholeFile(const fs::path& path) -> std::optional<std::string> {
+  std::ifstream input(path, std::ios::binary);
+  if (!input) {
+    return std::nullopt;
+  }
+  std::string bytes{std::istreambuf_iterator<char>(input),
+                    std::istreambuf_iterator<char>()};
+  if (input.bad()) {
+    return std::nullopt;
+  }
+  return bytes;
+}
+
+}  // namespace
+
+RenderedReportCache::RenderedReportCache(
+    std::filesystem::path cache_dir, std::string config_fingerprint,
+    std::string build_version,
+    std::shared_ptr<persistence::SqliteReadConnectionPool> read_pool,
+    std::uintmax_t max_bytes)
+    : cache_dir_(std::move(cache_dir)),
+      config_fingerprint_(std::move(config_fingerprint)),
+      build_version_(std::move(build_version)),
+      read_pool_(std::move(read_pool)),
+      max_bytes_(max_bytes) {}
+
+auto RenderedReportCache::ReadGenerations(std::string_view first_date,
+                                          std::string_view last_date)
+    -> std::optional<std::string> {
+  if (!read_pool_ || first_date.size() < kYearMonthLength ||
+      last_date.size() < kYearMonthLength) {
+    return std::nullopt;
+  }
+  // 库不存在时由查询路径报告错误，这里不重复上报诊断。
+  std::error_code exists_error;
+  if (!fs::exists(read_pool_->DbPath(), exists_error)) {
+    return std::nullopt;
+  }
+  const auto kLease = read_pool_->TryAcquire();
+  if (!kLease.has_value()) {
+    return std::nullopt;
+  }
+
+  // "*" 按字典序排在所有 YYYY-MM 之前，结果首行即全库纪元。
+  static const std::string kSelectSql = std::format(
+      "SELECT {0}, {1} FROM {2} WHERE {0} = '{3}' OR ({0} >= ?1 AND {0} <= ?2) "
+      "ORDER BY {0};",
+      generations::kScope, generations::kGeneration, generations::kTable,
+      generations::kGlobalScope);
+  const persistence::CachedSqliteStatement kStatement(kLease->Connection(),
+                                                      kSelectSql);
+  sqlite3_stmt* stmt = kStatement.Get();
+  if (stmt == nullptr) {
+    // 旧库尚未建代次表：无法判断数据是否变化，不缓存。
+    return std::nullopt;
+  }
+  const std::string_view kFirstMonth = first_date.substr(0, kYearMonthLength);
+  const std::string_view kLastMonth = last_date.substr(0, kYearMonthLength);
+  sqlite3_bind_text(stmt, 1, kFirstMonth.data(),
+                    static_cast<int>(kFirstMonth.size()), SQLITE_TRANSIENT);
+  sqlite3_bind_text(stmt, 2, kLastMonth.data(),
+                    static_cast<int>(kLastMonth.size()), SQLITE_TRANSIENT);
+
+  std::string result;
+  bool has_epoch = false;
+  int step = SQLITE_ROW;
+  while ((step = sqlite3_step(stmt)) == SQLITE_ROW) {
+    const auto* scope =
+        reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+    if (scope == nullptr) {
+      continue;
+    }
+    const std::string_view kScope(scope);
+    has_epoch = has_epoch || kScope == generations::kGlobalScope;
+    std::format_to(std::back_inserter(result), "{}{}={}",
+                   result.empty() ? "" : ",", kScope,
+                   sqlite3_column_int64(stmt, 1));
+  }
+  if (step != SQLITE_DONE || !has_epoch) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+auto RenderedReportCache::Lookup(const RenderedReportRequest& request)
+    -> RenderedReportLookup {
+  const auto kGenerations =
+      ReadGenerations(request.first_date, request.last_date);
+  if (!kGenerations.has_value()) {
+    return {};
+  }
+
+  RenderedReportLookup lookup{
+      .entry_key = std::format(
+          "{}|{}|{}|{}|{}|{}|{}|{}", kCacheFormatVersion, build_version_,
+          request.kind, request.first_date, request.last_date,
+          FormatTag(request.format), config_fingerprint_, *kGenerations),
+      .content = std::nullopt};
+  const std::string kFileName = EntryFileName(lookup.entry_key);
+
+  std::scoped_lock lock(mutex_);
+  EnsureIndexLoadedLocked();
+  const auto kIt = index_.find(kFileName);
+  if (kIt == index_.end()) {
+    return lookup;
+  }
+
+  auto bytes = ReadWholeFile(cache_dir_ / kFileName);
+  // 文件首行是完整键：不一致说明哈希碰撞或文件损坏，按未命中处理。
+  const std::size_t kHeaderSize = lookup.entry_key.size() + 1;
+  if (!bytes.has_value() || bytes->size() < kHeaderSize ||
+      std::string_view(*bytes).substr(0, lookup.entry_key.size()) !=
+          lookup.entry_key ||
+      (*bytes)[lookup.entry_key.size()] != '\n') {
+    if (!bytes.has_value()) {
+      EraseLocked(kIt->second);
+    }
+    return lookup;
+  }
+  bytes->erase(0, kHeaderSize);
+  lookup.content = std::move(*bytes);
+  TouchLocked(kIt->second);
+  return lookup;
+}
+
+auto RenderedReportCache::Store(const std::string& entry_key,
+                                std::string_view content) -> void {
+  if (entry_key.empty()) {
+    return;
+  }
+  const std::uintmax_t kEntrySize = entry_key.size() + 1 + content.size();
+  if (kEntrySize > max_bytes_) {
+    return;
+  }
+  const std::string kFileName = EntryFileName(entry_key);
+
+  std::scoped_lock lock(mutex_);
+  EnsureIndexLoadedLocked();
+
+  std::error_code error;
+  fs::create_directories(cache_dir_, error);
+  if (error) {
+    return;
+  }
+  const fs::path kTargetPath = cache_dir_ / kFileName;
+  fs::path temp_path = kTargetPath;
+  temp_path += kTempExtension;
+  {
+    std::ofstream output(temp_path, std::ios::binary | std::ios::trunc);
+    output << entry_key << '\n' << content;
+    output.flush();
+    if (!output) {
+      output.close();
+      fs::remove(temp_path, error);
+      return;
+    }
+  }
+  // 先写临时文件再改名，读者不会看到写了一半的条目。
+  fs::rename(temp_path, kTargetPath, error);
+  if (error) {
+    fs::remove(temp_path, error);
+    return;
+  }
+
+  if (const auto kIt = index_.find(kFileName); kIt != index_.end()) {
+    total_bytes_ -= kIt->second->size;
+    lru_.erase(kIt->second);
+    index_.erase(kIt);
+  }
+  lru_.push_front({.file_name = kFileName, .size = kEntrySize});
+  index_.emplace(kFileName, lru_.begin());
+  total_bytes_ += kEntrySize;
+  EvictLocked();
+}
+
+auto RenderedReportCache::EnsureIndexLoadedLocked() -> void {
+  if (index_loaded_) {
+    return;
+  }
+  index_loaded_ = true;
+
+  struct ScannedEntry {
+    fs::file_time_type last_write;
+    std::string file_name;
+    std::uintmax_t size = 0;
+  };
+  std::vector<ScannedEntry> scanned;
+  std::error_code error;
+  for (fs::directory_iterator it(cache_dir_, error), end;
+       !error && it != end; it.increment(error)) {
+    std::error_code entry_error;
+    if (!it->is_regular_file(entry_error)) {
+      continue;
+    }
+    const fs::path& path = it->path();
+    if (path.extension() == kTempExtension) {
+      // 上次写入中途退出留下的临时文件。
+      fs::remove(path, entry_error);
+      continue;
+    }
+    if (path.extension() != kEntryExtension) {
+      continue;
+    }
+    const auto kSize = it->file_size(entry_error);
+    if (entry_error) {
+      continue;
+    }
+    const auto kLastWrite = it->last_write_time(entry_error);
+    if (entry_error) {
+      continue;
+    }
+    scanned.push_back({.last_write = kLastWrite,
+                       .file_name = path.filename().string(),
+                       .size = kSize});
+  }
+
+  std::ranges::sort(scanned, [](const ScannedEntry& left,
+                                const ScannedEntry& right) {
+    return left.last_write > right.last_write;
+  });
+  for (auto& entry : scanned) {
+    lru_.push_back({.file_name = std::move(entry.file_name),
+                    .size = entry.size});
+    index_.emplace(lru_.back().file_name, std::prev(lru_.end()));
+    total_bytes_ += entry.size;
+  }
+  EvictLocked();
+}
+
+auto RenderedReportCache::TouchLocked(EntryList::iterator entry) -> void {
+  lru_.splice(lru_.begin(), lru_, entry);
+  // 修改时间记录访问顺序，重启后据此恢复 LRU。
+  std::error_code error;
+  fs::last_write_time(cache_dir_ / entry->file_name,
+                      fs::file_time_type::clock::now(), error);
+}
+
+auto RenderedReportCache::EraseLocked(EntryList::iterator entry) -> void {
+  std::error_code error;
+  fs::remove(cache_dir_ / entry->file_name, error);
+  total_bytes_ -= entry->size;
+  index_.erase(entry->file_name);
+  lru_.erase(entry);
+}
+
+auto RenderedReportCache::EvictLocked() -> void {
+  while (total_bytes_ > max_bytes_ && !lru_.empty()) {
+    EraseLocked(std::prev(lru_.end()));
+  }
+}
+
+auto FingerprintReportConfigFiles(
+    std::span<const std::filesystem::path> config_paths) -> std::string {
+  std::uint64_t hash = kFnvOffsetBasis;
+  for (const auto& path : config_paths) {
+    hash = Fnv1a64(path.generic_string(), hash);
+    hash = Fnv1a64(std::string_view("\0", 1), hash);
+    const auto kBytes = ReadWholeFile(path);
+    hash = Fnv1a64(kBytes.has_value() ? std::string_view(*kBytes)
+                                      : std::string_view("<missing>"),
+                   hash);
+    hash = Fnv1a64(std::string_view("\0", 1), hash);
+  }
+  return std::format("{:016x}", hash);
+}
+
+}  // namespace tracer::core::infrastructure::reports
@@ -4,6 +4,8 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include "application/ports/reporting/i_report_dto_formatter.hpp"
 #include "infra/config/models/report_catalog.hpp"
@@ -26,14 +28,27 @@ class ReportDtoFormatter final
   auto FormatYearly(const YearlyReportData& report, ReportFormat format)
       -> std::string override;
 
+  auto FormatDailyTo(const DailyReportData& report, ReportFormat format,
+                     std::string& output) -> void override;
+  auto FormatMonthlyTo(const MonthlyReportData& report, ReportFormat format,
+                       std::string& output) -> void override;
+  auto FormatPeriodTo(const PeriodReportData& report, ReportFormat format,
+                      std::string& output) -> void override;
+  auto FormatWeeklyTo(const WeeklyReportData& report, ReportFormat format,
+                      std::string& output) -> void override;
+  auto FormatYearlyTo(const YearlyReportData& report, ReportFormat format,
+                      std::string& output) -> void override;
+
  private:
   template <typename ReportDataType>
-  auto FormatWithCache(
-      const ReportDataType& report, ReportFormat format,
+  auto CachedFormatter(
+      ReportFormat format,
       std::map<ReportFormat, std::unique_ptr<IReportFormatter<ReportDataType>>>&
-          cache) -> std::string;
+          cache) -> const IReportFormatter<ReportDataType>&;
 
   const ReportCatalog& report_catalog_;
+  // 只保护各缓存的查找与插入；格式化器本身是 const 的，可并发调用。
+  std::mutex cache_mutex_;
   std::map<ReportFormat, std::unique_ptr<IReportFormatter<DailyReportData>>>
       daily_cache_;
   std::map<ReportFormat, std::unique_ptr<IReportFormatter<MonthlyReportData>>>
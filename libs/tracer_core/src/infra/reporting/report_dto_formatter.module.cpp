@@ -1,5 +1,6 @@
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -16,41 +17,77 @@ ReportDtoFormatter::ReportDtoFormatter(const ReportCatalog& report_catalog)
 
 auto ReportDtoFormatter::FormatDaily(const DailyReportData& report,
                                      ReportFormat format) -> std::string {
-  return FormatWithCache(report, format, daily_cache_);
+  return FormatReportWithScratch(CachedFormatter(format, daily_cache_),
+                                 report);
 }
 
 auto ReportDtoFormatter::FormatMonthly(const MonthlyReportData& report,
                                        ReportFormat format) -> std::string {
-  return FormatWithCache(report, format, monthly_cache_);
+  return FormatReportWithScratch(CachedFormatter(format, monthly_cache_),
+                                 report);
 }
 
 auto ReportDtoFormatter::FormatPeriod(const PeriodReportData& report,
                                       ReportFormat format) -> std::string {
-  return FormatWithCache(report, format, period_cache_);
+  return FormatReportWithScratch(CachedFormatter(format, period_cache_),
+                                 report);
 }
 
 auto ReportDtoFormatter::FormatWeekly(const WeeklyReportData& report,
                                       ReportFormat format) -> std::string {
-  return FormatWithCache(report, format, weekly_cache_);
+  return FormatReportWithScratch(CachedFormatter(format, weekly_cache_),
+                                 report);
 }
 
 auto ReportDtoFormatter::FormatYearly(const YearlyReportData& report,
                                       ReportFormat format) -> std::string {
-  return FormatWithCache(report, format, yearly_cache_);
+  return FormatReportWithScratch(CachedFormatter(format, yearly_cache_),
+                                 report);
+}
+
+auto ReportDtoFormatter::FormatDailyTo(const DailyReportData& report,
+                                       ReportFormat format,
+                                       std::string& output) -> void {
+  CachedFormatter(format, daily_cache_).FormatReportTo(report, output);
+}
+
+auto ReportDtoFormatter::FormatMonthlyTo(const MonthlyReportData& report,
+                                         ReportFormat format,
+                                         std::string& output) -> void {
+  CachedFormatter(format, monthly_cache_).FormatReportTo(report, output);
+}
+
+auto ReportDtoFormatter::FormatPeriodTo(const PeriodReportData& report,
+                                        ReportFormat format,
+                                        std::string& output) -> void {
+  CachedFormatter(format, period_cache_).FormatReportTo(report, output);
+}
+
+auto ReportDtoFormatter::FormatWeeklyTo(const WeeklyReportData& report,
+                                        ReportFormat format,
+                                        std::string& output) -> void {
+  CachedFormatter(format, weekly_cache_).FormatReportTo(report, output);
+}
+
+auto ReportDtoFormatter::FormatYearlyTo(const YearlyReportData& report,
+                                        ReportFormat format,
+                                        std::string& output) -> void {
+  CachedFormatter(format, yearly_cache_).FormatReportTo(report, output);
 }
 
 template <typename ReportDataType>
-auto ReportDtoFormatter::FormatWithCache(
-    const ReportDataType& report, ReportFormat format,
+auto ReportDtoFormatter::CachedFormatter(
+    ReportFormat format,
     std::map<ReportFormat, std::unique_ptr<IReportFormatter<ReportDataType>>>&
-        cache) -> std::string {
+        cache) -> const IReportFormatter<ReportDataType>& {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
   auto formatter_iter = cache.find(format);
   if (formatter_iter == cache.end()) {
-    auto formatter = GenericFormatterFactory<ReportDataType>::Create(
+    auto created = GenericFormatterFactory<ReportDataType>::Create(
         format, report_catalog_);
-    formatter_iter = cache.emplace(format, std::move(formatter)).first;
+    formatter_iter = cache.emplace(format, std::move(created)).first;
   }
-  return formatter_iter->second->FormatReport(report);
+  return *formatter_iter->second;
 }
 
 }  // namespace tracer::core::infrastructure::reports
@@ -56,7 +56,7 @@ auto ReportService::RunPeriodQuery(int days, ReportFormat format) const
   PeriodQuerier querier(db_, days, *platform_clock_);
   PeriodReportData report_data = querier.FetchData();
   auto& formatter = GetOrCreatePeriodFormatter(format);
-  return formatter.FormatReport(report_data);
+  return FormatReportWithScratch(formatter, report_data);
 }
 
 auto ReportService::RunWeeklyQuery(std::string_view iso_week_str,
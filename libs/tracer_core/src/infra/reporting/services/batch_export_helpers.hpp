@@ -7,6 +7,7 @@
 #include "domain/reports/interfaces/i_project_info_provider.hpp"
 #include "infra/reporting/data/cache/project_name_cache.hpp"
 #include "infra/reporting/data/utils/project_tree_builder.hpp"
+#include "infra/reporting/shared/interfaces/i_report_formatter.hpp"
 
 namespace reports::services {
 
@@ -34,7 +35,7 @@ inline void FormatReportMap(MapT& data_map, FormatterT& formatter,
       continue;
     }
     EnsureProjectTree(data, provider);
-    insert(key, formatter->FormatReport(data));
+    insert(key, FormatReportWithScratch(*formatter, data));
   }
 }
 
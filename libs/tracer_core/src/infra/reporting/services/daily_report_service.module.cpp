@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "infra/reporting/services/daily_report_service.hpp"
 #include "infra/config/models/report_catalog.hpp"
@@ -41,8 +42,9 @@ auto DailyReportService::GenerateAllReports(ReportFormat format)
     if (data.total_duration > 0) {
       ::reports::services::EnsureProjectTree(data, name_cache);
 
-      std::string formatted_report = formatter->FormatReport(data);
-      grouped_reports[year][month].push_back({date, formatted_report});
+      std::string formatted_report = FormatReportWithScratch(*formatter, data);
+      grouped_reports[year][month].push_back(
+          {date, std::move(formatted_report)});
     }
   }
 
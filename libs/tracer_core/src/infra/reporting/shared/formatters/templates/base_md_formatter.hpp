@@ -20,13 +20,20 @@ class BaseMdFormatter : public IReportFormatter<ReportDataT> {
 
   [[nodiscard]] auto FormatReport(const ReportDataT& data) const
       -> std::string override {
+    std::string report_stream;
+    FormatReportTo(data, report_stream);
+    return report_stream;
+  }
+
+  void FormatReportTo(const ReportDataT& data,
+                      std::string& report_stream) const override {
     // 1. 数据有效性检查
     if (std::string err = ValidateData(data); !err.empty()) {
-      return err + "\n";  // Markdown 通常多加个换行比较安全
+      report_stream += err;
+      report_stream += "\n";  // Markdown 通常多加个换行比较安全
+      return;
     }
 
-    std::string report_stream;
-
     // 2. 头部 / 摘要
     FormatHeaderContent(report_stream, data);
 
@@ -39,8 +46,6 @@ class BaseMdFormatter : public IReportFormatter<ReportDataT> {
       FormatExtraContent(report_stream, data);
       FormatProjectTreeSection(report_stream, data);
     }
-
-    return report_stream;
   }
 
  protected:
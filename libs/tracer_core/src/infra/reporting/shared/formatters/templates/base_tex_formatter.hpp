@@ -17,11 +17,18 @@ class BaseTexFormatter : public IReportFormatter<ReportDataT> {
 
   [[nodiscard]] auto FormatReport(const ReportDataT& data) const
       -> std::string override {
+    std::string output;
+    FormatReportTo(data, output);
+    return output;
+  }
+
+  void FormatReportTo(const ReportDataT& data,
+                      std::string& output) const override {
     if (std::string error = ValidateData(data); !error.empty()) {
-      return error;
+      output += error;
+      return;
     }
 
-    std::string output;
     output += GeneratePreamble();
 
     FormatHeaderContent(output, data);
@@ -35,7 +42,6 @@ class BaseTexFormatter : public IReportFormatter<ReportDataT> {
     }
 
     output += GeneratePostfix();
-    return output;
   }
 
  protected:
@@ -17,14 +17,19 @@ class BaseTypFormatter : public IReportFormatter<ReportDataT> {
   [[nodiscard]] auto FormatReport(const ReportDataT& data) const
       -> std::string override {
     std::string stream;
+    FormatReportTo(data, stream);
+    return stream;
+  }
 
+  void FormatReportTo(const ReportDataT& data,
+                      std::string& stream) const override {
     FormatPageSetup(stream);
     FormatTextSetup(stream);
 
     if (std::string error = ValidateData(data); !error.empty()) {
       stream += error;
       stream += "\n";
-      return stream;
+      return;
     }
 
     FormatHeaderContent(stream, data);
@@ -36,8 +41,6 @@ class BaseTypFormatter : public IReportFormatter<ReportDataT> {
       FormatExtraContent(stream, data);
       FormatProjectTreeSection(stream, data);
     }
-
-    return stream;
   }
 
  protected:
@@ -8,6 +8,7 @@
 #include "domain/reports/types/report_types.hpp"
 #include "infra/config/models/report_catalog.hpp"
 #include "infra/reporting/shared/factories/generic_formatter_factory.hpp"
+#include "infra/reporting/shared/interfaces/i_report_formatter.hpp"
 
 /**
  * @class BaseGenerator
@@ -54,8 +55,8 @@ class BaseGenerator {
     auto formatter = GenericFormatterFactory<ReportDataType>::Create(
         format, report_catalog_);
 
-    // 3. 格式化并返回报告
-    return formatter->FormatReport(report_data);
+    // 3. 在线程复用的缓冲区上格式化并返回报告
+    return FormatReportWithScratch(*formatter, report_data);
   }
 
  protected:
@@ -2,6 +2,7 @@
 #ifndef INFRASTRUCTURE_REPORTS_SHARED_INTERFACES_I_REPORT_FORMATTER_H_
 #define INFRASTRUCTURE_REPORTS_SHARED_INTERFACES_I_REPORT_FORMATTER_H_
 
+#include <cstddef>
 #include <string>
 
 #include "domain/reports/models/daily_report_data.hpp"
@@ -14,6 +15,32 @@ class IReportFormatter {
   virtual ~IReportFormatter() = default;
   [[nodiscard]] virtual auto FormatReport(const ReportDataType& data) const
       -> std::string = 0;
+
+  // 把报告追加到调用方持有的缓冲区末尾，内容与 FormatReport 逐字节
+  // 相同。Markdown/LaTeX/Typst 模板直接在缓冲区上构建报告。
+  virtual void FormatReportTo(const ReportDataType& data,
+                              std::string& output) const {
+    output += FormatReport(data);
+  }
 };
 
+// 在本线程复用的缓冲区上构建报告，再按实际长度拷贝一次返回：缓冲区
+// 容量稳定在常见报告的大小，大报告不再随追加反复重新分配。超过上限的
+// 缓冲区用完即释放，避免每个线程长期占着一份超大报告的内存。
+template <typename ReportDataType>
+[[nodiscard]] auto FormatReportWithScratch(
+    const IReportFormatter<ReportDataType>& formatter,
+    const ReportDataType& data) -> std::string {
+  constexpr std::size_t kMaxRetainedScratchBytes =
+      std::size_t{8} * 1024 * 1024;
+  thread_local std::string scratch;
+  scratch.clear();
+  formatter.FormatReportTo(data, scratch);
+  std::string report(scratch);
+  if (scratch.capacity() > kMaxRetainedScratchBytes) {
+    std::string().swap(scratch);
+  }
+  return report;
+}
+
 #endif  // INFRASTRUCTURE_REPORTS_SHARED_INTERFACES_I_REPORT_FORMATTER_H_
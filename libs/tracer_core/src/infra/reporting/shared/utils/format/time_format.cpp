@@ -6,13 +6,15 @@
 #include <ctime>
 #include <string>
 
+#include "shared/utils/civil_time.hpp"
+
 namespace {
+namespace civil_time = tracer::core::shared::civil_time;
+
 constexpr std::int64_t kSecondsInHour = 3600;
 constexpr std::int64_t kSecondsInMinute = 60;
 constexpr int kDateStringLength = 10;
 constexpr std::size_t kDurationBufferSize = 32U;
-constexpr int kMonthOffset = 5;
-constexpr int kDayOffset = 8;
 constexpr int kTmYearBase = 1900;
 constexpr int kYearWidth = 4;
 constexpr int kMonthDayWidth = 2;
@@ -80,17 +82,12 @@ auto AddDaysToDateStr(std::string date_str, int days) -> std::string {
     return date_str;
   }
 
-  int year = std::stoi(date_str.substr(0, 4));
-  int month = std::stoi(date_str.substr(kMonthOffset, 2));
-  int day = std::stoi(date_str.substr(kDayOffset, 2));
-
-  std::tm time_info{};
-  time_info.tm_year = year - kTmYearBase;
-  time_info.tm_mon = month - 1;
-  time_info.tm_mday = day + days;
-  std::mktime(&time_info);
-
-  return FormatDateTm(time_info);
+  const auto kDate = civil_time::ParseIsoDate(date_str);
+  if (!kDate.has_value()) {
+    return date_str;
+  }
+  return civil_time::FormatIsoDate(
+      civil_time::CivilFromDays(civil_time::DaysFromCivil(*kDate) + days));
 }
 
 auto GetCurrentDateStr() -> std::string {
@@ -33,6 +33,69 @@ inline constexpr std::string_view kProjectPaths = "project_paths";
 inline constexpr std::string_view kPath = "path";
 }  // namespace schema::projects::cte
 
+// 导入时与 time_records 同事务维护的物化汇总表；列名与 time_records
+// 保持一致，使按日期条件拼接的查询可以直接换表。
+namespace schema::project_daily_rollup::db {
+inline constexpr std::string_view kTable = "project_daily_rollup";
+inline constexpr std::string_view kDate = "date";
+inline constexpr std::string_view kYearMonth = "year_month";
+inline constexpr std::string_view kProjectId = "project_id";
+inline constexpr std::string_view kDuration = "duration";
+inline constexpr std::string_view kRecordCount = "record_count";
+}  // namespace schema::project_daily_rollup::db
+
+namespace schema::project_monthly_rollup::db {
+inline constexpr std::string_view kTable = "project_monthly_rollup";
+inline constexpr std::string_view kYearMonth = "year_month";
+inline constexpr std::string_view kProjectId = "project_id";
+inline constexpr std::string_view kDuration = "duration";
+inline constexpr std::string_view kRecordCount = "record_count";
+inline constexpr std::string_view kActiveDays = "active_days";
+}  // namespace schema::project_monthly_rollup::db
+
+// 每个有记录的日期一行，标记当天是否出现 study/exercise 等根项目。
+namespace schema::day_flag_rollup::db {
+inline constexpr std::string_view kTable = "day_flag_rollup";
+inline constexpr std::string_view kDate = "date";
+inline constexpr std::string_view kYearMonth = "year_month";
+inline constexpr std::string_view kStudy = "study";
+inline constexpr std::string_view kExercise = "exercise";
+inline constexpr std::string_view kCardio = "cardio";
+inline constexpr std::string_view kAnaerobic = "anaerobic";
+}  // namespace schema::day_flag_rollup::db
+
+// 汇总表的生成参数，键值对；day_flag_rollup 依赖的分类规则指纹记在
+// kProjectClassRulesKey 一行，与当前规则不同时汇总表视为过时。
+namespace schema::rollup_meta::db {
+inline constexpr std::string_view kTable = "rollup_meta";
+inline constexpr std::string_view kKey = "key";
+inline constexpr std::string_view kValue = "value";
+inline constexpr std::string_view kProjectClassRulesKey =
+    "project_class_rules";
+}  // namespace schema::rollup_meta::db
+
+// 可选的 FTS5（trigram 分词）全文索引，导入时与明细同事务维护。
+// 每条记录一行（record_id 为 time_records.logical_id），另为每个有备注的
+// 日期一行（只填 day_remark）；date 与 record_id 不参与索引。
+namespace schema::text_search::db {
+inline constexpr std::string_view kTable = "text_search";
+inline constexpr std::string_view kDate = "date";
+inline constexpr std::string_view kRecordId = "record_id";
+inline constexpr std::string_view kActivityRemark = "activity_remark";
+inline constexpr std::string_view kDayRemark = "day_remark";
+inline constexpr std::string_view kProjectPath = "project_path";
+}  // namespace schema::text_search::db
+
+// 报表数据代次：每个 YYYY-MM 一行，导入写入该月明细时加一；scope 为
+// "*" 的一行是全库纪元，全量替换时加一，建表时取随机初值，保证重建的
+// 数据库不会复用旧缓存键。
+namespace schema::report_generations::db {
+inline constexpr std::string_view kTable = "report_generations";
+inline constexpr std::string_view kScope = "scope";
+inline constexpr std::string_view kGeneration = "generation";
+inline constexpr std::string_view kGlobalScope = "*";
+}  // namespace schema::report_generations::db
+
 namespace schema::ingest_month_sync::db {
 inline constexpr std::string_view kTable = "ingest_month_sync";
 inline constexpr std::string_view kMonthKey = "month_key";
@@ -40,6 +103,8 @@ inline constexpr std::string_view kTxtRelativePath = "txt_relative_path";
 inline constexpr std::string_view kTxtContentHashSha256 =
     "txt_content_hash_sha256";
 inline constexpr std::string_view kIngestedAtUnixMs = "ingested_at_unix_ms";
+inline constexpr std::string_view kConverterConfigFingerprint =
+    "converter_config_fingerprint";
 }  // namespace schema::ingest_month_sync::db
 
 #endif  // INFRASTRUCTURE_SCHEMA_SQLITE_SCHEMA_H_
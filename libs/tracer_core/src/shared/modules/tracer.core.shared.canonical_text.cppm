@@ -8,6 +8,7 @@ export namespace tracer::core::shared::canonical_text {
 
 using ::tracer::core::shared::canonical_text::CanonicalizationResult;
 using ::tracer::core::shared::canonical_text::Canonicalize;
+using ::tracer::core::shared::canonical_text::CanonicalizeReference;
 using ::tracer::core::shared::canonical_text::RequireCanonicalText;
 using ::tracer::core::shared::canonical_text::ToUtf8Bytes;
 
@@ -17,6 +18,7 @@ export namespace tracer::core::shared::modtext {
 
 using tracer::core::shared::canonical_text::CanonicalizationResult;
 using tracer::core::shared::canonical_text::Canonicalize;
+using tracer::core::shared::canonical_text::CanonicalizeReference;
 using tracer::core::shared::canonical_text::RequireCanonicalText;
 using tracer::core::shared::canonical_text::ToUtf8Bytes;
 
@@ -0,0 +1,51 @@
+module;
+
+#include "shared/utils/civil_time.hpp"
+
+export module tracer.core.shared.civil_time;
+
+export namespace tracer::core::shared::civil_time {
+
+using ::tracer::core::shared::civil_time::CivilDate;
+using ::tracer::core::shared::civil_time::CivilFromDays;
+using ::tracer::core::shared::civil_time::DaysFromCivil;
+using ::tracer::core::shared::civil_time::DaysInMonth;
+using ::tracer::core::shared::civil_time::FormatIsoDate;
+using ::tracer::core::shared::civil_time::IsLeapYear;
+using ::tracer::core::shared::civil_time::IsoWeekdayFromDays;
+using ::tracer::core::shared::civil_time::IsValidDate;
+using ::tracer::core::shared::civil_time::kMinutesPerDay;
+using ::tracer::core::shared::civil_time::kMinutesPerHour;
+using ::tracer::core::shared::civil_time::kSecondsPerDay;
+using ::tracer::core::shared::civil_time::PackDate;
+using ::tracer::core::shared::civil_time::ParseIsoDate;
+using ::tracer::core::shared::civil_time::ParseIsoYearMonth;
+using ::tracer::core::shared::civil_time::ParseMinutesOfDay;
+using ::tracer::core::shared::civil_time::ToUtcEpochSeconds;
+using ::tracer::core::shared::civil_time::UnpackDate;
+using ::tracer::core::shared::civil_time::WrappedDurationMinutes;
+
+}  // namespace tracer::core::shared::civil_time
+
+export namespace tracer::core::shared::modcivil {
+
+using tracer::core::shared::civil_time::CivilDate;
+using tracer::core::shared::civil_time::CivilFromDays;
+using tracer::core::shared::civil_time::DaysFromCivil;
+using tracer::core::shared::civil_time::DaysInMonth;
+using tracer::core::shared::civil_time::FormatIsoDate;
+using tracer::core::shared::civil_time::IsLeapYear;
+using tracer::core::shared::civil_time::IsoWeekdayFromDays;
+using tracer::core::shared::civil_time::IsValidDate;
+using tracer::core::shared::civil_time::kMinutesPerDay;
+using tracer::core::shared::civil_time::kMinutesPerHour;
+using tracer::core::shared::civil_time::kSecondsPerDay;
+using tracer::core::shared::civil_time::PackDate;
+using tracer::core::shared::civil_time::ParseIsoDate;
+using tracer::core::shared::civil_time::ParseIsoYearMonth;
+using tracer::core::shared::civil_time::ParseMinutesOfDay;
+using tracer::core::shared::civil_time::ToUtcEpochSeconds;
+using tracer::core::shared::civil_time::UnpackDate;
+using tracer::core::shared::civil_time::WrappedDurationMinutes;
+
+}  // namespace tracer::core::shared::modcivil
@@ -3,5 +3,7 @@ export module tracer.core.shared;
 export import tracer.core.shared.canonical_text;
 export import tracer.core.shared.string_utils;
 export import tracer.core.shared.period_utils;
+export import tracer.core.shared.civil_time;
 export import tracer.core.shared.exceptions;
 export import tracer.core.shared.exit_codes;
+export import tracer.core.shared.work_stealing_executor;
@@ -7,13 +7,17 @@ export module tracer.core.shared.string_utils;
 export namespace tracer::core::shared::string_utils {
 
 using ::tracer::core::shared::string_utils::SplitString;
+using ::tracer::core::shared::string_utils::SplitView;
 using ::tracer::core::shared::string_utils::Trim;
+using ::tracer::core::shared::string_utils::TrimView;
 
 }  // namespace tracer::core::shared::string_utils
 
 export namespace tracer::core::shared::modutils {
 
 using tracer::core::shared::string_utils::SplitString;
+using tracer::core::shared::string_utils::SplitView;
 using tracer::core::shared::string_utils::Trim;
+using tracer::core::shared::string_utils::TrimView;
 
 }  // namespace tracer::core::shared::modutils
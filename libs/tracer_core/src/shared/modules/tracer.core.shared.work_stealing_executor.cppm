@@ -0,0 +1,19 @@
+module;
+
+#include "shared/utils/work_stealing_executor.hpp"
+
+export module tracer.core.shared.work_stealing_executor;
+
+export namespace tracer::core::shared::concurrency {
+
+using ::tracer::core::shared::concurrency::ResolveWorkerCount;
+using ::tracer::core::shared::concurrency::WorkStealingExecutor;
+
+}  // namespace tracer::core::shared::concurrency
+
+export namespace tracer::core::shared::modconcurrency {
+
+using tracer::core::shared::concurrency::ResolveWorkerCount;
+using tracer::core::shared::concurrency::WorkStealingExecutor;
+
+}  // namespace tracer::core::shared::modconcurrency
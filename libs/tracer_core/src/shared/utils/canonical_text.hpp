@@ -1,14 +1,29 @@
 #ifndef SHARED_UTILS_CANONICAL_TEXT_H_
 #define SHARED_UTILS_CANONICAL_TEXT_H_
 
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#include <immintrin.h>
+#define TRACER_CANONICAL_TEXT_HAS_AVX2_DISPATCH 1
+#endif
+#define TRACER_CANONICAL_TEXT_HAS_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define TRACER_CANONICAL_TEXT_HAS_NEON 1
+#endif
+
 namespace tracer::core::shared::canonical_text {
 
 struct CanonicalizationResult {
@@ -148,6 +163,8 @@ inline auto ValidateUtf8(std::span<const std::uint8_t> bytes,
   return "";
 }
 
+// 逐字节剥离 BOM 并把 CRLF/CR 归一为 LF；与 ValidateUtf8 一起构成
+// 标量参考实现，快速路径 `CanonicalizeFused` 必须与其结果逐字节一致。
 inline auto NormalizeValidatedBytes(std::span<const std::uint8_t> bytes)
     -> std::string {
   constexpr std::uint8_t kBom0 = 0xEFU;
@@ -176,19 +193,214 @@ inline auto NormalizeValidatedBytes(std::span<const std::uint8_t> bytes)
   return normalized;
 }
 
+// “普通字节”指无需任何处理即可原样拷贝的字节：ASCII 且不是 '\r'。
+inline auto ScanPlainAsciiScalar(const std::uint8_t* data, std::size_t size)
+    -> std::size_t {
+  std::size_t index = 0;
+  while (index < size && data[index] < 0x80U && data[index] != '\r') {
+    ++index;
+  }
+  return index;
+}
+
+#if defined(TRACER_CANONICAL_TEXT_HAS_SSE2)
+inline auto ScanPlainAsciiSse2(const std::uint8_t* data, std::size_t size)
+    -> std::size_t {
+  constexpr std::size_t kBlock = 16;
+  const __m128i kCarriageReturn = _mm_set1_epi8('\r');
+  std::size_t index = 0;
+  for (; index + kBlock <= size; index += kBlock) {
+    const __m128i kChunk = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(data + index));  // NOLINT
+    // 高位为 1 的字节（非 ASCII）和 '\r' 都会在掩码中置位。
+    const auto kMask = static_cast<unsigned>(
+        _mm_movemask_epi8(kChunk) |
+        _mm_movemask_epi8(_mm_cmpeq_epi8(kChunk, kCarriageReturn)));
+    if (kMask != 0U) {
+      return index + static_cast<std::size_t>(std::countr_zero(kMask));
+    }
+  }
+  return index + ScanPlainAsciiScalar(data + index, size - index);
+}
+#endif
+
+#if defined(TRACER_CANONICAL_TEXT_HAS_AVX2_DISPATCH)
+__attribute__((target("avx2"))) inline auto ScanPlainAsciiAvx2(
+    const std::uint8_t* data, std::size_t size) -> std::size_t {
+  constexpr std::size_t kBlock = 32;
+  const __m256i kCarriageReturn = _mm256_set1_epi8('\r');
+  std::size_t index = 0;
+  for (; index + kBlock <= size; index += kBlock) {
+    const __m256i kChunk = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(data + index));  // NOLINT
+    const auto kMask = static_cast<unsigned>(
+        _mm256_movemask_epi8(kChunk) |
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(kChunk, kCarriageReturn)));
+    if (kMask != 0U) {
+      return index + static_cast<std::size_t>(std::countr_zero(kMask));
+    }
+  }
+  return index + ScanPlainAsciiSse2(data + index, size - index);
+}
+#endif
+
+#if defined(TRACER_CANONICAL_TEXT_HAS_NEON)
+inline auto ScanPlainAsciiNeon(const std::uint8_t* data, std::size_t size)
+    -> std::size_t {
+  constexpr std::size_t kBlock = 16;
+  const uint8x16_t kHighBit = vdupq_n_u8(0x80U);
+  const uint8x16_t kCarriageReturn = vdupq_n_u8('\r');
+  std::size_t index = 0;
+  for (; index + kBlock <= size; index += kBlock) {
+    const uint8x16_t kChunk = vld1q_u8(data + index);
+    const uint8x16_t kSpecial = vorrq_u8(vcgeq_u8(kChunk, kHighBit),
+                                         vceqq_u8(kChunk, kCarriageReturn));
+    if (vmaxvq_u8(kSpecial) != 0U) {
+      // 块内定位交给标量扫描，最多 16 字节。
+      return index + ScanPlainAsciiScalar(data + index, kBlock);
+    }
+  }
+  return index + ScanPlainAsciiScalar(data + index, size - index);
+}
+#endif
+
+using ScanPlainAsciiFn = std::size_t (*)(const std::uint8_t*, std::size_t);
+
+inline auto ResolveScanPlainAscii() -> ScanPlainAsciiFn {
+#if defined(TRACER_CANONICAL_TEXT_HAS_AVX2_DISPATCH)
+  if (__builtin_cpu_supports("avx2")) {
+    return &ScanPlainAsciiAvx2;
+  }
+#endif
+#if defined(TRACER_CANONICAL_TEXT_HAS_SSE2)
+  return &ScanPlainAsciiSse2;
+#elif defined(TRACER_CANONICAL_TEXT_HAS_NEON)
+  return &ScanPlainAsciiNeon;
+#else
+  return &ScanPlainAsciiScalar;
+#endif
+}
+
+/**
+ * @brief 返回从 data 开始连续“普通字节”的数量（运行时选择 SIMD 实现）。
+ */
+inline auto ScanPlainAscii(const std::uint8_t* data, std::size_t size)
+    -> std::size_t {
+  static const ScanPlainAsciiFn kScan = ResolveScanPlainAscii();
+  return kScan(data, size);
+}
+
+// 校验 offset 处一个多字节序列，返回其长度；非法时返回 0。
+// 接受范围与 ValidateUtf8 完全一致。
+inline auto MultiByteSequenceLength(std::span<const std::uint8_t> bytes,
+                                    std::size_t offset) -> std::size_t {
+  const std::uint8_t lead = bytes[offset];
+  std::size_t length = 0;
+  std::uint8_t second_min = 0x80U;
+  std::uint8_t second_max = 0xBFU;
+  if (lead >= 0xC2U && lead <= 0xDFU) {
+    length = 2;
+  } else if (lead >= 0xE0U && lead <= 0xEFU) {
+    length = 3;
+    second_min = lead == 0xE0U ? 0xA0U : 0x80U;
+    second_max = lead == 0xEDU ? 0x9FU : 0xBFU;
+  } else if (lead >= 0xF0U && lead <= 0xF4U) {
+    length = 4;
+    second_min = lead == 0xF0U ? 0x90U : 0x80U;
+    second_max = lead == 0xF4U ? 0x8FU : 0xBFU;
+  } else {
+    return 0;
+  }
+
+  if (offset + length > bytes.size()) {
+    return 0;
+  }
+  const std::uint8_t second = bytes[offset + 1];
+  if (second < second_min || second > second_max) {
+    return 0;
+  }
+  for (std::size_t index = 2; index < length; ++index) {
+    if (!IsContinuationByte(bytes[offset + index])) {
+      return 0;
+    }
+  }
+  return length;
+}
+
+/**
+ * @brief 单趟完成 UTF-8 校验、BOM 剥离与换行归一。
+ *
+ * 连续的 ASCII 普通字节按 16/32 字节块批量拷贝；只有多字节序列和 '\r'
+ * 进入逐序列处理。遇到非法输入时回退到标量参考实现生成错误信息，
+ * 保证错误文本与历史行为一致。
+ */
+inline auto CanonicalizeFused(std::span<const std::uint8_t> bytes,
+                              std::string_view source_label)
+    -> CanonicalizationResult {
+  const std::size_t kSize = bytes.size();
+  std::size_t index = 0;
+  if (kSize >= 3 && bytes[0] == 0xEFU && bytes[1] == 0xBBU &&
+      bytes[2] == 0xBFU) {
+    index = 3;
+  }
+
+  std::string normalized(kSize - index, '\0');
+  char* const out = normalized.data();
+  std::size_t written = 0;
+  while (index < kSize) {
+    const std::size_t kPlain =
+        ScanPlainAscii(bytes.data() + index, kSize - index);
+    std::memcpy(out + written, bytes.data() + index, kPlain);
+    index += kPlain;
+    written += kPlain;
+    if (index >= kSize) {
+      break;
+    }
+
+    if (bytes[index] == '\r') {
+      out[written++] = '\n';
+      index += (index + 1 < kSize && bytes[index + 1] == '\n') ? 2 : 1;
+      continue;
+    }
+
+    const std::size_t kLength = MultiByteSequenceLength(bytes, index);
+    if (kLength == 0) {
+      return {.ok = false,
+              .text = "",
+              .error_message = ValidateUtf8(bytes, source_label)};
+    }
+    std::memcpy(out + written, bytes.data() + index, kLength);
+    index += kLength;
+    written += kLength;
+  }
+  normalized.resize(written);
+  return {.ok = true, .text = std::move(normalized), .error_message = ""};
+}
+
 inline auto CanonicalizeValidatedBytes(std::span<const std::uint8_t> bytes,
                                        std::string_view source_label)
     -> CanonicalizationResult {
-  const std::string validation_error = ValidateUtf8(bytes, source_label);
+  return CanonicalizeFused(bytes, source_label);
+}
+
+}  // namespace detail
+
+/**
+ * @brief 标量参考实现，仅用于与快速路径做差分测试。
+ */
+inline auto CanonicalizeReference(std::span<const std::uint8_t> bytes,
+                                  std::string_view source_label = {})
+    -> CanonicalizationResult {
+  const std::string validation_error =
+      detail::ValidateUtf8(bytes, source_label);
   if (!validation_error.empty()) {
     return {.ok = false, .text = "", .error_message = validation_error};
   }
-  return {
-      .ok = true, .text = NormalizeValidatedBytes(bytes), .error_message = ""};
+  return {.ok = true,
+          .text = detail::NormalizeValidatedBytes(bytes),
+          .error_message = ""};
 }
 
-}  // namespace detail
-
 inline auto Canonicalize(std::span<const std::uint8_t> bytes,
                          std::string_view source_label = {})
     -> CanonicalizationResult {
@@ -0,0 +1,250 @@
+// shared/utils/civil_time.hpp
+#ifndef SHARED_UTILS_CIVIL_TIME_H_
+#define SHARED_UTILS_CIVIL_TIME_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace tracer::core::shared::civil_time {
+
+/**
+ * 无分配的公历日期/时刻内核。
+ *
+ * 日期以 `CivilDate` 或打包整数 YYYYMMDD 表示，时刻以当天分钟数
+ * (minutes-of-day, 0..1439) 表示；日期换算使用 days-from-civil 算法
+ * (proleptic Gregorian)，全部函数为 constexpr，不依赖 locale/TZ，
+ * 也不触碰 `std::mktime` 的全局锁。
+ *
+ * 时区策略：本内核只产出“民用时间按 UTC 编码”的 epoch 秒
+ * (`ToUtcEpochSeconds`)。需要本地时区语义的调用方必须显式提供
+ * UTC 偏移（见 converter 中按日期缓存的本地偏移），内核本身不读取时区。
+ */
+
+inline constexpr int kMinutesPerHour = 60;
+inline constexpr int kHoursPerDay = 24;
+inline constexpr int kMinutesPerDay = kMinutesPerHour * kHoursPerDay;
+inline constexpr std::int64_t kSecondsPerMinute = 60;
+inline constexpr std::int64_t kSecondsPerDay =
+    kSecondsPerMinute * kMinutesPerDay;
+
+struct CivilDate {
+  int year = 0;
+  int month = 0;
+  int day = 0;
+
+  friend constexpr auto operator==(const CivilDate&, const CivilDate&)
+      -> bool = default;
+};
+
+namespace detail {
+
+constexpr int kDaysPerEra = 146097;
+constexpr int kYearsPerEra = 400;
+constexpr int kDaysFromEpochShift = 719468;
+constexpr int kPackedYearScale = 10000;
+constexpr int kPackedMonthScale = 100;
+
+[[nodiscard]] constexpr auto IsDigit(char value) -> bool {
+  return value >= '0' && value <= '9';
+}
+
+// 解析固定宽度的十进制数字段；出现非数字字符时返回 -1。
+[[nodiscard]] constexpr auto ParseFixedDigits(std::string_view text) -> int {
+  if (text.empty()) {
+    return -1;
+  }
+  int value = 0;
+  for (const char kDigit : text) {
+    if (!IsDigit(kDigit)) {
+      return -1;
+    }
+    value = (value * 10) + (kDigit - '0');
+  }
+  return value;
+}
+
+}  // namespace detail
+
+[[nodiscard]] constexpr auto IsLeapYear(int year) -> bool {
+  return (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0);
+}
+
+[[nodiscard]] constexpr auto DaysInMonth(int year, int month) -> int {
+  constexpr int kDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (month < 1 || month > 12) {
+    return 0;
+  }
+  if (month == 2 && IsLeapYear(year)) {
+    return 29;
+  }
+  return kDays[month - 1];
+}
+
+[[nodiscard]] constexpr auto IsValidDate(const CivilDate& date) -> bool {
+  return date.day >= 1 && date.day <= DaysInMonth(date.year, date.month);
+}
+
+/**
+ * @brief 公历日期 → 相对 1970-01-01 的天数（Howard Hinnant 算法）。
+ */
+[[nodiscard]] constexpr auto DaysFromCivil(const CivilDate& date)
+    -> std::int64_t {
+  const int kYear = date.year - (date.month <= 2 ? 1 : 0);
+  const int kEra =
+      (kYear >= 0 ? kYear : kYear - (detail::kYearsPerEra - 1)) /
+      detail::kYearsPerEra;
+  const int kYearOfEra = kYear - (kEra * detail::kYearsPerEra);
+  const int kMonthIndex = date.month + (date.month > 2 ? -3 : 9);
+  const int kDayOfYear = ((153 * kMonthIndex + 2) / 5) + date.day - 1;
+  const int kDayOfEra =
+      (kYearOfEra * 365) + (kYearOfEra / 4) - (kYearOfEra / 100) + kDayOfYear;
+  return (static_cast<std::int64_t>(kEra) * detail::kDaysPerEra) +
+         kDayOfEra - detail::kDaysFromEpochShift;
+}
+
+/**
+ * @brief 相对 1970-01-01 的天数 → 公历日期，`DaysFromCivil` 的逆运算。
+ */
+[[nodiscard]] constexpr auto CivilFromDays(std::int64_t days) -> CivilDate {
+  const std::int64_t kShifted = days + detail::kDaysFromEpochShift;
+  const std::int64_t kEra =
+      (kShifted >= 0 ? kShifted : kShifted - (detail::kDaysPerEra - 1)) /
+      detail::kDaysPerEra;
+  const auto kDayOfEra =
+      static_cast<int>(kShifted - (kEra * detail::kDaysPerEra));
+  const int kYearOfEra =
+      (kDayOfEra - (kDayOfEra / 1460) + (kDayOfEra / 36524) -
+       (kDayOfEra / (detail::kDaysPerEra - 1))) /
+      365;
+  const int kDayOfYear =
+      kDayOfEra - ((365 * kYearOfEra) + (kYearOfEra / 4) - (kYearOfEra / 100));
+  const int kMonthIndex = ((5 * kDayOfYear) + 2) / 153;
+  const int kDay = kDayOfYear - (((153 * kMonthIndex) + 2) / 5) + 1;
+  const int kMonth = kMonthIndex + (kMonthIndex < 10 ? 3 : -9);
+  const auto kYear = static_cast<int>(
+      (kEra * detail::kYearsPerEra) + kYearOfEra + (kMonth <= 2 ? 1 : 0));
+  return {.year = kYear, .month = kMonth, .day = kDay};
+}
+
+/// @brief ISO 星期编号：1=周一 ... 7=周日。
+[[nodiscard]] constexpr auto IsoWeekdayFromDays(std::int64_t days) -> int {
+  // 1970-01-01 是周四。
+  const std::int64_t kMondayBased = (days + 3) % 7;
+  return static_cast<int>(kMondayBased < 0 ? kMondayBased + 7 : kMondayBased) +
+         1;
+}
+
+[[nodiscard]] constexpr auto PackDate(const CivilDate& date) -> std::int32_t {
+  return (date.year * detail::kPackedYearScale) +
+         (date.month * detail::kPackedMonthScale) + date.day;
+}
+
+[[nodiscard]] constexpr auto UnpackDate(std::int32_t packed) -> CivilDate {
+  return {.year = packed / detail::kPackedYearScale,
+          .month = (packed / detail::kPackedMonthScale) %
+                   detail::kPackedMonthScale,
+          .day = packed % detail::kPackedMonthScale};
+}
+
+/**
+ * @brief 格式化为 "YYYY-MM-DD"（年份按 4 位补零）。
+ */
+[[nodiscard]] inline auto FormatIsoDate(const CivilDate& date) -> std::string {
+  std::string output(10U, '0');
+  int year = date.year;
+  for (std::size_t index = 4; index > 0; --index) {
+    output[index - 1] = static_cast<char>('0' + (year % 10));
+    year /= 10;
+  }
+  output[4] = '-';
+  output[5] = static_cast<char>('0' + (date.month / 10));
+  output[6] = static_cast<char>('0' + (date.month % 10));
+  output[7] = '-';
+  output[8] = static_cast<char>('0' + (date.day / 10));
+  output[9] = static_cast<char>('0' + (date.day % 10));
+  return output;
+}
+
+/**
+ * @brief 解析 "YYYY-MM-DD"；格式或日期非法时返回 std::nullopt。
+ */
+[[nodiscard]] constexpr auto ParseIsoDate(std::string_view text)
+    -> std::optional<CivilDate> {
+  if (text.size() != 10U || text[4] != '-' || text[7] != '-') {
+    return std::nullopt;
+  }
+  const CivilDate kDate{.year = detail::ParseFixedDigits(text.substr(0, 4)),
+                        .month = detail::ParseFixedDigits(text.substr(5, 2)),
+                        .day = detail::ParseFixedDigits(text.substr(8, 2))};
+  if (kDate.year < 0 || !IsValidDate(kDate)) {
+    return std::nullopt;
+  }
+  return kDate;
+}
+
+/**
+ * @brief 解析 "YYYY-MM"（日固定为 1）；非法时返回 std::nullopt。
+ */
+[[nodiscard]] constexpr auto ParseIsoYearMonth(std::string_view text)
+    -> std::optional<CivilDate> {
+  if (text.size() != 7U || text[4] != '-') {
+    return std::nullopt;
+  }
+  const CivilDate kDate{.year = detail::ParseFixedDigits(text.substr(0, 4)),
+                        .month = detail::ParseFixedDigits(text.substr(5, 2)),
+                        .day = 1};
+  if (kDate.year < 0 || !IsValidDate(kDate)) {
+    return std::nullopt;
+  }
+  return kDate;
+}
+
+/**
+ * @brief 解析 "HH:MM" 或 "HHMM" 为当天分钟数；非法时返回 std::nullopt。
+ */
+[[nodiscard]] constexpr auto ParseMinutesOfDay(std::string_view text)
+    -> std::optional<int> {
+  std::size_t minute_offset = 2;
+  if (text.size() == 5U) {
+    if (text[2] != ':') {
+      return std::nullopt;
+    }
+    minute_offset = 3;
+  } else if (text.size() != 4U) {
+    return std::nullopt;
+  }
+  const int kHour = detail::ParseFixedDigits(text.substr(0, 2));
+  const int kMinute = detail::ParseFixedDigits(text.substr(minute_offset, 2));
+  if (kHour < 0 || kHour >= kHoursPerDay || kMinute < 0 ||
+      kMinute >= kMinutesPerHour) {
+    return std::nullopt;
+  }
+  return (kHour * kMinutesPerHour) + kMinute;
+}
+
+/**
+ * @brief 计算跨午夜回绕的时长：结束早于开始时视为次日。
+ */
+[[nodiscard]] constexpr auto WrappedDurationMinutes(int start_minutes,
+                                                    int end_minutes) -> int {
+  return end_minutes >= start_minutes
+             ? end_minutes - start_minutes
+             : end_minutes + kMinutesPerDay - start_minutes;
+}
+
+/**
+ * @brief 将民用日期 + 当天分钟数按 UTC 编码为 epoch 秒。
+ */
+[[nodiscard]] constexpr auto ToUtcEpochSeconds(const CivilDate& date,
+                                               int minutes_of_day)
+    -> std::int64_t {
+  return (DaysFromCivil(date) * kSecondsPerDay) +
+         (static_cast<std::int64_t>(minutes_of_day) * kSecondsPerMinute);
+}
+
+}  // namespace tracer::core::shared::civil_time
+
+#endif  // SHARED_UTILS_CIVIL_TIME_H_
@@ -4,6 +4,7 @@
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace tracer::core::shared::string_utils {
@@ -40,6 +41,40 @@ inline auto SplitString(const std::string& str, char delimiter)
   return tokens;
 }
 
+/**
+ * @brief 去除两端空白字符，返回指向原缓冲区的视图，不分配内存。
+ * @param str 输入视图；返回值与其共享生命周期。
+ */
+inline auto TrimView(std::string_view str) -> std::string_view {
+  constexpr std::string_view kWhitespace = " \n\r\t\f\v";
+  const size_t kFirst = str.find_first_not_of(kWhitespace);
+  if (kFirst == std::string_view::npos) {
+    return {};
+  }
+  const size_t kLast = str.find_last_not_of(kWhitespace);
+  return str.substr(kFirst, kLast - kFirst + 1);
+}
+
+/**
+ * @brief 按分隔符拆分为指向原缓冲区的视图，语义与 SplitString 一致
+ *        （末尾分隔符不产生空片段）。
+ */
+inline auto SplitView(std::string_view str, char delimiter)
+    -> std::vector<std::string_view> {
+  std::vector<std::string_view> tokens;
+  size_t begin = 0;
+  while (begin < str.size()) {
+    const size_t kEnd = str.find(delimiter, begin);
+    if (kEnd == std::string_view::npos) {
+      tokens.push_back(str.substr(begin));
+      break;
+    }
+    tokens.push_back(str.substr(begin, kEnd - begin));
+    begin = kEnd + 1;
+  }
+  return tokens;
+}
+
 }  // namespace tracer::core::shared::string_utils
 
 #endif  // SHARED_UTILS_STRING_UTILS_H_
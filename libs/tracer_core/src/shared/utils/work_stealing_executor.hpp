@@ -0,0 +1,292 @@
+// shared/utils/work_stealing_executor.hpp
+#ifndef SHARED_UTILS_WORK_STEALING_EXECUTOR_H_
+#define SHARED_UTILS_WORK_STEALING_EXECUTOR_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace tracer::core::shared::concurrency {
+
+/**
+ * @brief 将请求的并发度解析为实际工作线程数。
+ * @param requested_workers 请求的线程数；0 表示使用 hardware_concurrency。
+ * @return 至少为 1 的工作线程数。
+ */
+inline auto ResolveWorkerCount(std::size_t requested_workers) -> std::size_t {
+  if (requested_workers > 0) {
+    return requested_workers;
+  }
+  const unsigned int kHardwareThreads = std::thread::hardware_concurrency();
+  return kHardwareThreads == 0U ? std::size_t{1}
+                                : static_cast<std::size_t>(kHardwareThreads);
+}
+
+/**
+ * @brief 固定线程数的 work-stealing 任务执行器。
+ *
+ * 每个工作线程持有自己的双端队列：本线程从尾部取任务（LIFO），空闲线程从
+ * 其他队列头部窃取（FIFO）。`ParallelFor` 的调用线程在等待期间也会参与执行，
+ * 因此可以在任务内部嵌套调用而不会死锁。结果写回按 index 定位，调用方负责
+ * 按 index 顺序归并，保证输出与串行执行一致。
+ */
+class WorkStealingExecutor {
+ public:
+  explicit WorkStealingExecutor(std::size_t requested_workers = 0)
+      : queues_(ResolveWorkerCount(requested_workers)) {
+    for (auto& queue : queues_) {
+      queue = std::make_unique<WorkerQueue>();
+    }
+    workers_.reserve(queues_.size());
+    for (std::size_t index = 0; index < queues_.size(); ++index) {
+      workers_.emplace_back([this, index]() -> void { WorkerLoop(index); });
+    }
+  }
+
+  ~WorkStealingExecutor() {
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+      stopping_ = true;
+    }
+    wake_cv_.notify_all();
+    for (auto& worker : workers_) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+  }
+
+  WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+  auto operator=(const WorkStealingExecutor&) -> WorkStealingExecutor& = delete;
+  WorkStealingExecutor(WorkStealingExecutor&&) = delete;
+  auto operator=(WorkStealingExecutor&&) -> WorkStealingExecutor& = delete;
+
+  [[nodiscard]] auto WorkerCount() const -> std::size_t {
+    return queues_.size();
+  }
+
+  /**
+   * @brief 可陆续提交任务的任务组，供“边产生输入边处理”的流水线使用。
+   *
+   * 组对象必须比其中的任务活得久：销毁前需调用 `Wait`。
+   */
+  class TaskGroup {
+   public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup&) = delete;
+    auto operator=(const TaskGroup&) -> TaskGroup& = delete;
+    TaskGroup(TaskGroup&&) = delete;
+    auto operator=(TaskGroup&&) -> TaskGroup& = delete;
+    ~TaskGroup() = default;
+
+   private:
+    friend class WorkStealingExecutor;
+
+    auto AddOne() -> std::size_t {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++remaining_;
+      errors_.emplace_back();
+      return errors_.size() - 1;
+    }
+
+    // 计数与通知都在锁内完成：调用线程观察到完成时，工作线程已不再访问
+    // 本对象，任务组可以安全析构。
+    auto CompleteOne(std::size_t index, std::exception_ptr error) -> void {
+      std::lock_guard<std::mutex> lock(mutex_);
+      errors_[index] = std::move(error);
+      --remaining_;
+      if (remaining_ == 0) {
+        done_cv_.notify_all();
+      }
+    }
+
+    [[nodiscard]] auto IsDone() -> bool {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return remaining_ == 0;
+    }
+
+    auto WaitDone() -> void {
+      std::unique_lock<std::mutex> lock(mutex_);
+      done_cv_.wait(lock, [this]() -> bool { return remaining_ == 0; });
+    }
+
+    auto RethrowFirstError() -> void {
+      std::vector<std::exception_ptr> errors;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        errors.swap(errors_);
+      }
+      for (const auto& error : errors) {
+        if (error) {
+          std::rethrow_exception(error);
+        }
+      }
+    }
+
+    std::size_t remaining_ = 0;
+    std::vector<std::exception_ptr> errors_;
+    std::mutex mutex_;
+    std::condition_variable done_cv_;
+  };
+
+  /**
+   * @brief 向任务组提交一个任务，立即返回。
+   */
+  template <typename Task>
+  auto Submit(TaskGroup& group, Task&& task) -> void {
+    const std::size_t kIndex = group.AddOne();
+    const std::size_t kQueue =
+        next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    try {
+      Push(kQueue, [&group, kIndex,
+                    task = std::forward<Task>(task)]() mutable -> void {
+        std::exception_ptr error;
+        try {
+          task();
+        } catch (...) {
+          error = std::current_exception();
+        }
+        group.CompleteOne(kIndex, std::move(error));
+      });
+    } catch (...) {
+      // 入队失败的任务不会执行，先销账，避免 Wait 永远等不到它。
+      group.CompleteOne(kIndex, nullptr);
+      throw;
+    }
+  }
+
+  /**
+   * @brief 阻塞直到任务组中已提交的任务全部完成，等待期间调用线程参与执行。
+   *
+   * 任务抛出的异常按提交顺序重新抛出第一个。
+   */
+  auto Wait(TaskGroup& group) -> void {
+    while (!group.IsDone()) {
+      std::function<void()> job;
+      if (TrySteal(0, job)) {
+        job();
+        continue;
+      }
+      // 队列中已无任务：本组剩余任务都在其他线程上执行中。
+      group.WaitDone();
+    }
+    group.RethrowFirstError();
+  }
+
+  /**
+   * @brief 对 [0, count) 的每个 index 执行 task(index)，阻塞直到全部完成。
+   *
+   * 任务抛出的异常会被收集，全部任务结束后按 index 顺序重新抛出第一个。
+   */
+  template <typename Task>
+  auto ParallelFor(std::size_t count, Task&& task) -> void {
+    if (count == 0) {
+      return;
+    }
+
+    TaskGroup group;
+    try {
+      for (std::size_t index = 0; index < count; ++index) {
+        Submit(group, [&task, index]() -> void { task(index); });
+      }
+    } catch (...) {
+      // 已提交的任务仍引用 group 与 task，须等它们结束；等待中的任务异常
+      // 不能覆盖提交失败本身。
+      const std::exception_ptr kSubmitError = std::current_exception();
+      try {
+        Wait(group);
+      } catch (...) {
+        // 保留提交失败，丢弃任务异常。
+      }
+      std::rethrow_exception(kSubmitError);
+    }
+    Wait(group);
+  }
+
+ private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> jobs;
+  };
+
+  auto Push(std::size_t queue_index, std::function<void()> job) -> void {
+    {
+      auto& queue = *queues_[queue_index];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.jobs.push_back(std::move(job));
+    }
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+      pending_.fetch_add(1, std::memory_order_release);
+    }
+    wake_cv_.notify_one();
+  }
+
+  auto TryPopLocal(std::size_t queue_index, std::function<void()>& job)
+      -> bool {
+    auto& queue = *queues_[queue_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) {
+      return false;
+    }
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    pending_.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+  }
+
+  auto TrySteal(std::size_t thief_index, std::function<void()>& job) -> bool {
+    const std::size_t kQueueCount = queues_.size();
+    for (std::size_t offset = 0; offset < kQueueCount; ++offset) {
+      auto& queue = *queues_[(thief_index + offset) % kQueueCount];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.jobs.empty()) {
+        continue;
+      }
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+      pending_.fetch_sub(1, std::memory_order_acq_rel);
+      return true;
+    }
+    return false;
+  }
+
+  auto WorkerLoop(std::size_t worker_index) -> void {
+    while (true) {
+      std::function<void()> job;
+      if (TryPopLocal(worker_index, job) ||
+          TrySteal(worker_index + 1, job)) {
+        job();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(wake_mutex_);
+      wake_cv_.wait(lock, [this]() -> bool {
+        return stopping_ || pending_.load(std::memory_order_acquire) > 0;
+      });
+      if (stopping_ && pending_.load(std::memory_order_acquire) == 0) {
+        return;
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> pending_{0};
+  std::atomic<std::size_t> next_queue_{0};
+  std::mutex wake_mutex_;
+  std::condition_variable wake_cv_;
+  bool stopping_ = false;
+};
+
+}  // namespace tracer::core::shared::concurrency
+
+#endif  // SHARED_UTILS_WORK_STEALING_EXECUTOR_H_
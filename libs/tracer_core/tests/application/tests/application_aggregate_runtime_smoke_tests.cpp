@@ -43,8 +43,8 @@ class SmokePipelineWorkflow final
   auto RunDatabaseImport(const std::string&) -> void override {}
   auto RunDatabaseImportFromMemory(
       const std::map<std::string, std::vector<DailyLog>>&) -> void override {}
-  auto RunIngest(const std::string&, DateCheckMode, bool, IngestMode)
-      -> void override {}
+  auto RunIngest(const std::string&, DateCheckMode, bool, IngestMode,
+                 std::size_t) -> void override {}
   auto RunIngestSyncStatusQuery(
       const tracer_core::core::dto::IngestSyncStatusRequest&)
       -> tracer_core::core::dto::IngestSyncStatusOutput override {
@@ -55,6 +55,18 @@ class SmokePipelineWorkflow final
       -> void override {}
   auto RunValidateStructure(const std::string&) -> void override {}
   auto RunValidateLogic(const std::string&, DateCheckMode) -> void override {}
+  auto RunValidateStructureFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&)
+      -> void override {}
+  auto RunValidateLogicFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&,
+      DateCheckMode) -> void override {}
+  auto RunIngestReplacingAllFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel>,
+      DateCheckMode) -> void override {}
+  auto RunIngestChangedMonthsFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel>,
+      DateCheckMode) -> void override {}
   auto RunRecordActivityAtomically(
       const tracer_core::core::dto::RecordActivityAtomicallyRequest&)
       -> tracer_core::core::dto::RecordActivityAtomicallyResponse override {
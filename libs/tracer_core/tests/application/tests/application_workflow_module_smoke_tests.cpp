@@ -45,6 +45,11 @@ class SmokeTimeSheetRepository final : public app_ports::ITimeSheetRepository {
   auto ReplaceMonthData(int, int, const std::vector<DayData>&,
                         const std::vector<TimeRecordInternal>&)
       -> void override {}
+  auto ReplaceMonthsData(
+      const std::vector<ReplaceMonthTarget>&, const std::vector<DayData>&,
+      const std::vector<TimeRecordInternal>&,
+      const std::vector<tracer_core::core::dto::IngestSyncStatusEntry>&)
+      -> void override {}
   auto UpsertIngestSyncStatus(
       const tracer_core::core::dto::IngestSyncStatusEntry&) -> void override {}
   auto ReplaceIngestSyncStatuses(
@@ -25,7 +25,8 @@ auto TestConvertResponses(TestState& state) -> void {
                                    .date_check_mode = DateCheckMode::kFull,
                                    .save_processed_output = true,
                                    .validate_logic = false,
-                                   .validate_structure = true};
+                                   .validate_structure = true,
+                                   .max_parallelism = 2};
 
   const auto kSuccess = runtime_api.pipeline().RunConvert(kRequest);
   Expect(state, kSuccess.ok, "RunConvert should return ok on success.");
@@ -51,6 +52,10 @@ auto TestConvertResponses(TestState& state) -> void {
          pipeline_workflow.last_converter_options.validate_structure ==
              kRequest.validate_structure,
          "RunConvert should forward validate_structure.");
+  Expect(state,
+         pipeline_workflow.last_converter_options.max_parallelism ==
+             kRequest.max_parallelism,
+         "RunConvert should forward max_parallelism.");
   Expect(state,
          !pipeline_workflow.last_converter_options
               .run_structure_validation_before_conversion,
@@ -89,7 +94,8 @@ auto TestIngestResponses(TestState& state) -> void {
   const IngestRequest kRequest = {.input_path = "source-folder",
                                   .date_check_mode = DateCheckMode::kContinuity,
                                   .save_processed_output = true,
-                                  .ingest_mode = IngestMode::kStandard};
+                                  .ingest_mode = IngestMode::kStandard,
+                                  .max_parallelism = 3};
 
   const auto kSuccess = runtime_api.pipeline().RunIngest(kRequest);
   Expect(state, kSuccess.ok, "RunIngest should return ok on success.");
@@ -108,6 +114,10 @@ auto TestIngestResponses(TestState& state) -> void {
   Expect(state,
          pipeline_workflow.last_ingest_import_mode == kRequest.ingest_mode,
          "RunIngest should forward ingest_mode.");
+  Expect(state,
+         pipeline_workflow.last_ingest_max_parallelism ==
+             kRequest.max_parallelism,
+         "RunIngest should forward max_parallelism.");
 
   pipeline_workflow.fail_ingest = true;
   const auto kFailure = runtime_api.pipeline().RunIngest(kRequest);
@@ -21,6 +21,7 @@ using tracer::core::application::modimporter::ImportService;
 using tracer::core::application::modimporter::ImportStats;
 using tracer::core::application::modimporter::ReplaceAllTarget;
 using tracer::core::application::modimporter::ReplaceMonthTarget;
+using tracer::core::application::modimporter::ReplaceMonthsTarget;
 using tracer::core::application::modimporter::TimeRecordInternal;
 using tracer::core::domain::modmodel::BaseActivityRecord;
 using tracer::core::domain::modmodel::DailyLog;
@@ -42,6 +43,7 @@ class FakeTimeSheetRepository final
   int import_call_count = 0;
   int replace_all_call_count = 0;
   int replace_call_count = 0;
+  int replace_months_call_count = 0;
   int replace_year = 0;
   int replace_month = 0;
   size_t import_days = 0;
@@ -50,6 +52,9 @@ class FakeTimeSheetRepository final
   size_t replace_all_records = 0;
   size_t replace_days = 0;
   size_t replace_records = 0;
+  size_t replace_months_targets = 0;
+  size_t replace_months_days = 0;
+  size_t replace_months_sync_entries = 0;
 
   [[nodiscard]] auto IsDbOpen() const -> bool override { return db_open; }
 
@@ -90,6 +95,18 @@ class FakeTimeSheetRepository final
     }
   }
 
+  auto ReplaceMonthsData(
+      const std::vector<ReplaceMonthTarget>& months,
+      const std::vector<DayData>& days,
+      const std::vector<TimeRecordInternal>& /*records*/,
+      const std::vector<tracer_core::core::dto::IngestSyncStatusEntry>&
+          sync_entries) -> void override {
+    ++replace_months_call_count;
+    replace_months_targets = months.size();
+    replace_months_days = days.size();
+    replace_months_sync_entries = sync_entries.size();
+  }
+
   auto UpsertIngestSyncStatus(
       const tracer_core::core::dto::IngestSyncStatusEntry&) -> void override {}
 
@@ -202,12 +219,46 @@ auto TestReplaceAllUsesReplaceAllPath(TestState& state) -> void {
          "Replace-all import should report ALL replace scope.");
 }
 
+auto TestReplaceMonthsUsesSingleTransactionPath(TestState& state) -> void {
+  FakeTimeSheetRepository repository;
+  ImportService service(repository);
+
+  ReplaceMonthsTarget target{
+      .months = {ReplaceMonthTarget{.kYear = kReplaceYear, .kMonth = 1},
+                 ReplaceMonthTarget{.kYear = kReplaceYear,
+                                    .kMonth = kReplaceMonth}},
+      .sync_entries = {tracer_core::core::dto::IngestSyncStatusEntry{
+                           .month_key = "2026-01"},
+                       tracer_core::core::dto::IngestSyncStatusEntry{
+                           .month_key = "2026-02"}},
+  };
+  const ImportStats kStats = service.ImportFromMemory(
+      BuildSingleDayMap(), std::nullopt, std::nullopt, target);
+
+  Expect(state, repository.replace_months_call_count == 1,
+         "Replace-months import should call ReplaceMonthsData once.");
+  Expect(state,
+         repository.replace_call_count == 0 &&
+             repository.import_call_count == 0,
+         "Replace-months import should not use per-month or append paths.");
+  Expect(state,
+         repository.replace_months_targets == 2U &&
+             repository.replace_months_sync_entries == 2U &&
+             repository.replace_months_days == 1U,
+         "Replace-months import should forward targets, sync rows and days.");
+  Expect(state,
+         kStats.replaced_month.has_value() &&
+             *kStats.replaced_month == "2026-01,2026-02",
+         "Replace-months import should report every replaced month.");
+}
+
 }  // namespace
 
 auto RunImportServiceTests(TestState& state) -> void {
   TestReplaceMonthUsesReplacePath(state);
   TestReplaceMonthStillRunsForEmptyData(state);
   TestReplaceAllUsesReplaceAllPath(state);
+  TestReplaceMonthsUsesSingleTransactionPath(state);
 }
 
 }  // namespace tracer_core::application::tests
@@ -1,5 +1,11 @@
 // application/tests/modules/report_tests.cpp
 #include "application/tests/modules/reporting_tests.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
 #include "application/tests/support/fakes.hpp"
 #include "application/tests/support/test_support.hpp"
 
@@ -7,6 +13,8 @@ namespace tracer_core::application::tests {
 
 using tracer_core::core::dto::PeriodBatchQueryRequest;
 using tracer_core::core::dto::ReportDisplayMode;
+using tracer_core::core::dto::ReportExportScope;
+using tracer_core::core::dto::TemporalReportExportProgress;
 using tracer_core::core::dto::TemporalReportQueryRequest;
 using tracer_core::core::dto::TemporalReportTargetsRequest;
 using tracer_core::core::dto::TemporalSelectionKind;
@@ -129,6 +137,66 @@ auto TestTemporalReportTargetsResponses(TestState& state) -> void {
          "RunTemporalReportTargetsQuery missing-service failure should include operation name.");
 }
 
+auto TestTemporalReportAllMatchingExport(TestState& state) -> void {
+  namespace fs = std::filesystem;
+  FakePipelineWorkflow pipeline_workflow;
+  FakeReportHandler report_handler;
+  auto report_data_query = std::make_shared<FakeReportDataQueryService>();
+  auto runtime_api =
+      BuildRuntimeApiForTest(pipeline_workflow, report_handler, report_data_query);
+
+  const fs::path kExportRoot =
+      fs::temp_directory_path() / "tracer_core_report_all_matching_export";
+  std::error_code cleanup_error;
+  fs::remove_all(kExportRoot, cleanup_error);
+
+  std::vector<TemporalReportExportProgress> progress;
+  const auto kExport = runtime_api.report().RunTemporalReportExport(
+      {.display_mode = ReportDisplayMode::kDay,
+       .export_scope = ReportExportScope::kAllMatching,
+       .output_root_path = kExportRoot.string(),
+       .max_render_workers = 2,
+       .progress_observer =
+           [&progress](const TemporalReportExportProgress& snapshot) -> void {
+         progress.push_back(snapshot);
+       }});
+  Expect(state, kExport.ok,
+         "RunTemporalReportExport all_matching should succeed.");
+
+  const auto kReadDayExport = [&kExportRoot](const std::string& date)
+      -> std::string {
+    std::ifstream file(kExportRoot / "markdown" / "day" / date.substr(0, 4) /
+                           date.substr(5, 2) / (date + ".md"),
+                       std::ios::binary);
+    return {std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()};
+  };
+  Expect(state, kReadDayExport("2026-01-03") == "daily:2026-01-03",
+         "all_matching export should write targets from the batch fetch.");
+  Expect(state, kReadDayExport("2026-01-04") == "daily:2026-01-04",
+         "all_matching export should fall back to per-target queries.");
+  Expect(state,
+         !progress.empty() && progress.front().phase == "fetch" &&
+             progress.back().phase == "done" &&
+             progress.back().total_count == 2U &&
+             progress.back().rendered_count == 2U &&
+             progress.back().written_count == 2U,
+         "all_matching export should report fetch/render/done progress.");
+
+  report_data_query->fail_target_not_found = true;
+  const auto kMissing = runtime_api.report().RunTemporalReportExport(
+      {.display_mode = ReportDisplayMode::kDay,
+       .export_scope = ReportExportScope::kAllMatching,
+       .output_root_path = kExportRoot.string()});
+  Expect(state, !kMissing.ok,
+         "all_matching export should fail when a fallback target is missing.");
+  Expect(state,
+         kMissing.error_contract.error_code == "reporting.target.not_found",
+         "all_matching export failure should keep the missing-target code.");
+
+  fs::remove_all(kExportRoot, cleanup_error);
+}
+
 auto TestStructuredWindowReportSemantics(TestState& state) -> void {
   FakePipelineWorkflow pipeline_workflow;
   FakeReportHandler report_handler;
@@ -223,6 +291,7 @@ auto TestStructuredWindowReportSemantics(TestState& state) -> void {
 auto RunReportTests(TestState& state) -> void {
   TestTemporalReportQueryResponses(state);
   TestTemporalReportTargetsResponses(state);
+  TestTemporalReportAllMatchingExport(state);
   TestStructuredWindowReportSemantics(state);
 }
 
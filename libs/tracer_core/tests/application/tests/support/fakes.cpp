@@ -36,12 +36,14 @@ auto FakePipelineWorkflow::RunDatabaseImportFromMemory(
 auto FakePipelineWorkflow::RunIngest(const std::string& source_path,
                                      DateCheckMode date_check_mode,
                                      bool save_processed,
-                                     IngestMode ingest_mode) -> void {
+                                     IngestMode ingest_mode,
+                                     std::size_t max_parallelism) -> void {
   ++ingest_call_count;
   last_ingest_input = source_path;
   last_ingest_mode = date_check_mode;
   last_ingest_save_processed = save_processed;
   last_ingest_import_mode = ingest_mode;
+  last_ingest_max_parallelism = max_parallelism;
   if (fail_ingest) {
     throw std::runtime_error("ingest failed");
   }
@@ -97,6 +99,23 @@ auto FakePipelineWorkflow::RunValidateLogic(const std::string& source_path,
   }
 }
 
+auto FakePipelineWorkflow::RunValidateStructureFromInputs(
+    const std::vector<tracer_core::application::dto::IngestInputModel>&
+    /*inputs*/) -> void {}
+
+auto FakePipelineWorkflow::RunValidateLogicFromInputs(
+    const std::vector<tracer_core::application::dto::IngestInputModel>&
+    /*inputs*/,
+    DateCheckMode /*date_check_mode*/) -> void {}
+
+auto FakePipelineWorkflow::RunIngestReplacingAllFromInputs(
+    std::vector<tracer_core::application::dto::IngestInputModel> /*inputs*/,
+    DateCheckMode /*date_check_mode*/) -> void {}
+
+auto FakePipelineWorkflow::RunIngestChangedMonthsFromInputs(
+    std::vector<tracer_core::application::dto::IngestInputModel> /*inputs*/,
+    DateCheckMode /*date_check_mode*/) -> void {}
+
 auto FakePipelineWorkflow::RunRecordActivityAtomically(
     const tracer_core::core::dto::RecordActivityAtomicallyRequest& request)
     -> tracer_core::core::dto::RecordActivityAtomicallyResponse {
@@ -301,7 +320,12 @@ auto FakeReportDataQueryService::QueryPeriodBatch(
 
 auto FakeReportDataQueryService::QueryAllDaily()
     -> std::map<std::string, DailyReportData> {
-  return {};
+  // 只覆盖第一个目标，all_matching 导出的批量与逐个回退两条路径都会被走到。
+  std::map<std::string, DailyReportData> reports;
+  if (!daily_targets.empty()) {
+    reports[daily_targets.front()].date = daily_targets.front();
+  }
+  return reports;
 }
 
 auto FakeReportDataQueryService::QueryAllMonthly()
@@ -2,6 +2,7 @@
 #ifndef APPLICATION_TESTS_SUPPORT_FAKES_H_
 #define APPLICATION_TESTS_SUPPORT_FAKES_H_
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -48,6 +49,7 @@ class FakePipelineWorkflow final
   bool last_ingest_save_processed = false;
   bool last_ingest_replace_all_save_processed = false;
   IngestMode last_ingest_import_mode = IngestMode::kStandard;
+  std::size_t last_ingest_max_parallelism = 0;
   std::string last_import_path;
   std::string last_validate_structure_input;
   std::string last_validate_logic_input;
@@ -123,7 +125,8 @@ class FakePipelineWorkflow final
       const std::map<std::string, std::vector<DailyLog>>& data_map)
       -> void override;
   auto RunIngest(const std::string& source_path, DateCheckMode date_check_mode,
-                 bool save_processed, IngestMode ingest_mode) -> void override;
+                 bool save_processed, IngestMode ingest_mode,
+                 std::size_t max_parallelism) -> void override;
   auto RunIngestSyncStatusQuery(
       const tracer_core::core::dto::IngestSyncStatusRequest& request)
       -> tracer_core::core::dto::IngestSyncStatusOutput override;
@@ -134,6 +137,19 @@ class FakePipelineWorkflow final
   auto RunValidateStructure(const std::string& source_path) -> void override;
   auto RunValidateLogic(const std::string& source_path,
                         DateCheckMode date_check_mode) -> void override;
+  auto RunValidateStructureFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&
+          inputs) -> void override;
+  auto RunValidateLogicFromInputs(
+      const std::vector<tracer_core::application::dto::IngestInputModel>&
+          inputs,
+      DateCheckMode date_check_mode) -> void override;
+  auto RunIngestReplacingAllFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+      DateCheckMode date_check_mode) -> void override;
+  auto RunIngestChangedMonthsFromInputs(
+      std::vector<tracer_core::application::dto::IngestInputModel> inputs,
+      DateCheckMode date_check_mode) -> void override;
   auto RunRecordActivityAtomically(
       const tracer_core::core::dto::RecordActivityAtomicallyRequest& request)
       -> tracer_core::core::dto::RecordActivityAtomicallyResponse override;
@@ -1,8 +1,14 @@
 import tracer.core.domain;
 
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
 #include <iostream>
 #include <map>
+#include <optional>
 #include <set>
+#include <sstream>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -14,10 +20,15 @@ using tracer::core::domain::model::BaseActivityRecord;
 using tracer::core::domain::model::DailyLog;
 using tracer::core::domain::model::RawEvent;
 using tracer::core::domain::model::SourceSpan;
+using tracer::core::domain::modlogic::converter::ActivityResolution;
+using tracer::core::domain::modlogic::converter::ActivityResolutionTable;
 using tracer::core::domain::modlogic::converter::DayProcessor;
 using tracer::core::domain::modlogic::converter::LogLinker;
 using tracer::core::domain::modlogic::converter::LogProcessingResult;
 using tracer::core::domain::modlogic::converter::LogProcessor;
+using tracer::core::domain::modlogic::lexer::TxtLineKind;
+using tracer::core::domain::modlogic::lexer::TxtLineLexer;
+using tracer::core::domain::modlogic::lexer::TxtLineToken;
 using tracer::core::domain::modlogic::validator_common::Diagnostic;
 using tracer::core::domain::modlogic::validator_common::DiagnosticSeverity;
 using tracer::core::domain::modlogic::validator_common::Error;
@@ -88,6 +99,120 @@ void TestConverterBridge(int& failures) {
          failures);
 }
 
+auto SetTimeZone(const char* value) -> void {
+#if defined(_WIN32)
+  _putenv_s("TZ", value == nullptr ? "" : value);
+  _tzset();
+#else
+  if (value == nullptr) {
+    unsetenv("TZ");
+  } else {
+    setenv("TZ", value, 1);
+  }
+  tzset();
+#endif
+}
+
+// Reference: the converter's historical per-activity path (get_time leaves
+// tm_isdst at 0, then mktime).
+auto LegacyMktimeTimestamp(const std::string& date, const std::string& time)
+    -> std::int64_t {
+  std::tm time_info = {};
+  std::stringstream time_stream(date + " " + time);
+  time_stream >> std::get_time(&time_info, "%Y-%m-%d %H:%M");
+  if (time_stream.fail()) {
+    return 0;
+  }
+  return static_cast<std::int64_t>(std::mktime(&time_info));
+}
+
+void TestConverterTimestampsMatchLegacyMktime(int& failures) {
+  const char* kPreviousTz = std::getenv("TZ");
+  const std::optional<std::string> kSavedTz =
+      kPreviousTz == nullptr ? std::nullopt
+                             : std::optional<std::string>(kPreviousTz);
+#if defined(_WIN32)
+  SetTimeZone("EST5EDT");
+#else
+  SetTimeZone("EST5EDT,M3.2.0,M11.1.0");
+#endif
+
+  ConverterConfig config = BuildTestConfig();
+  DayProcessor processor(config);
+  // Summer day plus both 2025 US transition days; the events straddle the
+  // 02:00 switch and the last one wraps past midnight.
+  for (const std::string kDate : {"2025-07-15", "2025-03-09", "2025-11-02"}) {
+    DailyLog previous_day;
+    DailyLog day;
+    day.date = kDate;
+    day.getupTime = "00:30";
+    for (const char* end_time :
+         {"01:30", "02:30", "03:30", "12:00", "23:30", "00:15"}) {
+      RawEvent event;
+      event.endTimeStr = end_time;
+      event.description = "study";
+      day.rawEvents.push_back(event);
+    }
+    processor.Process(previous_day, day);
+
+    Expect(day.processedActivities.size() == day.rawEvents.size(),
+           "Converter should map every timestamp fixture event.", failures);
+    for (const auto& activity : day.processedActivities) {
+      const std::int64_t kStart =
+          LegacyMktimeTimestamp(kDate, activity.start_time_str);
+      std::int64_t end = LegacyMktimeTimestamp(kDate, activity.end_time_str);
+      if (end < kStart) {
+        end += 24 * 60 * 60;
+      }
+      Expect(activity.start_timestamp == kStart,
+             "start_timestamp should match legacy mktime on " + kDate + " " +
+                 activity.start_time_str,
+             failures);
+      Expect(activity.end_timestamp == end,
+             "end_timestamp should match legacy mktime on " + kDate + " " +
+                 activity.end_time_str,
+             failures);
+    }
+  }
+
+  SetTimeZone(kSavedTz.has_value() ? kSavedTz->c_str() : nullptr);
+}
+
+void TestActivityResolutionTable(int& failures) {
+  ConverterConfig config = BuildTestConfig();
+  config.wake_keywords = {"wake"};
+  config.text_mapping["m"] = "meal";
+  config.text_mapping["s"] = "study_math";
+  config.duration_mappings["meal"] = {{.less_than_minutes = 30,
+                                       .value = "meal_snack"}};
+  config.top_parent_mapping["study"] = "learning";
+  config.activity_resolution = ActivityResolutionTable::Compile(config);
+
+  const auto kTable = ActivityResolutionTable::ForConfig(config);
+  Expect(kTable == config.activity_resolution,
+         "ForConfig should reuse the installed resolution table.", failures);
+
+  const ActivityResolution kStudy = kTable->Resolve("s", 60);
+  Expect(kStudy.has_activity && kStudy.project_path == "learning_math",
+         "Alias should resolve to a pre-joined canonical project path.",
+         failures);
+  Expect(kTable->Resolve("m", 10).project_path == "meal_snack" &&
+             kTable->Resolve("m", 45).project_path == "meal",
+         "Duration rules should be compiled per alias.", failures);
+  Expect(kTable->Resolve("s", 5).project_id == kStudy.project_id,
+         "Project ids should be interned per canonical path.", failures);
+
+  const ActivityResolution kUnknown = kTable->Resolve("study_misc", 5);
+  Expect(kUnknown.has_activity &&
+             kUnknown.project_id == ActivityResolution::kUncompiledProjectId &&
+             kTable->BuildProjectPath("study_misc") == "learning_misc",
+         "Unmapped descriptions should fall back to top-parent rewriting.",
+         failures);
+  Expect(kTable->IsWakeKeyword("wake") && kTable->IsKnownKeyword("s") &&
+             !kTable->IsKnownKeyword("study_misc"),
+         "Resolution table keyword sets mismatch.", failures);
+}
+
 void TestValidatorBridge(int& failures) {
   ConverterConfig config = BuildTestConfig();
   LineRules line_rules(config);
@@ -151,6 +276,51 @@ void TestValidatorBridge(int& failures) {
          "Diagnostic default severity mismatch.", failures);
 }
 
+void TestTxtLineLexerBridge(int& failures) {
+  const std::string kContent =
+      "y2026\n m03 \n\n0301\n# note\n0730study // a # b\n2460study\nxx\n";
+  const TxtLineLexer kLexer("#");
+  const std::vector<TxtLineToken> kTokens = kLexer.Tokenize(kContent);
+
+  Expect(kTokens.size() == 7U, "Lexer should skip blank lines only.",
+         failures);
+  if (kTokens.size() != 7U) {
+    return;
+  }
+  Expect(kTokens[0].kind == TxtLineKind::kYear &&
+             kTokens[1].kind == TxtLineKind::kMonth &&
+             kTokens[2].kind == TxtLineKind::kDate &&
+             kTokens[3].kind == TxtLineKind::kRemark &&
+             kTokens[6].kind == TxtLineKind::kUnrecognized,
+         "Lexer line classification mismatch.", failures);
+  Expect(kTokens[1].text == "m03" && kTokens[1].raw == " m03 " &&
+             kTokens[2].line_number == 4,
+         "Lexer should keep raw/trimmed views and 1-based line numbers.",
+         failures);
+  Expect(kTokens[3].remark_body == " note",
+         "Lexer remark body should follow the configured prefix.", failures);
+  Expect(kTokens[4].kind == TxtLineKind::kEvent &&
+             kTokens[4].time_hhmm == "0730" && kTokens[4].hour == 7 &&
+             kTokens[4].minute == 30 && kTokens[4].description == "study" &&
+             kTokens[4].inline_remark == "a # b",
+         "Lexer event split should use the earliest inline delimiter.",
+         failures);
+  Expect(kTokens[5].kind == TxtLineKind::kEvent &&
+             !kTokens[5].IsTimeInRange(),
+         "Lexer should defer time range checks to consumers.", failures);
+
+  ConverterConfig config = BuildTestConfig();
+  TextValidator text_validator(config);
+  std::set<Error> token_errors;
+  const std::vector<TxtLineToken> kValidTokens =
+      TxtLineLexer(config.remark_prefix)
+          .Tokenize("y2026\nm03\n0301\n0730study\n");
+  Expect(text_validator.Validate("module-smoke.txt", kValidTokens,
+                                 token_errors) &&
+             token_errors.empty(),
+         "TextValidator should accept pre-lexed tokens.", failures);
+}
+
 void TestStructureValidatorBridge(int& failures) {
   StructValidator struct_validator(DateCheckMode::kNone, {"wake"});
 
@@ -214,7 +384,10 @@ void TestStructureValidatorBridge(int& failures) {
 auto main() -> int {
   int failures = 0;
   TestConverterBridge(failures);
+  TestConverterTimestampsMatchLegacyMktime(failures);
+  TestActivityResolutionTable(failures);
   TestValidatorBridge(failures);
+  TestTxtLineLexerBridge(failures);
   TestStructureValidatorBridge(failures);
 
   if (failures == 0) {
@@ -12,6 +12,7 @@ namespace {
 using tracer::core::domain::model::BaseActivityRecord;
 using tracer::core::domain::model::DailyLog;
 using tracer::core::domain::model::ProcessingResult;
+using tracer::core::domain::model::SourceLine;
 using tracer::core::domain::model::SourceSpan;
 using tracer::core::domain::moderrors::ErrorRecord;
 using tracer::core::domain::moderrors::ErrorSeverity;
@@ -128,6 +129,16 @@ void TestDomainModelsAndTypes(int& failures) {
   span.line_start = 10;
   span.raw_text = "line";
   Expect(span.HasLine(), "SourceSpan HasLine should be true.", failures);
+  Expect(span.raw_text.view() == "line", "SourceSpan raw_text mismatch.",
+         failures);
+
+  const auto kShared =
+      std::make_shared<const std::string>("0730study\n0800wake");
+  const SourceLine kSecondLine(kShared, 10, 8);
+  Expect(kSecondLine.view() == "0800wake",
+         "SourceLine should view its offset range.", failures);
+  Expect(kSecondLine.view().data() == kShared->data() + 10,
+         "SourceLine should not copy the shared buffer.", failures);
 
   BaseActivityRecord record;
   record.project_path = "study_cpp";
@@ -1,5 +1,13 @@
 #include "infra/tests/modules_smoke/reporting.hpp"
 
 auto main() -> int {
-  return RunInfrastructureModuleReportsSmoke();
+  const int reports_status = RunInfrastructureModuleReportsSmoke();
+  if (reports_status != 0) {
+    return reports_status;
+  }
+  const int window_status = RunTrailingWindowAggregatorSmoke();
+  if (window_status != 0) {
+    return window_status;
+  }
+  return RunRenderedReportCacheSmoke();
 }
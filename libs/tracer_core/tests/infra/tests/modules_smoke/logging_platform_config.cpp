@@ -7,6 +7,7 @@ import tracer.core.infrastructure.config;
 #include "application/runtime_bridge/logger.hpp"
 #include "domain/types/converter_config.hpp"
 #include "infra/config/models/app_config.hpp"
+#include "infra/persistence/sqlite/project_dictionary.hpp"
 #include "infra/tests/modules_smoke/config.hpp"
 #include "infra/tests/modules_smoke/support.hpp"
 
@@ -132,6 +133,22 @@ auto RunInfrastructureModuleLoggingPlatformConfigSmoke() -> int {
     return 402;
   }
 
+  // 随附配置列出的分类规则应与内置表完全一致。
+  namespace persistence = tracer::core::infrastructure::persistence;
+  if (kLoadedFileConfig.project_class_rules.size() !=
+      persistence::DefaultProjectClassRules().size()) {
+    return 405;
+  }
+  persistence::InstallProjectClassRules(kLoadedFileConfig.project_class_rules);
+  const bool kMatchesDefaults =
+      persistence::ProjectClassRulesFingerprint() ==
+      persistence::ProjectClassRulesFingerprint(
+          persistence::DefaultProjectClassRules());
+  persistence::InstallProjectClassRules({});
+  if (!kMatchesDefaults) {
+    return 406;
+  }
+
   tracer::core::infrastructure::config::ConfigLoader config_loader(
       kFakeExePath.string());
   const AppConfig kLoadedAppConfig = config_loader.LoadConfiguration();
@@ -3,7 +3,11 @@ import tracer.core.infrastructure.persistence.write;
 
 #include "infra/tests/modules_smoke/persistence_runtime.hpp"
 
+#include <sqlite3.h>
+
 #include <filesystem>
+#include <format>
+#include <string>
 
 namespace {
 
@@ -51,6 +55,170 @@ auto RunPersistenceRuntimeSmokeImpl() -> int {
     if (projects.size() != 1U || projects.front().name != "Root") {
       return 29;
     }
+
+    tracer::core::infrastructure::persistence::SqliteReadConnectionPool
+        read_pool(kRuntimeDbPath);
+    sqlite3* pooled_db = nullptr;
+    {
+      const auto kLease = read_pool.TryAcquire();
+      if (!kLease.has_value() || kLease->Connection() == nullptr) {
+        return 31;
+      }
+      pooled_db = kLease->Connection();
+      // query_only 连接必须拒绝写入。
+      if (sqlite3_exec(pooled_db, "DELETE FROM projects;", nullptr, nullptr,
+                       nullptr) == SQLITE_OK) {
+        return 32;
+      }
+    }
+    {
+      const auto kLease = read_pool.TryAcquire();
+      if (!kLease.has_value() || kLease->Connection() != pooled_db) {
+        return 33;
+      }
+    }
+    read_pool.Invalidate();
+    if (!read_pool.TryAcquire().has_value()) {
+      return 34;
+    }
+
+    tracer::core::infrastructure::persistence::SqliteReadConnectionPool
+        missing_pool(kPersistenceRuntimeSmokeDir / "missing.sqlite");
+    if (missing_pool.TryAcquire().has_value()) {
+      return 35;
+    }
+
+    namespace persistence = tracer::core::infrastructure::persistence;
+    const auto kDictionary =
+        persistence::AcquireProjectDictionary(runtime_connection.GetDb());
+    const auto* root_entry = kDictionary->Find(1);
+    if (!kDictionary->Loaded() || root_entry == nullptr ||
+        root_entry->full_path != "Root" || kDictionary->Find(2) != nullptr) {
+      return 36;
+    }
+    if (persistence::AcquireProjectDictionary(runtime_connection.GetDb()) !=
+        kDictionary) {
+      return 37;
+    }
+    persistence::BumpProjectDictionaryGeneration();
+    if (persistence::AcquireProjectDictionary(runtime_connection.GetDb()) ==
+        kDictionary) {
+      return 38;
+    }
+
+    if (!tracer::core::infrastructure::persistence::importer::sqlite::
+            ExecuteSql(runtime_connection.GetDb(),
+                       "INSERT INTO projects "
+                       "(id, name, parent_id, full_path, depth) "
+                       "VALUES (2, 'study', NULL, 'study', 0);"
+                       "INSERT INTO days (date, year, month) "
+                       "VALUES ('2025-01-02', 2025, 1);"
+                       "INSERT INTO time_records VALUES "
+                       "(1, 0, 3600, '2025-01-02', '08:00', '09:00', 2, "
+                       "3600, 'study', NULL), "
+                       "(2, 3600, 5400, '2025-01-02', '09:00', '09:30', 1, "
+                       "1800, 'Root', NULL);",
+                       "seed persistence runtime smoke records")) {
+      return 39;
+    }
+    const auto kSnapshot =
+        persistence::AcquireRecordColumnSnapshot(runtime_connection.GetDb());
+    if (kSnapshot == nullptr || kSnapshot->Size() != 2U) {
+      return 40;
+    }
+    const auto kRows = kSnapshot->RowsInDays(kSnapshot->Days().front(),
+                                             kSnapshot->Days().back());
+    if (kSnapshot->SumDurations(kRows) != 5400 ||
+        kSnapshot->CountDays(kRows) != 1 ||
+        kSnapshot->CountDays(
+            kRows, persistence::RecordColumnSnapshot::kStudyFlag) != 1 ||
+        kSnapshot->CountDays(
+            kRows, persistence::RecordColumnSnapshot::kExerciseFlag) != 0) {
+      return 41;
+    }
+    if (persistence::AcquireRecordColumnSnapshot(runtime_connection.GetDb()) !=
+        kSnapshot) {
+      return 42;
+    }
+
+    // 其他连接的提交不经过导入代次，快照必须靠变更计数或 data_version
+    // 发现：回滚日志模式推进文件头计数，WAL 模式只推进 data_version。
+    sqlite3* external_db = nullptr;
+    if (sqlite3_open(kRuntimeDbPath.string().c_str(), &external_db) !=
+        SQLITE_OK) {
+      sqlite3_close(external_db);
+      return 45;
+    }
+    const auto kExternalInsert = [&](int record_id) -> bool {
+      const std::string kSql = std::format(
+          "INSERT INTO time_records VALUES "
+          "({}, 7200, 9000, '2025-01-02', '10:00', '10:30', 2, 1800, "
+          "'study', NULL);",
+          record_id);
+      return sqlite3_exec(external_db, kSql.c_str(), nullptr, nullptr,
+                          nullptr) == SQLITE_OK;
+    };
+    const bool kRollbackRefreshed = [&]() -> bool {
+      if (!kExternalInsert(3)) {
+        return false;
+      }
+      const auto kRefreshed =
+          persistence::AcquireRecordColumnSnapshot(runtime_connection.GetDb());
+      return kRefreshed != nullptr && kRefreshed != kSnapshot &&
+             kRefreshed->Size() == 3U;
+    }();
+    const bool kWalRefreshed = [&]() -> bool {
+      if (sqlite3_exec(external_db, "PRAGMA journal_mode = WAL;", nullptr,
+                       nullptr, nullptr) != SQLITE_OK) {
+        return false;
+      }
+      const auto kBefore =
+          persistence::AcquireRecordColumnSnapshot(runtime_connection.GetDb());
+      if (kBefore == nullptr ||
+          persistence::AcquireRecordColumnSnapshot(
+              runtime_connection.GetDb()) != kBefore ||
+          !kExternalInsert(4)) {
+        return false;
+      }
+      const auto kAfter =
+          persistence::AcquireRecordColumnSnapshot(runtime_connection.GetDb());
+      return kAfter != nullptr && kAfter != kBefore && kAfter->Size() == 4U;
+    }();
+    const bool kJournalRestored =
+        sqlite3_exec(external_db, "PRAGMA journal_mode = DELETE;", nullptr,
+                     nullptr, nullptr) == SQLITE_OK;
+    sqlite3_close(external_db);
+    if (!kRollbackRefreshed) {
+      return 46;
+    }
+    if (!kWalRefreshed || !kJournalRestored) {
+      return 47;
+    }
+
+    persistence::BumpProjectDictionaryGeneration();
+    const auto kClassified =
+        persistence::AcquireProjectDictionary(runtime_connection.GetDb());
+    const auto* study_entry = kClassified->Find(2);
+    if (study_entry == nullptr || study_entry->class_mask == 0U ||
+        study_entry->class_mask != persistence::ClassifyProjectPath("study") ||
+        kClassified->Find(1)->class_mask != 0U) {
+      return 43;
+    }
+
+    namespace importer_sqlite =
+        tracer::core::infrastructure::persistence::importer::sqlite;
+    if (!importer_sqlite::BumpReportGenerations(
+            runtime_connection.GetDb(),
+            importer_sqlite::RollupDateRange{.first_date = "2024-12-30",
+                                             .last_date = "2025-01-02"}) ||
+        !importer_sqlite::ExecuteSql(
+            runtime_connection.GetDb(),
+            "DELETE FROM report_generations WHERE scope = '*' OR "
+            "(scope IN ('2024-12', '2025-01') AND generation = 1);",
+            "check report generations") ||
+        sqlite3_changes(runtime_connection.GetDb()) != 3) {
+      return 44;
+    }
   } catch (...) {
     return 30;
   }
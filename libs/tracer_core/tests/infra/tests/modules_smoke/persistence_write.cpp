@@ -2,10 +2,277 @@ import tracer.core.infrastructure.persistence.write;
 
 #include "infra/tests/modules_smoke/persistence_write.hpp"
 
+#include <sqlite3.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "application/pipeline/importer/model/import_models.hpp"
+#include "infra/persistence/sqlite/project_dictionary.hpp"
 
 namespace {
 
+// 生成跨越多个批次（含不足一批的尾部）的连续日期数据。
+auto BuildBulkLoadFixture(std::size_t day_count)
+    -> std::pair<std::vector<DayData>, std::vector<TimeRecordInternal>> {
+  std::vector<DayData> days;
+  std::vector<TimeRecordInternal> records;
+  for (std::size_t index = 0; index < day_count; ++index) {
+    const int kMonth = static_cast<int>(index / 28) + 1;
+    const int kDay = static_cast<int>(index % 28) + 1;
+    const std::string kDate = std::format("2025-{:02d}-{:02d}", kMonth, kDay);
+    days.push_back(DayData{.date = kDate,
+                           .remark = "",
+                           .getup_time = "07:00",
+                           .year = 2025,
+                           .month = kMonth,
+                           .wake_anchor = 1});
+    records.push_back(TimeRecordInternal{
+        .logical_id = static_cast<long long>(index) + 1,
+        .start_timestamp = static_cast<long long>(index) * 100,
+        .end_timestamp = static_cast<long long>(index) * 100 + 60,
+        .start_time_str = "07:00",
+        .end_time_str = "08:00",
+        .project_path = index % 2 == 0 ? "study_math" : "routine_grooming",
+        .duration_seconds = 3600,
+        .remark = std::nullopt,
+        .date = kDate});
+  }
+  return {std::move(days), std::move(records)};
+}
+
+auto QueryInt64(sqlite3* sqlite_db, const char* sql) -> std::int64_t {
+  sqlite3_stmt* stmt = nullptr;
+  std::int64_t value = -1;
+  if (sqlite3_prepare_v2(sqlite_db, sql, -1, &stmt, nullptr) == SQLITE_OK &&
+      sqlite3_step(stmt) == SQLITE_ROW) {
+    value = sqlite3_column_int64(stmt, 0);
+  }
+  sqlite3_finalize(stmt);
+  return value;
+}
+
+// 汇总表应与 time_records 明细逐项一致。
+auto RollupsMatchRecords(sqlite3* sqlite_db) -> bool {
+  const std::int64_t kRecordTotal = QueryInt64(
+      sqlite_db, "SELECT COALESCE(SUM(duration), 0) FROM time_records;");
+  const std::int64_t kRecordCount =
+      QueryInt64(sqlite_db, "SELECT COUNT(*) FROM time_records;");
+  const std::int64_t kRecordDays =
+      QueryInt64(sqlite_db, "SELECT COUNT(DISTINCT date) FROM time_records;");
+  return QueryInt64(sqlite_db,
+                    "SELECT COALESCE(SUM(duration), 0) "
+                    "FROM project_daily_rollup;") == kRecordTotal &&
+         QueryInt64(sqlite_db,
+                    "SELECT COALESCE(SUM(duration), 0) "
+                    "FROM project_monthly_rollup;") == kRecordTotal &&
+         QueryInt64(sqlite_db,
+                    "SELECT COALESCE(SUM(record_count), 0) "
+                    "FROM project_monthly_rollup;") == kRecordCount &&
+         QueryInt64(sqlite_db, "SELECT COUNT(*) FROM day_flag_rollup;") ==
+             kRecordDays;
+}
+
+// 按日标记汇总应与报表回退路径（按路径快照现场判定）逐列一致。
+auto DayFlagsMatchSnapshotPredicate(sqlite3* sqlite_db) -> bool {
+  namespace persistence = tracer::core::infrastructure::persistence;
+  constexpr std::array<std::string_view, 4> kColumns = {
+      "study", "exercise", "cardio", "anaerobic"};
+  for (std::size_t index = 0; index < kColumns.size(); ++index) {
+    const std::string kRollupSql = std::format(
+        "SELECT COALESCE(SUM({}), 0) FROM day_flag_rollup;", kColumns[index]);
+    const std::string kRecordSql = std::format(
+        "SELECT COUNT(DISTINCT CASE WHEN {} THEN date END) "
+        "FROM time_records;",
+        persistence::ProjectClassPathSql(persistence::kDayFlagClasses[index],
+                                         "project_path_snapshot"));
+    if (QueryInt64(sqlite_db, kRollupSql.c_str()) !=
+        QueryInt64(sqlite_db, kRecordSql.c_str())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// 规则表化之前 DerivedTimeStatsAggregator 中逐条硬编码的判定，原样保留
+// 作为对照。
+auto LegacyPathHasRoot(std::string_view path, std::string_view root) -> bool {
+  return path == root || (path.size() > root.size() &&
+                          path.starts_with(root) && path[root.size()] == '_');
+}
+
+auto LegacyPathHasSegment(std::string_view path, std::string_view segment)
+    -> bool {
+  std::size_t start = 0;
+  while (start <= path.size()) {
+    const std::size_t kSeparator = path.find('_', start);
+    if (path.substr(start, kSeparator == std::string_view::npos
+                               ? std::string_view::npos
+                               : kSeparator - start) == segment) {
+      return true;
+    }
+    if (kSeparator == std::string_view::npos) {
+      return false;
+    }
+    start = kSeparator + 1;
+  }
+  return false;
+}
+
+auto LegacyClassMask(std::string_view path) -> std::uint32_t {
+  namespace persistence = tracer::core::infrastructure::persistence;
+  std::uint32_t mask = 0;
+  if (path.empty()) {
+    return mask;
+  }
+  if (path == "sleep_night") {
+    mask |= persistence::kProjectClassSleepNight;
+  }
+  if (path == "sleep_day") {
+    mask |= persistence::kProjectClassSleepDay;
+  }
+  if (LegacyPathHasRoot(path, "study")) {
+    mask |= persistence::kProjectClassStudy;
+  }
+  if (LegacyPathHasRoot(path, "exercise")) {
+    mask |= persistence::kProjectClassExercise;
+  }
+  if (LegacyPathHasRoot(path, "exercise_cardio")) {
+    mask |= persistence::kProjectClassCardio;
+  }
+  if (LegacyPathHasRoot(path, "exercise_anaerobic")) {
+    mask |= persistence::kProjectClassAnaerobic;
+  }
+  if (LegacyPathHasRoot(path, "recreation")) {
+    mask |= persistence::kProjectClassRecreation;
+    const std::size_t kSeparator = path.rfind('_');
+    const std::string_view kLeaf = kSeparator == std::string_view::npos
+                                       ? path
+                                       : path.substr(kSeparator + 1);
+    if (kLeaf == "zhihu") {
+      mask |= persistence::kProjectClassRecreationZhihu;
+    } else if (kLeaf == "bilibili") {
+      mask |= persistence::kProjectClassRecreationBilibili;
+    } else if (kLeaf == "douyin") {
+      mask |= persistence::kProjectClassRecreationDouyin;
+    }
+  }
+  if (LegacyPathHasRoot(path, "recreation_game")) {
+    mask |= persistence::kProjectClassGaming;
+  }
+  if (LegacyPathHasRoot(path, "routine_toilet")) {
+    mask |= persistence::kProjectClassToilet;
+  }
+  if (LegacyPathHasRoot(path, "routine") &&
+      (LegacyPathHasSegment(path, "grooming") ||
+       LegacyPathHasSegment(path, "body-hygiene") ||
+       LegacyPathHasSegment(path, "personal-hygiene") ||
+       LegacyPathHasSegment(path, "oral-hygiene"))) {
+    mask |= persistence::kProjectClassGrooming;
+  }
+  return mask;
+}
+
+// 内置规则的 C++ 判定与生成的 SQL 逐类别都应与旧判定一致，
+// 含叶子、分段与前缀相近的反例。
+auto ProjectClassRulesMatchLegacy(sqlite3* sqlite_db) -> bool {
+  namespace persistence = tracer::core::infrastructure::persistence;
+  constexpr std::array<std::string_view, 38> kPaths = {
+      "",
+      "study",
+      "study_math",
+      "studying",
+      "Study_math",
+      "work_study",
+      "exercise",
+      "exercise_cardio_run",
+      "exercise_cardiox",
+      "exercise_anaerobic_squat",
+      "sleep_night",
+      "sleep_night_nap",
+      "sleep_day",
+      "sleep",
+      "recreation",
+      "recreation_zhihu",
+      "recreation_video_bilibili",
+      "recreation_bilibili_video",
+      "recreation_douyin",
+      "recreation_zhihu_x",
+      "recreationzhihu",
+      "zhihu",
+      "work_zhihu",
+      "recreation_game",
+      "recreation_game_zhihu",
+      "recreation_gamex",
+      "routine",
+      "routine_toilet",
+      "routine_toilet_x",
+      "routine_grooming",
+      "routine_morning_body-hygiene",
+      "routine_personal-hygiene_x",
+      "routine_oral-hygiene",
+      "routine_hygiene",
+      "routine_grooming-x",
+      "other_grooming",
+      "routine__grooming",
+      "recreation_",
+  };
+  for (const std::string_view kPath : kPaths) {
+    const std::uint32_t kExpected = LegacyClassMask(kPath);
+    if (persistence::ClassifyProjectPath(kPath) != kExpected) {
+      return false;
+    }
+    for (std::uint32_t project_class = 1U;
+         project_class <= persistence::kProjectClassGrooming;
+         project_class <<= 1U) {
+      const std::string kSql = std::format(
+          "SELECT {};", persistence::ProjectClassPathSql(project_class, "?1"));
+      sqlite3_stmt* stmt = nullptr;
+      if (sqlite3_prepare_v2(sqlite_db, kSql.c_str(), -1, &stmt, nullptr) !=
+          SQLITE_OK) {
+        sqlite3_finalize(stmt);
+        return false;
+      }
+      sqlite3_bind_text(stmt, 1, kPath.data(), static_cast<int>(kPath.size()),
+                        SQLITE_TRANSIENT);
+      const bool kMatched = sqlite3_step(stmt) == SQLITE_ROW &&
+                            sqlite3_column_int(stmt, 0) != 0;
+      sqlite3_finalize(stmt);
+      if (kMatched != ((kExpected & project_class) != 0U)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// 全文索引可选；存在时每条记录、每个有备注的日期各对应一行。
+auto SearchIndexMatchesRecords(sqlite3* sqlite_db) -> bool {
+  if (QueryInt64(sqlite_db,
+                 "SELECT COUNT(*) FROM sqlite_master "
+                 "WHERE name = 'text_search';") == 0) {
+    return true;
+  }
+  return QueryInt64(sqlite_db,
+                    "SELECT COUNT(*) FROM text_search "
+                    "WHERE record_id IS NOT NULL;") ==
+             QueryInt64(sqlite_db, "SELECT COUNT(*) FROM time_records;") &&
+         QueryInt64(sqlite_db,
+                    "SELECT COUNT(*) FROM text_search "
+                    "WHERE record_id IS NULL;") ==
+             QueryInt64(sqlite_db,
+                        "SELECT COUNT(*) FROM days "
+                        "WHERE remark IS NOT NULL AND remark <> '';");
+}
+
 auto RunPersistenceWriteSmokeImpl() -> int {
   std::error_code cleanup_error;
 
@@ -59,9 +326,123 @@ auto RunPersistenceWriteSmokeImpl() -> int {
         persistence_writer(connection.GetDb(), statement.GetInsertDayStmt(),
                            statement.GetInsertRecordStmt(),
                            statement.GetInsertProjectStmt());
-    (void)repository;
+    if (statement.GetInsertDayBatchStmt() == nullptr ||
+        statement.GetInsertRecordBatchStmt() == nullptr) {
+      return 26;
+    }
     (void)resolver;
     (void)persistence_writer;
+
+    using tracer::core::infrastructure::persistence::importer::sqlite::
+        Statement;
+    const auto [kDays, kRecords] =
+        BuildBulkLoadFixture((Statement::kInsertBatchRows * 2) + 3);
+    repository.ReplaceAllData(kDays, kRecords);
+    repository.ImportData(kDays, kRecords);
+    const auto kTail =
+        repository.TryGetLatestActivityTailBeforeDate("2099-01-01");
+    if (!kTail.has_value() || kTail->date != kDays.back().date ||
+        kTail->end_time != "08:00") {
+      return 27;
+    }
+    // 批量语句与单行尾部都必须落库：行数应与夹具完全一致。
+    if (QueryInt64(connection.GetDb(), "SELECT COUNT(*) FROM days;") !=
+            static_cast<std::int64_t>(kDays.size()) ||
+        QueryInt64(connection.GetDb(), "SELECT COUNT(*) FROM time_records;") !=
+            static_cast<std::int64_t>(kRecords.size())) {
+      return 32;
+    }
+    if (!RollupsMatchRecords(connection.GetDb()) ||
+        QueryInt64(connection.GetDb(),
+                   "SELECT SUM(study) FROM day_flag_rollup;") !=
+            static_cast<std::int64_t>((kRecords.size() + 1) / 2) ||
+        !DayFlagsMatchSnapshotPredicate(connection.GetDb())) {
+      return 28;
+    }
+    if (!SearchIndexMatchesRecords(connection.GetDb())) {
+      return 30;
+    }
+    repository.ReplaceMonthData(2025, 1, {}, {});
+    if (!RollupsMatchRecords(connection.GetDb()) ||
+        QueryInt64(connection.GetDb(),
+                   "SELECT COUNT(*) FROM project_monthly_rollup "
+                   "WHERE year_month = '2025-01';") != 0) {
+      return 29;
+    }
+    if (!SearchIndexMatchesRecords(connection.GetDb())) {
+      return 31;
+    }
+
+    namespace persistence = tracer::core::infrastructure::persistence;
+    if (!ProjectClassRulesMatchLegacy(connection.GetDb())) {
+      return 33;
+    }
+    // 配置改动分类规则：打开写连接时按新规则重建按日标记，
+    // 之后恢复内置规则再重建一次。
+    const std::int64_t kGroomingDays = QueryInt64(
+        connection.GetDb(),
+        "SELECT COUNT(DISTINCT date) FROM time_records "
+        "WHERE project_path_snapshot = 'routine_grooming';");
+    const std::vector<ProjectClassRuleConfig> kStudyIsRoutine = {
+        {.project_class = "study",
+         .match = "root",
+         .root = "routine",
+         .token = ""}};
+    persistence::InstallProjectClassRules(kStudyIsRoutine);
+    const bool kRebuiltForConfig = [&]() -> bool {
+      tracer::core::infrastructure::persistence::importer::sqlite::Connection
+          reopened(kDbPath.string());
+      return persistence::DayFlagRollupMatchesRules(reopened.GetDb()) &&
+             QueryInt64(reopened.GetDb(),
+                        "SELECT SUM(study) FROM day_flag_rollup;") ==
+                 kGroomingDays &&
+             DayFlagsMatchSnapshotPredicate(reopened.GetDb());
+    }();
+    persistence::InstallProjectClassRules({});
+    if (!kRebuiltForConfig ||
+        persistence::DayFlagRollupMatchesRules(connection.GetDb())) {
+      return 34;
+    }
+    {
+      tracer::core::infrastructure::persistence::importer::sqlite::Connection
+          reopened(kDbPath.string());
+      if (!persistence::DayFlagRollupMatchesRules(reopened.GetDb()) ||
+          !DayFlagsMatchSnapshotPredicate(reopened.GetDb())) {
+        return 35;
+      }
+    }
+    // 无法识别的分类名被拒绝，已生效的规则保持不变。
+    const std::vector<ProjectClassRuleConfig> kUnknownClass = {
+        {.project_class = "reading",
+         .match = "root",
+         .root = "book",
+         .token = ""}};
+    try {
+      persistence::InstallProjectClassRules(kUnknownClass);
+      return 36;
+    } catch (const std::runtime_error&) {
+    }
+    if (persistence::ProjectClassRulesFingerprint() !=
+        persistence::ProjectClassRulesFingerprint(
+            persistence::DefaultProjectClassRules())) {
+      return 36;
+    }
+    // token 只能是单个路径段：含 '_' 时内存匹配与 SQL 匹配会不一致。
+    const std::vector<ProjectClassRuleConfig> kMultiSegmentToken = {
+        {.project_class = "cardio",
+         .match = "root_and_leaf",
+         .root = "exercise",
+         .token = "cardio_run"}};
+    try {
+      persistence::InstallProjectClassRules(kMultiSegmentToken);
+      return 37;
+    } catch (const std::runtime_error&) {
+    }
+    if (persistence::ProjectClassRulesFingerprint() !=
+        persistence::ProjectClassRulesFingerprint(
+            persistence::DefaultProjectClassRules())) {
+      return 37;
+    }
   } catch (...) {
     return 25;
   }
@@ -1,9 +1,14 @@
+import tracer.core.infrastructure.persistence.runtime;
 import tracer.core.infrastructure.persistence.write;
 import tracer.core.infrastructure.query.data.renderers;
 import tracer.core.infrastructure.query.data.repository;
 import tracer.core.infrastructure.query.data.stats;
 
+#include <algorithm>
 #include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include "application/dto/query_requests.hpp"
 #include "infra/tests/modules_smoke/query.hpp"
@@ -126,6 +131,125 @@ auto RunInfrastructureModuleQueryStatsRepositorySmoke() -> int {
              .empty()) {
       return 15;
     }
+
+    // 文件库走列式快照，临时库（空路径）走 SQL；两者对含空日的区间必须
+    // 给出相同结果。
+    namespace importer_sqlite =
+        tracer::core::infrastructure::persistence::importer::sqlite;
+    constexpr const char* kSeedSql =
+        "INSERT INTO projects (id, name, parent_id, full_path, depth) VALUES "
+        "(1, 'study', NULL, 'study', 0), "
+        "(2, 'math', 1, 'study_math', 1), "
+        "(3, 'exercise', NULL, 'exercise', 0);"
+        "INSERT INTO days (date, year, month) VALUES "
+        "('2026-03-01', 2026, 3), ('2026-03-02', 2026, 3), "
+        "('2026-03-03', 2026, 3), ('2026-03-04', 2026, 3), "
+        "('2026-03-05', 2026, 3);"
+        "INSERT INTO time_records VALUES "
+        "(1, 0, 3600, '2026-03-01', '08:00', '09:00', 1, 3600, 'study', NULL), "
+        "(2, 3600, 5400, '2026-03-01', '09:00', '09:30', 2, 1800, "
+        "'study_math', NULL), "
+        "(3, 7200, 7800, '2026-03-03', '10:00', '10:10', 3, 600, "
+        "'exercise', NULL), "
+        "(4, 9000, 10200, '2026-03-05', '11:00', '11:20', 1, 1200, "
+        "'study', NULL);";
+    importer_sqlite::Connection sql_connection("");
+    if (!importer_sqlite::ExecuteSql(connection.GetDb(), kSeedSql,
+                                     "seed snapshot query smoke") ||
+        !importer_sqlite::ExecuteSql(sql_connection.GetDb(), kSeedSql,
+                                     "seed sql query smoke")) {
+      return 16;
+    }
+    if (tracer::core::infrastructure::persistence::AcquireRecordColumnSnapshot(
+            connection.GetDb()) == nullptr) {
+      return 17;
+    }
+    const auto kSameRows =
+        [](const std::vector<
+               tracer::core::infrastructure::query::data::DayDurationRow>&
+               left,
+           const std::vector<
+               tracer::core::infrastructure::query::data::DayDurationRow>&
+               right) -> bool {
+      return std::ranges::equal(
+          left, right, [](const auto& lhs, const auto& rhs) -> bool {
+            return lhs.date == rhs.date &&
+                   lhs.total_seconds == rhs.total_seconds;
+          });
+    };
+    for (const std::optional<std::string>& root :
+         {std::optional<std::string>{"study"},
+          std::optional<std::string>{"exercise"},
+          std::optional<std::string>{}}) {
+      const auto kSnapshotRows = tracer::core::infrastructure::query::data::
+          QueryDayDurationsByRootInDateRange(connection.GetDb(), root,
+                                             "2026-02-28", "2026-03-06");
+      const auto kSqlRows = tracer::core::infrastructure::query::data::
+          QueryDayDurationsByRootInDateRange(sql_connection.GetDb(), root,
+                                             "2026-02-28", "2026-03-06");
+      if (kSnapshotRows.size() != 5U || !kSameRows(kSnapshotRows, kSqlRows)) {
+        return 18;
+      }
+    }
+    const auto kStudyRows = tracer::core::infrastructure::query::data::
+        QueryDayDurationsByRootInDateRange(connection.GetDb(), "study",
+                                           "2026-03-02", "2026-03-05");
+    if (kStudyRows.size() != 4U || kStudyRows.front().date != "2026-03-02" ||
+        kStudyRows.front().total_seconds != 0 ||
+        kStudyRows.back().total_seconds != 1200) {
+      return 19;
+    }
+
+    // 备注与项目过滤在有无全文索引时结果必须一致：引号、中文、不足三个
+    // 字符（不走索引）与 % 通配符（不走索引）各一例。
+    if (!importer_sqlite::ExecuteSql(
+            connection.GetDb(),
+            "UPDATE time_records SET activity_remark = CASE logical_id "
+            "WHEN 1 THEN 'said \"hello\" there' "
+            "WHEN 2 THEN '读书笔记整理' "
+            "WHEN 3 THEN '100% done' ELSE 'ok' END;",
+            "seed remark query smoke") ||
+        !importer_sqlite::RebuildSearchIndex(connection.GetDb(),
+                                             std::nullopt)) {
+      return 20;
+    }
+    struct TextFilterCase {
+      std::optional<std::string> remark;
+      std::optional<std::string> project;
+      const char* date;
+      long long total_seconds;
+    };
+    const std::vector<TextFilterCase> kTextCases = {
+        {.remark = "\"hello\"", .date = "2026-03-01", .total_seconds = 3600},
+        {.remark = "书笔记", .date = "2026-03-01", .total_seconds = 1800},
+        {.remark = "ok", .date = "2026-03-05", .total_seconds = 1200},
+        {.remark = "0%d", .date = "2026-03-03", .total_seconds = 600},
+        {.project = "_math", .date = "2026-03-01", .total_seconds = 1800},
+    };
+    const auto kRunTextCases = [&]() -> bool {
+      return std::ranges::all_of(
+          kTextCases, [&](const TextFilterCase& text_case) -> bool {
+            tracer::core::infrastructure::query::data::QueryFilters
+                text_filters{};
+            text_filters.remark = text_case.remark;
+            text_filters.project = text_case.project;
+            const auto kRows =
+                tracer::core::infrastructure::query::data::QueryDayDurations(
+                    connection.GetDb(), text_filters);
+            return kRows.size() == 1U && kRows.front().date == text_case.date &&
+                   kRows.front().total_seconds == text_case.total_seconds;
+          });
+    };
+    if (importer_sqlite::TableExists(connection.GetDb(), "text_search") &&
+        !kRunTextCases()) {
+      return 21;
+    }
+    if (!importer_sqlite::ExecuteSql(connection.GetDb(),
+                                     "DROP TABLE IF EXISTS text_search;",
+                                     "drop text_search query smoke") ||
+        !kRunTextCases()) {
+      return 22;
+    }
   } catch (...) {
     return 11;
   }
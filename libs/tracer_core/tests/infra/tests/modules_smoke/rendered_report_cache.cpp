@@ -0,0 +1,292 @@
+import tracer.core.infrastructure.persistence.runtime;
+import tracer.core.infrastructure.persistence.write;
+import tracer.core.infrastructure.reporting.data_querying;
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "application/pipeline/importer/model/import_models.hpp"
+#include "application/ports/reporting/i_rendered_report_cache.hpp"
+#include "domain/reports/types/report_types.hpp"
+#include "infra/tests/modules_smoke/reporting.hpp"
+
+namespace {
+
+namespace fs = std::filesystem;
+namespace reports = tracer::core::infrastructure::reports;
+
+using tracer_core::application::ports::RenderedReportRequest;
+
+constexpr std::string_view kFingerprint = "smoke-config";
+constexpr std::string_view kBuildVersion = "0.0.0+smoke-build";
+// LRU 用例中每个条目（键、换行与正文）在磁盘上的固定大小。
+constexpr std::uintmax_t kPaddedEntrySize = 512;
+
+// 每个月写入三天、每天一条记录。
+auto AppendMonthFixture(int month, std::vector<DayData>& days,
+                        std::vector<TimeRecordInternal>& records) -> void {
+  for (int day = 1; day <= 3; ++day) {
+    const std::string kDate = std::format("2025-{:02d}-{:02d}", month, day);
+    const long long kIndex = (month * 100LL) + day;
+    days.push_back(DayData{.date = kDate,
+                           .remark = "",
+                           .getup_time = "07:00",
+                           .year = 2025,
+                           .month = month,
+                           .wake_anchor = 1});
+    records.push_back(TimeRecordInternal{.logical_id = kIndex,
+                                         .start_timestamp = kIndex * 86400,
+                                         .end_timestamp = kIndex * 86400 + 3600,
+                                         .start_time_str = "07:00",
+                                         .end_time_str = "08:00",
+                                         .project_path = "study_math",
+                                         .duration_seconds = 3600,
+                                         .remark = std::nullopt,
+                                         .date = kDate});
+  }
+}
+
+auto Request(std::string_view kind, std::string_view first_date,
+             std::string_view last_date,
+             ReportFormat format = ReportFormat::kMarkdown)
+    -> RenderedReportRequest {
+  return {.kind = std::string(kind),
+          .first_date = std::string(first_date),
+          .last_date = std::string(last_date),
+          .format = format};
+}
+
+auto RenderedText(const RenderedReportRequest& request) -> std::string {
+  return std::format("# {} {}..{}\n", request.kind, request.first_date,
+                     request.last_date);
+}
+
+// 可缓存但尚无条目。
+auto IsMiss(reports::RenderedReportCache& cache,
+            const RenderedReportRequest& request) -> bool {
+  const auto kLookup = cache.Lookup(request);
+  return !kLookup.entry_key.empty() && !kLookup.content.has_value();
+}
+
+auto IsHit(reports::RenderedReportCache& cache,
+           const RenderedReportRequest& request, std::string_view expected)
+    -> bool {
+  const auto kLookup = cache.Lookup(request);
+  return kLookup.content.has_value() && *kLookup.content == expected;
+}
+
+// 未命中时按查询返回的键写入，返回该键。
+auto StoreRendered(reports::RenderedReportCache& cache,
+                   const RenderedReportRequest& request,
+                   std::string_view content) -> std::string {
+  const auto kLookup = cache.Lookup(request);
+  if (kLookup.entry_key.empty() || kLookup.content.has_value()) {
+    return {};
+  }
+  cache.Store(kLookup.entry_key, content);
+  return kLookup.entry_key;
+}
+
+// 正文补齐到使条目恰为 kPaddedEntrySize 字节。
+auto PaddedContent(std::string_view entry_key) -> std::string {
+  return std::string(kPaddedEntrySize - entry_key.size() - 1, 'x');
+}
+
+// 缓存文件首行保存完整键，据此找到键对应的文件。
+auto FindEntryFile(const fs::path& cache_dir, std::string_view entry_key)
+    -> std::optional<fs::path> {
+  std::error_code error;
+  for (const auto& entry : fs::directory_iterator(cache_dir, error)) {
+    std::ifstream input(entry.path(), std::ios::binary);
+    std::string header;
+    if (std::getline(input, header) && header == entry_key) {
+      return entry.path();
+    }
+  }
+  return std::nullopt;
+}
+
+auto CountEntryFiles(const fs::path& cache_dir) -> std::size_t {
+  std::size_t count = 0;
+  std::error_code error;
+  for (const auto& entry : fs::directory_iterator(cache_dir, error)) {
+    count += entry.path().extension() == ".report" ? 1U : 0U;
+  }
+  return count;
+}
+
+}  // namespace
+
+auto RunRenderedReportCacheSmoke() -> int {
+  std::error_code cleanup_error;
+  const fs::path kSmokeDir = fs::path("temp") / "phase20_rendered_report_cache";
+  const fs::path kDbPath = kSmokeDir / "reports.sqlite";
+  const fs::path kCacheDir = kSmokeDir / "cache";
+  const fs::path kLruCacheDir = kSmokeDir / "lru_cache";
+  fs::remove_all(kSmokeDir, cleanup_error);
+  fs::create_directories(kSmokeDir);
+
+  const auto kMarchDay = Request("day", "2025-03-02", "2025-03-02");
+  const auto kMarchWeek = Request("week", "2025-03-03", "2025-03-09");
+  const auto kMarchMonth = Request("month", "2025-03-01", "2025-03-31");
+  const auto kAprilDay = Request("day", "2025-04-02", "2025-04-02");
+  const auto kAprilMonth = Request("month", "2025-04-01", "2025-04-30");
+  const auto kCrossMonthWeek = Request("week", "2025-03-31", "2025-04-06");
+  const auto kYear = Request("year", "2025-01-01", "2025-12-31");
+  const std::array<RenderedReportRequest, 7> kAllRequests = {
+      kMarchDay,   kMarchWeek,      kMarchMonth, kAprilDay,
+      kAprilMonth, kCrossMonthWeek, kYear};
+
+  try {
+    auto read_pool = std::make_shared<
+        tracer::core::infrastructure::persistence::SqliteReadConnectionPool>(
+        kDbPath);
+    reports::RenderedReportCache cache(kCacheDir, std::string(kFingerprint),
+                                       std::string(kBuildVersion), read_pool);
+    // 库还不存在：读不到数据代次，不可缓存。
+    if (!cache.Lookup(kMarchDay).entry_key.empty()) {
+      return 71;
+    }
+
+    std::vector<DayData> march_days;
+    std::vector<TimeRecordInternal> march_records;
+    AppendMonthFixture(3, march_days, march_records);
+    std::vector<DayData> april_days;
+    std::vector<TimeRecordInternal> april_records;
+    AppendMonthFixture(4, april_days, april_records);
+    std::vector<DayData> all_days = march_days;
+    all_days.insert(all_days.end(), april_days.begin(), april_days.end());
+    std::vector<TimeRecordInternal> all_records = march_records;
+    all_records.insert(all_records.end(), april_records.begin(),
+                       april_records.end());
+
+    tracer::core::infrastructure::persistence::importer::Repository repository(
+        kDbPath.string());
+    repository.ImportData(all_days, all_records);
+
+    for (const auto& request : kAllRequests) {
+      if (StoreRendered(cache, request, RenderedText(request)).empty()) {
+        return 72;
+      }
+    }
+    for (const auto& request : kAllRequests) {
+      if (!IsHit(cache, request, RenderedText(request))) {
+        return 73;
+      }
+    }
+    // 键区分输出格式与核心构建版本。
+    reports::RenderedReportCache other_build(kCacheDir,
+                                             std::string(kFingerprint),
+                                             "0.0.1+smoke-build", read_pool);
+    if (!IsMiss(cache, Request("day", "2025-03-02", "2025-03-02",
+                               ReportFormat::kTyp)) ||
+        !IsMiss(other_build, kMarchDay)) {
+      return 74;
+    }
+
+    // 只替换四月：三月的日、周、月条目仍命中；四月的条目、跨月的周
+    // 以及全年都失效。
+    repository.ReplaceMonthData(2025, 4, april_days, april_records);
+    for (const auto& request : {kMarchDay, kMarchWeek, kMarchMonth}) {
+      if (!IsHit(cache, request, RenderedText(request))) {
+        return 75;
+      }
+    }
+    for (const auto& request : {kAprilDay, kAprilMonth, kCrossMonthWeek,
+                                kYear}) {
+      if (!IsMiss(cache, request)) {
+        return 76;
+      }
+    }
+
+    // 上限恰好容纳三个条目：先访问 A 再写入 D，淘汰最久未访问的 B。
+    constexpr std::uintmax_t kMaxBytes = kPaddedEntrySize * 3;
+    const auto& kEntryA = kMarchDay;
+    const auto& kEntryB = kMarchWeek;
+    const auto& kEntryC = kMarchMonth;
+    const auto& kEntryD = kAprilDay;
+    std::array<std::string, 4> contents;
+    std::array<std::string, 4> keys;
+    {
+      reports::RenderedReportCache lru_cache(
+          kLruCacheDir, std::string(kFingerprint), std::string(kBuildVersion),
+          read_pool, kMaxBytes);
+      const std::array<const RenderedReportRequest*, 4> kEntries = {
+          &kEntryA, &kEntryB, &kEntryC, &kEntryD};
+      for (std::size_t index = 0; index < kEntries.size(); ++index) {
+        keys[index] = lru_cache.Lookup(*kEntries[index]).entry_key;
+        if (keys[index].empty() ||
+            keys[index].size() + 1 >= kPaddedEntrySize) {
+          return 77;
+        }
+        contents[index] = PaddedContent(keys[index]);
+      }
+      for (std::size_t index = 0; index < 3; ++index) {
+        lru_cache.Store(keys[index], contents[index]);
+      }
+      if (!IsHit(lru_cache, kEntryA, contents[0])) {
+        return 78;
+      }
+      lru_cache.Store(keys[3], contents[3]);
+      if (!IsMiss(lru_cache, kEntryB) ||
+          !IsHit(lru_cache, kEntryA, contents[0]) ||
+          !IsHit(lru_cache, kEntryC, contents[2]) ||
+          !IsHit(lru_cache, kEntryD, contents[3]) ||
+          CountEntryFiles(kLruCacheDir) != 3) {
+        return 79;
+      }
+    }
+
+    // 重启：索引按文件修改时间恢复 LRU 顺序，并清理残留的临时文件。
+    const auto kNow = fs::file_time_type::clock::now();
+    const std::array<std::pair<std::size_t, std::chrono::hours>, 3> kAges = {
+        {{0, std::chrono::hours(3)},
+         {2, std::chrono::hours(2)},
+         {3, std::chrono::hours(1)}}};
+    for (const auto& [index, age] : kAges) {
+      const auto kPath = FindEntryFile(kLruCacheDir, keys[index]);
+      if (!kPath.has_value()) {
+        return 80;
+      }
+      fs::last_write_time(*kPath, kNow - age);
+    }
+    const fs::path kStaleTemp = kLruCacheDir / "0000000000000000.report.tmp";
+    {
+      std::ofstream stale(kStaleTemp, std::ios::binary);
+      stale << "partial";
+    }
+    reports::RenderedReportCache restarted(
+        kLruCacheDir, std::string(kFingerprint), std::string(kBuildVersion),
+        read_pool, kMaxBytes);
+    if (!IsHit(restarted, kEntryC, contents[2]) || fs::exists(kStaleTemp)) {
+      return 81;
+    }
+    // 恢复后的总大小仍受上限约束：写回 B 淘汰最旧的 A。
+    restarted.Store(keys[1], contents[1]);
+    if (!IsMiss(restarted, kEntryA) ||
+        !IsHit(restarted, kEntryB, contents[1]) ||
+        !IsHit(restarted, kEntryC, contents[2]) ||
+        !IsHit(restarted, kEntryD, contents[3]) ||
+        CountEntryFiles(kLruCacheDir) != 3) {
+      return 82;
+    }
+  } catch (...) {
+    return 70;
+  }
+
+  fs::remove_all(kSmokeDir, cleanup_error);
+  return 0;
+}
@@ -3,5 +3,7 @@
 #define TRACER_CORE_TESTS_INFRASTRUCTURE_MODULES_SMOKE_REPORTING_HPP_
 
 auto RunInfrastructureModuleReportsSmoke() -> int;
+auto RunTrailingWindowAggregatorSmoke() -> int;
+auto RunRenderedReportCacheSmoke() -> int;
 
 #endif  // TRACER_CORE_TESTS_INFRASTRUCTURE_MODULES_SMOKE_REPORTING_HPP_
@@ -0,0 +1,149 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "infra/reporting/data/queriers/utils/trailing_window_aggregator.hpp"
+#include "infra/tests/modules_smoke/reporting.hpp"
+
+namespace {
+
+namespace window = reports::data::window;
+
+struct RecordInput {
+  std::int32_t day = 0;
+  std::int64_t project_id = 0;
+  std::int64_t duration = 0;
+  std::uint8_t flags = 0;
+};
+
+struct DayFlagInput {
+  std::int32_t day = 0;
+  std::uint8_t flags = 0;
+};
+
+// 改写前的做法：每个窗口各自扫描全部输入。
+auto ReferenceWindow(const std::vector<RecordInput>& records,
+                     const std::vector<DayFlagInput>& day_flags,
+                     std::int32_t start_day) -> window::WindowTotals {
+  window::WindowTotals totals;
+  std::set<std::int32_t> record_days;
+  std::map<std::int32_t, std::uint8_t> flags_by_day;
+  for (const RecordInput& record : records) {
+    if (record.day < start_day) {
+      continue;
+    }
+    totals.total_duration += record.duration;
+    totals.project_durations[record.project_id] += record.duration;
+    record_days.insert(record.day);
+    flags_by_day[record.day] |= record.flags;
+  }
+  for (const DayFlagInput& entry : day_flags) {
+    if (entry.day >= start_day) {
+      flags_by_day[entry.day] |= entry.flags;
+    }
+  }
+  totals.record_days = static_cast<int>(record_days.size());
+  for (const auto& [day, flags] : flags_by_day) {
+    for (std::size_t bit = 0; bit < window::kDayFlagBits; ++bit) {
+      totals.flag_days[bit] += (flags >> bit) & 1U;
+    }
+  }
+  return totals;
+}
+
+auto SameTotals(const window::WindowTotals& left,
+                const window::WindowTotals& right) -> bool {
+  return left.total_duration == right.total_duration &&
+         left.record_days == right.record_days &&
+         left.flag_days == right.flag_days &&
+         left.project_durations == right.project_durations;
+}
+
+}  // namespace
+
+auto RunTrailingWindowAggregatorSmoke() -> int {
+  constexpr std::int32_t kToday = 20000;
+  constexpr std::int32_t kHistoryDays = 2200;
+  constexpr std::int64_t kZeroDurationProject = 99;
+  constexpr std::uint8_t kWakeAnchorFlag = 1U << 7U;
+
+  std::vector<RecordInput> records;
+  std::vector<DayFlagInput> day_flags;
+  // 固定种子的线性同余序列，保证每次运行数据相同。
+  std::uint32_t state = 12345U;
+  const auto kNext = [&state](std::uint32_t bound) -> std::uint32_t {
+    state = (state * 1103515245U) + 12345U;
+    return (state >> 8U) % bound;
+  };
+  for (std::int32_t day = kToday - kHistoryDays + 1; day <= kToday; ++day) {
+    const std::uint32_t kKind = kNext(10);
+    if (kKind == 0) {
+      continue;  // 完全空白的一天。
+    }
+    if (kKind == 1) {
+      // 只有标记、没有记录的一天。
+      day_flags.push_back({.day = day, .flags = kWakeAnchorFlag});
+      continue;
+    }
+    const std::uint32_t kCount = 1 + kNext(4);
+    for (std::uint32_t index = 0; index < kCount; ++index) {
+      const auto kProject = static_cast<std::int64_t>(1 + kNext(6));
+      records.push_back(
+          {.day = day,
+           .project_id = kProject,
+           .duration = static_cast<std::int64_t>(kNext(7200)),
+           .flags = static_cast<std::uint8_t>(1U << (kProject % 4))});
+    }
+    if (kKind == 2) {
+      records.push_back({.day = day,
+                         .project_id = kZeroDurationProject,
+                         .duration = 0,
+                         .flags = 0});
+    }
+    if (kKind == 3) {
+      day_flags.push_back({.day = day, .flags = kWakeAnchorFlag});
+    }
+  }
+  // 同一天的记录标记位相互重叠时只计一次。
+  records.push_back(
+      {.day = kToday, .project_id = 1, .duration = 60, .flags = 0b11U});
+
+  const std::array<std::int32_t, 6> kWindows = {7, 30, 90, 365, 30, 1825};
+  std::vector<std::int32_t> start_days;
+  for (const std::int32_t kWindow : kWindows) {
+    start_days.push_back(kToday - kWindow + 1);
+  }
+
+  window::TrailingWindowAggregator aggregator;
+  aggregator.Reserve(records.size() + day_flags.size());
+  // 倒序加入，验证 Sweep 不依赖输入顺序。
+  for (auto it = records.rbegin(); it != records.rend(); ++it) {
+    aggregator.AddRecord(it->day, it->project_id, it->duration, it->flags);
+  }
+  for (const DayFlagInput& entry : day_flags) {
+    aggregator.AddDayFlags(entry.day, entry.flags);
+  }
+  const auto kResults = aggregator.Sweep(start_days);
+  if (kResults.size() != start_days.size()) {
+    return 61;
+  }
+  for (std::size_t index = 0; index < start_days.size(); ++index) {
+    if (!SameTotals(kResults[index],
+                    ReferenceWindow(records, day_flags, start_days[index]))) {
+      return 62;
+    }
+  }
+  if (!SameTotals(kResults[1], kResults[4])) {
+    return 63;
+  }
+  const auto& longest = kResults.back();
+  const auto kZeroIt = longest.project_durations.find(kZeroDurationProject);
+  if (kZeroIt == longest.project_durations.end() || kZeroIt->second != 0 ||
+      longest.flag_days[7] == 0) {
+    return 64;
+  }
+  return 0;
+}
@@ -11,11 +11,13 @@ import tracer.core.infrastructure.reporting.dto;
 #include <filesystem>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "application/ports/reporting/i_report_formatter_registry.hpp"
 #include "infra/config/models/report_catalog.hpp"
 #include "infra/reporting/facade/android_static_report_formatter_registrar.hpp"
+#include "infra/reporting/shared/factories/generic_formatter_factory.hpp"
 #include "infra/tests/report_formatter/report_formatter_parity_internal.hpp"
 
 namespace {
@@ -248,6 +250,56 @@ auto CollectOutputs(infra_reports::ReportDtoFormatter& formatter,
   return outputs;
 }
 
+// FormatReportTo must append exactly what FormatReport returns, both after
+// existing content and when one buffer is reused across reports, and
+// FormatReportWithScratch must return the same text.
+template <typename ReportDataType>
+auto FormatReportToMatches(const ReportCatalog& catalog,
+                           const ReportDataType& report, ReportFormat format)
+    -> bool {
+  const auto formatter =
+      GenericFormatterFactory<ReportDataType>::Create(format, catalog);
+  const std::string expected = formatter->FormatReport(report);
+  const std::string prefix = "existing buffer content\n";
+
+  std::string buffer = prefix;
+  formatter->FormatReportTo(report, buffer);
+  if (buffer != prefix + expected) {
+    return false;
+  }
+  buffer.clear();
+  formatter->FormatReportTo(report, buffer);
+  formatter->FormatReportTo(report, buffer);
+  if (buffer != expected + expected) {
+    return false;
+  }
+  // The thread-local scratch buffer must not leak one report into the next.
+  return FormatReportWithScratch(*formatter, report) == expected &&
+         FormatReportWithScratch(*formatter, report) == expected;
+}
+
+auto CheckFormatReportToParity(const ReportCatalog& catalog,
+                               const DailyReportData& daily_report,
+                               const MonthlyReportData& monthly_report,
+                               const WeeklyReportData& weekly_report,
+                               const YearlyReportData& yearly_report,
+                               const PeriodReportData& range_report,
+                               ReportFormat format, const char* format_label,
+                               int& failures) -> void {
+  const auto check = [&](const char* case_label, bool matches) -> void {
+    if (!matches) {
+      std::cerr << "[FAIL] FormatReportTo differs from FormatReport: "
+                << format_label << " " << case_label << '\n';
+      ++failures;
+    }
+  };
+  check("day", FormatReportToMatches(catalog, daily_report, format));
+  check("month", FormatReportToMatches(catalog, monthly_report, format));
+  check("week", FormatReportToMatches(catalog, weekly_report, format));
+  check("year", FormatReportToMatches(catalog, yearly_report, format));
+  check("range", FormatReportToMatches(catalog, range_report, format));
+}
+
 // NOLINTEND(readability-magic-numbers,readability-identifier-naming,bugprone-easily-swappable-parameters,modernize-use-auto,modernize-use-designated-initializers)
 
 }  // namespace
@@ -307,6 +359,15 @@ auto RunFormatterParityTests() -> int {
     outputs.android_by_format[2] = CollectOutputs(
         *android_formatter, daily_report, monthly_report, weekly_report,
         yearly_report, range_report, ReportFormat::kTyp);
+    CheckFormatReportToParity(catalog, daily_report, monthly_report,
+                              weekly_report, yearly_report, range_report,
+                              ReportFormat::kMarkdown, "markdown", failures);
+    CheckFormatReportToParity(catalog, daily_report, monthly_report,
+                              weekly_report, yearly_report, range_report,
+                              ReportFormat::kLaTeX, "latex", failures);
+    CheckFormatReportToParity(catalog, daily_report, monthly_report,
+                              weekly_report, yearly_report, range_report,
+                              ReportFormat::kTyp, "typst", failures);
   } catch (const std::exception& exception) {
     std::cerr << "[FAIL] formatter setup threw exception: " << exception.what()
               << '\n';
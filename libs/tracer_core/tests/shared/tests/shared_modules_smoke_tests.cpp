@@ -1,14 +1,30 @@
 import tracer.core.shared;
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <random>
 #include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
 
 namespace {
 
+using tracer::core::shared::modcivil::CivilDate;
+using tracer::core::shared::modcivil::CivilFromDays;
+using tracer::core::shared::modcivil::DaysFromCivil;
+using tracer::core::shared::modcivil::FormatIsoDate;
+using tracer::core::shared::modcivil::IsoWeekdayFromDays;
+using tracer::core::shared::modcivil::PackDate;
+using tracer::core::shared::modcivil::ParseIsoDate;
+using tracer::core::shared::modcivil::ParseMinutesOfDay;
+using tracer::core::shared::modcivil::ToUtcEpochSeconds;
+using tracer::core::shared::modcivil::UnpackDate;
+using tracer::core::shared::modcivil::WrappedDurationMinutes;
+using tracer::core::shared::modconcurrency::ResolveWorkerCount;
+using tracer::core::shared::modconcurrency::WorkStealingExecutor;
 using tracer::core::shared::modperiod::FormatIsoWeek;
 using tracer::core::shared::modperiod::IsoWeek;
 using tracer::core::shared::modperiod::IsoWeekEndDate;
@@ -16,13 +32,16 @@ using tracer::core::shared::modperiod::IsoWeekStartDate;
 using tracer::core::shared::modperiod::ParseGregorianYear;
 using tracer::core::shared::modperiod::ParseIsoWeek;
 using tracer::core::shared::modtext::Canonicalize;
+using tracer::core::shared::modtext::CanonicalizeReference;
 using tracer::core::shared::modtext::RequireCanonicalText;
 using tracer::core::shared::modtext::ToUtf8Bytes;
 using tracer::core::shared::modtypes::AppError;
 using tracer::core::shared::modtypes::AppExitCode;
 using tracer::core::shared::modtypes::LogicError;
 using tracer::core::shared::string_utils::SplitString;
+using tracer::core::shared::string_utils::SplitView;
 using tracer::core::shared::string_utils::Trim;
+using tracer::core::shared::string_utils::TrimView;
 
 auto Expect(bool condition, std::string_view message, int& failures) -> void {
   if (condition) {
@@ -40,6 +59,19 @@ void TestStringModuleContract(int& failures) {
          failures);
   Expect(tokens.size() == 3U && tokens[1] == "b",
          "SplitString module contract content mismatch.", failures);
+
+  Expect(TrimView(" \thello\r") == "hello",
+         "TrimView module contract mismatch.", failures);
+  for (const std::string_view kInput : {"", "a_", "a__b", "_a", "a_b_c"}) {
+    const std::vector<std::string> kOwned =
+        SplitString(std::string(kInput), '_');
+    const std::vector<std::string_view> kViews = SplitView(kInput, '_');
+    bool same = kOwned.size() == kViews.size();
+    for (std::size_t index = 0; same && index < kOwned.size(); ++index) {
+      same = kOwned[index] == kViews[index];
+    }
+    Expect(same, "SplitView should match SplitString semantics.", failures);
+  }
 }
 
 void TestCanonicalTextContract(int& failures) {
@@ -74,6 +106,56 @@ void TestCanonicalTextContract(int& failures) {
          "ToUtf8Bytes should preserve canonical UTF-8 bytes.", failures);
 }
 
+// 随机拼接 ASCII、CR/LF、合法与非法多字节片段，对比快速路径与标量参考实现。
+void TestCanonicalTextDifferential(int& failures) {
+  const std::vector<std::vector<std::uint8_t>> kPieces = {
+      {'a'},
+      {'\r'},
+      {'\n'},
+      {'\r', '\n'},
+      {0xEFU, 0xBBU, 0xBFU},
+      {0xE4U, 0xB8U, 0xADU},
+      {0xF0U, 0x9FU, 0x98U, 0x80U},
+      {0xC3U, 0xA9U},
+      {'0', '9', '3', '0', 's', 't', 'u', 'd', 'y', '_', 'm', 'a', 't', 'h',
+       ' ', '/', '/', ' ', 'n', 'o', 't', 'e', 's', '!', '!', '!', '!', '!',
+       '!', '!', '!', '!', '!', '!', '!', '!'},
+      {0xEDU, 0xA0U, 0x80U},
+      {0xF4U, 0x90U, 0x80U, 0x80U},
+      {0xE0U, 0x80U, 0x80U},
+      {0xE4U, 0xB8U},
+      {0xFFU},
+      {0x80U},
+  };
+  constexpr std::size_t kFirstInvalidPiece = 9;
+
+  std::mt19937 rng(20260317U);
+  int mismatches = 0;
+  for (int round = 0; round < 20000; ++round) {
+    const bool kValidOnly = (round % 2) == 0;
+    std::vector<std::uint8_t> input;
+    const std::size_t kPieceCount = rng() % 48U;
+    for (std::size_t piece = 0; piece < kPieceCount; ++piece) {
+      std::size_t index = rng() % kPieces.size();
+      if (kValidOnly && index >= kFirstInvalidPiece) {
+        index = 0;
+      }
+      input.insert(input.end(), kPieces[index].begin(), kPieces[index].end());
+    }
+
+    const std::span<const std::uint8_t> kBytes(input.data(), input.size());
+    const auto kFast = Canonicalize(kBytes, "diff.txt");
+    const auto kReference = CanonicalizeReference(kBytes, "diff.txt");
+    if (kFast.ok != kReference.ok || kFast.text != kReference.text ||
+        kFast.error_message != kReference.error_message) {
+      ++mismatches;
+    }
+  }
+  Expect(mismatches == 0,
+         "Canonicalize fast path should match the scalar reference.",
+         failures);
+}
+
 void TestPeriodBridge(int& failures) {
   int year = 0;
   Expect(ParseGregorianYear("2025", year), "ParseGregorianYear should pass.",
@@ -92,6 +174,120 @@ void TestPeriodBridge(int& failures) {
          failures);
 }
 
+static_assert(DaysFromCivil({.year = 1970, .month = 1, .day = 1}) == 0);
+static_assert(ParseMinutesOfDay("23:59") == 1439);
+static_assert(WrappedDurationMinutes(23 * 60, 60) == 120);
+
+void TestCivilTimeContract(int& failures) {
+  bool round_trip = true;
+  for (std::int64_t days = -200000; days <= 200000; days += 37) {
+    round_trip = round_trip && DaysFromCivil(CivilFromDays(days)) == days;
+  }
+  Expect(round_trip, "CivilFromDays should invert DaysFromCivil.", failures);
+
+  const auto kLeapDay = ParseIsoDate("2024-02-29");
+  Expect(kLeapDay.has_value() && PackDate(*kLeapDay) == 20240229,
+         "ParseIsoDate should accept leap days.", failures);
+  Expect(!ParseIsoDate("2023-02-29").has_value() &&
+             !ParseIsoDate("2023-1-01").has_value() &&
+             !ParseIsoDate("2023-0a-01").has_value(),
+         "ParseIsoDate should reject invalid dates.", failures);
+  Expect(UnpackDate(20250307) == CivilDate{.year = 2025, .month = 3, .day = 7},
+         "UnpackDate should split YYYYMMDD.", failures);
+  Expect(FormatIsoDate(CivilFromDays(DaysFromCivil(*kLeapDay) + 1)) ==
+             "2024-03-01",
+         "Day arithmetic should cross month boundaries.", failures);
+  Expect(IsoWeekdayFromDays(DaysFromCivil(*kLeapDay)) == 4,
+         "2024-02-29 should be a Thursday.", failures);
+
+  Expect(ParseMinutesOfDay("0830") == 510 && ParseMinutesOfDay("08:30") == 510,
+         "ParseMinutesOfDay should accept HHMM and HH:MM.", failures);
+  Expect(!ParseMinutesOfDay("24:00").has_value() &&
+             !ParseMinutesOfDay("12:60").has_value() &&
+             !ParseMinutesOfDay("1a:00").has_value(),
+         "ParseMinutesOfDay should reject out-of-range values.", failures);
+  Expect(ToUtcEpochSeconds({.year = 2000, .month = 1, .day = 1}, 90) ==
+             946690200,
+         "ToUtcEpochSeconds should match the UTC epoch.", failures);
+}
+
+void TestWorkStealingExecutorContract(int& failures) {
+  Expect(ResolveWorkerCount(0) >= 1U,
+         "ResolveWorkerCount should fall back to at least one worker.",
+         failures);
+  Expect(ResolveWorkerCount(3) == 3U,
+         "ResolveWorkerCount should honor explicit worker counts.", failures);
+
+  WorkStealingExecutor executor(2);
+  Expect(executor.WorkerCount() == 2U,
+         "WorkStealingExecutor should start the requested worker count.",
+         failures);
+
+  std::vector<int> slots(64, 0);
+  executor.ParallelFor(slots.size(), [&](std::size_t index) -> void {
+    std::vector<int> nested(4, 0);
+    executor.ParallelFor(nested.size(), [&](std::size_t inner) -> void {
+      nested[inner] = 1;
+    });
+    slots[index] = static_cast<int>(index) + nested[0] + nested[3];
+  });
+  bool all_slots_written = true;
+  for (std::size_t index = 0; index < slots.size(); ++index) {
+    all_slots_written =
+        all_slots_written && slots[index] == static_cast<int>(index) + 2;
+  }
+  Expect(all_slots_written,
+         "ParallelFor should run every index once, including nested batches.",
+         failures);
+
+  std::string first_error;
+  try {
+    executor.ParallelFor(8, [](std::size_t index) -> void {
+      if (index == 2U || index == 6U) {
+        throw std::runtime_error("task-" + std::to_string(index));
+      }
+    });
+  } catch (const std::runtime_error& error) {
+    first_error = error.what();
+  }
+  Expect(first_error == "task-2",
+         "ParallelFor should rethrow the lowest-index task failure.", failures);
+}
+
+void TestTaskGroupContract(int& failures) {
+  WorkStealingExecutor executor(2);
+  WorkStealingExecutor::TaskGroup group;
+  std::vector<int> slots(16, 0);
+  for (std::size_t index = 0; index < slots.size(); ++index) {
+    executor.Submit(group, [&slots, index]() -> void {
+      slots[index] = static_cast<int>(index) * 2;
+    });
+  }
+  executor.Wait(group);
+  bool all_written = true;
+  for (std::size_t index = 0; index < slots.size(); ++index) {
+    all_written = all_written && slots[index] == static_cast<int>(index) * 2;
+  }
+  Expect(all_written, "TaskGroup should run every submitted task.", failures);
+
+  std::string first_error;
+  try {
+    for (int index = 0; index < 4; ++index) {
+      executor.Submit(group, [index]() -> void {
+        if (index >= 1) {
+          throw std::runtime_error("group-" + std::to_string(index));
+        }
+      });
+    }
+    executor.Wait(group);
+  } catch (const std::runtime_error& error) {
+    first_error = error.what();
+  }
+  Expect(first_error == "group-1",
+         "TaskGroup::Wait should rethrow the earliest submitted failure.",
+         failures);
+}
+
 void TestTypesBridge(int& failures) {
   try {
     throw LogicError("logic");
@@ -112,7 +308,11 @@ auto main() -> int {
   int failures = 0;
   TestStringModuleContract(failures);
   TestCanonicalTextContract(failures);
+  TestCanonicalTextDifferential(failures);
   TestPeriodBridge(failures);
+  TestCivilTimeContract(failures);
+  TestWorkStealingExecutorContract(failures);
+  TestTaskGroupContract(failures);
   TestTypesBridge(failures);
 
   if (failures == 0) {
@@ -11,6 +11,7 @@ struct IngestRequestPayload {
   std::optional<std::string> date_check_mode;
   std::optional<bool> save_processed_output;
   std::optional<std::string> ingest_mode;
+  std::optional<int> max_parallelism;
 };
 
 struct IngestSyncStatusRequestPayload {
@@ -23,6 +24,7 @@ struct ConvertRequestPayload {
   std::optional<bool> save_processed_output;
   std::optional<bool> validate_logic;
   std::optional<bool> validate_structure;
+  std::optional<int> max_parallelism;
 };
 
 struct ImportRequestPayload {
@@ -70,6 +70,7 @@ struct CliCommandDefaultsPayload {
 
 struct CliConfigPayload {
   bool default_save_processed_output = false;
+  int default_max_parallelism = 0;
   std::optional<std::string> default_date_check_mode;
   CliGlobalDefaultsPayload defaults;
   CliCommandDefaultsPayload command_defaults;
@@ -14,6 +14,7 @@ namespace {
 using nlohmann::json;
 using tracer::transport::modfields::RequireStringField;
 using tracer::transport::modfields::TryReadBoolField;
+using tracer::transport::modfields::TryReadIntField;
 using tracer::transport::modfields::TryReadStringField;
 using tracer::transport::modfields::TryReadStringListField;
 
@@ -61,6 +62,12 @@ auto DecodeIngestRequest(std::string_view request_json)
   }
   out.ingest_mode = kIngestMode.value;
 
+  const auto kMaxParallelism = TryReadIntField(kPayload, "max_parallelism");
+  if (kMaxParallelism.HasError()) {
+    throw std::invalid_argument(kMaxParallelism.error.message);
+  }
+  out.max_parallelism = kMaxParallelism.value;
+
   return out;
 }
 
@@ -77,6 +84,9 @@ auto EncodeIngestRequest(const IngestRequestPayload& request) -> std::string {
   if (request.ingest_mode.has_value()) {
     payload["ingest_mode"] = *request.ingest_mode;
   }
+  if (request.max_parallelism.has_value()) {
+    payload["max_parallelism"] = *request.max_parallelism;
+  }
   return payload.dump();
 }
 
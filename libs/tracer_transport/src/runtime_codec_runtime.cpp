@@ -13,6 +13,7 @@ namespace {
 using nlohmann::json;
 using tracer::transport::modfields::RequireStringField;
 using tracer::transport::modfields::TryReadBoolField;
+using tracer::transport::modfields::TryReadIntField;
 using tracer::transport::modfields::TryReadStringField;
 
 auto ParseEnvelope(std::string_view response_json, std::string_view context) {
@@ -108,15 +109,21 @@ auto ParseCliConfig(const json& payload) -> CliConfigPayload {
 
   const auto kDefaultSave =
       TryReadBoolField(payload, "default_save_processed_output");
+  const auto kDefaultMaxParallelism =
+      TryReadIntField(payload, "default_max_parallelism");
   const auto kDefaultDateMode =
       TryReadStringField(payload, "default_date_check_mode");
   if (kDefaultSave.HasError()) {
     throw std::invalid_argument(kDefaultSave.error.message);
   }
+  if (kDefaultMaxParallelism.HasError()) {
+    throw std::invalid_argument(kDefaultMaxParallelism.error.message);
+  }
   if (kDefaultDateMode.HasError()) {
     throw std::invalid_argument(kDefaultDateMode.error.message);
   }
   out.default_save_processed_output = kDefaultSave.value.value_or(false);
+  out.default_max_parallelism = kDefaultMaxParallelism.value.value_or(0);
   out.default_date_check_mode = kDefaultDateMode.value;
 
   if (const auto kDefaultsIt = payload.find("defaults");
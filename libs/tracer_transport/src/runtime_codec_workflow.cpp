@@ -14,6 +14,7 @@ namespace {
 using nlohmann::json;
 using tracer::transport::modfields::RequireStringField;
 using tracer::transport::modfields::TryReadBoolField;
+using tracer::transport::modfields::TryReadIntField;
 using tracer::transport::modfields::TryReadStringField;
 
 auto ParseRequestObject(std::string_view request_json) -> json {
@@ -44,6 +45,7 @@ auto DecodeConvertRequest(std::string_view request_json)
   const auto kValidateLogic = TryReadBoolField(kPayload, "validate_logic");
   const auto kValidateStructure =
       TryReadBoolField(kPayload, "validate_structure");
+  const auto kMaxParallelism = TryReadIntField(kPayload, "max_parallelism");
   if (kDateCheckMode.HasError()) {
     throw std::invalid_argument(kDateCheckMode.error.message);
   }
@@ -56,6 +58,9 @@ auto DecodeConvertRequest(std::string_view request_json)
   if (kValidateStructure.HasError()) {
     throw std::invalid_argument(kValidateStructure.error.message);
   }
+  if (kMaxParallelism.HasError()) {
+    throw std::invalid_argument(kMaxParallelism.error.message);
+  }
 
   ConvertRequestPayload out{};
   out.input_path = kInputPath.value.value_or("");
@@ -63,6 +68,7 @@ auto DecodeConvertRequest(std::string_view request_json)
   out.save_processed_output = kSaveProcessed.value;
   out.validate_logic = kValidateLogic.value;
   out.validate_structure = kValidateStructure.value;
+  out.max_parallelism = kMaxParallelism.value;
   return out;
 }
 
@@ -82,6 +88,9 @@ auto EncodeConvertRequest(const ConvertRequestPayload& request) -> std::string {
   if (request.validate_structure.has_value()) {
     payload["validate_structure"] = *request.validate_structure;
   }
+  if (request.max_parallelism.has_value()) {
+    payload["max_parallelism"] = *request.max_parallelism;
+  }
   return payload.dump();
 }
 
@@ -11,6 +11,7 @@ void TestEncodeRequestRoundTrip(int& failures) {
     request.date_check_mode = "none";
     request.save_processed_output = false;
     request.ingest_mode = "single_txt_replace_month";
+    request.max_parallelism = 2;
     const auto encoded = EncodeIngestRequest(request);
     const auto decoded = DecodeIngestRequest(encoded);
     Expect(decoded.input_path == request.input_path,
@@ -23,6 +24,9 @@ void TestEncodeRequestRoundTrip(int& failures) {
            failures);
     Expect(decoded.ingest_mode == request.ingest_mode,
            "EncodeIngestRequest round-trip ingest_mode mismatch.", failures);
+    Expect(decoded.max_parallelism == request.max_parallelism,
+           "EncodeIngestRequest round-trip max_parallelism mismatch.",
+           failures);
   }
 
   {
@@ -42,6 +46,7 @@ void TestEncodeRequestRoundTrip(int& failures) {
     request.save_processed_output = false;
     request.validate_logic = true;
     request.validate_structure = false;
+    request.max_parallelism = 1;
     const auto encoded = EncodeConvertRequest(request);
     const auto decoded = DecodeConvertRequest(encoded);
     Expect(decoded.input_path == request.input_path,
@@ -58,6 +63,9 @@ void TestEncodeRequestRoundTrip(int& failures) {
     Expect(decoded.validate_structure == request.validate_structure,
            "EncodeConvertRequest round-trip validate_structure mismatch.",
            failures);
+    Expect(decoded.max_parallelism == request.max_parallelism,
+           "EncodeConvertRequest round-trip max_parallelism mismatch.",
+           failures);
   }
 
   {
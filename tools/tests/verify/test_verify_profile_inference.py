@@ -97,6 +97,14 @@ class TestVerifyProfileInference(TestCase):
         self.assertEqual(inference.profiles, ("fast",))
         self.assertIn("shared build/test infra", inference.reason)
 
+    def test_classify_bench_sources_map_to_shell_aggregate(self):
+        inference = classify_changed_paths(
+            ["apps/tracer_core_shell/tests/bench/tracer_bench_main.cpp"]
+        )
+
+        self.assertFalse(inference.fallback_to_fast)
+        self.assertEqual(inference.profiles, ("shell_aggregate",))
+
     def test_classify_windows_workflow_falls_back_to_fast_with_shared_reason(self):
         inference = classify_changed_paths(
             [".github/workflows/windows-build-matrix.yml"]
@@ -68,6 +68,7 @@ _OWNER_PROFILE_RULES: tuple[tuple[str, str], ...] = (
     ("libs/tracer_core/src/application/reporting/", "cap_reporting"),
     ("libs/tracer_core/src/application/use_cases/report_api.cpp", "cap_reporting"),
     ("libs/tracer_core/src/application/use_cases/report_api_support.cpp", "cap_reporting"),
+    ("libs/tracer_core/src/application/use_cases/report_batch_export", "cap_reporting"),
     (
         "libs/tracer_core/src/application/use_cases/tracer_core_api_report.module.cpp",
         "cap_reporting",
@@ -188,6 +189,7 @@ _NON_OWNER_SHELL_PROFILE_RULES: tuple[tuple[str, str], ...] = (
     ("apps/tracer_core_shell/host/bootstrap/", "shell_aggregate"),
     ("apps/tracer_core_shell/host/exchange/", "shell_aggregate"),
     ("apps/tracer_core_shell/host/native_bridge_progress.cpp", "shell_aggregate"),
+    ("apps/tracer_core_shell/tests/bench/", "shell_aggregate"),
     ("apps/tracer_core_shell/tests/integration/tracer_core_c_api_runtime_", "shell_aggregate"),
     (
         "apps/tracer_core_shell/tests/integration/tracer_core_c_api_stability_internal.hpp",